@@ -197,30 +197,93 @@ namespace BINDER_SPACE
         HRESULT hr = S_OK;
         LONG kContextVersion = 0;
         BindResult bindResult;
+        bool fAddToFailureCache = false;
+        PathString assemblyDisplayName;
         ApplicationContext* pApplicationContext = pBinder->GetAppContext();
 
         // Tracing happens outside the binder lock to avoid calling into managed code within the lock
         BinderTracing::ResolutionAttemptedOperation tracer{pAssemblyName, pBinder, 0 /*managedALC*/, hr};
 
+        _ASSERTE(pAssemblyName != NULL);
+        pAssemblyName->GetDisplayName(assemblyDisplayName,
+                                      AssemblyName::INCLUDE_VERSION);
+
     Retry:
+        fAddToFailureCache = false;
         {
-            // Lock the binding application context
+            // Lock the binding application context. The lock protects the failure
+            // cache and the execution context; the probing phase below reads only
+            // immutable context state (the TPA map and the probing paths) and the
+            // file system, so it runs unlocked to let binds of independent
+            // assemblies overlap their I/O. Races with competing binds are
+            // resolved by the version check in RegisterAndGetHostChosen.
             CRITSEC_Holder contextLock(pApplicationContext->GetCriticalSectionCookie());
 
-            _ASSERTE(pAssemblyName != NULL);
-            IF_FAIL_GO(BindByName(pApplicationContext,
-                                    pAssemblyName,
-                                    false, // skipFailureCaching
-                                    false, // skipVersionCompatibilityCheck
-                                    excludeAppPaths,
-                                    &bindResult));
+            // Look for already cached binding failure (ignore PA, every PA will lock the context)
+            IF_FAIL_GO(pApplicationContext->GetFailureCache()->Lookup(assemblyDisplayName));
+            if (hr == S_FALSE)
+            {
+                // workaround: Special case for byte arrays. Rerun the bind to create binding log.
+                pAssemblyName->SetIsDefinition(TRUE);
+                hr = S_OK;
+            }
+
+            fAddToFailureCache = true;
+
+            if (!IsValidArchitecture(pAssemblyName->GetArchitecture()))
+            {
+                // Assembly reference contains wrong architecture
+                IF_FAIL_GO(FUSION_E_INVALID_NAME);
+            }
+
+            IF_FAIL_GO(BindInContext(pApplicationContext,
+                                     pAssemblyName,
+                                     false, // skipVersionCompatibilityCheck
+                                     pApplicationContext->IsTpaListProvided(),
+                                     &bindResult));
 
             // Remember the post-bind version
             kContextVersion = pApplicationContext->GetVersion();
 
         } // lock(pApplicationContext)
 
+        if (!bindResult.HaveResult() && pApplicationContext->IsTpaListProvided())
+        {
+            IF_FAIL_GO(BindByProbing(pApplicationContext,
+                                     pAssemblyName,
+                                     excludeAppPaths,
+                                     &bindResult));
+        }
+
+        if (!bindResult.HaveResult())
+        {
+            // Behavior rules are clueless now
+            IF_FAIL_GO(HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND));
+        }
+
     Exit:
+        if (FAILED(hr) && fAddToFailureCache)
+        {
+            // Lock the binding application context
+            CRITSEC_Holder contextLock(pApplicationContext->GetCriticalSectionCookie());
+
+            // The probe ran without the lock held. If a competing bind registered
+            // this assembly in the meantime, retry and pick up its result instead
+            // of caching a stale failure.
+            if (kContextVersion != pApplicationContext->GetVersion())
+            {
+                Assembly *pRegisteredAssembly = NULL;
+                if ((FindInExecutionContext(pApplicationContext, pAssemblyName, &pRegisteredAssembly) == S_OK)
+                    && (pRegisteredAssembly != NULL))
+                {
+                    bindResult.Reset();
+                    goto Retry;
+                }
+            }
+
+            hr = pApplicationContext->AddToFailureCache(assemblyDisplayName, hr);
+        }
+
         tracer.TraceBindResult(bindResult);
 
         if (bindResult.HaveResult())
@@ -473,6 +536,32 @@ namespace BINDER_SPACE
         HRESULT hr = S_OK;
 
         bool isTpaListProvided = pApplicationContext->IsTpaListProvided();
+        IF_FAIL_GO(BindInContext(pApplicationContext,
+                                 pAssemblyName,
+                                 skipVersionCompatibilityCheck,
+                                 isTpaListProvided,
+                                 pBindResult));
+
+        if (!pBindResult->HaveResult() && isTpaListProvided)
+        {
+            IF_FAIL_GO(BindByProbing(pApplicationContext,
+                                     pAssemblyName,
+                                     excludeAppPaths,
+                                     pBindResult));
+        }
+    Exit:
+        return hr;
+    }
+
+    /* static */
+    HRESULT AssemblyBinderCommon::BindInContext(ApplicationContext *pApplicationContext,
+                                                AssemblyName       *pAssemblyName,
+                                                bool                skipVersionCompatibilityCheck,
+                                                bool                isTpaListProvided,
+                                                BindResult         *pBindResult)
+    {
+        HRESULT hr = S_OK;
+
         Assembly *pAssembly = NULL;
         hr = FindInExecutionContext(pApplicationContext, pAssemblyName, &pAssembly);
 
@@ -503,32 +592,39 @@ namespace BINDER_SPACE
 
             pBindResult->SetResult(pAssembly, /*isInContext*/ true);
         }
-        else
-        if (isTpaListProvided)
+    Exit:
+        return hr;
+    }
+
+    /* static */
+    HRESULT AssemblyBinderCommon::BindByProbing(ApplicationContext *pApplicationContext,
+                                                AssemblyName       *pAssemblyName,
+                                                bool                excludeAppPaths,
+                                                BindResult         *pBindResult)
+    {
+        HRESULT hr = S_OK;
+
+        // BindByTpaList handles setting attempt results on the bind result
+        hr = BindByTpaList(pApplicationContext,
+                                 pAssemblyName,
+                                 excludeAppPaths,
+                                 pBindResult);
+        if (SUCCEEDED(hr) && pBindResult->HaveResult())
         {
-            // BindByTpaList handles setting attempt results on the bind result
-            hr = BindByTpaList(pApplicationContext,
-                                     pAssemblyName,
-                                     excludeAppPaths,
-                                     pBindResult);
-            if (SUCCEEDED(hr) && pBindResult->HaveResult())
-            {
-                bool isCompatible = IsCompatibleAssemblyVersion(pAssemblyName, pBindResult->GetAssemblyName());
-                hr = isCompatible ? S_OK : FUSION_E_APP_DOMAIN_LOCKED;
-                pBindResult->SetAttemptResult(hr, pBindResult->GetAssembly());
+            bool isCompatible = IsCompatibleAssemblyVersion(pAssemblyName, pBindResult->GetAssemblyName());
+            hr = isCompatible ? S_OK : FUSION_E_APP_DOMAIN_LOCKED;
+            pBindResult->SetAttemptResult(hr, pBindResult->GetAssembly());
 
-                // TPA binder returns FUSION_E_REF_DEF_MISMATCH for incompatible version
-                if (hr == FUSION_E_APP_DOMAIN_LOCKED && isTpaListProvided)
-                    hr = FUSION_E_REF_DEF_MISMATCH;
-            }
+            // TPA binder returns FUSION_E_REF_DEF_MISMATCH for incompatible version
+            if (hr == FUSION_E_APP_DOMAIN_LOCKED && pApplicationContext->IsTpaListProvided())
+                hr = FUSION_E_REF_DEF_MISMATCH;
+        }
 
-            if (FAILED(hr))
-            {
-                pBindResult->SetNoResult();
-            }
-            IF_FAIL_GO(hr);
+        if (FAILED(hr))
+        {
+            pBindResult->SetNoResult();
         }
-    Exit:
+
         return hr;
     }
 
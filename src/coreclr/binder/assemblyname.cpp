@@ -26,7 +26,9 @@
 namespace
 {
     // See https://docs.microsoft.com/dotnet/framework/reflection-and-codedom/specifying-fully-qualified-type-names#specifying-assembly-names
-    const WCHAR* s_neutralCulture = W("neutral");
+    // Kept in ASCII so that comparisons against the UTF-8 stored culture do not
+    // force a conversion to UTF-16.
+    const CHAR* s_neutralCulture = "neutral";
 }
 
 STDAPI BinderAcquireImport(PEImage* pPEImage,
@@ -204,13 +206,17 @@ namespace BINDER_SPACE
     BOOL AssemblyName::IsCoreLib()
     {
         // TODO: Is this simple comparison enough?
-        return SString::_wcsicmp(GetSimpleName().GetUnicode(), CoreLibName_W) == 0;
+        // The simple name is stored in UTF-8. Comparing against an ASCII literal lets
+        // the common all-ASCII case run without converting the name to UTF-16.
+        SString coreLibName(SString::Literal, CoreLibName_A);
+        return GetSimpleName().EqualsCaseInsensitive(coreLibName);
     }
 
     bool AssemblyName::IsNeutralCulture()
     {
+        SString neutralCulture(SString::Literal, s_neutralCulture);
         return m_cultureOrLanguage.IsEmpty()
-            || SString::_wcsicmp(m_cultureOrLanguage.GetUnicode(), s_neutralCulture) == 0;
+            || m_cultureOrLanguage.EqualsCaseInsensitive(neutralCulture);
     }
 
     ULONG AssemblyName::Hash(DWORD dwIncludeFlags)
@@ -382,6 +388,8 @@ namespace BINDER_SPACE
 
         if (culture.IsEmpty())
         {
+            // Use the ASCII literal so the culture stays directly comparable (and
+            // hashable) against other UTF-8 stored cultures without conversion.
             culture.SetLiteral(s_neutralCulture);
         }
 
@@ -80,6 +80,19 @@ namespace BINDER_SPACE
                                   /* in */  bool                excludeAppPaths,
                                   /* out */ BindResult         *pBindResult);
 
+        // Requires the application context lock to be held.
+        static HRESULT BindInContext(/* in */  ApplicationContext *pApplicationContext,
+                                     /* in */  AssemblyName       *pAssemblyName,
+                                     /* in */  bool                skipVersionCompatibilityCheck,
+                                     /* in */  bool                isTpaListProvided,
+                                     /* out */ BindResult         *pBindResult);
+
+        // Safe to run without the application context lock held.
+        static HRESULT BindByProbing(/* in */  ApplicationContext *pApplicationContext,
+                                     /* in */  AssemblyName       *pAssemblyName,
+                                     /* in */  bool                excludeAppPaths,
+                                     /* out */ BindResult         *pBindResult);
+
         static HRESULT FindInExecutionContext(/* in */  ApplicationContext  *pApplicationContext,
                                               /* in */  AssemblyName        *pAssemblyName,
                                               /* out */ Assembly           **ppAssembly);
@@ -20,6 +20,7 @@ CrashInfo::CrashInfo(const CreateDumpOptions& options) :
     m_signal(options.Signal),
     m_moduleInfos(&ModuleInfoCompare),
     m_mainModule(nullptr),
+    m_unwindModuleCache(PAL_CreateUnwindModuleCache()),
     m_cbModuleMappings(0),
     m_dataTargetPagesAdded(0),
     m_enumMemoryPagesAdded(0)
@@ -69,6 +70,12 @@ CrashInfo::~CrashInfo()
         FreeLibrary(m_hdac);
         m_hdac = nullptr;
     }
+    // Free the native unwinder's module layout cache
+    if (m_unwindModuleCache != nullptr)
+    {
+        PAL_DestroyUnwindModuleCache(m_unwindModuleCache);
+        m_unwindModuleCache = nullptr;
+    }
 #ifdef __APPLE__
     if (m_task != 0)
     {
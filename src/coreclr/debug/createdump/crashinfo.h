@@ -78,6 +78,7 @@ private:
     std::set<MemoryRegion> m_moduleAddresses;       // memory region to module base address
     std::set<ModuleInfo*, bool (*)(const ModuleInfo* lhs, const ModuleInfo* rhs)> m_moduleInfos; // module infos (base address and module name)
     ModuleInfo* m_mainModule;                       // the module containing "Main"
+    PVOID m_unwindModuleCache;                      // module layout cache shared by all the native thread unwinds
 
     // no public copy constructor
     CrashInfo(const CrashInfo&) = delete;
@@ -120,6 +121,7 @@ public:
     inline const std::string& Name() const { return m_name; }
     inline const ModuleInfo* MainModule() const { return m_mainModule; }
     inline const uint64_t RuntimeBaseAddress() const { return m_runtimeBaseAddress; }
+    inline PVOID UnwindModuleCache() const { return m_unwindModuleCache; }
 
     inline const std::vector<ThreadInfo*>& Threads() const { return m_threads; }
     inline const std::set<MemoryRegion>& ModuleMappings() const { return m_moduleMappings; }
@@ -96,10 +96,12 @@ ThreadInfo::UnwindNativeFrames(CONTEXT* pContext)
             break;
         }
 
-        // Unwind the native frame adding all the memory accessed to the core dump via the read memory adapter.
+        // Unwind the native frame adding all the memory accessed to the core dump via the read memory
+        // adapter. The module layout cache is shared by all the thread walks of this dump session, so
+        // each module's headers are only read from the target once.
         ULONG64 functionStart;
-        if (!PAL_VirtualUnwindOutOfProc(pContext, nullptr, &functionStart, baseAddress, ReadMemoryAdapter)) {
-            TRACE("Unwind: PAL_VirtualUnwindOutOfProc returned false\n");
+        if (!PAL_VirtualUnwindOutOfProcWithCache(pContext, nullptr, &functionStart, baseAddress, ReadMemoryAdapter, m_crashInfo.UnwindModuleCache())) {
+            TRACE("Unwind: PAL_VirtualUnwindOutOfProcWithCache returned false\n");
             break;
         }
 
@@ -2228,6 +2228,117 @@ DacInstanceManager::FreeAllBlocks(bool fSaveBlock)
     }
 }
 
+//----------------------------------------------------------------------------
+//
+// DacTargetPageCache.
+//
+//----------------------------------------------------------------------------
+
+DacTargetPageCache::DacTargetPageCache(void)
+{
+    SUPPORTS_DAC_HOST_ONLY;
+
+    memset(m_entries, 0, sizeof(m_entries));
+}
+
+DacTargetPageCache::~DacTargetPageCache(void)
+{
+    SUPPORTS_DAC_HOST_ONLY;
+
+    for (ULONG32 i = 0; i < CACHE_ENTRY_COUNT; i++)
+    {
+        delete [] m_entries[i].data;
+    }
+}
+
+bool
+DacTargetPageCache::Read(TADDR addr, PVOID buffer, ULONG32 size)
+{
+    SUPPORTS_DAC_HOST_ONLY;
+
+    // Large reads do not benefit from combining; let them go to the target.
+    if (size == 0 || size > CACHE_PAGE_SIZE)
+    {
+        return false;
+    }
+
+    TADDR pageBase = addr & ~(TADDR)(CACHE_PAGE_SIZE - 1);
+    ULONG32 offset = (ULONG32)(addr - pageBase);
+
+    // Reads that straddle a page boundary are rare enough not to be worth
+    // stitching two entries together.
+    if (offset + size > CACHE_PAGE_SIZE)
+    {
+        return false;
+    }
+
+    Entry* entry = EntryForPage(pageBase);
+    if (entry->pageBase != pageBase)
+    {
+        if (entry->data == NULL)
+        {
+            entry->data = new (nothrow) BYTE[CACHE_PAGE_SIZE];
+            if (entry->data == NULL)
+            {
+                return false;
+            }
+        }
+
+        entry->pageBase = 0;
+
+        ULONG32 returned = 0;
+        HRESULT status = g_dacImpl->m_pTarget->
+            ReadVirtual(pageBase, entry->data, CACHE_PAGE_SIZE, &returned);
+        if (FAILED(status) || returned == 0)
+        {
+            // Leave the entry empty. The caller falls back to a direct read,
+            // so an unreadable page still produces the right error.
+            return false;
+        }
+
+        entry->pageBase = pageBase;
+        entry->validSize = returned;
+    }
+
+    if (offset + size > entry->validSize)
+    {
+        return false;
+    }
+
+    memcpy(buffer, entry->data + offset, size);
+    return true;
+}
+
+void
+DacTargetPageCache::Invalidate(TADDR addr, ULONG32 size)
+{
+    SUPPORTS_DAC_HOST_ONLY;
+
+    TADDR pageBase = addr & ~(TADDR)(CACHE_PAGE_SIZE - 1);
+    TADDR end = addr + size;
+
+    for (; pageBase < end; pageBase += CACHE_PAGE_SIZE)
+    {
+        Entry* entry = EntryForPage(pageBase);
+        if (entry->pageBase == pageBase)
+        {
+            entry->pageBase = 0;
+        }
+    }
+}
+
+void
+DacTargetPageCache::Flush(void)
+{
+    SUPPORTS_DAC_HOST_ONLY;
+
+    // Keep the page buffers; only forget what they hold.
+    for (ULONG32 i = 0; i < CACHE_ENTRY_COUNT; i++)
+    {
+        m_entries[i].pageBase = 0;
+    }
+}
+
 //----------------------------------------------------------------------------
 //
 // DacStreamManager.
@@ -3231,6 +3342,10 @@ ClrDataAccess::QueryInterface(THIS_
     {
         ifaceRet = static_cast<ISOSDacInterface13*>(this);
     }
+    else if (IsEqualIID(interfaceId, __uuidof(ISOSDacInterface14)))
+    {
+        ifaceRet = static_cast<ISOSDacInterface14*>(this);
+    }
     else
     {
         *iface = NULL;
@@ -3273,6 +3388,9 @@ ClrDataAccess::Flush(void)
     // Free instance memory.
     m_instances.Flush();
 
+    // The debuggee may run after a flush, so cached target pages are stale.
+    m_pageCache.Flush();
+
     // When the host instance cache is flushed we
     // update the instance age count so that
     // all child objects automatically become
@@ -150,6 +150,14 @@ DacReadAll(TADDR addr, PVOID buffer, ULONG32 size, bool throwEx)
         DacError(CORDBG_E_TARGET_INCONSISTENT);
     }
 
+    // Small reads are usually served out of the page cache, which fetches the
+    // whole containing page from the target instead of crossing over for every
+    // few bytes.
+    if (g_dacImpl->m_pageCache.Read(addr, buffer, size))
+    {
+        return S_OK;
+    }
+
     HRESULT status;
     ULONG32 returned;
 
@@ -199,6 +207,9 @@ DacWriteAll(TADDR addr, PVOID buffer, ULONG32 size, bool throwEx)
 
     HRESULT status;
 
+    // Writes make any cached copy of these pages stale.
+    g_dacImpl->m_pageCache.Invalidate(addr, size);
+
     status = g_dacImpl->m_pMutableTarget->WriteVirtual(addr, (PBYTE)buffer, size);
     if (status != S_OK)
     {
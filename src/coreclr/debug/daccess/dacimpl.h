@@ -648,6 +648,59 @@ struct DumpMemoryReportStatics
 };
 
 
+//----------------------------------------------------------------------------
+//
+// DacTargetPageCache.
+//
+// Inspection issues huge numbers of small target reads; against a live
+// process each one is a cross-process operation. This cache combines them:
+// on a miss the whole page-aligned span containing the request is fetched
+// and later small reads within it are served from the host copy. Like the
+// instance cache it relies on the target being stopped, and is emptied by
+// ClrDataAccess::Flush when the debuggee continues. Writes through
+// DacWriteAll invalidate the pages they touch.
+//
+//----------------------------------------------------------------------------
+
+class DacTargetPageCache
+{
+public:
+    DacTargetPageCache(void);
+    ~DacTargetPageCache(void);
+
+    // Attempts to serve a read from the cache, fetching the containing page on
+    // a miss. Returns false if the read cannot be served and the caller should
+    // read from the target directly.
+    bool Read(TADDR addr, PVOID buffer, ULONG32 size);
+
+    // Drops any cached pages overlapping the given range.
+    void Invalidate(TADDR addr, ULONG32 size);
+
+    void Flush(void);
+
+private:
+    // 4KB pages: an aligned span this size never crosses a target mapping
+    // boundary, so a page fetch succeeds whenever a direct read would.
+    static const ULONG32 CACHE_PAGE_SHIFT = 12;
+    static const ULONG32 CACHE_PAGE_SIZE = 1 << CACHE_PAGE_SHIFT;
+    // Direct mapped; 1MB of cached target memory at most.
+    static const ULONG32 CACHE_ENTRY_COUNT = 256;
+
+    struct Entry
+    {
+        TADDR pageBase;     // 0 when the entry is empty
+        ULONG32 validSize;  // bytes successfully read starting at pageBase
+        BYTE* data;         // lazily allocated page buffer
+    };
+
+    Entry* EntryForPage(TADDR pageBase)
+    {
+        return &m_entries[(pageBase >> CACHE_PAGE_SHIFT) & (CACHE_ENTRY_COUNT - 1)];
+    }
+
+    Entry m_entries[CACHE_ENTRY_COUNT];
+};
+
 class DacInstanceManager
 {
 public:
@@ -816,7 +869,8 @@ class ClrDataAccess
       public ISOSDacInterface10,
       public ISOSDacInterface11,
       public ISOSDacInterface12,
-      public ISOSDacInterface13
+      public ISOSDacInterface13,
+      public ISOSDacInterface14
 {
 public:
     ClrDataAccess(ICorDebugDataTarget * pTarget, ICLRDataTarget * pLegacyTarget=0);
@@ -1216,6 +1270,9 @@ public:
     virtual HRESULT STDMETHODCALLTYPE GetGCFreeRegions(ISOSMemoryEnum **ppEnum);
     virtual HRESULT STDMETHODCALLTYPE LockedFlush();
 
+    // ISOSDacInterface14
+    virtual HRESULT STDMETHODCALLTYPE GetObjectsInRange(CLRDATA_ADDRESS start, CLRDATA_ADDRESS end, unsigned int alignment, unsigned int count, SOSBulkObjectData *objects, unsigned int *pFetched, CLRDATA_ADDRESS *pNextObject);
+
     //
     // ClrDataAccess.
     //
@@ -1416,6 +1473,7 @@ public:
     TADDR m_globalBase;
     DacGlobals m_dacGlobals;
     DacInstanceManager m_instances;
+    DacTargetPageCache m_pageCache;
     ULONG32 m_instanceAge;
     bool m_debugMode;
 
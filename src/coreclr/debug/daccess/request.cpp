@@ -5387,3 +5387,55 @@ HRESULT ClrDataAccess::LockedFlush()
     SOSDacLeave();
     return hr;
 }
+
+HRESULT ClrDataAccess::GetObjectsInRange(CLRDATA_ADDRESS start, CLRDATA_ADDRESS end, unsigned int alignment, unsigned int count,
+                                         SOSBulkObjectData *objects, unsigned int *pFetched, CLRDATA_ADDRESS *pNextObject)
+{
+    if (start == 0 || end < start || objects == NULL || pFetched == NULL || pNextObject == NULL)
+        return E_INVALIDARG;
+
+    // The alignment is supplied by the caller because it depends on which
+    // generation is being walked, not on anything the DAC can derive here.
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+        return E_INVALIDARG;
+
+    SOSDacEnter();
+
+    unsigned int fetched = 0;
+    TADDR current = CLRDATA_ADDRESS_TO_TADDR(start);
+    TADDR endAddr = CLRDATA_ADDRESS_TO_TADDR(end);
+
+    while (fetched < count && current < endAddr)
+    {
+        // Stop at the first object that fails validation; *pNextObject tells
+        // the caller where the walk ended so a lack of progress is visible.
+        TADDR mtTADDR = DACGetMethodTableFromObjectPointer(current, m_pTarget);
+        if (mtTADDR == NULL)
+            break;
+
+        BOOL bFree = FALSE;
+        PTR_MethodTable mt = PTR_MethodTable(mtTADDR);
+        if (!DacValidateMethodTable(mt, bFree))
+            break;
+
+        ULONG64 size = mt->GetBaseSize();
+        if (mt->GetComponentSize())
+            size += (ULONG64)DACGetNumComponents(current, m_pTarget) * mt->GetComponentSize();
+
+        objects[fetched].Address = TO_CDADDR(current);
+        objects[fetched].MethodTable = HOST_CDADDR(mt);
+        objects[fetched].Size = size;
+        fetched++;
+
+        if (size == 0)
+            break;
+
+        current += (TADDR)ALIGN_UP(size, alignment);
+    }
+
+    *pFetched = fetched;
+    *pNextObject = TO_CDADDR(current);
+
+    SOSDacLeave();
+    return hr;
+}
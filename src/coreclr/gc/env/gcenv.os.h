@@ -441,6 +441,19 @@ public:
     // Flush write buffers of processors that are executing threads of the current process
     static void FlushProcessWriteBuffers();
 
+    // Open the hardware performance counter set sampled at GC boundaries (cycles,
+    // instructions retired, last level cache misses, branch mispredictions).
+    // Return:
+    //  true if hardware counters are supported and were opened successfully
+    static bool OpenHardwareCounters();
+
+    // Read the accumulated values of the counters opened by OpenHardwareCounters.
+    // Parameters:
+    //  counters - receives the values in the order listed for OpenHardwareCounters
+    // Return:
+    //  true if the counters were read successfully
+    static bool ReadHardwareCounters(uint64_t counters[4]);
+
     // Break into a debugger
     static void DebugBreak();
 
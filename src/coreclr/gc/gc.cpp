@@ -18,7 +18,13 @@
 
 #include "gcpriv.h"
 
-#if defined(TARGET_AMD64) && defined(TARGET_WINDOWS)
+#if defined(TARGET_AMD64)
+#include <emmintrin.h>
+#elif defined(TARGET_ARM64)
+#include <arm_neon.h>
+#endif
+
+#if defined(TARGET_AMD64)
 #define USE_VXSORT
 #else
 #define USE_INTROSORT
@@ -58,6 +64,10 @@ BOOL bgc_heap_walk_for_etw_p = FALSE;
 #define commit_min_th (16*OS_PAGE_SIZE)
 
 #define MIN_SOH_CROSS_GEN_REFS (400)
+
+// If gen0 GCs would come more often than this (in microseconds), the adaptive
+// budget controller grows the budget instead (see new_allocation_allowed).
+#define gen0_adaptive_min_interval_us (50 * 1000)
 #define MIN_LOH_CROSS_GEN_REFS (800)
 
 #ifdef SERVER_GC
@@ -1900,6 +1910,10 @@ const size_t fgn_check_quantum = 2*1024*1024;
 
 #ifdef MH_SC_MARK
 const int max_snoop_level = 128;
+// Maximum # of entries a thief takes from a victim's mark stack in one
+// snooping pass. Stealing a small chunk instead of a single object
+// amortizes the snoop cost and the thief/victim cache-line traffic.
+const int mark_steal_chunk_size = 8;
 #endif //MH_SC_MARK
 
 #ifdef CARD_BUNDLE
@@ -2195,6 +2209,7 @@ VOLATILE(BOOL) gc_heap::gc_started;
 #ifdef MULTIPLE_HEAPS
 GCEvent     gc_heap::gc_start_event;
 bool        gc_heap::gc_thread_no_affinitize_p = false;
+bool        gc_heap::numa_partitioned_alloc_p = false;
 uintptr_t   process_mask = 0;
 
 int         gc_heap::n_heaps;
@@ -2292,6 +2307,7 @@ double      gc_heap::short_plugs_pad_ratio = 0;
 
 int         gc_heap::generation_skip_ratio_threshold = 0;
 int         gc_heap::conserve_mem_setting = 0;
+bool        gc_heap::adaptive_gen0_budget_p = false;
 bool        gc_heap::spin_count_unit_config_p = false;
 
 uint64_t    gc_heap::suspended_start_time = 0;
@@ -2569,6 +2585,8 @@ EEThreadId  gc_heap::bgc_thread_id;
 
 uint8_t*    gc_heap::background_written_addresses [array_size+2];
 
+size_t      gc_heap::background_written_range_sizes [array_size+2];
+
 heap_segment* gc_heap::freeable_soh_segment = 0;
 
 size_t      gc_heap::bgc_overflow_count = 0;
@@ -2792,6 +2810,9 @@ size_t gc_heap::gen2_removed_no_undo = 0;
 size_t gc_heap::saved_pinned_plug_index = INVALID_SAVED_PINNED_PLUG_INDEX;
 #endif //DOUBLY_LINKED_FL
 
+size_t gc_heap::older_gen_fl_items_considered = 0;
+size_t gc_heap::older_gen_fl_items_taken = 0;
+
 #ifdef FEATURE_EVENT_TRACE
 etw_bucket_info gc_heap::bucket_info[NUM_GEN2_ALIST];
 #endif //FEATURE_EVENT_TRACE
@@ -7694,6 +7715,31 @@ bool gc_heap::new_allocation_allowed (int gen_number)
                 }
             }
         }
+        else if (adaptive_gen0_budget_p && (settings.pause_mode != pause_no_gc))
+        {
+            // Bursty workloads can exhaust the budget long before enough dead
+            // objects accumulate to make a gen0 GC worthwhile. Grant budget in
+            // small increments - up to one extra budget per cycle - while the
+            // collection interval would otherwise drop below
+            // gen0_adaptive_min_interval_us; the next GC re-derives the budget
+            // from survival as usual.
+            dynamic_data* dd0 = dynamic_data_of (0);
+            size_t desired = dd_desired_allocation (dd0);
+
+            if (gen0_adaptive_boost < desired)
+            {
+                uint64_t elapsed_us = GetHighPrecisionTimeStamp () - dd_time_clock (dd0);
+                if (elapsed_us < gen0_adaptive_min_interval_us)
+                {
+                    size_t boost = max ((desired / 8), dd_min_size (dd0));
+                    gen0_adaptive_boost += boost;
+                    dd_new_allocation (dd0) += boost;
+                    dprintf (2, ("h%d adaptive gen0 boost %zd (total %zd), %zd us since last GC",
+                        heap_number, boost, gen0_adaptive_boost, (size_t)elapsed_us));
+                    return TRUE;
+                }
+            }
+        }
         return FALSE;
     }
 #ifndef MULTIPLE_HEAPS
@@ -13134,6 +13180,18 @@ void gc_heap::distribute_free_regions()
 
         decommit_step (decommit_step_milliseconds);
     }
+    // if memory load is high (for example when running close to a container limit),
+    // holding on to committed regions until a future GC catches up risks the process
+    // being killed in the meantime - drain the decommit list now instead of rate
+    // limiting and returning the remainder to the free list
+    uint32_t memory_load = 0;
+    get_memory_info (&memory_load);
+    if ((memory_load != 0) && (memory_load >= high_memory_load_th))
+    {
+        while (decommit_step (DECOMMIT_TIME_STEP_MILLISECONDS))
+        {
+        }
+    }
     // transfer any remaining regions on the decommit list back to the free list
     for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
     {
@@ -13287,18 +13345,48 @@ void gc_heap::reset_write_watch_for_gc_heap(void* base_address, size_t region_si
 }
 
 // static
-void gc_heap::get_write_watch_for_gc_heap(bool reset, void *base_address, size_t region_size,
-                                          void** dirty_pages, uintptr_t* dirty_page_count_ref,
+// Retrieves the dirty state of the region as ranges of contiguous dirty pages - for each range
+// its base address and its size in bytes. On input *dirty_range_count_ref is the capacity of
+// both output arrays, on output it is the number of ranges recorded. Returns true if the output
+// may be incomplete because the arrays filled up, in which case the caller should scan again
+// starting at the end of the last range returned.
+bool gc_heap::get_write_watch_for_gc_heap(bool reset, void *base_address, size_t region_size,
+                                          void** dirty_range_addresses, size_t* dirty_range_sizes,
+                                          uintptr_t* dirty_range_count_ref,
                                           bool is_runtime_suspended)
 {
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
-    SoftwareWriteWatch::GetDirty(base_address, region_size, dirty_pages, dirty_page_count_ref,
-                                 reset, is_runtime_suspended);
+    return !SoftwareWriteWatch::GetDirtyRanges(base_address, region_size, dirty_range_addresses,
+                                               dirty_range_sizes, dirty_range_count_ref,
+                                               reset, is_runtime_suspended);
 #else // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     UNREFERENCED_PARAMETER(is_runtime_suspended);
-    bool success = GCToOSInterface::GetWriteWatch(reset, base_address, region_size, dirty_pages,
-                                                  dirty_page_count_ref);
+    uintptr_t page_count = *dirty_range_count_ref;
+    bool success = GCToOSInterface::GetWriteWatch(reset, base_address, region_size, dirty_range_addresses,
+                                                  &page_count);
     assert(success);
+
+    // The OS reports individual pages in ascending order - coalesce adjacent ones into ranges in
+    // place. The write index can never get ahead of the read index.
+    uintptr_t range_count = 0;
+    for (uintptr_t i = 0; i < page_count; i++)
+    {
+        uint8_t* page = (uint8_t*)dirty_range_addresses[i];
+        if ((range_count != 0) &&
+            (((uint8_t*)dirty_range_addresses[range_count - 1] + dirty_range_sizes[range_count - 1]) == page))
+        {
+            dirty_range_sizes[range_count - 1] += WRITE_WATCH_UNIT_SIZE;
+        }
+        else
+        {
+            dirty_range_addresses[range_count] = page;
+            dirty_range_sizes[range_count] = WRITE_WATCH_UNIT_SIZE;
+            range_count++;
+        }
+    }
+    bool more_p = (page_count == *dirty_range_count_ref);
+    *dirty_range_count_ref = range_count;
+    return more_p;
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 }
 
@@ -14140,6 +14228,8 @@ gc_heap::init_semi_shared()
 
     dprintf (1, ("conserve_mem_setting = %d", conserve_mem_setting));
 
+    adaptive_gen0_budget_p = (GCConfig::GetGCAdaptiveGen0Budget() != 0);
+
     reset_mm_p = TRUE;
 
     ret = 1;
@@ -14177,6 +14267,8 @@ gc_heap* gc_heap::make_gc_heap (
 
     res->vm_heap = vm_hp;
     res->alloc_context_count = 0;
+    res->numa_local_balance_failures = 0;
+    res->gen0_adaptive_boost = 0;
 
 #ifndef USE_REGIONS
     res->mark_list_piece_start = new (nothrow) uint8_t**[n_heaps];
@@ -18436,11 +18528,26 @@ void gc_heap::balance_heaps (alloc_context* acontext)
 
                         if ((max_hp == org_hp) && (end < finish))
                         {
+                            if (numa_partitioned_alloc_p)
+                            {
+                                // In partitioned mode we stay on the local node unless it has
+                                // repeatedly failed to yield a better heap, which indicates
+                                // sustained imbalance rather than transient noise.
+                                int failures = Interlocked::Increment (&org_hp->numa_local_balance_failures);
+                                if (failures < numa_partition_spill_threshold)
+                                    break;
+                            }
+
                             start = end; end = finish;
                             delta = local_delta * 2; // Make it twice as hard to balance to remote nodes on NUMA.
                         }
                         else
                         {
+                            if (numa_partitioned_alloc_p && (max_hp != org_hp))
+                            {
+                                org_hp->numa_local_balance_failures = 0;
+                            }
+
                             // we already found a better heap, or there are no remote NUMA nodes
                             break;
                         }
@@ -18982,6 +19089,8 @@ uint8_t* gc_heap::allocate_in_older_generation (generation* gen, size_t size,
                 {
                     dprintf (3, ("considering free list in added list%zx", (size_t)free_list));
 
+                    older_gen_fl_items_considered++;
+
                     size_t free_list_size = unused_array_size (free_list);
 
                     if (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, free_list, (free_list + free_list_size),
@@ -19002,6 +19111,8 @@ uint8_t* gc_heap::allocate_in_older_generation (generation* gen, size_t size,
                             dprintf (3333, ("SFA: %p->%p(%d)", free_list, (free_list + free_list_size),
                                 (generation_set_bgc_mark_bit_p (gen) ? 1 : 0)));
                         }
+                        older_gen_fl_items_taken++;
+
                         adjust_limit (free_list, free_list_size, gen);
                         generation_allocate_end_seg_p (gen) = FALSE;
 
@@ -19035,6 +19146,8 @@ uint8_t* gc_heap::allocate_in_older_generation (generation* gen, size_t size,
             {
                 dprintf (3, ("considering free list %zx", (size_t)free_list));
 
+                older_gen_fl_items_considered++;
+
                 size_t free_list_size = unused_array_size (free_list);
 
                 if (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, free_list, (free_list + free_list_size),
@@ -19063,6 +19176,8 @@ uint8_t* gc_heap::allocate_in_older_generation (generation* gen, size_t size,
                     }
 #endif //DOUBLY_LINKED_FL
 
+                    older_gen_fl_items_taken++;
+
                     adjust_limit (free_list, free_list_size, gen);
                     generation_allocate_end_seg_p (gen) = FALSE;
                     goto finished;
@@ -21402,6 +21517,13 @@ void gc_heap::gc1()
 
         get_gc_data_per_heap()->maxgen_size_info.running_free_list_efficiency = (uint32_t)(generation_allocator_efficiency (generation_of (max_generation)) * 100);
 
+        if (older_gen_fl_items_considered != 0)
+        {
+            dprintf (2, ("h%d: older gen FL search: considered %zd items, took %zd (avg scan %zd)",
+                heap_number, older_gen_fl_items_considered, older_gen_fl_items_taken,
+                (older_gen_fl_items_taken ? (older_gen_fl_items_considered / older_gen_fl_items_taken) : older_gen_fl_items_considered)));
+        }
+
         free_list_info (max_generation, "after computing new dynamic data");
     }
 
@@ -24739,8 +24861,45 @@ gc_heap::mark_steal()
                     uint64_t start_tick = GCToOSInterface::GetLowPrecisionTimeStamp();
 #endif //SNOOP_STATS
 
+                    // While we have the victim's stack hot, try to steal a chunk of
+                    // additional ready normal entries above the one we just claimed.
+                    // Each extra entry is claimed with the same per-slot interlocked
+                    // protocol a second thief would use, so this doesn't change the
+                    // stack invariants - it just batches the snooping.
+                    uint8_t* stolen_chunk[mark_steal_chunk_size];
+                    int stolen_count = 0;
+                    if (((size_t)o > 4) && !partial_object_p (o) && (o == start))
+                    {
+                        int chunk_level = level + 1;
+                        while ((stolen_count < (mark_steal_chunk_size - 1)) &&
+                               (chunk_level < (max_snoop_level - 1)))
+                        {
+                            uint8_t* co = ref_mark_stack (hp, chunk_level);
+                            if (!ref_p (co) || ((size_t)co <= 4) || partial_object_p (co))
+                                break;
+                            uint8_t* co_next = ref_mark_stack (hp, chunk_level + 1);
+                            if (!ref_p (co_next))
+                                break;
+                            if (Interlocked::CompareExchangePointer (&ref_mark_stack (hp, chunk_level),
+                                                                     (uint8_t*)4, co) != co)
+                                break;
+#ifdef SNOOP_STATS
+                            snoop_stat.interlocked_count++;
+                            snoop_stat.normal_count++;
+#endif //SNOOP_STATS
+                            stolen_chunk[stolen_count++] = co;
+                            chunk_level++;
+                        }
+                    }
+
                     mark_object_simple1 (o, start, heap_number);
 
+                    for (int chunk_idx = 0; chunk_idx < stolen_count; chunk_idx++)
+                    {
+                        uint8_t* co = stolen_chunk[chunk_idx];
+                        mark_object_simple1 (co, co, heap_number);
+                    }
+
 #ifdef SNOOP_STATS
                     dprintf (SNOOP_LOG, ("heap%d: done marking %zx from %d [%d] %dms tl:%dms",
                             heap_number, (size_t)o, (heap_number+1)%n_heaps, level,
@@ -26190,6 +26349,12 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
     // based on the how the scanning proceeded).
     s_fUnscannedPromotions = TRUE;
 
+#ifdef FEATURE_EVENT_TRACE
+    // Rescan rounds completed so far. Every thread goes through the same number of rounds (see the lock-step
+    // comment below), so the local count on the thread that wins the terminating join is the global one.
+    uint32_t rescan_rounds = 0;
+#endif //FEATURE_EVENT_TRACE
+
     // We don't know how many times we need to loop yet. In particular we can't base the loop condition on
     // the state of this thread's portion of the dependent handle table. That's because promotions on other
     // threads could cause handle promotions to become necessary here. Even if there are definitely no more
@@ -26264,6 +26429,18 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
                         g_heaps[i]->min_overflow_address = all_heaps_min;
                     }
                 }
+
+#ifdef FEATURE_EVENT_TRACE
+                // All scanning threads are parked in the join, so the per-thread promotion counts are stable.
+                if (EVENT_ENABLED (GCDependentHandleScan))
+                {
+                    FIRE_EVENT (GCDependentHandleScan,
+                        (uint32_t)condemned_gen_number,
+                        (uint32_t)(initial_scan_p ? 1 : 0),
+                        rescan_rounds,
+                        (uint64_t)GCScan::GcDhGetPromotedCount());
+                }
+#endif //FEATURE_EVENT_TRACE
             }
 
             dprintf(3, ("Starting all gc thread mark stack overflow processing"));
@@ -26295,6 +26472,9 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
         // If the portion of the dependent handle table managed by this worker has handles that could still be
         // promoted perform a rescan. If the rescan resulted in at least one promotion note this fact since it
         // could require a rescan of handles on this or other workers.
+#ifdef FEATURE_EVENT_TRACE
+        rescan_rounds++;
+#endif //FEATURE_EVENT_TRACE
         if (GCScan::GcDhUnpromotedHandlesExist(sc))
             if (GCScan::GcDhReScan(sc))
                 s_fUnscannedPromotions = TRUE;
@@ -26305,19 +26485,28 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
 // threads synchronized.
 void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc, BOOL initial_scan_p)
 {
+#ifndef FEATURE_EVENT_TRACE
     UNREFERENCED_PARAMETER(initial_scan_p);
+#endif //!FEATURE_EVENT_TRACE
 
     // Whenever we call this method there may have been preceding object promotions. So set
     // fUnscannedPromotions unconditionally (during further iterations of the scanning loop this will be set
     // based on the how the scanning proceeded).
     bool fUnscannedPromotions = true;
 
+#ifdef FEATURE_EVENT_TRACE
+    uint32_t rescan_rounds = 0;
+#endif //FEATURE_EVENT_TRACE
+
     // Loop until there are either no more dependent handles that can have their secondary promoted or we've
     // managed to perform a scan without promoting anything new.
     while (GCScan::GcDhUnpromotedHandlesExist(sc) && fUnscannedPromotions)
     {
         // On each iteration of the loop start with the assumption that no further objects have been promoted.
         fUnscannedPromotions = false;
+#ifdef FEATURE_EVENT_TRACE
+        rescan_rounds++;
+#endif //FEATURE_EVENT_TRACE
 
         // Handle any mark stack overflow: scanning dependent handles relies on all previous object promotions
         // being visible. If there was an overflow (process_mark_overflow returned true) then additional
@@ -26337,6 +26526,17 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
     // scan any handles at all this is the processing of overflows that may have occurred prior to this method
     // invocation).
     process_mark_overflow(condemned_gen_number);
+
+#ifdef FEATURE_EVENT_TRACE
+    if (EVENT_ENABLED (GCDependentHandleScan))
+    {
+        FIRE_EVENT (GCDependentHandleScan,
+            (uint32_t)condemned_gen_number,
+            (uint32_t)(initial_scan_p ? 1 : 0),
+            rescan_rounds,
+            (uint64_t)GCScan::GcDhGetPromotedCount());
+    }
+#endif //FEATURE_EVENT_TRACE
 }
 #endif //MULTIPLE_HEAPS
 
@@ -26675,6 +26875,13 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
         GCToEEInterface::BeforeGcScanRoots(condemned_gen_number, /* is_bgc */ false, /* is_concurrent */ false);
         num_sizedrefs = GCToEEInterface::GetTotalNumSizedRefHandles();
 
+#ifdef MULTIPLE_HEAPS
+        // arm the sharded strong-handle scan while the other threads are
+        // still parked; they will claim table segments cooperatively in
+        // GcScanHandles below
+        GCScan::GcPrepareSharedHandleScan ((uint32_t)n_heaps);
+#endif //MULTIPLE_HEAPS
+
 #ifdef FEATURE_EVENT_TRACE
         informational_event_enabled_p = EVENT_ENABLED (GCMarkWithType);
         if (informational_event_enabled_p)
@@ -29701,6 +29908,9 @@ void gc_heap::plan_phase (int condemned_gen_number)
     saved_pinned_plug_index = INVALID_SAVED_PINNED_PLUG_INDEX;
 #endif //DOUBLY_LINKED_FL
 
+    older_gen_fl_items_considered = 0;
+    older_gen_fl_items_taken = 0;
+
     while (1)
     {
         if (x >= end)
@@ -35710,6 +35920,7 @@ inline uint8_t* gc_heap::high_page (heap_segment* seg, BOOL concurrent_p)
 }
 
 void gc_heap::revisit_written_page (uint8_t* page,
+                                    size_t span_size,
                                     uint8_t* end,
                                     BOOL concurrent_p,
                                     uint8_t*& last_page,
@@ -35721,6 +35932,9 @@ void gc_heap::revisit_written_page (uint8_t* page,
     uint8_t*   o             = 0;
     int align_const = get_alignment_constant (!large_objects_p);
     uint8_t* high_address = end;
+    // A span is a range of contiguous dirty pages so we can go through all of them in one pass
+    // instead of re-finding the first object on each page.
+    uint8_t* page_limit = min (high_address, page + span_size);
     uint8_t* current_lowest_address = background_saved_lowest_address;
     uint8_t* current_highest_address = background_saved_highest_address;
     BOOL no_more_loop_p = FALSE;
@@ -35751,9 +35965,9 @@ void gc_heap::revisit_written_page (uint8_t* page,
 
     dprintf (3,("page %zx start: %zx, %zx[ ",
                (size_t)page, (size_t)o,
-               (size_t)(min (high_address, page + WRITE_WATCH_UNIT_SIZE))));
+               (size_t)page_limit));
 
-    while (o < (min (high_address, page + WRITE_WATCH_UNIT_SIZE)))
+    while (o < page_limit)
     {
         size_t s;
 
@@ -35808,7 +36022,7 @@ void gc_heap::revisit_written_page (uint8_t* page,
             {
                 dprintf (3, ("going through %zx", (size_t)o));
                 go_through_object (method_table(o), o, s, poo, start_address, use_start, (o + s),
-                                    if ((uint8_t*)poo >= min (high_address, page + WRITE_WATCH_UNIT_SIZE))
+                                    if ((uint8_t*)poo >= page_limit)
                                     {
                                         no_more_loop_p = TRUE;
                                         goto end_limit;
@@ -35822,7 +36036,7 @@ void gc_heap::revisit_written_page (uint8_t* page,
             else if (
                 concurrent_p &&
                 ((CObjectHeader*)o)->IsFree() &&
-                (next_o > min (high_address, page + WRITE_WATCH_UNIT_SIZE)))
+                (next_o > page_limit))
             {
                 // We need to not skip the object here because of this corner scenario:
                 // A large object was being allocated during BGC mark so we first made it
@@ -35859,7 +36073,7 @@ end_limit:
 #ifdef MULTIPLE_HEAPS
     if (concurrent_p)
     {
-        assert (last_object < (min (high_address, page + WRITE_WATCH_UNIT_SIZE)));
+        assert (last_object < page_limit);
     }
     else
 #endif //MULTIPLE_HEAPS
@@ -35914,6 +36128,7 @@ void gc_heap::revisit_written_pages (BOOL concurrent_p, BOOL reset_only_p)
             //and if we reset the last page write watch status,
             // they wouldn't be guaranteed to be visited -> gc hole.
             uintptr_t bcount = array_size;
+            bool more_ranges_p = true;
             uint8_t* last_page = 0;
             uint8_t* last_object = heap_segment_mem (seg);
             uint8_t* high_address = 0;
@@ -35957,8 +36172,7 @@ void gc_heap::revisit_written_pages (BOOL concurrent_p, BOOL reset_only_p)
                         high_address = high_page (seg, concurrent_p);
                     }
 
-                    if ((base_address < high_address) &&
-                        (bcount >= array_size))
+                    if ((base_address < high_address) && more_ranges_p)
                     {
                         ptrdiff_t region_size = high_address - base_address;
                         dprintf (3, ("h%d: gw: [%zx(%zd)", heap_number, (size_t)base_address, (size_t)region_size));
@@ -35974,9 +36188,11 @@ void gc_heap::revisit_written_pages (BOOL concurrent_p, BOOL reset_only_p)
                         }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
-                        get_write_watch_for_gc_heap (reset_watch_state, base_address, region_size,
-                                                     (void**)background_written_addresses,
-                                                     &bcount, is_runtime_suspended);
+                        bcount = array_size;
+                        more_ranges_p = get_write_watch_for_gc_heap (reset_watch_state, base_address, region_size,
+                                                                     (void**)background_written_addresses,
+                                                                     background_written_range_sizes,
+                                                                     &bcount, is_runtime_suspended);
 
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
                         if (!is_runtime_suspended)
@@ -35987,9 +36203,12 @@ void gc_heap::revisit_written_pages (BOOL concurrent_p, BOOL reset_only_p)
 
                         if (bcount != 0)
                         {
-                            total_dirtied_pages += bcount;
+                            for (unsigned i = 0; i < bcount; i++)
+                            {
+                                total_dirtied_pages += background_written_range_sizes[i] / WRITE_WATCH_UNIT_SIZE;
+                            }
 
-                            dprintf (3, ("Found %zu pages [%zx, %zx[",
+                            dprintf (3, ("Found %zu dirty ranges [%zx, %zx[",
                                             bcount, (size_t)base_address, (size_t)high_address));
                         }
 
@@ -36003,27 +36222,28 @@ void gc_heap::revisit_written_pages (BOOL concurrent_p, BOOL reset_only_p)
                             for (unsigned i = 0; i < bcount; i++)
                             {
                                 uint8_t* page = (uint8_t*)background_written_addresses[i];
-                                dprintf (3, ("looking at page %d at %zx(h: %zx)", i,
-                                    (size_t)page, (size_t)high_address));
+                                size_t span_size = background_written_range_sizes[i];
+                                dprintf (3, ("looking at range %d at %zx(%zx)(h: %zx)", i,
+                                    (size_t)page, span_size, (size_t)high_address));
                                 if (page < high_address)
                                 {
-                                    //search for marked objects in the page
-                                    revisit_written_page (page, high_address, concurrent_p,
+                                    //search for marked objects in the range
+                                    revisit_written_page (page, span_size, high_address, concurrent_p,
                                                           last_page, last_object,
                                                           !small_object_segments,
                                                           total_marked_objects);
                                 }
                                 else
                                 {
-                                    dprintf (3, ("page %d at %zx is >= %zx!", i, (size_t)page, (size_t)high_address));
+                                    dprintf (3, ("range %d at %zx is >= %zx!", i, (size_t)page, (size_t)high_address));
                                     assert (!"page shouldn't have exceeded limit");
                                 }
                             }
                         }
 
-                        if (bcount >= array_size){
-                            base_address = background_written_addresses [array_size-1] + WRITE_WATCH_UNIT_SIZE;
-                            bcount = array_size;
+                        if (more_ranges_p)
+                        {
+                            base_address = background_written_addresses [bcount - 1] + background_written_range_sizes [bcount - 1];
                         }
                     }
                     else
@@ -37927,6 +38147,59 @@ uint8_t* gc_heap::find_first_object (uint8_t* start, uint8_t* first_object)
     return o;
 }
 
+// Scan [card_word, card_word_end[ for the first non-zero card word. On large
+// heaps this linear scan dominates ephemeral card scanning, so where the
+// baseline ISA has SIMD we check 64 bytes per iteration and only fall back to
+// the scalar loop to pinpoint the word within a non-zero block.
+inline
+uint32_t* find_first_nonzero_card_word (uint32_t* card_word, uint32_t* card_word_end)
+{
+#if defined(TARGET_AMD64)
+    const size_t words_per_step = 4 * (sizeof (__m128i) / sizeof (uint32_t));
+    while ((((size_t)card_word & (sizeof (__m128i) - 1)) != 0) && (card_word < card_word_end))
+    {
+        if (*card_word)
+            return card_word;
+        card_word++;
+    }
+    while ((card_word + words_per_step) <= card_word_end)
+    {
+        __m128i v0 = _mm_load_si128 ((const __m128i*)card_word);
+        __m128i v1 = _mm_load_si128 ((const __m128i*)card_word + 1);
+        __m128i v2 = _mm_load_si128 ((const __m128i*)card_word + 2);
+        __m128i v3 = _mm_load_si128 ((const __m128i*)card_word + 3);
+        __m128i ored = _mm_or_si128 (_mm_or_si128 (v0, v1), _mm_or_si128 (v2, v3));
+        if (_mm_movemask_epi8 (_mm_cmpeq_epi32 (ored, _mm_setzero_si128 ())) != 0xffff)
+        {
+            // one of these words is non-zero - let the scalar loop find it
+            break;
+        }
+        card_word += words_per_step;
+    }
+#elif defined(TARGET_ARM64)
+    const size_t words_per_step = 4 * (sizeof (uint32x4_t) / sizeof (uint32_t));
+    while ((card_word + words_per_step) <= card_word_end)
+    {
+        uint32x4_t v0 = vld1q_u32 (card_word);
+        uint32x4_t v1 = vld1q_u32 (card_word + 4);
+        uint32x4_t v2 = vld1q_u32 (card_word + 8);
+        uint32x4_t v3 = vld1q_u32 (card_word + 12);
+        uint32x4_t ored = vorrq_u32 (vorrq_u32 (v0, v1), vorrq_u32 (v2, v3));
+        if (vmaxvq_u32 (ored) != 0)
+        {
+            // one of these words is non-zero - let the scalar loop find it
+            break;
+        }
+        card_word += words_per_step;
+    }
+#endif //TARGET_AMD64
+    while ((card_word < card_word_end) && !(*card_word))
+    {
+        card_word++;
+    }
+    return card_word;
+}
+
 #ifdef CARD_BUNDLE
 // Find the first non-zero card word between cardw and cardw_end.
 // The index of the word we find is returned in cardw.
@@ -37961,10 +38234,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
 
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_first_nonzero_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -37978,10 +38248,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
             }
             // explore the end of the card bundle so we can possibly clear it
             card_word_end = &card_table[card_bundle_cardw (cardb+1)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_first_nonzero_card_word (card_word, card_word_end);
             if ((cardw <= card_bundle_cardw (cardb)) &&
                 (card_word == card_word_end))
             {
@@ -38001,18 +38268,14 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
         uint32_t* card_word = &card_table[cardw];
         uint32_t* card_word_end = &card_table [cardw_end];
 
-        while (card_word < card_word_end)
+        card_word = find_first_nonzero_card_word (card_word, card_word_end);
+        if (card_word < card_word_end)
         {
-            if ((*card_word) != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
-        return FALSE;
 
+        return FALSE;
     }
 }
 #endif //CARD_BUNDLE
@@ -38069,12 +38332,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 #else //CARD_BUNDLE
         // Go through the remaining card words between here and card_word_end until we find
         // one that is non-zero.
-        do
-        {
-            ++last_card_word;
-        }
-
-        while ((last_card_word < &card_table [card_word_end]) && !(*last_card_word));
+        last_card_word = find_first_nonzero_card_word (last_card_word + 1, &card_table [card_word_end]);
         if (last_card_word < &card_table [card_word_end])
         {
             card_word_value = *last_card_word;
@@ -40866,6 +41124,13 @@ void gc_heap::compute_new_dynamic_data (int gen_number)
     generation*   gen = generation_of (gen_number);
     size_t        in = (gen_number==0) ? 0 : compute_in (gen_number);
 
+    if ((gen_number == 0) && (gen0_adaptive_boost != 0))
+    {
+        dprintf (2, ("h%d consumed %zd bytes of adaptive gen0 boost this cycle",
+            heap_number, gen0_adaptive_boost));
+        gen0_adaptive_boost = 0;
+    }
+
     size_t total_gen_size = generation_size (gen_number);
     //keep track of fragmentation
     dd_fragmentation (dd) = generation_free_list_space (gen) + generation_free_obj_space (gen);
@@ -45388,6 +45653,9 @@ HRESULT GCHeap::Initialize()
     gc_heap::gc_thread_no_affinitize_p = (gc_heap::heap_hard_limit ?
         !affinity_config_specified_p : (GCConfig::GetNoAffinitize() != 0));
 
+    gc_heap::numa_partitioned_alloc_p = (GCConfig::GetGCNumaPartitionedAlloc() != 0) &&
+        GCToOSInterface::CanEnableGCNumaAware();
+
     if (!(gc_heap::gc_thread_no_affinitize_p))
     {
         uint32_t num_affinitized_processors = (uint32_t)process_affinity_set->Count();
@@ -46773,6 +47041,56 @@ last_recorded_gc_info* gc_heap::get_completed_bgc_info()
 }
 #endif //BACKGROUND_GC
 
+#ifdef FEATURE_EVENT_TRACE
+// Samples the hardware counters opened through GCToOSInterface and fires the
+// deltas accumulated since the previous sample as the GCHardwareCounters event,
+// so a single trace correlates GC activity with microarchitectural behavior
+// such as cache misses. Opt-in via the GCHardwareCounters config; only ever
+// called on the thread running the GC, so plain statics suffice.
+static void fire_hardware_counters_event (bool is_gc_start, uint32_t condemned_gen)
+{
+    enum hw_counters_state
+    {
+        hw_counters_uninitialized = 0,
+        hw_counters_enabled = 1,
+        hw_counters_disabled = 2
+    };
+    static hw_counters_state state = hw_counters_uninitialized;
+    static uint64_t last_values[4];
+
+    if (state == hw_counters_disabled)
+        return;
+
+    if (!EVENT_ENABLED (GCHardwareCounters))
+        return;
+
+    if (state == hw_counters_uninitialized)
+    {
+        if (!GCConfig::GetGCHardwareCounters() || !GCToOSInterface::OpenHardwareCounters())
+        {
+            state = hw_counters_disabled;
+            return;
+        }
+        memset (last_values, 0, sizeof (last_values));
+        state = hw_counters_enabled;
+    }
+
+    uint64_t values[4];
+    if (!GCToOSInterface::ReadHardwareCounters (values))
+        return;
+
+    FIRE_EVENT (GCHardwareCounters,
+        (uint32_t)(is_gc_start ? 1 : 0),
+        condemned_gen,
+        values[0] - last_values[0],
+        values[1] - last_values[1],
+        values[2] - last_values[2],
+        values[3] - last_values[3]);
+
+    memcpy (last_values, values, sizeof (last_values));
+}
+#endif //FEATURE_EVENT_TRACE
+
 void gc_heap::do_pre_gc()
 {
     STRESS_LOG_GC_STACK;
@@ -46834,6 +47152,9 @@ void gc_heap::do_pre_gc()
                                          static_cast<int>(GCEventStatus::GetEnabledLevel(GCEventProvider_Private)),
                                          static_cast<int>(GCEventStatus::GetEnabledKeywords(GCEventProvider_Private)));
 #endif // __linux__
+#ifdef FEATURE_EVENT_TRACE
+    fire_hardware_counters_event (true /* is_gc_start */, (uint32_t)settings.condemned_generation);
+#endif //FEATURE_EVENT_TRACE
 
     if (settings.concurrent)
     {
@@ -47177,6 +47498,10 @@ void gc_heap::do_post_gc()
                          (uint32_t)settings.reason,
                          !!settings.concurrent);
 
+#ifdef FEATURE_EVENT_TRACE
+    fire_hardware_counters_event (false /* is_gc_start */, (uint32_t)settings.condemned_generation);
+#endif //FEATURE_EVENT_TRACE
+
     add_to_history();
 
     uint32_t current_memory_load = 0;
@@ -48203,6 +48528,43 @@ size_t GCHeap::GetNumberFinalizableObjects()
 #endif //MULTIPLE_HEAPS
 }
 
+unsigned int GCHeap::GetFinalizationPartitionCount()
+{
+#ifdef MULTIPLE_HEAPS
+    return (unsigned int)gc_heap::n_heaps;
+#else //MULTIPLE_HEAPS
+    return 1;
+#endif //MULTIPLE_HEAPS
+}
+
+Object* GCHeap::GetNextFinalizableInPartition (unsigned int partition)
+{
+#ifdef MULTIPLE_HEAPS
+    assert (partition < (unsigned int)gc_heap::n_heaps);
+    CFinalize* fq = gc_heap::g_heaps [partition]->finalize_queue;
+
+    //return the first non critical one, then the critical ones.
+    Object* O = fq->GetNextFinalizableObject (TRUE);
+    if (O)
+        return O;
+    return fq->GetNextFinalizableObject (FALSE);
+#else //MULTIPLE_HEAPS
+    assert (partition == 0);
+    return pGenGCHeap->finalize_queue->GetNextFinalizableObject();
+#endif //MULTIPLE_HEAPS
+}
+
+size_t GCHeap::GetNumberOfFinalizableInPartition (unsigned int partition)
+{
+#ifdef MULTIPLE_HEAPS
+    assert (partition < (unsigned int)gc_heap::n_heaps);
+    return gc_heap::g_heaps [partition]->finalize_queue->GetNumberFinalizableObjects();
+#else //MULTIPLE_HEAPS
+    assert (partition == 0);
+    return pGenGCHeap->finalize_queue->GetNumberFinalizableObjects();
+#endif //MULTIPLE_HEAPS
+}
+
 size_t GCHeap::GetFinalizablePromotedCount()
 {
 #ifdef MULTIPLE_HEAPS
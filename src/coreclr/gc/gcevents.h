@@ -48,5 +48,15 @@ KNOWN_EVENT(PrvSetGCHandle, GCEventProvider_Private, GCEventLevel_Information, G
 KNOWN_EVENT(PrvDestroyGCHandle, GCEventProvider_Private, GCEventLevel_Information, GCEventKeyword_GCHandlePrivate)
 KNOWN_EVENT(PinPlugAtGCTime, GCEventProvider_Private, GCEventLevel_Verbose, GCEventKeyword_GCPrivate)
 
+// Hardware performance counter deltas sampled at GC start and end (see GCConfig::GetGCHardwareCounters).
+// Payload: IsGCStart, CondemnedGeneration, Cycles, InstructionsRetired, CacheMisses, BranchMispredictions
+DYNAMIC_EVENT(GCHardwareCounters, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint64_t, uint64_t, uint64_t, uint64_t)
+
+// Fired when a dependent handle promotion scan reaches its fixpoint, once for the scan after mark and once
+// for the scan after finalization promotion. RescanRounds counts the rescan iterations this invocation took;
+// PromotedSecondaries is cumulative over the whole GC.
+// Payload: CondemnedGeneration, IsInitialScan, RescanRounds, PromotedSecondaries
+DYNAMIC_EVENT(GCDependentHandleScan, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint32_t, uint64_t)
+
 #undef KNOWN_EVENT
 #undef DYNAMIC_EVENT
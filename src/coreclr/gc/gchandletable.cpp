@@ -56,6 +56,41 @@ OBJECTHANDLE GCHandleStore::CreateDependentHandle(Object* primary, Object* secon
     return handle;
 }
 
+uint32_t GCHandleStore::CreateHandlesOfType(Object** pObjects, uint32_t count, HandleType type, OBJECTHANDLE* pHandles)
+{
+    HHANDLETABLE handletable = _underlyingBucket.pTable[GetCurrentThreadHomeHeapNumber()];
+    uint32_t created = ::HndCreateHandles(handletable, type, pHandles, count);
+
+    // Assign the referents only after the whole batch is allocated, so a
+    // short allocation can be unwound cleanly by the caller.
+    for (uint32_t i = 0; i < created; i++)
+    {
+        ::HndAssignHandle(pHandles[i], ObjectToOBJECTREF(pObjects[i]));
+    }
+
+    return created;
+}
+
+void GCHandleStore::DestroyHandlesOfType(const OBJECTHANDLE* pHandles, uint32_t count, HandleType type)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // A batch must come from a single underlying table, which is the case
+    // for handles created together by CreateHandlesOfType.
+    HHANDLETABLE handletable = ::HndGetHandleTable(pHandles[0]);
+#ifdef _DEBUG
+    for (uint32_t i = 1; i < count; i++)
+    {
+        assert(::HndGetHandleTable(pHandles[i]) == handletable);
+    }
+#endif
+
+    ::HndDestroyHandles(handletable, type, pHandles, count);
+}
+
 GCHandleStore::~GCHandleStore()
 {
     ::Ref_DestroyHandleTableBucket(&_underlyingBucket);
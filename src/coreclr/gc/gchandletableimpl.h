@@ -22,6 +22,10 @@ public:
 
     virtual OBJECTHANDLE CreateDependentHandle(Object* primary, Object* secondary);
 
+    virtual uint32_t CreateHandlesOfType(Object** pObjects, uint32_t count, HandleType type, OBJECTHANDLE* pHandles);
+
+    virtual void DestroyHandlesOfType(const OBJECTHANDLE* pHandles, uint32_t count, HandleType type);
+
     virtual ~GCHandleStore();
 
     HandleTableBucket _underlyingBucket;
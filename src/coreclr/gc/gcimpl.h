@@ -207,6 +207,10 @@ public:
     Object* GetNextFinalizable() { return GetNextFinalizableObject(); };
     size_t GetNumberOfFinalizable() { return GetNumberFinalizableObjects(); }
 
+    unsigned int GetFinalizationPartitionCount();
+    Object* GetNextFinalizableInPartition(unsigned int partition);
+    size_t GetNumberOfFinalizableInPartition(unsigned int partition);
+
     PER_HEAP_ISOLATED HRESULT GetGcCounters(int gen, gc_counters* counters);
 
     size_t GetValidSegmentSize(bool large_seg = false);
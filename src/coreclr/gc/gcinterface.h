@@ -11,7 +11,7 @@
 // The minor version of the IGCHeap interface. Non-breaking changes are required
 // to bump the minor version number. GCs and EEs with minor version number
 // mismatches can still interoperate correctly, with some care.
-#define GC_INTERFACE_MINOR_VERSION 1
+#define GC_INTERFACE_MINOR_VERSION 3
 
 // The major version of the IGCToCLR interface. Breaking changes to this interface
 // require bumps in the major version number.
@@ -517,6 +517,16 @@ public:
 
     virtual OBJECTHANDLE CreateDependentHandle(Object* primary, Object* secondary) PURE_VIRTUAL
 
+    // Creates a batch of handles of the given type in one pass over the handle table,
+    // amortizing table locking across the batch. Returns the number of handles created,
+    // which is `count` except under out-of-memory conditions.
+    virtual uint32_t CreateHandlesOfType(Object** pObjects, uint32_t count, HandleType type, OBJECTHANDLE* pHandles) PURE_VIRTUAL
+
+    // Destroys a batch of handles of the given type in one pass over the handle table.
+    // All handles in the batch must belong to this store and the same underlying table,
+    // which is the case for handles created together by CreateHandlesOfType.
+    virtual void DestroyHandlesOfType(const OBJECTHANDLE* pHandles, uint32_t count, HandleType type) PURE_VIRTUAL
+
     virtual ~IGCHandleStore() {};
 };
 
@@ -980,6 +990,18 @@ public:
 
     // Refresh the memory limit
     virtual int RefreshMemoryLimit() PURE_VIRTUAL
+
+    // Returns the number of independent partitions the finalization queue is divided
+    // into. Objects are queued for finalization on the partition of the heap they were
+    // allocated from, so separate threads can drain separate partitions without
+    // contending on each other's queues.
+    virtual unsigned int GetFinalizationPartitionCount() PURE_VIRTUAL
+
+    // Gets the next finalizable object from the given partition.
+    virtual Object* GetNextFinalizableInPartition(unsigned int partition) PURE_VIRTUAL
+
+    // Gets the number of finalizable objects in the given partition.
+    virtual size_t GetNumberOfFinalizableInPartition(unsigned int partition) PURE_VIRTUAL
 };
 
 #ifdef WRITE_BARRIER_CHECK
@@ -1001,6 +1023,12 @@ enum GC_ALLOC_FLAGS
     GC_ALLOC_ALIGN8             = 8,
     GC_ALLOC_ZEROING_OPTIONAL   = 16,
     GC_ALLOC_LARGE_OBJECT_HEAP  = 32,
+    // Objects allocated on the pinned object heap are guaranteed to never move for
+    // their entire lifetime. This is a hard API contract: callers may hand out raw
+    // interior pointers to native code without creating any handle, so the POH can
+    // never be compacted - there is no way to find and retarget such pointers.
+    // Fragmentation in this heap has to be managed by allocation policy and by the
+    // fragmentation telemetry exposed through GetMemoryInfo's per-generation data.
     GC_ALLOC_PINNED_OBJECT_HEAP = 64,
     GC_ALLOC_USER_OLD_HEAP      = GC_ALLOC_LARGE_OBJECT_HEAP | GC_ALLOC_PINNED_OBJECT_HEAP,
 };
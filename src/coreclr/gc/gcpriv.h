@@ -2324,7 +2324,7 @@ private:
     PER_HEAP_ISOLATED_METHOD void distribute_free_regions();
 #ifdef BACKGROUND_GC
     PER_HEAP_ISOLATED_METHOD void reset_write_watch_for_gc_heap(void* base_address, size_t region_size);
-    PER_HEAP_ISOLATED_METHOD void get_write_watch_for_gc_heap(bool reset, void *base_address, size_t region_size, void** dirty_pages, uintptr_t* dirty_page_count_ref, bool is_runtime_suspended);
+    PER_HEAP_ISOLATED_METHOD bool get_write_watch_for_gc_heap(bool reset, void *base_address, size_t region_size, void** dirty_range_addresses, size_t* dirty_range_sizes, uintptr_t* dirty_range_count_ref, bool is_runtime_suspended);
     PER_HEAP_METHOD void switch_one_quantum();
     PER_HEAP_METHOD void reset_ww_by_chunk (uint8_t* start_address, size_t total_reset_size);
     PER_HEAP_METHOD void switch_on_reset (BOOL concurrent_p, size_t* current_total_reset_size, size_t last_reset_size);
@@ -3059,7 +3059,8 @@ private:
 
     PER_HEAP_METHOD uint8_t* high_page (heap_segment* seg, BOOL concurrent_p);
 
-    PER_HEAP_METHOD void revisit_written_page (uint8_t* page, uint8_t* end,
+    PER_HEAP_METHOD void revisit_written_page (uint8_t* page, size_t span_size,
+                               uint8_t* end,
                                BOOL concurrent_p, uint8_t*& last_page,
                                uint8_t*& last_object, BOOL large_objects_p,
                                size_t& num_marked_objects);
@@ -3389,7 +3390,10 @@ private:
 #endif //!USE_REGIONS
 
 #ifdef WRITE_WATCH
+    // Dirty state is consumed as ranges of contiguous pages - background_written_addresses holds
+    // each range's base address and background_written_range_sizes its size in bytes.
     PER_HEAP_FIELD_SINGLE_GC uint8_t* background_written_addresses[array_size + 2];
+    PER_HEAP_FIELD_SINGLE_GC size_t background_written_range_sizes[array_size + 2];
 #endif //WRITE_WATCH
 
 #ifdef SNOOP_STATS
@@ -3500,6 +3504,12 @@ private:
     PER_HEAP_FIELD_SINGLE_GC size_t saved_pinned_plug_index;
 #endif //DOUBLY_LINKED_FL
 
+    // Free list search length stats for allocate_in_older_generation - how many
+    // free items we examined vs how many we actually took. A high considered:taken
+    // ratio means long scans within buckets, ie a badly fragmented free list.
+    PER_HEAP_FIELD_SINGLE_GC size_t older_gen_fl_items_considered;
+    PER_HEAP_FIELD_SINGLE_GC size_t older_gen_fl_items_taken;
+
 #ifdef FEATURE_LOH_COMPACTION
     PER_HEAP_FIELD_SINGLE_GC size_t loh_pinned_queue_tos;
     PER_HEAP_FIELD_SINGLE_GC size_t loh_pinned_queue_bos;
@@ -3523,6 +3533,10 @@ private:
     // Only field used by allocation is new_allocation.
     PER_HEAP_FIELD_SINGLE_GC_ALLOC dynamic_data dynamic_data_table[total_generation_count];
 
+    // Extra gen0 budget granted by the adaptive budget controller since the
+    // last GC; reset when gen0's dynamic data is recomputed.
+    PER_HEAP_FIELD_SINGLE_GC_ALLOC size_t gen0_adaptive_boost;
+
     // the # of bytes allocates since the last full compacting GC, maintained by the allocator and
     // reset during the next full compacting GC
     PER_HEAP_FIELD_SINGLE_GC_ALLOC uint64_t loh_alloc_since_cg;
@@ -3535,6 +3549,12 @@ private:
 #ifdef MULTIPLE_HEAPS
     PER_HEAP_FIELD_SINGLE_GC_ALLOC VOLATILE(int) alloc_context_count;
 
+    // # of consecutive times balance_heaps could not find a better heap for
+    // one of this heap's contexts on the local NUMA node. Only maintained when
+    // numa_partitioned_alloc_p is set; once it reaches
+    // numa_partition_spill_threshold we allow a remote-node balance pass.
+    PER_HEAP_FIELD_SINGLE_GC_ALLOC VOLATILE(int) numa_local_balance_failures;
+
     // Init-ed during a GC and updated by allocator after that GC
     PER_HEAP_FIELD_SINGLE_GC_ALLOC bool gen0_allocated_after_gc_p;
 #endif //MULTIPLE_HEAPS
@@ -4121,6 +4141,11 @@ private:
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY int generation_skip_ratio_threshold;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY int conserve_mem_setting;
 
+    // When set, new_allocation_allowed grants extra gen0 budget (in small
+    // increments, bounded per cycle) while the time since the last GC is below
+    // gen0_adaptive_min_interval_us, instead of triggering another gen0 GC.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool adaptive_gen0_budget_p;
+
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool spin_count_unit_config_p;
 
     // For SOH we always allocate segments of the same
@@ -4202,7 +4227,13 @@ private:
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool gc_thread_no_affinitize_p;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t min_gen0_balance_delta;
 
+    // When set, balance_heaps only considers heaps on the allocating thread's
+    // NUMA node; remote nodes are considered only after the local node has
+    // repeatedly failed to yield a better heap (see numa_local_balance_failures).
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool numa_partitioned_alloc_p;
+
 #define alloc_quantum_balance_units (16)
+#define numa_partition_spill_threshold (8)
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t min_balance_threshold;
 
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t max_decommit_step_size;
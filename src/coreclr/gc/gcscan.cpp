@@ -57,6 +57,7 @@ void GCScan::GcDhInitialScan(promote_func* fn, int condemned, int max_gen, ScanC
     pDhContext->m_iCondemned = condemned;
     pDhContext->m_iMaxGen = max_gen;
     pDhContext->m_pScanContext = sc;
+    pDhContext->m_cSecondaryPromotions = 0;
 
     // Look for dependent handle whose primary has been promoted but whose secondary has not. Promote the
     // secondary in those cases. Additionally this scan sets the m_fUnpromotedPrimaries and m_fPromoted state
@@ -93,6 +94,13 @@ bool GCScan::GcDhReScan(ScanContext* sc)
     return Ref_ScanDependentHandlesForPromotion(pDhContext);
 }
 
+size_t GCScan::GcDhGetPromotedCount()
+{
+    WRAPPER_NO_CONTRACT;
+
+    return Ref_GetDependentHandlePromotedCount();
+}
+
 /*
  * Scan for dead weak pointers
  */
@@ -174,6 +182,11 @@ void GCScan::GcScanHandles (promote_func* fn,  int condemned, int max_gen,
     }
 }
 
+void GCScan::GcPrepareSharedHandleScan (uint32_t uScanThreads)
+{
+    Ref_PrepareSharedHandleScan (uScanThreads);
+}
+
 /*
  * Scan all handle roots in this 'namespace' for profiling
  */
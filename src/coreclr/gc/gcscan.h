@@ -28,6 +28,7 @@ struct DhContext
     int             m_iCondemned;               // The condemned generation
     int             m_iMaxGen;                  // The maximum generation
     ScanContext    *m_pScanContext;             // The GC's scan context for this phase
+    size_t          m_cSecondaryPromotions;     // Secondaries promoted by this thread in the current GC (telemetry)
 };
 
 class GCScan
@@ -42,6 +43,10 @@ class GCScan
     //
     static void GcScanHandles (promote_func* fn, int condemned, int max_gen, ScanContext* sc);
 
+    // arms the sharded strong-handle scan; called on one thread before the
+    // scanning threads are released (server GC only)
+    static void GcPrepareSharedHandleScan (uint32_t uScanThreads);
+
     static void GcRuntimeStructuresValid (BOOL bValid);
 
     static bool GetGcRuntimeStructuresValid ();
@@ -74,6 +79,10 @@ class GCScan
     // any objects were promoted as a result.
     static bool GcDhReScan(ScanContext* sc);
 
+    // Total number of secondaries promoted in the current GC, summed over all scanning threads. Only safe to
+    // call when the scanning threads are synchronized (or there's just one of them).
+    static size_t GcDhGetPromotedCount();
+
     // post-promotions callback
     static void GcPromotionsGranted (int condemned, int max_gen,
                                      ScanContext* sc);
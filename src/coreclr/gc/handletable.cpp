@@ -316,6 +316,70 @@ OBJECTHANDLE HndCreateHandle(HHANDLETABLE hTable, uint32_t uType, OBJECTREF obje
     // return the result
     return handle;
 }
+
+/*
+ * HndCreateHandles
+ *
+ * Entrypoint for allocating a batch of handles of the same type. The handles
+ * are created with null referents and no extra info; callers assign the
+ * referents afterwards. Small batches are satisfied from the handle cache,
+ * where pops are lock-free and refills amortize the table lock over a whole
+ * cache bank; larger batches take the table lock once and allocate straight
+ * from the segments.
+ *
+ * Returns the number of handles actually allocated, which is uCount except
+ * under out-of-memory conditions.
+ *
+ */
+uint32_t HndCreateHandles(HHANDLETABLE hTable, uint32_t uType, OBJECTHANDLE *pHandles, uint32_t uCount)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    // fetch the handle table pointer
+    HandleTable *pTable = Table(hTable);
+
+    // sanity check the type index
+    _ASSERTE(uType < pTable->uTypeCount);
+
+    uint32_t uSatisfied;
+    if (uCount < HANDLES_PER_CACHE_BANK)
+    {
+        uSatisfied = TableAllocHandlesFromCache(pTable, uType, pHandles, uCount);
+    }
+    else
+    {
+        CrstHolder ch(&pTable->Lock);
+        uSatisfied = TableAllocBulkHandles(pTable, uType, pHandles, uCount);
+    }
+
+    for (uint32_t u = 0; u < uSatisfied; u++)
+    {
+        OBJECTHANDLE handle = pHandles[u];
+
+#ifdef DEBUG_DestroyedHandleValue
+        if (*(_UNCHECKED_OBJECTREF *)handle == DEBUG_DestroyedHandleValue)
+            *(_UNCHECKED_OBJECTREF *)handle = NULL;
+#endif
+
+        // the handle better not point at anything yet
+        _ASSERTE(*(_UNCHECKED_OBJECTREF *)handle == NULL);
+
+        STRESS_LOG2(LF_GC, LL_INFO1000, "CreateHandle: %p, type=%d\n", handle, uType);
+    }
+
+#if defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+    g_dwHandles += uSatisfied;
+#endif // defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+
+    return uSatisfied;
+}
 #endif // !DACCESS_COMPILE
 
 #ifdef _DEBUG
@@ -387,6 +451,61 @@ void HndDestroyHandle(HHANDLETABLE hTable, uint32_t uType, OBJECTHANDLE handle)
 #endif // defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
 }
 
+/*
+ * HndDestroyHandles
+ *
+ * Entrypoint for freeing a batch of handles of the same type. Small batches
+ * go back to the handle cache, where pushes are lock-free and spills
+ * amortize the table lock over a whole cache bank; larger batches take the
+ * table lock once and return the handles straight to the segments.
+ *
+ */
+void HndDestroyHandles(HHANDLETABLE hTable, uint32_t uType, const OBJECTHANDLE *pHandles, uint32_t uCount)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    // fetch the handle table pointer
+    HandleTable *pTable = Table(hTable);
+
+    // sanity check the type index
+    _ASSERTE(uType < pTable->uTypeCount);
+
+    for (uint32_t u = 0; u < uCount; u++)
+    {
+        OBJECTHANDLE handle = pHandles[u];
+
+        // sanity check the handles we are being asked to free
+        _ASSERTE(handle);
+        _ASSERTE(HandleFetchType(handle) == uType);
+
+        STRESS_LOG2(LF_GC, LL_INFO1000, "DestroyHandle: *%p->%p\n", handle, *(_UNCHECKED_OBJECTREF *)handle);
+
+        FIRE_EVENT(DestroyGCHandle, (void *)handle);
+        FIRE_EVENT(PrvDestroyGCHandle, (void *)handle);
+    }
+
+    if (uCount < HANDLES_PER_CACHE_BANK)
+    {
+        TableFreeHandlesToCache(pTable, uType, pHandles, uCount);
+    }
+    else
+    {
+        CrstHolder ch(&pTable->Lock);
+        TableFreeBulkUnpreparedHandles(pTable, uType, pHandles, uCount);
+    }
+
+#if defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+    g_dwHandles -= uCount;
+#endif // defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+}
+
 
 /*
  * HndDestroyHandleOfUnknownType
@@ -669,6 +788,25 @@ void HndEnumHandles(HHANDLETABLE hTable, const uint32_t *puType, uint32_t uTypeC
     }
 }
 
+#ifndef DACCESS_COMPILE
+/*
+ * HndArmSharedScan
+ *
+ * Arms the table's claim cursor for a sharded GC scan.  Must be called on a
+ * single thread before the scanning threads start (they synchronize with the
+ * arming thread via the GC's own rendezvous), after which each thread passing
+ * HNDGCF_SHARDED to HndScanHandlesForGC claims a disjoint set of segments.
+ *
+ */
+void HndArmSharedScan(HHANDLETABLE hTable)
+{
+    WRAPPER_NO_CONTRACT;
+
+    PTR_HandleTable pTable = Table(hTable);
+    pTable->pSharedScanCursor = pTable->pSegmentList;
+}
+#endif // !DACCESS_COMPILE
+
 /*
  * HndScanHandlesForGC
  *
@@ -753,6 +891,13 @@ void HndScanHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t
 #endif
     }
 
+#ifndef DACCESS_COMPILE
+    // sharded scans distribute this table's segments across the scanning
+    // threads via the claim cursor armed by HndArmSharedScan
+    if (flags & HNDGCF_SHARDED)
+        pfnSegment = SharedSegmentIterator;
+#endif
+
     // set up parameters for scan callbacks
     ScanCallbackInfo info;
 
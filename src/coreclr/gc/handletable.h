@@ -71,6 +71,12 @@ void            HndDestroyHandle(HHANDLETABLE hTable, uint32_t uType, OBJECTHAND
 
 void            HndDestroyHandleOfUnknownType(HHANDLETABLE hTable, OBJECTHANDLE handle);
 
+/*
+ * bulk handle allocation and deallocation
+ */
+uint32_t        HndCreateHandles(HHANDLETABLE hTable, uint32_t uType, OBJECTHANDLE *pHandles, uint32_t uCount);
+void            HndDestroyHandles(HHANDLETABLE hTable, uint32_t uType, const OBJECTHANDLE *pHandles, uint32_t uCount);
+
 /*
  * owner data associated with handles
  */
@@ -111,6 +117,7 @@ void HndEnumHandles(HHANDLETABLE hTable, const uint32_t *puType, uint32_t uTypeC
 #define HNDGCF_AGE          (0x00000001)    // age handles while scanning
 #define HNDGCF_ASYNC        (0x00000002)    // drop the table lock while scanning
 #define HNDGCF_EXTRAINFO    (0x00000004)    // iterate per-handle data while scanning
+#define HNDGCF_SHARDED      (0x00000008)    // claim segments via interlocked cursor (multiple scanning threads)
 
 GC_DAC_VISIBLE_NO_MANGLE
 void            HndScanHandlesForGC(HHANDLETABLE hTable,
@@ -123,6 +130,8 @@ void            HndScanHandlesForGC(HHANDLETABLE hTable,
                                     uint32_t maxgen,
                                     uint32_t flags);
 
+void            HndArmSharedScan(HHANDLETABLE hTable);
+
 void            HndResetAgeMap(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags);
 void            HndVerifyTable(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags);
 
@@ -403,6 +403,12 @@ struct HandleTable
      */
     AsyncScanInfo *pAsyncScanInfo;
 
+    /*
+     * claim cursor for sharded GC scans (see SharedSegmentIterator);
+     * armed by HndArmSharedScan before the scanning threads start
+     */
+    VOLATILE(PTR_TableSegment) pSharedScanCursor;
+
     /*
      * per-table user info
      */
@@ -855,6 +861,23 @@ PTR_TableSegment CALLBACK QuickSegmentIterator(PTR_HandleTable pTable, PTR_Table
 PTR_TableSegment CALLBACK StandardSegmentIterator(PTR_HandleTable pTable, PTR_TableSegment pPrevSegment, CrstHolderWithState *pCrstHolder = 0);
 
 
+#ifndef DACCESS_COMPILE
+/*
+ * SharedSegmentIterator
+ *
+ * Returns the next unclaimed segment of the table's shared scan, claiming
+ * it with an interlocked pop of the claim cursor so that multiple threads
+ * scanning the same table each process a disjoint set of segments.
+ *
+ * The cursor must have been armed via HndArmSharedScan before the scanning
+ * threads start, and no handles may be created or destroyed while a shared
+ * scan is in flight (guaranteed during GC scans since the EE is suspended).
+ *
+ */
+PTR_TableSegment CALLBACK SharedSegmentIterator(PTR_HandleTable pTable, PTR_TableSegment pPrevSegment, CrstHolderWithState *pCrstHolder = 0);
+#endif
+
+
 /*
  * FullSegmentIterator
  *
@@ -1409,6 +1409,43 @@ PTR_TableSegment CALLBACK StandardSegmentIterator(PTR_HandleTable pTable, PTR_Ta
 }
 
 
+#ifndef DACCESS_COMPILE
+/*
+ * SharedSegmentIterator
+ *
+ * Returns the next unclaimed segment of the table's shared scan.
+ *
+ * Multiple threads can scan the same table concurrently; each segment is
+ * handed to exactly one of them via an interlocked pop of the claim cursor.
+ * Per-segment maintenance (chain resorting) is safe since only the claiming
+ * thread touches the segment, but no segments are freed on this path - that
+ * maintenance still happens on FullSegmentIterator scans.
+ *
+ */
+PTR_TableSegment CALLBACK SharedSegmentIterator(PTR_HandleTable pTable, PTR_TableSegment pPrevSegment, CrstHolderWithState *)
+{
+    LIMITED_METHOD_CONTRACT;
+    UNREFERENCED_PARAMETER(pPrevSegment);
+
+    PTR_TableSegment pSegment;
+    do
+    {
+        pSegment = pTable->pSharedScanCursor;
+        if (!pSegment)
+            return NULL;
+    }
+    while (Interlocked::CompareExchangePointer(&pTable->pSharedScanCursor,
+                                               pSegment->pNextSegment, pSegment) != pSegment);
+
+    // re-sort the block chains if necessary
+    if (pSegment->fResortChains)
+        SegmentResortChains(pSegment);
+
+    return pSegment;
+}
+#endif // !DACCESS_COMPILE
+
+
 /*
  * FullSegmentIterator
  *
@@ -208,6 +208,7 @@ void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *p
             // promotion might be all that is pinning that object. If we've already scanned that dependent
             // handle relationship, we could lose it secondary object.
             pDhContext->m_fPromoted = true;
+            pDhContext->m_cSecondaryPromotions++;
         }
     }
     else if (*pObjRef)
@@ -1044,6 +1045,44 @@ void Ref_TracePinningRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
 }
 
 
+#ifndef DACCESS_COMPILE
+// # of GC threads that still have to run Ref_TraceNormalRoots for the
+// currently armed shared handle scan; 0 means no shared scan is armed.
+static VOLATILE(int32_t) g_uSharedScanThreadsRemaining = 0;
+
+/*
+ * Arms every handle table for a sharded strong-handle scan.  Called on a
+ * single thread before the GC scanning threads are released; the threads
+ * then claim table segments cooperatively in Ref_TraceNormalRoots instead
+ * of each scanning only its own slot's tables, which balances heaps with
+ * very unevenly populated tables.
+ */
+void Ref_PrepareSharedHandleScan(uint32_t uScanThreads)
+{
+    WRAPPER_NO_CONTRACT;
+
+    HandleTableMap* walk = &g_HandleTableMap;
+    while (walk)
+    {
+        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i++)
+        {
+            if (walk->pBuckets[i] != NULL)
+            {
+                for (int uCPUindex = 0; uCPUindex < getNumberOfSlots(); uCPUindex++)
+                {
+                    HHANDLETABLE hTable = walk->pBuckets[i]->pTable[uCPUindex];
+                    if (hTable)
+                        HndArmSharedScan(hTable);
+                }
+            }
+        }
+        walk = walk->pNext;
+    }
+
+    g_uSharedScanThreadsRemaining = (int32_t)uScanThreads;
+}
+#endif // !DACCESS_COMPILE
+
 void Ref_TraceNormalRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc, Ref_promote_func* fn)
 {
     WRAPPER_NO_CONTRACT;
@@ -1057,17 +1096,44 @@ void Ref_TraceNormalRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
     uint32_t flags = (sc->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
     HandleTableMap *walk = &g_HandleTableMap;
-    while (walk) {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-            if (walk->pBuckets[i] != NULL)
-            {
-                HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber(sc)];
-                if (hTable)
+#ifndef DACCESS_COMPILE
+    if (!sc->concurrent && (g_uSharedScanThreadsRemaining != 0))
+    {
+        // a shared scan is armed - scan every slot's tables, claiming segments
+        // cooperatively with the other GC threads
+        while (walk) {
+            for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+                if (walk->pBuckets[i] != NULL)
                 {
-                    HndScanHandlesForGC(hTable, PromoteObject, uintptr_t(sc), uintptr_t(fn), types, uTypeCount, condemned, maxgen, flags);
+                    for (int uCPUindex = 0; uCPUindex < getNumberOfSlots(); uCPUindex++)
+                    {
+                        HHANDLETABLE hTable = walk->pBuckets[i]->pTable[uCPUindex];
+                        if (hTable)
+                        {
+                            HndScanHandlesForGC(hTable, PromoteObject, uintptr_t(sc), uintptr_t(fn), types, uTypeCount, condemned, maxgen, flags | HNDGCF_SHARDED);
+                        }
+                    }
                 }
-            }
-        walk = walk->pNext;
+            walk = walk->pNext;
+        }
+
+        Interlocked::Decrement(&g_uSharedScanThreadsRemaining);
+    }
+    else
+#endif // !DACCESS_COMPILE
+    {
+        while (walk) {
+            for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+                if (walk->pBuckets[i] != NULL)
+                {
+                    HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber(sc)];
+                    if (hTable)
+                    {
+                        HndScanHandlesForGC(hTable, PromoteObject, uintptr_t(sc), uintptr_t(fn), types, uTypeCount, condemned, maxgen, flags);
+                    }
+                }
+            walk = walk->pNext;
+        }
     }
 
     // promote objects pointed to by variable handles whose dynamic type is VHT_STRONG
@@ -1194,6 +1260,20 @@ DhContext *Ref_GetDependentHandleContext(ScanContext* sc)
     return &g_pDependentHandleContexts[getSlotNumber(sc)];
 }
 
+// Sum the secondary promotion counts accumulated by the individual scanning threads during the current GC.
+// Only meaningful while the scanning threads are synchronized, since the counts are updated without locking.
+size_t Ref_GetDependentHandlePromotedCount()
+{
+    WRAPPER_NO_CONTRACT;
+
+    size_t cPromoted = 0;
+    int n_slots = getNumberOfSlots();
+    for (int i = 0; i < n_slots; i++)
+        cPromoted += g_pDependentHandleContexts[i].m_cSecondaryPromotions;
+
+    return cPromoted;
+}
+
 // Scan the dependent handle table promoting any secondary object whose associated primary object is promoted.
 //
 // Multiple scans may be required since (a) secondary promotions made during one scan could cause the primary
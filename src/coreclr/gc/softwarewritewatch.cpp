@@ -6,6 +6,12 @@
 #include "env/gcenv.os.h"
 #include "softwarewritewatch.h"
 
+#if defined(TARGET_AMD64)
+#include <emmintrin.h>
+#elif defined(TARGET_ARM64)
+#include <arm_neon.h>
+#endif
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 #ifndef DACCESS_COMPILE
 
@@ -108,6 +114,133 @@ bool SoftwareWriteWatch::GetDirtyFromBlock(
     return true;
 }
 
+// Returns the first byte in [begin, end) that does not equal 'value', or 'end' if there is none. Each byte of the write
+// watch table is only ever 0 or 0xff, so scanning a chunk at a time for a mismatch is sufficient both to skip over clean
+// regions (value == 0) and to extend through dirty regions (value == 0xff).
+static uint8_t *ScanForByteMismatch(uint8_t *begin, uint8_t *end, uint8_t value)
+{
+    assert(begin <= end);
+
+#if defined(TARGET_AMD64)
+    __m128i chunkValue = _mm_set1_epi8(static_cast<char>(value));
+    while ((end - begin) >= 16)
+    {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+        uint32_t equalMask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, chunkValue)));
+        if (equalMask != 0xffff)
+        {
+            DWORD bitIndex;
+            BitScanForward(&bitIndex, ~equalMask & 0xffff);
+            return begin + bitIndex;
+        }
+        begin += 16;
+    }
+#elif defined(TARGET_ARM64)
+    uint8x16_t chunkValue = vdupq_n_u8(value);
+    while ((end - begin) >= 16)
+    {
+        uint8x16_t equalMask = vceqq_u8(vld1q_u8(begin), chunkValue);
+        if (vminvq_u8(equalMask) != 0xff)
+        {
+            // The mismatch is in this chunk, let the byte loop below locate it
+            break;
+        }
+        begin += 16;
+    }
+#endif
+
+    while (begin < end && *begin == value)
+    {
+        ++begin;
+    }
+    return begin;
+}
+
+// Coalesces consecutive dirty pages in the region into ranges, recording for each range its base address and its size in
+// bytes. On input, *dirtyRangeCountRef is the capacity of both arrays; on output, it is the number of ranges recorded.
+// Returns false if the scan stopped early because the arrays filled up; dirty state beyond the end of the last recorded
+// range is left untouched in that case, so the caller can continue the scan from there.
+bool SoftwareWriteWatch::GetDirtyRanges(
+    void *baseAddress,
+    size_t regionByteSize,
+    void **dirtyRangeAddresses,
+    size_t *dirtyRangeByteSizes,
+    size_t *dirtyRangeCountRef,
+    bool clearDirty,
+    bool isRuntimeSuspended)
+{
+    VerifyCreated();
+    VerifyMemoryRegion(baseAddress, regionByteSize);
+    assert(dirtyRangeAddresses != nullptr);
+    assert(dirtyRangeByteSizes != nullptr);
+    assert(dirtyRangeCountRef != nullptr);
+
+    size_t dirtyRangeCapacity = *dirtyRangeCountRef;
+    if (dirtyRangeCapacity == 0)
+    {
+        return false;
+    }
+
+    if (!isRuntimeSuspended)
+    {
+        // When a page is marked as dirty, a memory barrier is not issued after the write most of the time. Issue a memory
+        // barrier on all active threads of the process now to make recent changes to dirty state visible to this thread.
+        GCToOSInterface::FlushProcessWriteBuffers();
+    }
+
+    uint8_t *tableRegionStart;
+    size_t tableRegionByteSize;
+    TranslateToTableRegion(baseAddress, regionByteSize, &tableRegionStart, &tableRegionByteSize);
+    uint8_t *tableRegionEnd = tableRegionStart + tableRegionByteSize;
+
+    size_t dirtyRangeIndex = 0;
+    bool scanCompleted = true;
+    uint8_t *current = tableRegionStart;
+    while (true)
+    {
+        // Skip over clean pages to the start of the next dirty run
+        current = ScanForByteMismatch(current, tableRegionEnd, 0);
+        if (current == tableRegionEnd)
+        {
+            break;
+        }
+
+        uint8_t *runStart = current;
+        current = ScanForByteMismatch(current, tableRegionEnd, 0xff);
+
+        if (clearDirty)
+        {
+            // Clear only the bytes for which pages are recorded as dirty
+            memset(runStart, 0, current - runStart);
+        }
+
+        void *rangeAddress = GetPageAddress(runStart - GetTable());
+        assert(rangeAddress >= GetHeapStartAddress());
+        assert(rangeAddress < GetHeapEndAddress());
+        dirtyRangeAddresses[dirtyRangeIndex] = rangeAddress;
+        dirtyRangeByteSizes[dirtyRangeIndex] = static_cast<size_t>(current - runStart) * WRITE_WATCH_UNIT_SIZE;
+        ++dirtyRangeIndex;
+        if (dirtyRangeIndex == dirtyRangeCapacity)
+        {
+            scanCompleted = current == tableRegionEnd;
+            break;
+        }
+    }
+    *dirtyRangeCountRef = dirtyRangeIndex;
+
+    if (!isRuntimeSuspended && clearDirty && dirtyRangeIndex != 0)
+    {
+        // When dirtying a page, the dirty state of the page is first checked to see if the page is already dirty. If already
+        // dirty, the write to mark it as dirty is skipped. So, when the dirty state of a page is cleared, we need to make sure
+        // the cleared state is visible to other threads that may dirty the page, before marking through objects in the page, so
+        // that the GC will not miss marking through dirtied objects in the page. Issue a memory barrier on all active threads
+        // of the process now.
+        MemoryBarrier(); // flush writes from this thread first to guarantee ordering
+        GCToOSInterface::FlushProcessWriteBuffers();
+    }
+    return scanCompleted;
+}
+
 void SoftwareWriteWatch::GetDirty(
     void *baseAddress,
     size_t regionByteSize,
@@ -77,6 +77,7 @@ private:
     static bool GetDirtyFromBlock(uint8_t *block, uint8_t *firstPageAddressInBlock, size_t startByteIndex, size_t endByteIndex, void **dirtyPages, size_t *dirtyPageIndexRef, size_t dirtyPageCount, bool clearDirty);
 public:
     static void GetDirty(void *baseAddress, size_t regionByteSize, void **dirtyPages, size_t *dirtyPageCountRef, bool clearDirty, bool isRuntimeSuspended);
+    static bool GetDirtyRanges(void *baseAddress, size_t regionByteSize, void **dirtyRangeAddresses, size_t *dirtyRangeByteSizes, size_t *dirtyRangeCountRef, bool clearDirty, bool isRuntimeSuspended);
 };
 
 inline void SoftwareWriteWatch::VerifyCreated()
@@ -92,6 +92,9 @@ extern "C"
 #endif // __APPLE__
 
 #ifdef __linux__
+#include <dirent.h> // opendir, readdir
+#include <stdlib.h> // atoi
+#include <linux/perf_event.h>
 #include <sys/syscall.h> // __NR_membarrier
 // Ensure __NR_membarrier is defined for portable builds.
 # if !defined(__NR_membarrier)
@@ -457,6 +460,133 @@ void GCToOSInterface::FlushProcessWriteBuffers()
 #endif // TARGET_APPLE
 }
 
+#ifdef __linux__
+
+// Ensure __NR_perf_event_open is defined for portable builds.
+#if !defined(__NR_perf_event_open)
+# if defined(__amd64__)
+#  define __NR_perf_event_open 298
+# elif defined(__i386__)
+#  define __NR_perf_event_open 336
+# elif defined(__arm__)
+#  define __NR_perf_event_open 364
+# elif defined(__aarch64__)
+#  define __NR_perf_event_open 241
+# elif defined(__loongarch64)
+#  define __NR_perf_event_open 241
+# else
+#  error Unknown architecture
+# endif
+#endif
+
+// The hardware counter set sampled at GC boundaries; the order matches the
+// output array of GCToOSInterface::ReadHardwareCounters.
+static const uint64_t g_hardwareCounterConfigs[] =
+{
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES
+};
+
+static const int NUM_HARDWARE_COUNTERS = sizeof(g_hardwareCounterConfigs) / sizeof(g_hardwareCounterConfigs[0]);
+static const int MAX_HARDWARE_COUNTER_THREADS = 64;
+static int g_hardwareCounterFds[NUM_HARDWARE_COUNTERS][MAX_HARDWARE_COUNTER_THREADS];
+static int g_hardwareCounterThreadCount = 0;
+
+// Open the hardware performance counter set sampled at GC boundaries.
+// Without elevated privileges perf_event_open can only target individual
+// threads of the current process, so a counter set is opened for every thread
+// present at the time of the call; threads created later are accounted for
+// through counter inheritance from their creating thread.
+bool GCToOSInterface::OpenHardwareCounters()
+{
+    DIR* taskDir = opendir("/proc/self/task");
+    if (taskDir == nullptr)
+        return false;
+
+    int threadCount = 0;
+    struct dirent* entry;
+    while ((entry = readdir(taskDir)) != nullptr && threadCount < MAX_HARDWARE_COUNTER_THREADS)
+    {
+        if (entry->d_name[0] < '0' || entry->d_name[0] > '9')
+            continue;
+
+        pid_t tid = (pid_t)atoi(entry->d_name);
+        bool opened = true;
+        int fds[NUM_HARDWARE_COUNTERS];
+        for (int i = 0; i < NUM_HARDWARE_COUNTERS; i++)
+        {
+            struct perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = g_hardwareCounterConfigs[i];
+            attr.inherit = 1;        // count threads created after this call too
+            attr.exclude_kernel = 1; // no privileges required for user mode only counting
+            attr.exclude_hv = 1;
+
+            fds[i] = (int)syscall(__NR_perf_event_open, &attr, tid, -1 /* any cpu */, -1 /* no group */, 0);
+            if (fds[i] == -1)
+            {
+                // The thread may have exited between readdir and here, or the
+                // kernel/hardware may not support this counter - skip the thread.
+                while (--i >= 0)
+                    close(fds[i]);
+                opened = false;
+                break;
+            }
+        }
+
+        if (opened)
+        {
+            for (int i = 0; i < NUM_HARDWARE_COUNTERS; i++)
+                g_hardwareCounterFds[i][threadCount] = fds[i];
+            threadCount++;
+        }
+    }
+    closedir(taskDir);
+
+    g_hardwareCounterThreadCount = threadCount;
+    return threadCount > 0;
+}
+
+// Read the accumulated values of the counters opened by OpenHardwareCounters,
+// summed across all counted threads.
+bool GCToOSInterface::ReadHardwareCounters(uint64_t counters[4])
+{
+    if (g_hardwareCounterThreadCount == 0)
+        return false;
+
+    for (int i = 0; i < NUM_HARDWARE_COUNTERS; i++)
+    {
+        uint64_t total = 0;
+        for (int t = 0; t < g_hardwareCounterThreadCount; t++)
+        {
+            uint64_t value;
+            if (read(g_hardwareCounterFds[i][t], &value, sizeof(value)) != (ssize_t)sizeof(value))
+                return false;
+            total += value;
+        }
+        counters[i] = total;
+    }
+    return true;
+}
+
+#else // __linux__
+
+bool GCToOSInterface::OpenHardwareCounters()
+{
+    return false;
+}
+
+bool GCToOSInterface::ReadHardwareCounters(uint64_t /* counters */[4])
+{
+    return false;
+}
+
+#endif // __linux__
+
 // Break into a debugger. Uses a compiler intrinsic if one is available,
 // otherwise raises a SIGTRAP.
 void GCToOSInterface::DebugBreak()
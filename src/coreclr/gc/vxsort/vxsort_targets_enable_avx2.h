@@ -6,6 +6,6 @@
 #pragma clang attribute push (__attribute__((target("avx2"))), apply_to = any(function))
 #else
 #pragma GCC push_options
-#pragma GCC target("avx512f")
+#pragma GCC target("avx2")
 #endif
 #endif
@@ -646,6 +646,20 @@ void GCToOSInterface::FlushProcessWriteBuffers()
     ::FlushProcessWriteBuffers();
 }
 
+// Open the hardware performance counter set sampled at GC boundaries.
+// Not supported on Windows; ETW sessions can collect PMC data alongside
+// the runtime events instead.
+bool GCToOSInterface::OpenHardwareCounters()
+{
+    return false;
+}
+
+// Read the accumulated values of the counters opened by OpenHardwareCounters
+bool GCToOSInterface::ReadHardwareCounters(uint64_t /* counters */[4])
+{
+    return false;
+}
+
 // Break into a debugger
 void GCToOSInterface::DebugBreak()
 {
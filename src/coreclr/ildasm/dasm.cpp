@@ -7358,6 +7358,10 @@ FILE* OpenOutput(_In_ __nullterminated const WCHAR* wzFileName)
 
     if(pfile)
     {
+        // The dump is emitted line by line; a sizeable stdio buffer lets the text
+        // reach the OS in large chunks instead of a write per few lines, which
+        // matters when disassembling very large assemblies.
+        setvbuf(pfile,NULL,_IOFBF,1024*1024);
         if(g_uCodePage == CP_UTF8) fwrite("\357\273\277",3,1,pfile);
         else if(g_uCodePage == 0xFFFFFFFF) fwrite("\377\376",2,1,pfile);
     }
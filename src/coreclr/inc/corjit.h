@@ -363,6 +363,21 @@ public:
         void* HandleTable[HandleHistogram32::SIZE];
     };
 
+    // Value histograms store raw pointer-sized values rather than handles.
+    // Entries are always 8 bytes so the serialized format is the same on
+    // all targets.
+    struct ValueHistogram32
+    {
+        uint32_t Count;
+        uint64_t ValueTable[HandleHistogram32::SIZE];
+    };
+
+    struct ValueHistogram64
+    {
+        uint64_t Count;
+        uint64_t ValueTable[HandleHistogram32::SIZE];
+    };
+
     enum class PgoInstrumentationKind
     {
         // This must be kept in sync with PgoInstrumentationKind in PgoFormat.cs
@@ -400,6 +415,9 @@ public:
         EdgeLongCount = (DescriptorMin * 6) | EightByte, // edge counter using unsigned 8 byte int
         GetLikelyClass = (DescriptorMin * 7) | TypeHandle, // Compressed get likely class data
         GetLikelyMethod = (DescriptorMin * 7) | MethodHandle, // Compressed get likely method data
+        ValueHistogramIntCount = (DescriptorMin * 8) | FourByte | Align8Byte, // 4 byte counter that is part of a value histogram. Aligned to match ValueHistogram32's alignment.
+        ValueHistogramLongCount = (DescriptorMin * 8) | EightByte, // 8 byte counter that is part of a value histogram
+        ValueHistogram = (DescriptorMin * 9) | EightByte, // Histogram of raw values
     };
 
     struct PgoInstrumentationSchema
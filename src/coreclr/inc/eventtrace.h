@@ -134,6 +134,11 @@ namespace ETW
         static BOOL s_fHeapAllocHighEventEnabledNow;
         static BOOL s_fHeapAllocLowEventEnabledNow;
 
+        // Same startup/current split for the sampled AllocationSampled event, which
+        // also depends on the slow allocation helpers being chosen at startup.
+        static BOOL s_fAllocationSamplingEnabledOnStartup;
+        static BOOL s_fAllocationSamplingEnabledNow;
+
         // If DOTNET_UNSUPPORTED_ETW_ObjectAllocationEventsPerTypePerSec is set, then
         // this is used to determine the event frequency, overriding
         // s_nDefaultMsBetweenEvents above (regardless of which
@@ -165,6 +170,8 @@ namespace ETW
         static void PostRegistrationInit();
         static BOOL IsHeapAllocEventEnabled();
         static void SendObjectAllocatedEvent(Object * pObject);
+        static BOOL IsAllocationSamplingEnabled();
+        static void SendAllocationSampledEvent(Object * pObject, UINT32 allocationKind);
         static CrstBase * GetHashCrst();
         static VOID LogTypeAndParametersIfNecessary(BulkTypeEventLogger * pBulkTypeEventLogger, ULONGLONG thAsAddr, TypeLogBehavior typeLogBehavior);
         static VOID OnModuleUnload(Module * pModule);
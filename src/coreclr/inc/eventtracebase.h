@@ -889,6 +889,12 @@ namespace ETW
 #endif // FEATURE_EVENT_TRACE
     };
 
+    // Methods collected under the code heap and code versioning locks whose
+    // rundown events are emitted after those locks are released. Both defined
+    // in eventtrace.cpp.
+    struct JitMethodRundownInfo;
+    class JitMethodsRundownSnapshot;
+
     // Class to wrap all Method logic for ETW
     class MethodLog
     {
@@ -903,7 +909,18 @@ namespace ETW
             BOOL fSendMethodEvent,
             BOOL fSendILToNativeMapEvent,
             BOOL fSendRichDebugInfoEvent,
-            BOOL fGetCodeIds);
+            BOOL fGetCodeIds,
+            JitMethodsRundownSnapshot *pSnapshot,
+            MethodDescSet *pSentMethodDetailsSet);
+        static VOID SendEventsForJitMethod(
+            const JitMethodRundownInfo &info,
+            DWORD dwEventOptions,
+            BOOL fLoadOrDCStart,
+            BOOL fUnloadOrDCEnd,
+            BOOL fSendMethodEvent,
+            BOOL fSendILToNativeMapEvent,
+            BOOL fSendRichDebugInfoEvent,
+            MethodDescSet *pSentMethodDetailsSet);
         static VOID SendEventsForNgenMethods(Module *pModule, DWORD dwEventOptions);
         static VOID SendMethodJitStartEvent(MethodDesc *pMethodDesc, SString *namespaceOrClassName=NULL, SString *methodName=NULL, SString *methodSignature=NULL);
         static VOID SendMethodILToNativeMapEvent(MethodDesc * pMethodDesc, DWORD dwEventOptions, PCODE pNativeCodeStartAddress, DWORD nativeCodeId, ReJITID ilCodeId);
@@ -1261,6 +1278,7 @@ namespace ETW
                 static void SendResume(UINT32 newMethodCount);
                 static void SendBackgroundJitStart(UINT32 pendingMethodCount);
                 static void SendBackgroundJitStop(UINT32 pendingMethodCount, UINT32 jittedMethodCount);
+                static void SendOnStackReplacement(UINT64 methodID, UINT32 ilOffset, UINT32 hitCount, UINT64 dwellTimeMs);
 #else
                 static bool IsEnabled() { return false; }
                 static void SendSettings() {}
@@ -1268,6 +1286,7 @@ namespace ETW
                 static void SendResume(UINT32 newMethodCount) {}
                 static void SendBackgroundJitStart(UINT32 pendingMethodCount) {}
                 static void SendBackgroundJitStop(UINT32 pendingMethodCount, UINT32 jittedMethodCount) {}
+                static void SendOnStackReplacement(UINT64 methodID, UINT32 ilOffset, UINT32 hitCount, UINT64 dwellTimeMs) {}
 #endif
 
                 DISABLE_CONSTRUCT_COPY(Runtime);
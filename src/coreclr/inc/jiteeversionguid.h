@@ -43,11 +43,11 @@ typedef const GUID *LPCGUID;
 #define GUID_DEFINED
 #endif // !GUID_DEFINED
 
-constexpr GUID JITEEVersionIdentifier = { /* 236d7997-3d71-45f9-b7d7-5241ad89a56f */
-    0x236d7997,
-    0x3d71,
-    0x45f9,
-    { 0xb7, 0xd7, 0x52, 0x41, 0xad, 0x89, 0xa5, 0x6f }
+constexpr GUID JITEEVersionIdentifier = { /* 9e3c5e04-9a54-4d4f-bd30-e2e01b0f9b2a */
+    0x9e3c5e04,
+    0x9a54,
+    0x4d4f,
+    { 0xbd, 0x30, 0xe2, 0xe0, 0x1b, 0x0f, 0x9b, 0x2a }
   };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -797,6 +797,93 @@ public:
 
 
 
+//===============================================================================
+// An InterleavedStubCache sits in front of an interleaved LoaderHeap and hands
+// out fixed-size stubs (precodes) without taking the heap lock on the typical
+// path. Threads claim stubs from the current slab with a single interlocked
+// compare-exchange; the heap lock is only taken to carve a new slab out of the
+// underlying heap or to recycle stubs that were backed out.
+//
+// The cache implements ILoaderHeapBackout so that AllocMemTracker rollback
+// works exactly as it does for allocations made directly on a LoaderHeap:
+// backed-out stubs are pushed onto a free list (linked through the stub's
+// writable data slot at +GetStubCodePageSize()) and handed out again later.
+//
+// Slab descriptors are retained for the lifetime of the cache and slab memory
+// is never returned to the underlying heap, so a thread racing with a refill
+// can safely operate on a stale descriptor: its claim either fails because the
+// slab is full, or returns a stub that was never handed out before.
+//===============================================================================
+typedef DPTR(class InterleavedStubCache) PTR_InterleavedStubCache;
+class InterleavedStubCache : public ILoaderHeapBackout
+{
+private:
+    struct StubSlab
+    {
+        BYTE *          m_pCur;     // Next unclaimed stub. Only ever moves forward.
+        BYTE *          m_pEnd;     // First byte past the slab. Immutable once published.
+        StubSlab *      m_pNext;    // Older slabs, kept alive so stale readers stay safe.
+    };
+
+    PTR_LoaderHeap      m_pHeap;
+    StubSlab *          m_pSlab;            // Most recently carved slab
+    BYTE *              m_pFreeList;        // Backed out stubs; guarded by m_CriticalSection
+    DWORD               m_dwStubSize;
+    DWORD               m_dwStubsPerSlab;
+    CRITSEC_COOKIE      m_CriticalSection;
+
+#ifndef DACCESS_COMPILE
+public:
+    InterleavedStubCache();
+    virtual ~InterleavedStubCache();
+
+    void Init(LoaderHeap *pHeap, DWORD dwStubSize);
+
+#ifdef _DEBUG
+#define AllocStub()    RealAllocStub( __FILE__, __LINE__ )
+#else
+#define AllocStub()    RealAllocStub()
+#endif
+
+    TaggedMemAllocPtr RealAllocStub(
+#ifdef _DEBUG
+                        _In_ _In_z_ const char *szFile
+                        , int lineNum
+#endif
+                        );
+
+    virtual void RealBackoutMem(void *pMem
+                        , size_t dwSize
+#ifdef _DEBUG
+                        , _In_ _In_z_ const char *szFile
+                        , int lineNum
+                        , _In_ _In_z_ const char *szAllocFile
+                        , int allocLineNum
+#endif
+                        );
+
+private:
+    BYTE *TryClaimFromSlab();
+
+    BYTE **GetFreeListSlot(BYTE *pStub)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // The stub's writable data slot lives one stub code page past the stub
+        // itself. It is fully reinitialized when the stub is handed out again,
+        // so it is free for the cache's use while the stub sits on the free list.
+        return (BYTE **)(pStub + GetStubCodePageSize());
+    }
+#endif // DACCESS_COMPILE
+
+public:
+    DWORD GetStubSize() const
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_dwStubSize;
+    }
+};
+
 
 
 //===============================================================================
@@ -593,6 +593,32 @@ class EMPTY_BASES_DECL SHash : public TRAITS
     count_t       m_tableCount;           // number of elements in table
     count_t       m_tableOccupied;        // number, includes deleted slots
     count_t       m_tableMax;             // maximum occupied count before reallocating
+
+#ifdef SHASH_PROBE_STATS
+  public:
+    // Cumulative probe-length statistics, maintained by Lookup.  Define
+    // SHASH_PROBE_STATS locally when evaluating hash quality or probing
+    // changes; it adds fields to the table (which breaks the layout
+    // contract verified by VerifyLayouts.inc), so it must not be defined
+    // in shipping builds.
+
+    count_t GetLookupCount() const { return m_lookupCount; }
+    count_t GetProbeCount() const { return m_probeCount; }
+    count_t GetMaxProbeLength() const { return m_maxProbeLength; }
+
+  private:
+    void UpdateProbeStats(count_t probes) const
+    {
+        m_lookupCount++;
+        m_probeCount += probes;
+        if (probes > m_maxProbeLength)
+            m_maxProbeLength = probes;
+    }
+
+    mutable count_t m_lookupCount;        // number of lookups performed
+    mutable count_t m_probeCount;         // total slots examined across all lookups
+    mutable count_t m_maxProbeLength;     // longest probe sequence seen
+#endif // SHASH_PROBE_STATS
 };  // class SHash
 
 // disables support for DAC marshaling. Useful for defining right-side only SHashes
@@ -17,6 +17,11 @@ SHash<TRAITS>::SHash()
     m_tableCount(0),
     m_tableOccupied(0),
     m_tableMax(0)
+#ifdef SHASH_PROBE_STATS
+    , m_lookupCount(0)
+    , m_probeCount(0)
+    , m_maxProbeLength(0)
+#endif
 {
     LIMITED_METHOD_CONTRACT;
 
@@ -683,12 +688,25 @@ const typename SHash<TRAITS>::element_t * SHash<TRAITS>::Lookup(PTR_element_t ta
     count_t index = hash % tableSize;
     count_t increment = 0; // delay computation
 
+#ifdef SHASH_PROBE_STATS
+    count_t probes = 0;
+#endif
+
     while (TRUE)
     {
+#ifdef SHASH_PROBE_STATS
+        probes++;
+#endif
+
         element_t& current = table[index];
 
         if (TRAITS::IsNull(current))
+        {
+#ifdef SHASH_PROBE_STATS
+            UpdateProbeStats(probes);
+#endif
             RETURN NULL;
+        }
 
         if (!TRAITS::IsDeleted(current))
         {
@@ -698,6 +716,9 @@ const typename SHash<TRAITS>::element_t * SHash<TRAITS>::Lookup(PTR_element_t ta
             }
             else if (TRAITS::Equals(key, TRAITS::GetKey(current)))
             {
+#ifdef SHASH_PROBE_STATS
+                UpdateProbeStats(probes);
+#endif
                 RETURN &current;
             }
         }
@@ -45,9 +45,12 @@ public:
 #endif //_DEBUG
 
 private:
+    BOOL EnsureReadWaiterSemaphore();   // Create the read waiter semaphore on demand
+    BOOL EnsureWriteWaiterEvent();      // Create the write waiter event on demand
+
     Volatile<ULONG> m_dwFlag;               // internal state, see implementation
-    HANDLE          m_hReadWaiterSemaphore; // semaphore for awakening read waiters
-    HANDLE          m_hWriteWaiterEvent;    // event for awakening write waiters
+    HANDLE          m_hReadWaiterSemaphore; // semaphore for awakening read waiters, created on first contention
+    HANDLE          m_hWriteWaiterEvent;    // event for awakening write waiters, created on first contention
 };  // class UTSemReadWrite
 
 #endif // __UTSEM_H__
@@ -3473,6 +3473,12 @@ void CodeGen::genCodeForCpBlkUnroll(GenTreeBlk* node)
                                ? YMM_REGSIZE_BYTES
                                : XMM_REGSIZE_BYTES;
 
+        if ((size >= ZMM_RECOMMENDED_THRESHOLD) && compiler->compOpportunisticallyDependsOn(InstructionSet_AVX512F))
+        {
+            // Only use ZMM for large copies due to possible CPU throttle issues
+            regSize = ZMM_REGSIZE_BYTES;
+        }
+
         auto emitSimdMovs = [&]() {
             if (srcLclNum != BAD_VAR_NUM)
             {
@@ -3519,6 +3525,12 @@ void CodeGen::genCodeForCpBlkUnroll(GenTreeBlk* node)
                 // if reminder is <=16 then switch to XMM
                 regSize = size <= XMM_REGSIZE_BYTES ? XMM_REGSIZE_BYTES : regSize;
 
+                // likewise, step a ZMM copy down to YMM when the remainder fits it
+                if ((size <= YMM_REGSIZE_BYTES) && (regSize > YMM_REGSIZE_BYTES))
+                {
+                    regSize = YMM_REGSIZE_BYTES;
+                }
+
                 // Rewind dstOffset so we can fit a vector for the while remainder
                 srcOffset -= (regSize - size);
                 dstOffset -= (regSize - size);
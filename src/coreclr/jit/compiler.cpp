@@ -4837,10 +4837,18 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
         //
         DoPhase(this, PHASE_CLONE_LOOPS, &Compiler::optCloneLoops);
 
+        // Vectorize simple counted loops
+        //
+        DoPhase(this, PHASE_VECTORIZE_LOOPS, &Compiler::optVectorizeLoops);
+
         // Unroll loops
         //
         DoPhase(this, PHASE_UNROLL_LOOPS, &Compiler::optUnrollLoops);
 
+        // Strength reduce multiplications of loop iterators by constants.
+        //
+        DoPhase(this, PHASE_STRENGTH_REDUCTION, &Compiler::optStrengthReduceLoops);
+
         // Clear loop table info that is not used after this point, and might become invalid.
         //
         DoPhase(this, PHASE_CLEAR_LOOP_INFO, &Compiler::optClearLoopIterInfo);
@@ -4880,6 +4888,7 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
     if (opts.OptimizationEnabled())
     {
         bool doSsa                     = true;
+        bool doSparseConstProp         = true;
         bool doEarlyProp               = true;
         bool doValueNum                = true;
         bool doLoopHoisting            = true;
@@ -4893,6 +4902,7 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
 
 #if defined(OPT_CONFIG)
         doSsa                     = (JitConfig.JitDoSsa() != 0);
+        doSparseConstProp         = doSsa && (JitConfig.JitDoSparseConstProp() != 0);
         doEarlyProp               = doSsa && (JitConfig.JitDoEarlyProp() != 0);
         doValueNum                = doSsa && (JitConfig.JitDoValueNumber() != 0);
         doLoopHoisting            = doValueNum && (JitConfig.JitDoLoopHoisting() != 0);
@@ -4923,6 +4933,13 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
                 fgLocalVarLiveness();
             }
 
+            if (doSparseConstProp)
+            {
+                // Sparse conditional constant propagation over SSA
+                //
+                DoPhase(this, PHASE_SPARSE_COND_CONST_PROP, &Compiler::optSparseCondConstProp);
+            }
+
             if (doEarlyProp)
             {
                 // Propagate array length and rewrite getType() method call
@@ -8869,6 +8886,7 @@ void JitTimer::PrintCsvHeader()
 #ifdef DEBUG
             fprintf(s_csvFile, "\"Alignment Candidates\",");
             fprintf(s_csvFile, "\"Loops Aligned\",");
+            fprintf(s_csvFile, "\"Alignment Padding Bytes\",");
 #endif // DEBUG
 #endif // FEATURE_LOOP_ALIGN
             for (int i = 0; i < PHASE_NUMBER_OF; i++)
@@ -8946,6 +8964,7 @@ void JitTimer::PrintCsvMethodStats(Compiler* comp)
 #ifdef DEBUG
     fprintf(s_csvFile, "%u,", comp->loopAlignCandidates);
     fprintf(s_csvFile, "%u,", comp->loopsAligned);
+    fprintf(s_csvFile, "%u,", comp->loopAlignPaddingBytes);
 #endif // DEBUG
 #endif // FEATURE_LOOP_ALIGN
     unsigned __int64 totCycles = 0;
@@ -5720,6 +5720,7 @@ public:
     UINT32                                 fgPgoEdgeCounts;
     UINT32                                 fgPgoClassProfiles;
     UINT32                                 fgPgoMethodProfiles;
+    UINT32                                 fgPgoValueProfiles;
     unsigned                               fgPgoInlineePgo;
     unsigned                               fgPgoInlineeNoPgo;
     unsigned                               fgPgoInlineeNoPgoSingleBlock;
@@ -6266,7 +6267,9 @@ public:
 
     PhaseStatus optCloneLoops();
     void optCloneLoop(unsigned loopInd, LoopCloneContext* context);
-    PhaseStatus optUnrollLoops(); // Unrolls loops (needs to have cost info)
+    PhaseStatus optVectorizeLoops();      // Rewrites simple counted loops using SIMD stores
+    PhaseStatus optStrengthReduceLoops(); // Replaces iterator-times-constant multiplies with running additions
+    PhaseStatus optUnrollLoops();    // Unrolls loops (needs to have cost info)
     void        optRemoveRedundantZeroInits();
     PhaseStatus optIfConversion(); // If conversion
 
@@ -6531,8 +6534,9 @@ public:
     }
 
 #ifdef DEBUG
-    unsigned char loopsAligned; // number of loops actually aligned
-#endif                          // DEBUG
+    unsigned char loopsAligned;          // number of loops actually aligned
+    unsigned      loopAlignPaddingBytes; // total bytes of padding emitted to align loops
+#endif                                   // DEBUG
 
     bool optRecordLoop(BasicBlock*   head,
                        BasicBlock*   top,
@@ -6985,6 +6989,7 @@ public:
     void optCopyPropPushDef(GenTree* defNode, GenTreeLclVarCommon* lclNode, LclNumToLiveDefsMap* curSsaName);
     int optCopyProp_LclVarScore(const LclVarDsc* lclVarDsc, const LclVarDsc* copyVarDsc, bool preferOp2);
     PhaseStatus optVnCopyProp();
+    PhaseStatus optSparseCondConstProp();
     INDEBUG(void optDumpCopyPropStack(LclNumToLiveDefsMap* curSsaName));
 
     /**************************************************************************
@@ -7096,7 +7101,10 @@ public:
                  bool                   isInterface,
                  CORINFO_CLASS_HANDLE*  classGuess,
                  CORINFO_METHOD_HANDLE* methodGuess,
-                 unsigned*              likelihood);
+                 unsigned*              likelihood,
+                 CORINFO_CLASS_HANDLE*  extraClassGuesses,
+                 unsigned*              extraLikelihoods,
+                 unsigned*              extraGuessCount);
 
     void considerGuardedDevirtualization(GenTreeCall*            call,
                                          IL_OFFSET               ilOffset,
@@ -7107,12 +7115,16 @@ public:
 
     bool isCompatibleMethodGDV(GenTreeCall* call, CORINFO_METHOD_HANDLE gdvTarget);
 
-    void addGuardedDevirtualizationCandidate(GenTreeCall*          call,
-                                             CORINFO_METHOD_HANDLE methodHandle,
-                                             CORINFO_CLASS_HANDLE  classHandle,
-                                             unsigned              methodAttr,
-                                             unsigned              classAttr,
-                                             unsigned              likelihood);
+    void addGuardedDevirtualizationCandidate(GenTreeCall*           call,
+                                             CORINFO_METHOD_HANDLE  methodHandle,
+                                             CORINFO_CLASS_HANDLE   classHandle,
+                                             unsigned               methodAttr,
+                                             unsigned               classAttr,
+                                             unsigned               likelihood,
+                                             CORINFO_CONTEXT_HANDLE originalContext,
+                                             CORINFO_CLASS_HANDLE*  extraClasses,
+                                             unsigned*              extraLikelihoods,
+                                             unsigned               extraGuessCount);
 
     bool doesMethodHaveExpRuntimeLookup()
     {
@@ -8882,10 +8894,11 @@ public:
         {
             maxRegSize = maxSIMDStructBytes();
 #if defined(TARGET_XARCH)
-            if (type != UnrollKind::Memmove)
+            if (type == UnrollKind::Memset)
             {
-                // TODO-XARCH-AVX512: Consider enabling this for AVX512 where it's beneficial.
-                // Enabled for Memmove only for now.
+                // Initialization unrolls broadcast the fill value with at most YMM-wide
+                // stores (see genCodeForInitBlkUnroll), so don't scale the memset
+                // threshold past that.
                 maxRegSize = min(maxRegSize, YMM_REGSIZE_BYTES);
             }
             threshold = maxRegSize;
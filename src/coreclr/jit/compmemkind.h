@@ -57,6 +57,7 @@ CompMemKindMacro(VariableLiveRanges)
 CompMemKindMacro(ClassLayout)
 CompMemKindMacro(TailMergeThrows)
 CompMemKindMacro(EarlyProp)
+CompMemKindMacro(SparseConstProp)
 CompMemKindMacro(ZeroInit)
 CompMemKindMacro(Pgo)
 //clang-format on
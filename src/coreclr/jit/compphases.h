@@ -65,7 +65,9 @@ CompPhaseNameMacro(PHASE_SET_BLOCK_WEIGHTS,          "Set block weights",
 CompPhaseNameMacro(PHASE_ZERO_INITS,                 "Redundant zero Inits",           false, -1, false)
 CompPhaseNameMacro(PHASE_FIND_LOOPS,                 "Find loops",                     false, -1, false)
 CompPhaseNameMacro(PHASE_CLONE_LOOPS,                "Clone loops",                    false, -1, false)
+CompPhaseNameMacro(PHASE_VECTORIZE_LOOPS,            "Vectorize loops",                false, -1, false)
 CompPhaseNameMacro(PHASE_UNROLL_LOOPS,               "Unroll loops",                   false, -1, false)
+CompPhaseNameMacro(PHASE_STRENGTH_REDUCTION,         "Strength reduce IVs",            false, -1, false)
 CompPhaseNameMacro(PHASE_CLEAR_LOOP_INFO,            "Clear loop info",                false, -1, false)
 CompPhaseNameMacro(PHASE_MORPH_MDARR,                "Morph array ops",                false, -1, false)
 CompPhaseNameMacro(PHASE_HOIST_LOOP_CODE,            "Hoist loop code",                false, -1, false)
@@ -80,6 +82,7 @@ CompPhaseNameMacro(PHASE_BUILD_SSA_LIVENESS,         "SSA: liveness",
 CompPhaseNameMacro(PHASE_BUILD_SSA_DF,               "SSA: DF",                        false, PHASE_BUILD_SSA, false)
 CompPhaseNameMacro(PHASE_BUILD_SSA_INSERT_PHIS,      "SSA: insert phis",               false, PHASE_BUILD_SSA, false)
 CompPhaseNameMacro(PHASE_BUILD_SSA_RENAME,           "SSA: rename",                    false, PHASE_BUILD_SSA, false)
+CompPhaseNameMacro(PHASE_SPARSE_COND_CONST_PROP,     "Sparse conditional const prop",  false, -1, false)
 CompPhaseNameMacro(PHASE_EARLY_PROP,                 "Early Value Propagation",        false, -1, false)
 CompPhaseNameMacro(PHASE_VALUE_NUMBER,               "Do value numbering",             false, -1, false)
 CompPhaseNameMacro(PHASE_OPTIMIZE_INDEX_CHECKS,      "Optimize index checks",          false, -1, false)
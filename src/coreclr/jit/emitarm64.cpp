@@ -16180,6 +16180,84 @@ bool emitter::IsRedundantLdStr(
     return false;
 }
 
+//-----------------------------------------------------------------------------------
+// RemoveOverwrittenStr: Remove a previously-emitted "str" instruction if the
+//    current store overwrites the same location, making the previous store dead.
+//
+//    str x1,  [x2, #56]   <-- dead, will be removed
+//    str x3,  [x2, #56]
+//
+// Arguments:
+//    ins  - The current instruction
+//    reg1 - The current value register
+//    reg2 - The current base register
+//    imm  - Immediate offset
+//    size - Operand size
+//    fmt  - Format of instruction
+//
+// Return Value:
+//    true if the previous instruction was removed. The current instruction still
+//    needs to be emitted.
+//
+// Notes:
+//    Coalescing adjacent non-volatile stores is permitted by the memory model;
+//    volatile stores use "stlr" and so never match here. The caller is expected
+//    to have ruled out GC values: removing a store to a tracked GC slot would
+//    move the point at which the slot's contents become scannable.
+//
+bool emitter::RemoveOverwrittenStr(
+    instruction ins, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt)
+{
+    if ((ins != INS_str) || (emitLastIns->idIns() != INS_str))
+    {
+        return false;
+    }
+
+    if (emitLastIns->idGCref() != GCT_NONE)
+    {
+        return false;
+    }
+
+    regNumber prevReg2   = emitLastIns->idReg2();
+    insFormat lastInsfmt = emitLastIns->idInsFmt();
+    emitAttr  prevSize   = emitLastIns->idOpSize();
+    ssize_t   prevImm    = emitGetInsSC(emitLastIns);
+
+    // Only optimize if:
+    // 1. "base" or "base plus immediate offset" addressing modes.
+    // 2. Addressing mode matches with previous instruction.
+    // 3. The operand size matches with previous instruction
+    if (((fmt != IF_LS_2A) && (fmt != IF_LS_2B)) || (fmt != lastInsfmt) || (prevSize != size))
+    {
+        return false;
+    }
+
+    if ((prevReg2 != reg2) || (prevImm != imm))
+    {
+        // Not the same location.
+        return false;
+    }
+
+    // Don't remove instructions whilst in prologs or epilogs, as these contain "unwindable"
+    // parts, where we need to report unwind codes to the OS.
+    if (emitIGisInProlog(emitCurIG) || emitIGisInEpilog(emitCurIG))
+    {
+        return false;
+    }
+#ifdef FEATURE_EH_FUNCLETS
+    if (emitIGisInFuncletProlog(emitCurIG) || emitIGisInFuncletEpilog(emitCurIG))
+    {
+        return false;
+    }
+#endif
+
+    JITDUMP("\n -- removing previous 'str reg%u [reg%u, #%u]' as it is overwritten by 'str reg%u [reg%u, #%u]'.\n",
+            emitLastIns->idReg1(), prevReg2, prevImm, reg1, reg2, imm);
+
+    emitRemoveLastInstruction();
+    return true;
+}
+
 //-----------------------------------------------------------------------------------
 // ReplaceLdrStrWithPairInstr: Potentially, overwrite a previously-emitted "ldr" or "str"
 //                             instruction with an "ldp" or "stp" instruction.
@@ -126,6 +126,7 @@ bool IsRedundantMov(instruction ins, emitAttr size, regNumber dst, regNumber src
 
 // Methods to optimize a Ldr or Str with an alternative instruction.
 bool IsRedundantLdStr(instruction ins, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt);
+bool RemoveOverwrittenStr(instruction ins, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt);
 RegisterOrder IsOptimizableLdrStrWithPair(
     instruction ins, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt);
 bool ReplaceLdrStrWithPairInstr(
@@ -157,6 +158,16 @@ inline bool OptimizeLdrStr(instruction ins,
         return true;
     }
 
+    // Is the previous instruction a store to the same location that this store
+    // makes dead? If so, remove it. Stay away from GC values; removing a store
+    // would move the point at which the slot's GC lifetime is updated. The
+    // current instruction still needs to be emitted, and removal clears the
+    // last-instruction state, so stop here.
+    if (!EA_IS_GCREF_OR_BYREF(reg1Attr) && RemoveOverwrittenStr(ins, reg1, reg2, imm, size, fmt))
+    {
+        return false;
+    }
+
     // Register 2 needs conversion to unencoded value for following optimisation checks.
     reg2 = encodingZRtoSP(reg2);
 
@@ -11918,6 +11918,7 @@ BYTE* emitter::emitOutputAlign(insGroup* ig, instrDesc* id, BYTE* dst)
     }
 
     emitComp->loopsAligned++;
+    emitComp->loopAlignPaddingBytes += paddingToAdd;
 #endif
 
 #ifdef DEBUG
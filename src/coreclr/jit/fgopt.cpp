@@ -6002,6 +6002,41 @@ bool Compiler::fgReorderBlocks(bool useProfile)
 #endif // DEBUG
     }
 
+#ifdef DEBUG
+    // When profile data drove the layout, report how much branch weight now falls
+    // through, so different orderings can be compared from the jit dump.
+    if (verbose && useProfile && fgIsUsingProfileWeights())
+    {
+        weight_t fallThroughWeight = BB_ZERO_WEIGHT;
+        weight_t totalBranchWeight = BB_ZERO_WEIGHT;
+
+        for (BasicBlock* const b : Blocks())
+        {
+            const unsigned numSucc = b->NumSucc(this);
+            for (unsigned i = 0; i < numSucc; i++)
+            {
+                BasicBlock* const succ = b->GetSucc(i, this);
+                FlowEdge* const   edge = fgGetPredForBlock(succ, b);
+                if (edge == nullptr)
+                {
+                    continue;
+                }
+                totalBranchWeight += edge->edgeWeightMin();
+                if (succ == b->bbNext)
+                {
+                    fallThroughWeight += edge->edgeWeightMin();
+                }
+            }
+        }
+
+        if (totalBranchWeight > BB_ZERO_WEIGHT)
+        {
+            printf("fgReorderBlocks: fall-through weight " FMT_WT " of " FMT_WT " (%.1f%%)\n", fallThroughWeight,
+                   totalBranchWeight, 100.0 * fallThroughWeight / totalBranchWeight);
+        }
+    }
+#endif // DEBUG
+
     return changed;
 }
 #ifdef _PREFAST_
@@ -2201,6 +2201,191 @@ private:
     }
 };
 
+//------------------------------------------------------------------------
+// IsValueProfilingCandidate: check if a call is a helper call whose result
+//   is worth value profiling
+//
+// Arguments:
+//   compiler -- compiler instance
+//   call -- call to check
+//
+// Returns:
+//   true if the call is an idempotent helper call returning a pointer-sized
+//   value that tends to be invariant at a given call site.
+//
+static bool IsValueProfilingCandidate(Compiler* compiler, GenTreeCall* call)
+{
+    if (call->gtCallType != CT_HELPER)
+    {
+        return false;
+    }
+
+    switch (compiler->eeGetHelperNum(call->gtCallMethHnd))
+    {
+        // Statics base accesses. The base address for a given call site is
+        // invariant once the class is initialized; thread statics are
+        // excluded as their base varies per thread.
+        case CORINFO_HELP_GETSHARED_GCSTATIC_BASE:
+        case CORINFO_HELP_GETSHARED_NONGCSTATIC_BASE:
+        case CORINFO_HELP_GETSHARED_GCSTATIC_BASE_NOCTOR:
+        case CORINFO_HELP_GETSHARED_NONGCSTATIC_BASE_NOCTOR:
+        // typeof() and friends.
+        case CORINFO_HELP_TYPEHANDLE_TO_RUNTIMETYPE:
+            break;
+
+        default:
+            return false;
+    }
+
+    return call->TypeIs(TYP_REF, TYP_BYREF, TYP_I_IMPL);
+}
+
+//------------------------------------------------------------------------
+// ValueHistogramProbeVisitor: invoke functor on each idempotent helper
+//   call in a tree whose result is a value profiling candidate
+//
+template <class TFunctor>
+class ValueHistogramProbeVisitor final : public GenTreeVisitor<ValueHistogramProbeVisitor<TFunctor>>
+{
+public:
+    enum
+    {
+        DoPreOrder = true
+    };
+
+    TFunctor& m_functor;
+    Compiler* m_compiler;
+
+    ValueHistogramProbeVisitor(Compiler* compiler, TFunctor& functor)
+        : GenTreeVisitor<ValueHistogramProbeVisitor>(compiler), m_functor(functor), m_compiler(compiler)
+    {
+    }
+    Compiler::fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+    {
+        GenTree* const node = *use;
+        if (node->IsCall() && IsValueProfilingCandidate(m_compiler, node->AsCall()))
+        {
+            // The functor may wrap the call; don't walk into the replacement.
+            //
+            m_functor(m_compiler, use);
+            return Compiler::WALK_SKIP_SUBTREES;
+        }
+
+        return Compiler::WALK_CONTINUE;
+    }
+};
+
+//------------------------------------------------------------------------
+// BuildValueHistogramProbeSchemaGen: functor that creates value probe schema elements
+//
+class BuildValueHistogramProbeSchemaGen
+{
+private:
+    Schema&   m_schema;
+    unsigned& m_schemaCount;
+    IL_OFFSET m_ilOffset;
+
+public:
+    BuildValueHistogramProbeSchemaGen(Schema& schema, unsigned& schemaCount)
+        : m_schema(schema), m_schemaCount(schemaCount), m_ilOffset(BAD_IL_OFFSET)
+    {
+    }
+
+    void SetCurrentILOffset(IL_OFFSET ilOffset)
+    {
+        m_ilOffset = ilOffset;
+    }
+
+    void operator()(Compiler* compiler, GenTree** use)
+    {
+        ICorJitInfo::PgoInstrumentationSchema schemaElem = {};
+        schemaElem.Count                                 = 1;
+        schemaElem.InstrumentationKind                   = compiler->opts.compCollect64BitCounts
+                                             ? ICorJitInfo::PgoInstrumentationKind::ValueHistogramLongCount
+                                             : ICorJitInfo::PgoInstrumentationKind::ValueHistogramIntCount;
+        schemaElem.ILOffset = (int32_t)m_ilOffset;
+        schemaElem.Offset   = 0;
+
+        m_schema.push_back(schemaElem);
+        m_schemaCount++;
+
+        schemaElem.InstrumentationKind = ICorJitInfo::PgoInstrumentationKind::ValueHistogram;
+        schemaElem.Count               = ICorJitInfo::HandleHistogram32::SIZE;
+        m_schema.push_back(schemaElem);
+        m_schemaCount++;
+    }
+};
+
+//------------------------------------------------------------------------
+// ValueHistogramProbeInserter: functor that adds value probe instrumentation
+//
+class ValueHistogramProbeInserter
+{
+    Schema&  m_schema;
+    uint8_t* m_profileMemory;
+    int*     m_currentSchemaIndex;
+
+public:
+    ValueHistogramProbeInserter(Schema& schema, uint8_t* profileMemory, int* pCurrentSchemaIndex)
+        : m_schema(schema), m_profileMemory(profileMemory), m_currentSchemaIndex(pCurrentSchemaIndex)
+    {
+    }
+
+    void operator()(Compiler* compiler, GenTree** use)
+    {
+        if (*m_currentSchemaIndex + 2 > (int)m_schema.size())
+        {
+            return;
+        }
+
+        const ICorJitInfo::PgoInstrumentationSchema& countEntry = m_schema[*m_currentSchemaIndex];
+
+        const bool is32 =
+            countEntry.InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::ValueHistogramIntCount;
+        const bool is64 =
+            countEntry.InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::ValueHistogramLongCount;
+        if (!is32 && !is64)
+        {
+            return;
+        }
+
+        assert(m_schema[*m_currentSchemaIndex + 1].InstrumentationKind ==
+               ICorJitInfo::PgoInstrumentationKind::ValueHistogram);
+
+        uint8_t* const histogram = m_profileMemory + countEntry.Offset;
+        *m_currentSchemaIndex += 2;
+
+        GenTreeCall* const call = (*use)->AsCall();
+
+        JITDUMP("Adding value probe for helper call [%06u]\n", compiler->dspTreeID(call));
+
+        // We transform the use of the helper call from (CALL helper ...) to
+        //
+        //      (COMMA
+        //        (ASG tmp, (CALL helper ...))
+        //        (COMMA
+        //          (CALL probe_fn tmp, &probeEntry)
+        //          tmp))
+        //
+        const var_types type   = call->TypeGet();
+        unsigned const  tmpNum = compiler->lvaGrabTemp(true DEBUGARG("value histogram profile tmp"));
+        compiler->lvaTable[tmpNum].lvType = type;
+
+        GenTree* const tmpNode     = compiler->gtNewLclvNode(tmpNum, type);
+        GenTree* const profileNode = compiler->gtNewIconNode((ssize_t)histogram, TYP_I_IMPL);
+        GenTree* const helperCallNode =
+            compiler->gtNewHelperCallNode(is32 ? CORINFO_HELP_VALUEPROFILE32 : CORINFO_HELP_VALUEPROFILE64, TYP_VOID,
+                                          tmpNode, profileNode);
+
+        GenTree* const tmpNode2      = compiler->gtNewLclvNode(tmpNum, type);
+        GenTree* const callCommaNode = compiler->gtNewOperNode(GT_COMMA, type, helperCallNode, tmpNode2);
+        GenTree* const tmpNode3      = compiler->gtNewLclvNode(tmpNum, type);
+        GenTree* const asgNode       = compiler->gtNewOperNode(GT_ASG, type, tmpNode3, call);
+
+        *use = compiler->gtNewOperNode(GT_COMMA, type, asgNode, callCommaNode);
+    }
+};
+
 //------------------------------------------------------------------------
 // HandleHistogramProbeInstrumentor: instrumentor that adds a class probe to each
 //   virtual call in the basic block
@@ -2253,7 +2438,10 @@ void HandleHistogramProbeInstrumentor::Prepare(bool isPreImport)
 //
 void HandleHistogramProbeInstrumentor::BuildSchemaElements(BasicBlock* block, Schema& schema)
 {
-    if ((block->bbFlags & BBF_HAS_HISTOGRAM_PROFILE) == 0)
+    const bool hasHandleProbes = (block->bbFlags & BBF_HAS_HISTOGRAM_PROFILE) != 0;
+    const bool doValueProbes   = (JitConfig.JitValueProfiling() > 0);
+
+    if (!hasHandleProbes && !doValueProbes)
     {
         return;
     }
@@ -2264,11 +2452,27 @@ void HandleHistogramProbeInstrumentor::BuildSchemaElements(BasicBlock* block, Sc
 
     // Scan the statements and identify the class probes
     //
-    BuildHandleHistogramProbeSchemaGen                              schemaGen(schema, m_schemaCount);
-    HandleHistogramProbeVisitor<BuildHandleHistogramProbeSchemaGen> visitor(m_comp, schemaGen);
-    for (Statement* const stmt : block->Statements())
+    if (hasHandleProbes)
     {
-        visitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+        BuildHandleHistogramProbeSchemaGen                              schemaGen(schema, m_schemaCount);
+        HandleHistogramProbeVisitor<BuildHandleHistogramProbeSchemaGen> visitor(m_comp, schemaGen);
+        for (Statement* const stmt : block->Statements())
+        {
+            visitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+        }
+    }
+
+    // Scan the statements and identify the value probes
+    //
+    if (doValueProbes)
+    {
+        BuildValueHistogramProbeSchemaGen                              valueSchemaGen(schema, m_schemaCount);
+        ValueHistogramProbeVisitor<BuildValueHistogramProbeSchemaGen> valueVisitor(m_comp, valueSchemaGen);
+        for (Statement* const stmt : block->Statements())
+        {
+            valueSchemaGen.SetCurrentILOffset(stmt->GetDebugInfo().GetLocation().GetOffset());
+            valueVisitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+        }
     }
 }
 
@@ -2282,7 +2486,10 @@ void HandleHistogramProbeInstrumentor::BuildSchemaElements(BasicBlock* block, Sc
 //
 void HandleHistogramProbeInstrumentor::Instrument(BasicBlock* block, Schema& schema, uint8_t* profileMemory)
 {
-    if ((block->bbFlags & BBF_HAS_HISTOGRAM_PROFILE) == 0)
+    const bool hasHandleProbes = (block->bbFlags & BBF_HAS_HISTOGRAM_PROFILE) != 0;
+    const bool doValueProbes   = (JitConfig.JitValueProfiling() > 0);
+
+    if (!hasHandleProbes && !doValueProbes)
     {
         return;
     }
@@ -2292,16 +2499,31 @@ void HandleHistogramProbeInstrumentor::Instrument(BasicBlock* block, Schema& sch
     //
     JITDUMP("Scanning for calls to profile in " FMT_BB "\n", block->bbNum);
 
+    int histogramSchemaIndex = block->bbHistogramSchemaIndex;
+    assert((histogramSchemaIndex >= 0) && (histogramSchemaIndex <= (int)schema.size()));
+
     // Scan the statements and add class probes
     //
-    int histogramSchemaIndex = block->bbHistogramSchemaIndex;
-    assert((histogramSchemaIndex >= 0) && (histogramSchemaIndex < (int)schema.size()));
+    if (hasHandleProbes)
+    {
+        HandleHistogramProbeInserter insertProbes(schema, profileMemory, &histogramSchemaIndex, m_instrCount);
+        HandleHistogramProbeVisitor<HandleHistogramProbeInserter> visitor(m_comp, insertProbes);
+        for (Statement* const stmt : block->Statements())
+        {
+            visitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+        }
+    }
 
-    HandleHistogramProbeInserter insertProbes(schema, profileMemory, &histogramSchemaIndex, m_instrCount);
-    HandleHistogramProbeVisitor<HandleHistogramProbeInserter> visitor(m_comp, insertProbes);
-    for (Statement* const stmt : block->Statements())
+    // Scan the statements and add value probes
+    //
+    if (doValueProbes)
     {
-        visitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+        ValueHistogramProbeInserter insertValueProbes(schema, profileMemory, &histogramSchemaIndex);
+        ValueHistogramProbeVisitor<ValueHistogramProbeInserter> valueVisitor(m_comp, insertValueProbes);
+        for (Statement* const stmt : block->Statements())
+        {
+            valueVisitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+        }
     }
 }
 
@@ -2364,7 +2586,8 @@ PhaseStatus Compiler::fgPrepareToInstrumentMethod()
     const bool useClassProfiles    = (JitConfig.JitClassProfiling() > 0);
     const bool useDelegateProfiles = (JitConfig.JitDelegateProfiling() > 0);
     const bool useVTableProfiles   = (JitConfig.JitVTableProfiling() > 0);
-    if (!prejit && (useClassProfiles || useDelegateProfiles || useVTableProfiles))
+    const bool useValueProfiles    = (JitConfig.JitValueProfiling() > 0);
+    if (!prejit && (useClassProfiles || useDelegateProfiles || useVTableProfiles || useValueProfiles))
     {
         fgHistogramInstrumentor = new (this, CMK_Pgo) HandleHistogramProbeInstrumentor(this);
     }
@@ -2649,6 +2872,19 @@ PhaseStatus Compiler::fgIncorporateProfileData()
 
                 __fallthrough;
 
+            case ICorJitInfo::PgoInstrumentationKind::ValueHistogramIntCount:
+            case ICorJitInfo::PgoInstrumentationKind::ValueHistogramLongCount:
+                if ((iSchema + 1 < fgPgoSchemaCount) &&
+                    (fgPgoSchema[iSchema + 1].InstrumentationKind ==
+                     ICorJitInfo::PgoInstrumentationKind::ValueHistogram))
+                {
+                    fgPgoValueProfiles++;
+                    iSchema++;
+                    break;
+                }
+
+                __fallthrough;
+
             default:
                 JITDUMP("Unknown PGO record type 0x%x in schema entry %u (offset 0x%x count 0x%x other 0x%x)\n",
                         fgPgoSchema[iSchema].InstrumentationKind, iSchema, fgPgoSchema[iSchema].ILOffset,
@@ -2664,8 +2900,75 @@ PhaseStatus Compiler::fgIncorporateProfileData()
     }
 
     JITDUMP("Profile summary: %d runs, %d block probes, %d edge probes, %d class profiles, %d method profiles, %d "
-            "other records\n",
-            fgNumProfileRuns, fgPgoBlockCounts, fgPgoEdgeCounts, fgPgoClassProfiles, fgPgoMethodProfiles, otherRecords);
+            "value profiles, %d other records\n",
+            fgNumProfileRuns, fgPgoBlockCounts, fgPgoEdgeCounts, fgPgoClassProfiles, fgPgoMethodProfiles,
+            fgPgoValueProfiles, otherRecords);
+
+#ifdef DEBUG
+    // Show what the value profiles say, and how dominant the most common
+    // value at each site is. We do not yet transform based on this.
+    //
+    if (verbose && (fgPgoValueProfiles > 0))
+    {
+        for (UINT32 iSchema = 0; iSchema + 1 < fgPgoSchemaCount; iSchema++)
+        {
+            const ICorJitInfo::PgoInstrumentationSchema& countEntry = fgPgoSchema[iSchema];
+            const ICorJitInfo::PgoInstrumentationSchema& tableEntry = fgPgoSchema[iSchema + 1];
+
+            const bool isValueCount =
+                (countEntry.InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::ValueHistogramIntCount) ||
+                (countEntry.InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::ValueHistogramLongCount);
+
+            if (!isValueCount ||
+                (tableEntry.InstrumentationKind != ICorJitInfo::PgoInstrumentationKind::ValueHistogram))
+            {
+                continue;
+            }
+
+            uint64_t* const values    = (uint64_t*)(fgPgoData + tableEntry.Offset);
+            unsigned const  numValues = (unsigned)tableEntry.Count;
+
+            // Find the most frequently observed value.
+            //
+            uint64_t dominantValue = 0;
+            unsigned dominantCount = 0;
+            unsigned totalCount    = 0;
+
+            for (unsigned i = 0; i < numValues; i++)
+            {
+                if (values[i] == 0)
+                {
+                    continue;
+                }
+
+                totalCount++;
+
+                unsigned count = 0;
+                for (unsigned j = 0; j < numValues; j++)
+                {
+                    if (values[j] == values[i])
+                    {
+                        count++;
+                    }
+                }
+
+                if (count > dominantCount)
+                {
+                    dominantCount = count;
+                    dominantValue = values[i];
+                }
+            }
+
+            if (totalCount > 0)
+            {
+                printf("Value profile at IL offset 0x%x: dominant value 0x%llx (%u/%u samples)\n",
+                       countEntry.ILOffset, (unsigned long long)dominantValue, dominantCount, totalCount);
+            }
+
+            iSchema++;
+        }
+    }
+#endif // DEBUG
 
     const bool haveBlockCounts = fgPgoBlockCounts > 0;
     const bool haveEdgeCounts  = fgPgoEdgeCounts > 0;
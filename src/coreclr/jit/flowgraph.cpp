@@ -71,7 +71,15 @@ PhaseStatus Compiler::fgInsertGCPolls()
 {
     PhaseStatus result = PhaseStatus::MODIFIED_NOTHING;
 
-    if ((optMethodFlags & OMF_NEEDS_GCPOLLS) == 0)
+    // Optionally poll at loop back edge sources in Tier0 methods, so threads
+    // stuck in Tier0 loops reach a GC safe point without needing to be
+    // hijacked or redirected. Tiering soon replaces such code with optimized
+    // code, so the extra polls are a transient cost.
+    //
+    const bool pollBackEdges = opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0) && compHasBackwardJump &&
+                               (JitConfig.TC_BackEdgeGCPolls() > 0);
+
+    if (((optMethodFlags & OMF_NEEDS_GCPOLLS) == 0) && !pollBackEdges)
     {
         return result;
     }
@@ -86,7 +94,17 @@ PhaseStatus Compiler::fgInsertGCPolls()
 
         // When optimizations are enabled, we can't rely on BBF_HAS_SUPPRESSGC_CALL flag:
         // the call could've been moved, e.g., hoisted from a loop, CSE'd, etc.
-        if (opts.OptimizationDisabled() ? ((block->bbFlags & BBF_HAS_SUPPRESSGC_CALL) == 0) : !blockNeedsGCPoll(block))
+        bool blockNeedsPoll = ((optMethodFlags & OMF_NEEDS_GCPOLLS) != 0) &&
+                              (opts.OptimizationDisabled() ? ((block->bbFlags & BBF_HAS_SUPPRESSGC_CALL) != 0)
+                                                           : blockNeedsGCPoll(block));
+
+        if (!blockNeedsPoll && pollBackEdges && block->KindIs(BBJ_COND, BBJ_ALWAYS) &&
+            ((block->bbFlags & BBF_BACKWARD_JUMP_SOURCE) != 0))
+        {
+            blockNeedsPoll = true;
+        }
+
+        if (!blockNeedsPoll)
         {
             continue;
         }
@@ -5541,17 +5541,25 @@ void Compiler::addFatPointerCandidate(GenTreeCall* call)
 //    classGuess  - [out] the class to guess for (mutually exclusive with methodGuess)
 //    methodGuess - [out] the method to guess for (mutually exclusive with classGuess)
 //    likelihood  - [out] an estimate of the likelihood that the guess will succeed
+//    extraClassGuesses - [out] additional, less likely classes to guess for
+//        (array of GuardedDevirtualizationCandidateInfo::maxExtraGuesses entries)
+//    extraLikelihoods  - [out] likelihood estimates for the extra class guesses
+//    extraGuessCount   - [out] number of extra class guesses returned
 //
 void Compiler::pickGDV(GenTreeCall*           call,
                        IL_OFFSET              ilOffset,
                        bool                   isInterface,
                        CORINFO_CLASS_HANDLE*  classGuess,
                        CORINFO_METHOD_HANDLE* methodGuess,
-                       unsigned*              likelihood)
+                       unsigned*              likelihood,
+                       CORINFO_CLASS_HANDLE*  extraClassGuesses,
+                       unsigned*              extraLikelihoods,
+                       unsigned*              extraGuessCount)
 {
-    *classGuess  = NO_CLASS_HANDLE;
-    *methodGuess = NO_METHOD_HANDLE;
-    *likelihood  = 0;
+    *classGuess      = NO_CLASS_HANDLE;
+    *methodGuess     = NO_METHOD_HANDLE;
+    *likelihood      = 0;
+    *extraGuessCount = 0;
 
     const int               maxLikelyClasses = 32;
     LikelyClassMethodRecord likelyClasses[maxLikelyClasses];
@@ -5676,6 +5684,26 @@ void Compiler::pickGDV(GenTreeCall*           call,
         {
             *classGuess = (CORINFO_CLASS_HANDLE)likelyClasses[0].handle;
             *likelihood = likelyClasses[0].likelihood;
+
+            // For polymorphic sites, see if it's worth guessing for the next
+            // most likely classes as well. These expand into chained guards
+            // with direct (non-inlined) calls, so the bar is lower than for
+            // the primary guess, but each still needs to be reasonably likely.
+            //
+            const unsigned maxGuesses = (unsigned)JitConfig.JitGuardedDevirtualizationMaxGuesses();
+            const unsigned extraLikelihoodThreshold = 10;
+            for (unsigned i = 1; (i < numberOfClasses) && (i < maxGuesses) &&
+                                 (*extraGuessCount < GuardedDevirtualizationCandidateInfo::maxExtraGuesses);
+                 i++)
+            {
+                if (likelyClasses[i].likelihood < extraLikelihoodThreshold)
+                {
+                    break;
+                }
+                extraClassGuesses[*extraGuessCount] = (CORINFO_CLASS_HANDLE)likelyClasses[i].handle;
+                extraLikelihoods[*extraGuessCount]  = likelyClasses[i].likelihood;
+                (*extraGuessCount)++;
+            }
             return;
         }
 
@@ -5823,7 +5851,11 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
     CORINFO_CLASS_HANDLE  likelyClass;
     CORINFO_METHOD_HANDLE likelyMethod;
     unsigned              likelihood;
-    pickGDV(call, ilOffset, isInterface, &likelyClass, &likelyMethod, &likelihood);
+    CORINFO_CLASS_HANDLE  extraClasses[GuardedDevirtualizationCandidateInfo::maxExtraGuesses];
+    unsigned              extraLikelihoods[GuardedDevirtualizationCandidateInfo::maxExtraGuesses];
+    unsigned              extraGuessCount = 0;
+    pickGDV(call, ilOffset, isInterface, &likelyClass, &likelyMethod, &likelihood, extraClasses, extraLikelihoods,
+            &extraGuessCount);
 
     if ((likelyClass == NO_CLASS_HANDLE) && (likelyMethod == NO_METHOD_HANDLE))
     {
@@ -5862,6 +5894,40 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
         }
 
         likelyMethod = dvInfo.devirtualizedMethod;
+
+        // Validate any extra class guesses the same way. Skip guesses that are
+        // abstract (stale profile), that are value classes (the unboxed entry
+        // dance is only done for the primary guess), or that we can't resolve.
+        //
+        unsigned validExtraGuessCount = 0;
+        for (unsigned i = 0; i < extraGuessCount; i++)
+        {
+            const uint32_t extraClassAttribs = info.compCompHnd->getClassAttribs(extraClasses[i]);
+
+            if ((extraClassAttribs & (CORINFO_FLG_ABSTRACT | CORINFO_FLG_VALUECLASS)) != 0)
+            {
+                JITDUMP("Not guessing for extra class %u; abstract or value class\n", i + 1);
+                continue;
+            }
+
+            CORINFO_DEVIRTUALIZATION_INFO extraDvInfo;
+            extraDvInfo.virtualMethod               = baseMethod;
+            extraDvInfo.objClass                    = extraClasses[i];
+            extraDvInfo.context                     = *pContextHandle;
+            extraDvInfo.exactContext                = *pContextHandle;
+            extraDvInfo.pResolvedTokenVirtualMethod = nullptr;
+
+            if (!info.compCompHnd->resolveVirtualMethod(&extraDvInfo))
+            {
+                JITDUMP("Can't figure out which method extra class %u would invoke, skipping\n", i + 1);
+                continue;
+            }
+
+            extraClasses[validExtraGuessCount]     = extraClasses[i];
+            extraLikelihoods[validExtraGuessCount] = extraLikelihoods[i];
+            validExtraGuessCount++;
+        }
+        extraGuessCount = validExtraGuessCount;
     }
 
     uint32_t likelyMethodAttribs = info.compCompHnd->getMethodAttribs(likelyMethod);
@@ -5926,7 +5992,7 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
     // Add this as a potential candidate.
     //
     addGuardedDevirtualizationCandidate(call, likelyMethod, likelyClass, likelyMethodAttribs, likelyClassAttribs,
-                                        likelihood);
+                                        likelihood, *pContextHandle, extraClasses, extraLikelihoods, extraGuessCount);
 }
 
 //------------------------------------------------------------------------
@@ -5949,13 +6015,21 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
 //    methodAttr - attributes of the method
 //    classAttr - attributes of the class
 //    likelihood - odds that this class is the class seen at runtime
+//    originalContext - context handle of the call site
+//    extraClasses - additional classes to test for at runtime (nullptr if none)
+//    extraLikelihoods - odds for each of the extra classes
+//    extraGuessCount - number of extra classes
 //
-void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
-                                                   CORINFO_METHOD_HANDLE methodHandle,
-                                                   CORINFO_CLASS_HANDLE  classHandle,
-                                                   unsigned              methodAttr,
-                                                   unsigned              classAttr,
-                                                   unsigned              likelihood)
+void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*           call,
+                                                   CORINFO_METHOD_HANDLE  methodHandle,
+                                                   CORINFO_CLASS_HANDLE   classHandle,
+                                                   unsigned               methodAttr,
+                                                   unsigned               classAttr,
+                                                   unsigned               likelihood,
+                                                   CORINFO_CONTEXT_HANDLE originalContext,
+                                                   CORINFO_CLASS_HANDLE*  extraClasses,
+                                                   unsigned*              extraLikelihoods,
+                                                   unsigned               extraGuessCount)
 {
     // This transformation only makes sense for delegate and virtual calls
     assert(call->IsDelegateInvoke() || call->IsVirtual());
@@ -6029,6 +6103,17 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
     pInfo->guardedClassHandle              = classHandle;
     pInfo->likelihood                      = likelihood;
     pInfo->requiresInstMethodTableArg      = false;
+    pInfo->originalContextHandle           = originalContext;
+    pInfo->extraGuessCount                 = extraGuessCount;
+
+    for (unsigned i = 0; i < extraGuessCount; i++)
+    {
+        assert(classHandle != NO_CLASS_HANDLE);
+        pInfo->extraGuardedClassHandles[i] = extraClasses[i];
+        pInfo->extraLikelihoods[i]         = extraLikelihoods[i];
+        JITDUMP("    ... will also guess for class %s [likelihood:%u%%]\n", eeGetClassName(extraClasses[i]),
+                extraLikelihoods[i]);
+    }
 
     // If the guarded class is a value class, look for an unboxed entry point.
     //
@@ -7549,9 +7634,20 @@ void Compiler::impCheckCanInline(GenTreeCall*           call,
 #endif
 
             // Fetch method info. This may fail, if the method doesn't have IL.
+            // The inline strategy caches the outcome per callee, so repeated
+            // call sites for the same callee only query the runtime once.
             //
-            CORINFO_METHOD_INFO methInfo;
-            if (!compCompHnd->getMethodInfo(ftn, &methInfo))
+            InlineStrategy* const strategy = compiler->impInlineRoot()->m_inlineStrategy;
+            CORINFO_METHOD_INFO   methInfo;
+            bool                  hasMethodInfo;
+
+            if (!strategy->LookupMethodInfo(ftn, &methInfo, &hasMethodInfo))
+            {
+                hasMethodInfo = compCompHnd->getMethodInfo(ftn, &methInfo);
+                strategy->RecordMethodInfo(ftn, &methInfo, hasMethodInfo);
+            }
+
+            if (!hasMethodInfo)
             {
                 inlineResult->NoteFatal(InlineObservation::CALLEE_NO_METHOD_INFO);
                 return;
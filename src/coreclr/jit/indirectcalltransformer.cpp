@@ -442,7 +442,7 @@ private:
     {
     public:
         GuardedDevirtualizationTransformer(Compiler* compiler, BasicBlock* block, Statement* stmt)
-            : Transformer(compiler, block, stmt), returnTemp(BAD_VAR_NUM)
+            : Transformer(compiler, block, stmt), returnTemp(BAD_VAR_NUM), numExtraChecks(0)
         {
         }
 
@@ -918,6 +918,187 @@ private:
             // Set the original statement to a nop.
             //
             stmt->SetRootNode(compiler->gtNewNothingNode());
+
+            // If the profile named more likely classes for this site, guard for
+            // them too, before falling back to the residual call.
+            //
+            CreateExtraGuesses();
+        }
+
+        //------------------------------------------------------------------------
+        // CreateExtraGuesses: expand any additional class guesses into chained
+        //   guards between the primary then block and the else (residual) block.
+        //
+        // Notes:
+        //   Each extra guess gets a check block comparing the method table of
+        //   'this' against the guessed class, and a then block making a direct
+        //   call to the devirtualized method. Unlike the primary guess these
+        //   calls are not inline candidates; the win is avoiding the stub or
+        //   vtable dispatch for secondary classes at polymorphic sites. Guards
+        //   are emitted in decreasing order of likelihood, so the most probable
+        //   classes are tested first.
+        //
+        void CreateExtraGuesses()
+        {
+            GuardedDevirtualizationCandidateInfo* const guardedInfo = origCall->gtGuardedDevirtualizationCandidateInfo;
+
+            if ((guardedInfo->guardedClassHandle == NO_CLASS_HANDLE) || (guardedInfo->extraGuessCount == 0))
+            {
+                return;
+            }
+
+            assert(!origCall->IsDelegateInvoke());
+
+            BasicBlock* insertAfter = thenBlock;
+
+            for (unsigned i = 0; i < guardedInfo->extraGuessCount; i++)
+            {
+                CORINFO_CLASS_HANDLE const clsHnd = guardedInfo->extraGuardedClassHandles[i];
+
+                // Check block: compare the method table of 'this' against this guess.
+                //
+                BasicBlock* const extraCheckBlock = CreateAndInsertBasicBlock(BBJ_COND, insertAfter);
+                extraCheckBlock->bbFlags |= currBlock->bbFlags & BBF_SPLIT_GAINED;
+
+                GenTree* const thisTree          = compiler->gtCloneExpr(origCall->gtArgs.GetThisArg()->GetNode());
+                GenTree* const methodTable       = compiler->gtNewMethodTableLookup(thisTree);
+                GenTree* const targetMethodTable = compiler->gtNewIconEmbClsHndNode(clsHnd);
+                GenTree* const compare = compiler->gtNewOperNode(GT_NE, TYP_INT, targetMethodTable, methodTable);
+                GenTree* const jmpTree = compiler->gtNewOperNode(GT_JTRUE, TYP_VOID, compare);
+                Statement* const jmpStmt = compiler->fgNewStmtFromTree(jmpTree, stmt->GetDebugInfo());
+                compiler->fgInsertStmtAtEnd(extraCheckBlock, jmpStmt);
+
+                // Then block: copy 'this' to an exactly typed temp and make a
+                // direct call.
+                //
+                BasicBlock* const extraThenBlock = CreateAndInsertBasicBlock(BBJ_ALWAYS, extraCheckBlock);
+                extraThenBlock->bbFlags |= currBlock->bbFlags & BBF_SPLIT_GAINED;
+
+                const unsigned thisTemp = compiler->lvaGrabTemp(false DEBUGARG("guarded devirt extra this exact temp"));
+                GenTree* const clonedObj = compiler->gtCloneExpr(origCall->gtArgs.GetThisArg()->GetNode());
+                GenTree* const assign    = compiler->gtNewTempAssign(thisTemp, clonedObj);
+                compiler->lvaSetClass(thisTemp, clsHnd, true);
+                compiler->fgNewStmtAtEnd(extraThenBlock, assign);
+
+                GenTreeCall* const call = compiler->gtCloneExpr(origCall)->AsCall();
+                call->gtArgs.GetThisArg()->SetEarlyNode(compiler->gtNewLclvNode(thisTemp, TYP_REF));
+                call->SetIsGuarded();
+
+                JITDUMP("Direct call [%06u] for extra class guess %u in block " FMT_BB "\n", compiler->dspTreeID(call),
+                        i + 1, extraThenBlock->bbNum);
+
+                // Invoke impDevirtualizeCall to transform the call for us, given
+                // the original (base) method, the call site context, and the exact
+                // class on the new 'this'. We verified resolvability when we
+                // recorded the guess, so this should succeed.
+                //
+                CORINFO_METHOD_HANDLE  methodHnd   = call->gtCallMethHnd;
+                unsigned               methodFlags = compiler->info.compCompHnd->getMethodAttribs(methodHnd);
+                CORINFO_CONTEXT_HANDLE context     = guardedInfo->originalContextHandle;
+                const bool             isLateDevirtualization = true;
+                const bool explicitTailCall = (origCall->gtCallMoreFlags & GTF_CALL_M_EXPLICIT_TAILCALL) != 0;
+                compiler->impDevirtualizeCall(call, nullptr, &methodHnd, &methodFlags, &context, nullptr,
+                                              isLateDevirtualization, explicitTailCall);
+                assert(!call->IsVirtual());
+
+                if (returnTemp != BAD_VAR_NUM)
+                {
+                    GenTree* const retAssign = compiler->gtNewTempAssign(returnTemp, call);
+                    compiler->fgNewStmtAtEnd(extraThenBlock, retAssign);
+                }
+                else
+                {
+                    compiler->fgNewStmtAtEnd(extraThenBlock, call, stmt->GetDebugInfo());
+                }
+
+                extraCheckBlocks[numExtraChecks] = extraCheckBlock;
+                extraThenBlocks[numExtraChecks]  = extraThenBlock;
+                numExtraChecks++;
+
+                insertAfter = extraThenBlock;
+            }
+        }
+
+        //------------------------------------------------------------------------
+        // SetWeights: set weights for new blocks, including any extra guess blocks.
+        //
+        virtual void SetWeights()
+        {
+            Transformer::SetWeights();
+
+            if (numExtraChecks == 0)
+            {
+                return;
+            }
+
+            GuardedDevirtualizationCandidateInfo* const guardedInfo = origCall->gtGuardedDevirtualizationCandidateInfo;
+
+            unsigned residualLikelihood = 100 - likelihood;
+            for (unsigned i = 0; i < numExtraChecks; i++)
+            {
+                extraCheckBlocks[i]->inheritWeightPercentage(currBlock, residualLikelihood);
+
+                unsigned extraLikelihood = guardedInfo->extraLikelihoods[i];
+                if (extraLikelihood > residualLikelihood)
+                {
+                    extraLikelihood = residualLikelihood;
+                }
+                extraThenBlocks[i]->inheritWeightPercentage(currBlock, extraLikelihood);
+                residualLikelihood -= extraLikelihood;
+            }
+            elseBlock->inheritWeightPercentage(currBlock, residualLikelihood);
+
+            JITDUMP("Estimated residual slow path rate for guarded call site [%06u] after %u guesses: %u%%\n",
+                    compiler->dspTreeID(origCall), 1 + numExtraChecks, residualLikelihood);
+        }
+
+        //------------------------------------------------------------------------
+        // ChainFlow: link new blocks into correct cfg. With extra guesses the
+        //   primary check's failed path falls into the first extra check, and
+        //   each extra check's failed path continues on to the next one, ending
+        //   at the else (residual) block.
+        //
+        virtual void ChainFlow()
+        {
+            if (numExtraChecks == 0)
+            {
+                Transformer::ChainFlow();
+                return;
+            }
+
+            assert(compiler->fgPredsComputed);
+
+            // currBlock
+            compiler->fgRemoveRefPred(remainderBlock, currBlock);
+
+            if (checkBlock != currBlock)
+            {
+                compiler->fgAddRefPred(checkBlock, currBlock);
+            }
+
+            // checkBlock
+            checkBlock->bbJumpDest = extraCheckBlocks[0];
+            compiler->fgAddRefPred(extraCheckBlocks[0], checkBlock);
+            compiler->fgAddRefPred(thenBlock, checkBlock);
+
+            // thenBlock
+            thenBlock->bbJumpDest = remainderBlock;
+            compiler->fgAddRefPred(remainderBlock, thenBlock);
+
+            // extra check and then blocks
+            for (unsigned i = 0; i < numExtraChecks; i++)
+            {
+                BasicBlock* const nextCheck = (i + 1 < numExtraChecks) ? extraCheckBlocks[i + 1] : elseBlock;
+                extraCheckBlocks[i]->bbJumpDest = nextCheck;
+                compiler->fgAddRefPred(nextCheck, extraCheckBlocks[i]);
+                compiler->fgAddRefPred(extraThenBlocks[i], extraCheckBlocks[i]);
+
+                extraThenBlocks[i]->bbJumpDest = remainderBlock;
+                compiler->fgAddRefPred(remainderBlock, extraThenBlocks[i]);
+            }
+
+            // elseBlock
+            compiler->fgAddRefPred(remainderBlock, elseBlock);
         }
 
         // For chained gdv, we modify the expansion as follows:
@@ -1008,6 +1189,15 @@ private:
         //
         void ScoutForChainedGdv()
         {
+            // The chained gdv expansion assumes the next site's check block has
+            // exactly one hot and one cold predecessor; extra guess guards give
+            // it more, so don't chain onto this expansion.
+            //
+            if (numExtraChecks > 0)
+            {
+                return;
+            }
+
             // If the current call isn't sufficiently likely, don't try and form a chain.
             //
             const unsigned gdvChainLikelihood = JitConfig.JitGuardedDevirtualizationChainLikelihood();
@@ -1133,8 +1323,11 @@ private:
         }
 
     private:
-        unsigned   returnTemp;
-        Statement* lastStmt;
+        unsigned    returnTemp;
+        Statement*  lastStmt;
+        BasicBlock* extraCheckBlocks[GuardedDevirtualizationCandidateInfo::maxExtraGuesses];
+        BasicBlock* extraThenBlocks[GuardedDevirtualizationCandidateInfo::maxExtraGuesses];
+        unsigned    numExtraChecks;
 
         //------------------------------------------------------------------------
         // CreateTreeForLookup: Create a tree representing a lookup of a method address.
@@ -842,6 +842,9 @@ InlineStrategy::InlineStrategy(Compiler* compiler)
     , m_CurrentTimeEstimate(0)
     , m_InitialSizeEstimate(0)
     , m_CurrentSizeEstimate(0)
+    , m_MethodInfoCache(nullptr)
+    , m_MethodInfoQueryCount(0)
+    , m_MethodInfoHitCount(0)
     , m_HasForceViaDiscretionary(false)
 #if defined(DEBUG) || defined(INLINE_DATA)
     , m_MethodXmlFilePosition(0)
@@ -1243,6 +1246,77 @@ bool InlineStrategy::BudgetCheck(unsigned ilSize)
     return result;
 }
 
+//------------------------------------------------------------------------
+// LookupMethodInfo: see if method info for a callee was already fetched
+//    during this compilation
+//
+// Arguments:
+//    callee - inline candidate method
+//    methInfo - [out] cached method info, if the original query succeeded
+//    hasMethodInfo - [out] true if the original query succeeded
+//
+// Return Value:
+//    true if there is a cached outcome for this callee
+//
+// Notes:
+//    The cache is scoped to the root compilation; repeated call sites
+//    for the same callee (common with guarded devirtualization and in
+//    large methods) avoid redundant getMethodInfo queries.
+
+bool InlineStrategy::LookupMethodInfo(CORINFO_METHOD_HANDLE callee, CORINFO_METHOD_INFO* methInfo, bool* hasMethodInfo)
+{
+    m_MethodInfoQueryCount++;
+
+    if (m_MethodInfoCache == nullptr)
+    {
+        return false;
+    }
+
+    MethodInfoCacheEntry* entry;
+    if (!m_MethodInfoCache->Lookup(callee, &entry))
+    {
+        return false;
+    }
+
+    m_MethodInfoHitCount++;
+
+    *hasMethodInfo = entry->hasMethodInfo;
+    if (entry->hasMethodInfo)
+    {
+        *methInfo = entry->methInfo;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// RecordMethodInfo: remember the outcome of fetching method info for a callee
+//
+// Arguments:
+//    callee - inline candidate method
+//    methInfo - method info from the runtime (only read if hasMethodInfo)
+//    hasMethodInfo - whether the getMethodInfo query succeeded
+
+void InlineStrategy::RecordMethodInfo(CORINFO_METHOD_HANDLE callee,
+                                      const CORINFO_METHOD_INFO* methInfo,
+                                      bool                       hasMethodInfo)
+{
+    if (m_MethodInfoCache == nullptr)
+    {
+        m_MethodInfoCache =
+            new (m_Compiler, CMK_Inlining) MethodInfoCache(m_Compiler->getAllocator(CMK_Inlining));
+    }
+
+    MethodInfoCacheEntry* entry = new (m_Compiler, CMK_Inlining) MethodInfoCacheEntry;
+    entry->hasMethodInfo        = hasMethodInfo;
+    if (hasMethodInfo)
+    {
+        entry->methInfo = *methInfo;
+    }
+
+    m_MethodInfoCache->Set(callee, entry);
+}
+
 //------------------------------------------------------------------------
 // NewRoot: construct an InlineContext for the root method
 //
@@ -1393,6 +1467,8 @@ void InlineStrategy::Dump(bool verbose)
     }
 
     printf("Budget: initialSize=%d, finalSize=%d\n", m_InitialSizeEstimate, m_CurrentSizeEstimate);
+
+    printf("MethodInfo cache: %u queries, %u hits\n", m_MethodInfoQueryCount, m_MethodInfoHitCount);
 }
 
 // Static to track emission of the inline data header
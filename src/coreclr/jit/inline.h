@@ -591,11 +591,24 @@ struct HandleHistogramProfileCandidateInfo
 //
 struct GuardedDevirtualizationCandidateInfo : HandleHistogramProfileCandidateInfo
 {
+    // Maximum number of class guesses for a call site beyond the primary one.
+    static const unsigned maxExtraGuesses = 2;
+
     CORINFO_CLASS_HANDLE  guardedClassHandle;
     CORINFO_METHOD_HANDLE guardedMethodHandle;
     CORINFO_METHOD_HANDLE guardedMethodUnboxedEntryHandle;
     unsigned              likelihood;
     bool                  requiresInstMethodTableArg;
+
+    // Additional, less likely class guesses for the same call site. These
+    // expand into chained guards whose success paths make direct (but not
+    // inlined) calls; the primary guess above remains the inline candidate.
+    // originalContextHandle is the context of the call site itself, needed to
+    // re-devirtualize against the extra classes during the guard expansion.
+    CORINFO_CONTEXT_HANDLE originalContextHandle;
+    CORINFO_CLASS_HANDLE   extraGuardedClassHandles[maxExtraGuesses];
+    unsigned               extraLikelihoods[maxExtraGuesses];
+    unsigned               extraGuessCount;
 };
 
 // InlineCandidateInfo provides basic information about a particular
@@ -997,6 +1010,16 @@ public:
         m_PrejitRootObservation = r.GetPolicy()->GetObservation();
     }
 
+    // See if method info was already fetched for this callee during this
+    // compilation. Returns true if there is a cached outcome; on success
+    // *methInfo is filled in, and *hasMethodInfo says whether the original
+    // runtime query succeeded.
+    bool LookupMethodInfo(CORINFO_METHOD_HANDLE callee, CORINFO_METHOD_INFO* methInfo, bool* hasMethodInfo);
+
+    // Record the outcome of fetching method info for a callee, so repeated
+    // call sites for the same callee can skip the runtime query.
+    void RecordMethodInfo(CORINFO_METHOD_HANDLE callee, const CORINFO_METHOD_INFO* methInfo, bool hasMethodInfo);
+
     // Dump csv header for inline stats to indicated file.
     static void DumpCsvHeader(FILE* f);
 
@@ -1075,6 +1098,17 @@ private:
     // Estimate native code size change because of this inline.
     int EstimateSize(InlineContext* context);
 
+    // Cached outcome of a getMethodInfo query for an inline candidate.
+    // Entries with hasMethodInfo false remember that the query failed.
+    struct MethodInfoCacheEntry
+    {
+        CORINFO_METHOD_INFO methInfo;
+        bool                hasMethodInfo;
+    };
+
+    typedef JitHashTable<CORINFO_METHOD_HANDLE, JitPtrKeyFuncs<struct CORINFO_METHOD_STRUCT_>, MethodInfoCacheEntry*>
+        MethodInfoCache;
+
 #if defined(DEBUG) || defined(INLINE_DATA)
     static bool          s_HasDumpedDataHeader;
     static bool          s_HasDumpedXmlHeader;
@@ -1104,6 +1138,9 @@ private:
     int               m_CurrentTimeEstimate;
     int               m_InitialSizeEstimate;
     int               m_CurrentSizeEstimate;
+    MethodInfoCache*  m_MethodInfoCache;
+    unsigned          m_MethodInfoQueryCount;
+    unsigned          m_MethodInfoHitCount;
     bool              m_HasForceViaDiscretionary;
 
 #if defined(DEBUG) || defined(INLINE_DATA)
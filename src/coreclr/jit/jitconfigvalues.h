@@ -121,6 +121,19 @@ CONFIG_INTEGER(JitMinOptsLvRefCount, W("JITMinOptsLvRefcount"), DEFAULT_MIN_OPTS
                                                                                                // of MinOpts
 CONFIG_INTEGER(JitNoCSE, W("JitNoCSE"), 0)
 CONFIG_INTEGER(JitNoCSE2, W("JitNoCSE2"), 0)
+
+// CSE promotion heuristic parameters, for offline tuning (e.g. via superpmi
+// replay). The defaults leave the heuristic unchanged.
+//
+// Overrides the number of enregistered locals at which the aggressive/moderate
+// promotion cutoff weights are sampled (-1 means use the register-file-derived
+// default).
+CONFIG_INTEGER(JitCSEAggressiveEnregNum, W("JitCSEAggressiveEnregNum"), -1)
+CONFIG_INTEGER(JitCSEModerateEnregNum, W("JitCSEModerateEnregNum"), -1)
+// Percent scale applied to the final aggressive/moderate promotion cutoffs
+// (100 means no change).
+CONFIG_INTEGER(JitCSEAggressiveCutoffMult, W("JitCSEAggressiveCutoffMult"), 100)
+CONFIG_INTEGER(JitCSEModerateCutoffMult, W("JitCSEModerateCutoffMult"), 100)
 CONFIG_INTEGER(JitNoForceFallback, W("JitNoForceFallback"), 0) // Set to non-zero to prevent NOWAY assert testing.
                                                                // Overrides DOTNET_JitForceFallback and JIT stress
                                                                // flags.
@@ -129,9 +142,11 @@ CONFIG_INTEGER(JitNoHoist, W("JitNoHoist"), 0)
 CONFIG_INTEGER(JitNoInline, W("JitNoInline"), 0)                 // Disables inlining of all methods
 CONFIG_INTEGER(JitNoMemoryBarriers, W("JitNoMemoryBarriers"), 0) // If 1, don't generate memory barriers
 CONFIG_INTEGER(JitNoRegLoc, W("JitNoRegLoc"), 0)
+CONFIG_INTEGER(JitNoStrengthReduction, W("JitNoStrengthReduction"), 0) // Disables loop IV strength reduction
 CONFIG_INTEGER(JitNoStructPromotion, W("JitNoStructPromotion"), 0) // Disables struct promotion 1 - for all, 2 - for
                                                                    // params.
 CONFIG_INTEGER(JitNoUnroll, W("JitNoUnroll"), 0)
+CONFIG_INTEGER(JitNoVectorizeLoops, W("JitNoVectorizeLoops"), 0) // Disable loop auto-vectorization
 CONFIG_INTEGER(JitOrder, W("JitOrder"), 0)
 CONFIG_INTEGER(JitQueryCurrentStaticFieldClass, W("JitQueryCurrentStaticFieldClass"), 1)
 CONFIG_INTEGER(JitReportFastTailCallDecisions, W("JitReportFastTailCallDecisions"), 0)
@@ -425,6 +440,7 @@ CONFIG_INTEGER(JitDoRangeAnalysis, W("JitDoRangeAnalysis"), 1) // Perform range
 CONFIG_INTEGER(JitDoVNBasedDeadStoreRemoval, W("JitDoVNBasedDeadStoreRemoval"), 1) // Perform VN-based dead store
                                                                                    // removal
 CONFIG_INTEGER(JitDoRedundantBranchOpts, W("JitDoRedundantBranchOpts"), 1) // Perform redundant branch optimizations
+CONFIG_INTEGER(JitDoSparseConstProp, W("JitDoSparseConstProp"), 1) // Perform sparse conditional constant propagation
 CONFIG_STRING(JitEnableRboRange, W("JitEnableRboRange"))
 CONFIG_STRING(JitEnableTailMergeRange, W("JitEnableTailMergeRange"))
 CONFIG_STRING(JitEnableVNBasedDeadStoreRemovalRange, W("JitEnableVNBasedDeadStoreRemovalRange"))
@@ -520,6 +536,8 @@ CONFIG_INTEGER(JitEECallTimingInfo, W("JitEECallTimingInfo"), 0)
 
 #if defined(DEBUG)
 CONFIG_INTEGER(JitEnableFinallyCloning, W("JitEnableFinallyCloning"), 1)
+// Print a line per method with the number of objects and bytes moved from the heap to the stack.
+CONFIG_INTEGER(JitObjectStackAllocationDump, W("JitObjectStackAllocationDump"), 0)
 CONFIG_INTEGER(JitEnableRemoveEmptyTry, W("JitEnableRemoveEmptyTry"), 1)
 #endif // DEBUG
 
@@ -529,6 +547,8 @@ CONFIG_INTEGER(JitEnableGuardedDevirtualization, W("JitEnableGuardedDevirtualiza
 // Various policies for GuardedDevirtualization
 CONFIG_INTEGER(JitGuardedDevirtualizationChainLikelihood, W("JitGuardedDevirtualizationChainLikelihood"), 0x4B) // 75
 CONFIG_INTEGER(JitGuardedDevirtualizationChainStatements, W("JitGuardedDevirtualizationChainStatements"), 4)
+// Max number of guarded class guesses (guards) per call site; guesses past the first become direct calls
+CONFIG_INTEGER(JitGuardedDevirtualizationMaxGuesses, W("JitGuardedDevirtualizationMaxGuesses"), 3)
 #if defined(DEBUG)
 CONFIG_STRING(JitGuardedDevirtualizationRange, W("JitGuardedDevirtualizationRange"))
 CONFIG_INTEGER(JitRandomGuardedDevirtualization, W("JitRandomGuardedDevirtualization"), 0)
@@ -549,6 +569,9 @@ CONFIG_INTEGER(TC_PartialCompilation, W("TC_PartialCompilation"), 0)
 // 1 - backedge targets
 // 2 - adaptive (default)
 CONFIG_INTEGER(TC_PatchpointStrategy, W("TC_PatchpointStrategy"), 2)
+// Insert GC polls at loop back edge sources in Tier0 methods, so threads in Tier0 loops
+// reach a GC safe point by polling instead of having to be hijacked or redirected.
+CONFIG_INTEGER(TC_BackEdgeGCPolls, W("TC_BackEdgeGCPolls"), 0)
 #if defined(DEBUG)
 // Randomly sprinkle patchpoints. Value is the likelihood any given stack-empty point becomes a patchpoint.
 CONFIG_INTEGER(JitRandomOnStackReplacement, W("JitRandomOnStackReplacement"), 0)
@@ -581,6 +604,7 @@ CONFIG_INTEGER(JitConsumeProfileForCasts, W("JitConsumeProfileForCasts"), 1) //
 CONFIG_INTEGER(JitClassProfiling, W("JitClassProfiling"), 1)         // Profile virtual and interface calls
 CONFIG_INTEGER(JitDelegateProfiling, W("JitDelegateProfiling"), 1)   // Profile resolved delegate call targets
 CONFIG_INTEGER(JitVTableProfiling, W("JitVTableProfiling"), 0)       // Profile resolved vtable call targets
+CONFIG_INTEGER(JitValueProfiling, W("JitValueProfiling"), 0)         // Profile results of idempotent helper calls
 CONFIG_INTEGER(JitEdgeProfiling, W("JitEdgeProfiling"), 1)           // Profile edges instead of blocks
 CONFIG_INTEGER(JitCollect64BitCounts, W("JitCollect64BitCounts"), 0) // Collect counts as 64-bit values.
 
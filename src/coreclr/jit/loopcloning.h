@@ -186,6 +186,41 @@ exception occurs.
     3. Perform short circuit AND for (array != null) side effect check
       before hoisting (limit <= a.length) check.
 
+    Future improvements
+
+    Loop interchange and strip-mining (loop blocking) for cache locality have been
+    proposed as follow-on transformations that could reuse the array access analysis
+    performed here (ArrIndex / LC_Array reconstruction and the deref condition
+    machinery). Some notes on what that would actually require, for whoever picks
+    this up:
+
+    1. Legality for interchange needs a dependence test over the loop nest: for every
+       pair of accesses to the same array, the direction vector of the dependence must
+       remain lexicographically non-negative after permuting the loops. We currently
+       have no dependence analysis at all; the cloning analysis only proves bounds
+       checks redundant, it says nothing about cross-iteration memory dependences.
+       Even a simple ZIV/SIV test framework would need value-numbered affine index
+       recognition that doesn't exist today.
+
+    2. Jagged arrays (the common C# case, and the main case this file handles) make
+       interchange generally illegal without runtime checks: `a[i][j]` rows may alias
+       each other or overlap other arrays, and row lengths may differ, so the
+       rectangular iteration space assumption doesn't hold. True multi-dimensional
+       arrays (GT_MDARR, LcMdArrayOptInfo) have a rectangular space and a single
+       object, so they are the plausible starting point; cloning-style runtime
+       conditions could guard row-regularity for the jagged case, at significant
+       code-size cost.
+
+    3. Strip-mining alone is always legal for a countable loop but is only profitable
+       when paired with interchange (to get the blocking effect), so it inherits the
+       same prerequisites in practice.
+
+    4. The transformation itself would need to rewrite the iterator update and test of
+       both loops in the nest and renumber the loop table; the current cloning
+       transform deliberately never reshapes the loop structure, only duplicates it.
+
+    Given 1 and 2 this is a design-stage item; nothing below implements it.
+
 */
 #pragma once
 
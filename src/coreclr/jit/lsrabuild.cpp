@@ -2516,18 +2516,25 @@ void LinearScan::buildIntervals()
             {
                 VarSetOps::DiffD(compiler, expUseSet, nextBlock->bbLiveIn);
             }
-            for (BasicBlock* succ : block->GetAllSuccs(compiler))
+
+            // Only enumerate successors if there's anything left to resolve; for
+            // blocks with many successors (e.g. large switches) the enumeration
+            // itself is costly.
+            if (!VarSetOps::IsEmpty(compiler, expUseSet))
             {
-                if (VarSetOps::IsEmpty(compiler, expUseSet))
+                for (BasicBlock* succ : block->GetAllSuccs(compiler))
                 {
-                    break;
-                }
+                    if (isBlockVisited(succ))
+                    {
+                        continue;
+                    }
+                    VarSetOps::DiffD(compiler, expUseSet, succ->bbLiveIn);
 
-                if (isBlockVisited(succ))
-                {
-                    continue;
+                    if (VarSetOps::IsEmpty(compiler, expUseSet))
+                    {
+                        break;
+                    }
                 }
-                VarSetOps::DiffD(compiler, expUseSet, succ->bbLiveIn);
             }
 
             if (!VarSetOps::IsEmpty(compiler, expUseSet))
@@ -52,12 +52,38 @@ PhaseStatus ObjectAllocator::DoPhase()
     {
         ComputeStackObjectPointers(&m_bitVecTraits);
         RewriteUses();
-        return PhaseStatus::MODIFIED_EVERYTHING;
     }
-    else
+
+    ReportStackAllocations();
+
+    return didStackAllocate ? PhaseStatus::MODIFIED_EVERYTHING : PhaseStatus::MODIFIED_NOTHING;
+}
+
+//------------------------------------------------------------------------
+// ReportStackAllocations: Report how many heap allocations this method
+//                         lost to the stack and how many bytes they cover.
+//
+// Notes:
+//    With DOTNET_JitObjectStackAllocationDump a line per method is written
+//    to jit standard output so corpus runs (e.g. over SuperPMI collections)
+//    can aggregate heap-allocation elimination across a fleet of methods.
+//
+void ObjectAllocator::ReportStackAllocations()
+{
+    if (m_stackAllocationCount == 0)
     {
-        return PhaseStatus::MODIFIED_NOTHING;
+        return;
     }
+
+    JITDUMP("Stack allocated %u object(s) covering %u byte(s)\n", m_stackAllocationCount, m_stackAllocationSize);
+
+#ifdef DEBUG
+    if (JitConfig.JitObjectStackAllocationDump() != 0)
+    {
+        printf("ObjectStackAllocation: %u objects, %u bytes in %s\n", m_stackAllocationCount, m_stackAllocationSize,
+               comp->info.compFullName);
+    }
+#endif // DEBUG
 }
 
 //------------------------------------------------------------------------------
@@ -408,6 +434,9 @@ bool ObjectAllocator::MorphAllocObjNodes()
                     stmt->GetRootNode()->gtBashToNOP();
                     comp->optMethodFlags |= OMF_HAS_OBJSTACKALLOC;
                     didStackAllocate = true;
+
+                    m_stackAllocationCount++;
+                    m_stackAllocationSize += comp->info.compCompHnd->getHeapClassSize(clsHnd);
                 }
                 else
                 {
@@ -670,6 +699,12 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
                 canLclVarEscapeViaParentStack = false;
                 break;
 
+            case GT_NULLCHECK:
+            case GT_ARR_LENGTH:
+                // The object is merely dereferenced; its address doesn't escape.
+                canLclVarEscapeViaParentStack = false;
+                break;
+
             case GT_CALL:
             {
                 GenTreeCall* asCall = parent->AsCall();
@@ -760,8 +795,12 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
                 keepChecking = true;
                 break;
 
+            case GT_ARR_LENGTH:
+                break;
+
             case GT_FIELD:
             case GT_IND:
+            case GT_NULLCHECK:
             {
                 // The new target could be *not* on the heap.
                 parent->gtFlags &= ~GTF_IND_TGT_HEAP;
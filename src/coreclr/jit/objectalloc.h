@@ -35,6 +35,8 @@ class ObjectAllocator final : public Phase
     BitVec              m_DefinitelyStackPointingPointers;
     LocalToLocalMap     m_HeapLocalToStackLocalMap;
     BitSetShortLongRep* m_ConnGraphAdjacencyMatrix;
+    unsigned int        m_stackAllocationCount;
+    unsigned int        m_stackAllocationSize;
 
     //===============================================================================
     // Methods
@@ -60,6 +62,7 @@ private:
     void ComputeEscapingNodes(BitVecTraits* bitVecTraits, BitVec& escapingNodes);
     void ComputeStackObjectPointers(BitVecTraits* bitVecTraits);
     bool     MorphAllocObjNodes();
+    void     ReportStackAllocations();
     void     RewriteUses();
     GenTree* MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* allocObj);
     unsigned int MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* allocObj, BasicBlock* block, Statement* stmt);
@@ -80,6 +83,8 @@ inline ObjectAllocator::ObjectAllocator(Compiler* comp)
     , m_AnalysisDone(false)
     , m_bitVecTraits(comp->lvaCount, comp)
     , m_HeapLocalToStackLocalMap(comp->getAllocator())
+    , m_stackAllocationCount(0)
+    , m_stackAllocationSize(0)
 {
     m_EscapingPointers                = BitVecOps::UninitVal();
     m_PossiblyStackPointingPointers   = BitVecOps::UninitVal();
@@ -1855,6 +1855,25 @@ public:
 #endif
         }
 
+        // Set the enregistered-locals counts at which we sample the aggressive and moderate
+        // promotion cutoff weights below.
+        //
+        unsigned aggressiveEnregNum = (CNT_CALLEE_ENREG * 3 / 2);
+        unsigned moderateEnregNum   = ((CNT_CALLEE_ENREG * 3) + (CNT_CALLEE_TRASH * 2));
+
+#ifdef DEBUG
+        // Optionally override the sample points, for offline heuristic tuning.
+        //
+        if (JitConfig.JitCSEAggressiveEnregNum() >= 0)
+        {
+            aggressiveEnregNum = (unsigned)JitConfig.JitCSEAggressiveEnregNum();
+        }
+        if (JitConfig.JitCSEModerateEnregNum() >= 0)
+        {
+            moderateEnregNum = (unsigned)JitConfig.JitCSEModerateEnregNum();
+        }
+#endif
+
         // Iterate over the sorted list of tracked local variables. These are the register candidates for LSRA.
         // We normally visit the LclVars in order of their weighted ref counts and our heuristic assumes that the
         // highest weighted ref count LclVars will be enregistered and that the lowest weighted ref count
@@ -1902,9 +1921,6 @@ public:
             // when enregCount reached a certain value we assign the current LclVar
             // (weighted) ref count to aggressiveRefCnt or moderateRefCnt.
             //
-            const unsigned aggressiveEnregNum = (CNT_CALLEE_ENREG * 3 / 2);
-            const unsigned moderateEnregNum   = ((CNT_CALLEE_ENREG * 3) + (CNT_CALLEE_TRASH * 2));
-            //
             // On Windows x64 this yields:
             // aggressiveEnregNum == 12 and moderateEnregNum == 38
             // Thus we will typically set the cutoff values for
@@ -1926,7 +1942,7 @@ public:
                 }
                 aggressiveRefCnt += BB_UNITY_WEIGHT;
             }
-            if ((moderateRefCnt == 0) && (enregCount > ((CNT_CALLEE_ENREG * 3) + (CNT_CALLEE_TRASH * 2))))
+            if ((moderateRefCnt == 0) && (enregCount > moderateEnregNum))
             {
                 if (CodeOptKind() == Compiler::SMALL_CODE)
                 {
@@ -1950,6 +1966,13 @@ public:
         //
         moderateRefCnt = max(BB_UNITY_WEIGHT, moderateRefCnt);
 
+#ifdef DEBUG
+        // Optionally scale the final cutoffs, for offline heuristic tuning.
+        //
+        aggressiveRefCnt = (aggressiveRefCnt * JitConfig.JitCSEAggressiveCutoffMult()) / 100;
+        moderateRefCnt   = (moderateRefCnt * JitConfig.JitCSEModerateCutoffMult()) / 100;
+#endif
+
 #ifdef DEBUG
         if (m_pCompiler->verbose)
         {
@@ -30,7 +30,8 @@ void Compiler::optInit()
     optCurLoopEpoch           = 0;
 
 #ifdef DEBUG
-    loopsAligned = 0;
+    loopsAligned          = 0;
+    loopAlignPaddingBytes = 0;
 #endif
 
     /* Keep track of the number of calls and indirect calls made by this method */
@@ -3996,6 +3997,510 @@ bool Compiler::optComputeLoopRep(int        constInit,
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// optVectorizeLoops: Rewrite simple counted loops using SIMD stores.
+//
+// This is a deliberately conservative first cut at auto-vectorization.
+// The only shape handled is a single-block top-entry fill loop
+//
+//   for (i = icon; i < icon; i++) { *(base + i) = byte-constant; }
+//
+// where 'base' is a loop-invariant byref/native int local, as produced by
+// span and array element stores after bounds checks have been cloned away.
+// Such a loop is store-only, so there are no cross-iteration dependences
+// and no aliasing hazards; it is replaced by a run of unaligned 16-byte
+// vector stores of the splatted constant, with a final overlapping store
+// covering the tail (overlapping stores of the same value are idempotent).
+//
+// The loops this handles have a constant trip count that is too large for
+// the unroller, so this runs before it; loops it rewrites disappear from
+// the loop table.
+//
+// Returns:
+//   suitable phase status
+//
+PhaseStatus Compiler::optVectorizeLoops()
+{
+#ifndef FEATURE_SIMD
+    return PhaseStatus::MODIFIED_NOTHING;
+#else // FEATURE_SIMD
+    if (compCodeOpt() == SMALL_CODE)
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    if ((optLoopCount == 0) || !IsBaselineSimdIsaSupported())
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+#ifdef DEBUG
+    if (JitConfig.JitNoVectorizeLoops())
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+#endif
+
+    // Byte count of one vector store.
+    const unsigned vectorSize = 16;
+
+    // Don't emit more straight-line stores than this.
+    const unsigned maxStores = 16;
+
+    bool change = false;
+
+    for (unsigned lnum = optLoopCount - 1; lnum != ~0U; --lnum)
+    {
+        PREFAST_ASSUME(lnum != 0U - 1);
+
+        LoopDsc& loop = optLoopTable[lnum];
+
+        const unsigned loopFlags     = loop.lpFlags;
+        const unsigned requiredFlags = LPFLG_CONST_INIT | LPFLG_CONST_LIMIT;
+        if (((loopFlags & requiredFlags) != requiredFlags) || ((loopFlags & LPFLG_REMOVED) != 0))
+        {
+            continue;
+        }
+
+        if (!loop.lpIsTopEntry())
+        {
+            continue;
+        }
+
+        // Only single-block loops; the body block also holds the increment and the test.
+        BasicBlock* const body = loop.lpTop;
+        if (body != loop.lpBottom)
+        {
+            continue;
+        }
+
+        // Keep the flow fixup simple: the head must fall into the loop,
+        // i.e. there is no duplicated zero-trip test to clean up.
+        BasicBlock* const head = loop.lpHead;
+        if (head->bbJumpKind != BBJ_NONE)
+        {
+            continue;
+        }
+
+        const int        lbeg     = loop.lpConstInit;
+        const int        llim     = loop.lpConstLimit();
+        const unsigned   lvar     = loop.lpIterVar();
+        const int        iterInc  = loop.lpIterConst();
+        const genTreeOps iterOper = loop.lpIterOper();
+        const genTreeOps testOper = loop.lpTestOper();
+
+        // Only the canonical upward-counting form. With a non-negative
+        // constant init and limit the test works out the same whether the
+        // comparison is signed or unsigned, so don't check GTF_UNSIGNED.
+        if ((iterOper != GT_ADD) || (iterInc != 1) || (testOper != GT_LT) || (lbeg < 0) || (llim <= lbeg))
+        {
+            continue;
+        }
+
+        if (lvaTable[lvar].IsAddressExposed() || lvaTable[lvar].lvIsStructField)
+        {
+            continue;
+        }
+
+        const unsigned totalIter = (unsigned)(llim - lbeg);
+
+        // One byte per iteration; need at least a full vector, and stay
+        // within the straight-line store budget (the tail store may overlap).
+        if ((totalIter < vectorSize) || (totalIter > maxStores * vectorSize))
+        {
+            continue;
+        }
+
+        // The body must be exactly: store; increment; test.
+        Statement* const storeStmt = body->firstStmt();
+        if (storeStmt == nullptr)
+        {
+            continue;
+        }
+        Statement* const incrStmt = storeStmt->GetNextStmt();
+        if (incrStmt == nullptr)
+        {
+            continue;
+        }
+        Statement* const testStmt = incrStmt->GetNextStmt();
+        if ((testStmt == nullptr) || (testStmt != body->lastStmt()))
+        {
+            continue;
+        }
+        if (!testStmt->GetRootNode()->OperIs(GT_JTRUE))
+        {
+            continue;
+        }
+
+        GenTree* const incr = incrStmt->GetRootNode();
+        if (!incr->OperIs(GT_ASG) || !incr->AsOp()->gtGetOp1()->OperIs(GT_LCL_VAR) ||
+            (incr->AsOp()->gtGetOp1()->AsLclVarCommon()->GetLclNum() != lvar))
+        {
+            continue;
+        }
+
+        // Match "IND<byte>(ADD(base, i)) = cns".
+        GenTree* const store = storeStmt->GetRootNode();
+        if (!store->OperIs(GT_ASG))
+        {
+            continue;
+        }
+
+        GenTree* const dst = store->AsOp()->gtGetOp1();
+        GenTree* const val = store->AsOp()->gtGetOp2();
+
+        if (!dst->OperIs(GT_IND) || !dst->TypeIs(TYP_BYTE, TYP_UBYTE) || ((dst->gtFlags & GTF_IND_VOLATILE) != 0))
+        {
+            continue;
+        }
+
+        if (!val->OperIs(GT_CNS_INT) || val->IsIconHandle())
+        {
+            continue;
+        }
+
+        GenTree* const addr = dst->AsIndir()->Addr();
+        if (!addr->OperIs(GT_ADD))
+        {
+            continue;
+        }
+
+        // One operand is the invariant base local, the other the iterator
+        // (possibly widened to native int for the address computation).
+        GenTree* base = nullptr;
+        for (int i = 0; i < 2; i++)
+        {
+            GenTree* const op1 = (i == 0) ? addr->AsOp()->gtGetOp1() : addr->AsOp()->gtGetOp2();
+            GenTree* const op2 = (i == 0) ? addr->AsOp()->gtGetOp2() : addr->AsOp()->gtGetOp1();
+
+            GenTree* idx = op2;
+            if (idx->OperIs(GT_CAST) && !idx->gtOverflow())
+            {
+                idx = idx->AsCast()->CastOp();
+            }
+
+            if (op1->OperIs(GT_LCL_VAR) && op1->TypeIs(TYP_BYREF, TYP_I_IMPL) && idx->OperIs(GT_LCL_VAR) &&
+                (idx->AsLclVarCommon()->GetLclNum() == lvar))
+            {
+                base = op1;
+                break;
+            }
+        }
+
+        if (base == nullptr)
+        {
+            continue;
+        }
+
+        const unsigned baseLclNum = base->AsLclVarCommon()->GetLclNum();
+        if ((baseLclNum == lvar) || lvaTable[baseLclNum].IsAddressExposed())
+        {
+            continue;
+        }
+
+        JITDUMP("Vectorizing fill loop " FMT_LP " in " FMT_BB ": V%02u[%d..%d) = 0x%02x via V%02u\n", lnum,
+                body->bbNum, baseLclNum, lbeg, llim, (unsigned)(val->AsIntCon()->IconValue() & 0xFF), lvar);
+
+        // Replace the loop body with straight-line vector stores.
+        fgRemoveStmt(body, storeStmt);
+        fgRemoveStmt(body, incrStmt);
+        fgRemoveStmt(body, testStmt);
+
+        const uint8_t   fillByte = (uint8_t)val->AsIntCon()->IconValue();
+        const var_types addrType = base->TypeGet();
+
+        int offset = lbeg;
+        while (offset < llim)
+        {
+            // The last store backs up to cover the tail; it may overlap the
+            // previous store, which is fine since all stores write the same value.
+            if (offset + (int)vectorSize > llim)
+            {
+                offset = llim - (int)vectorSize;
+            }
+
+            GenTreeVecCon* const vecCon = gtNewVconNode(TYP_SIMD16);
+            for (unsigned i = 0; i < vectorSize; i++)
+            {
+                vecCon->gtSimdVal.u8[i] = fillByte;
+            }
+
+            GenTree* storeAddr = gtNewLclvNode(baseLclNum, addrType);
+            if (offset != 0)
+            {
+                storeAddr = gtNewOperNode(GT_ADD, addrType, storeAddr, gtNewIconNode(offset, TYP_I_IMPL));
+            }
+
+            GenTree* const ind = gtNewOperNode(GT_IND, TYP_SIMD16, storeAddr);
+            ind->gtFlags |= GTF_IND_UNALIGNED;
+
+            fgNewStmtAtEnd(body, gtNewAssignNode(ind, vecCon));
+
+            offset += (int)vectorSize;
+        }
+
+        // The iterator may be live after the loop; give it its final value.
+        fgNewStmtAtEnd(body, gtNewAssignNode(gtNewLclvNode(lvar, genActualType(lvaTable[lvar].TypeGet())),
+                                             gtNewIconNode(llim)));
+
+        // The body no longer loops.
+        fgRemoveRefPred(body, body);
+        body->bbJumpKind = BBJ_NONE;
+        body->bbJumpDest = nullptr;
+        body->bbFlags &= ~(BBF_LOOP_HEAD | BBF_BACKWARD_JUMP_SOURCE | BBF_BACKWARD_JUMP_TARGET);
+        body->scaleBBWeight(1.0 / BB_LOOP_WEIGHT_SCALE);
+
+#if FEATURE_LOOP_ALIGN
+        body->unmarkLoopAlign(this DEBUG_ARG("Vectorized loop"));
+#endif
+
+        optMarkLoopRemoved(lnum);
+        change = true;
+    }
+
+    return change ? PhaseStatus::MODIFIED_EVERYTHING : PhaseStatus::MODIFIED_NOTHING;
+#endif // FEATURE_SIMD
+}
+
+//-----------------------------------------------------------------------------
+// optStrengthReduceLoops: replace multiplications of a loop iterator by a
+//   constant with a running addition.
+//
+// Occurrences of "i * icon" in an iterator loop body are classic derived
+// induction variables: rather than re-deriving the multiply from 'i' every
+// iteration, a new temp is initialized to "i * icon" in the loop head and
+// bumped by "iterConst * icon" right after the iterator update, and the
+// multiplies become uses of the temp.
+//
+// Both GT_MUL and the running addition wrap modulo 2^32, so the rewrite
+// preserves values even when the multiplication overflows; overflow-checked
+// multiplies are not candidates. Multiplications by powers of two and by the
+// scales an address mode can fold (3, 5, 9) are also left alone: those become
+// shifts or LEAs anyway, and trading them for another loop-carried live
+// variable would hurt more than help.
+//
+// Only constant multipliers are handled. Multiplies by a loop-invariant local
+// (a variable stride) would additionally need an invariance proof that this
+// per-loop analysis doesn't have; loop hoisting has one, but runs much later,
+// over value numbers, and cannot create loop-carried state.
+//
+// Returns:
+//   suitable phase status
+//
+PhaseStatus Compiler::optStrengthReduceLoops()
+{
+    if (compCodeOpt() == SMALL_CODE)
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    if (optLoopCount == 0)
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+#ifdef DEBUG
+    if (JitConfig.JitNoStrengthReduction())
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+#endif
+
+    // Collects uses of "iv * icon" multiplies in a loop body.
+    //
+    class IterMulVisitor final : public GenTreeVisitor<IterMulVisitor>
+    {
+        unsigned m_ivLcl;
+
+    public:
+        enum
+        {
+            DoPreOrder = true
+        };
+
+        ArrayStack<GenTree**> m_uses;
+
+        IterMulVisitor(Compiler* compiler, unsigned ivLcl)
+            : GenTreeVisitor(compiler), m_ivLcl(ivLcl), m_uses(compiler->getAllocator(CMK_LoopOpt))
+        {
+        }
+
+        fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+        {
+            GenTree* const node = *use;
+
+            if (node->OperIs(GT_MUL) && node->TypeIs(TYP_INT) && !node->gtOverflow())
+            {
+                GenTree* const op1 = node->AsOp()->gtGetOp1();
+                GenTree* const op2 = node->AsOp()->gtGetOp2();
+
+                if (op1->OperIs(GT_LCL_VAR) && (op1->AsLclVarCommon()->GetLclNum() == m_ivLcl) &&
+                    op2->IsCnsIntOrI() && !op2->IsIconHandle())
+                {
+                    m_uses.Push(use);
+                    return WALK_SKIP_SUBTREES;
+                }
+            }
+
+            return WALK_CONTINUE;
+        }
+    };
+
+    // Multiplications the backend folds into a shift or an address mode scale.
+    //
+    auto isCheapMultiplier = [](ssize_t mul) {
+        if ((mul >= -1) && (mul <= 1))
+        {
+            return true;
+        }
+        const size_t absMul = (mul < 0) ? (size_t)(-mul) : (size_t)mul;
+        return isPow2(absMul) || (absMul == 3) || (absMul == 5) || (absMul == 9);
+    };
+
+    // Don't create more derived induction variables than this per loop;
+    // each one is another loop-carried live range.
+    const int maxTempsPerLoop = 4;
+
+    bool change = false;
+
+    for (unsigned lnum = 0; lnum < optLoopCount; lnum++)
+    {
+        LoopDsc& loop = optLoopTable[lnum];
+
+        if (((loop.lpFlags & LPFLG_ITER) == 0) || loop.lpIsRemoved())
+        {
+            continue;
+        }
+
+        // Only the canonical "i += icon" update.
+        if (loop.lpIterOper() != GT_ADD)
+        {
+            continue;
+        }
+
+        const unsigned ivLcl = loop.lpIterVar();
+
+        if (lvaTable[ivLcl].TypeGet() != TYP_INT)
+        {
+            continue;
+        }
+
+        if (lvaTable[ivLcl].IsAddressExposed() || lvaTable[ivLcl].lvIsStructField)
+        {
+            continue;
+        }
+
+        // The iterator must be updated only by the canonical increment, so a
+        // running addition placed next to it stays in lockstep.
+        if (optIsVarAssigned(loop.lpTop, loop.lpBottom, loop.lpIterTree, ivLcl))
+        {
+            continue;
+        }
+
+        // Every entry to the loop must come through the head, so the temp can
+        // be initialized there.
+        bool entryOk = true;
+        for (BasicBlock* const pred : loop.lpEntry->PredBlocks())
+        {
+            if ((pred != loop.lpHead) && !loop.lpContains(pred))
+            {
+                entryOk = false;
+                break;
+            }
+        }
+        if (!entryOk)
+        {
+            continue;
+        }
+
+        // Find the increment statement in the bottom block. Multiplies at or
+        // after it would see the updated iterator, so collection stops there.
+        Statement* incrStmt = nullptr;
+        for (Statement* const stmt : loop.lpBottom->Statements())
+        {
+            if (stmt->GetRootNode() == loop.lpIterTree)
+            {
+                incrStmt = stmt;
+                break;
+            }
+        }
+        if (incrStmt == nullptr)
+        {
+            continue;
+        }
+
+        // Collect candidate multiplies from the loop body.
+        //
+        IterMulVisitor visitor(this, ivLcl);
+        for (BasicBlock* const block : loop.LoopBlocks())
+        {
+            for (Statement* const stmt : block->Statements())
+            {
+                if ((block == loop.lpBottom) && (stmt == incrStmt))
+                {
+                    break;
+                }
+                visitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+            }
+        }
+
+        // Group the uses by multiplier; each distinct multiplier gets one
+        // running-addition temp.
+        //
+        int tempsCreated = 0;
+        for (int i = 0; (i < visitor.m_uses.Height()) && (tempsCreated < maxTempsPerLoop); i++)
+        {
+            GenTree* const firstUse = *visitor.m_uses.Bottom(i);
+            if (firstUse->OperIs(GT_LCL_VAR))
+            {
+                // Already rewritten as part of an earlier group.
+                continue;
+            }
+
+            const ssize_t multiplier = firstUse->AsOp()->gtGetOp2()->AsIntCon()->IconValue();
+            if (isCheapMultiplier(multiplier))
+            {
+                continue;
+            }
+
+            const unsigned tempLcl = lvaGrabTemp(false DEBUGARG("strength reduced iv"));
+
+            JITDUMP(FMT_LP ": strength reducing V%02u * %d into V%02u\n", lnum, ivLcl, (int)multiplier, tempLcl);
+
+            // In the head: temp = i * icon.
+            GenTree* const initMul =
+                gtNewOperNode(GT_MUL, TYP_INT, gtNewLclvNode(ivLcl, TYP_INT), gtNewIconNode((int)multiplier));
+            fgNewStmtNearEnd(loop.lpHead, gtNewTempAssign(tempLcl, initMul));
+
+            // After the iterator update: temp += iterConst * icon (with the
+            // same wraparound the multiply has).
+            const int deltaVal = (int)((unsigned)loop.lpIterConst() * (unsigned)multiplier);
+            GenTree* const delta =
+                gtNewOperNode(GT_ADD, TYP_INT, gtNewLclvNode(tempLcl, TYP_INT), gtNewIconNode(deltaVal));
+            fgInsertStmtAfter(loop.lpBottom, incrStmt, fgNewStmtFromTree(gtNewTempAssign(tempLcl, delta)));
+
+            // Replace all multiplies by this multiplier with the temp.
+            for (int j = i; j < visitor.m_uses.Height(); j++)
+            {
+                GenTree** const use  = visitor.m_uses.Bottom(j);
+                GenTree* const  node = *use;
+                if (node->OperIs(GT_MUL) &&
+                    (node->AsOp()->gtGetOp2()->AsIntCon()->IconValue() == multiplier))
+                {
+                    JITDUMP("  replacing [%06u] with V%02u\n", dspTreeID(node), tempLcl);
+                    *use = gtNewLclvNode(tempLcl, TYP_INT);
+                    DEBUG_DESTROY_NODE(node->AsOp()->gtGetOp1(), node->AsOp()->gtGetOp2(), node);
+                }
+            }
+
+            tempsCreated++;
+            change = true;
+        }
+    }
+
+    return change ? PhaseStatus::MODIFIED_EVERYTHING : PhaseStatus::MODIFIED_NOTHING;
+}
+
 #ifdef _PREFAST_
 #pragma warning(push)
 #pragma warning(disable : 21000) // Suppress PREFast warning about overly large function
@@ -0,0 +1,824 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+/*XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XX                                                                           XX
+XX           Sparse Conditional Constant Propagation                         XX
+XX                                                                           XX
+XX  Classic SCCP over the SSA form built by SsaBuilder. Unlike the later     XX
+XX  VN-based assertion propagation, this pass evaluates loop-carried phis    XX
+XX  optimistically, so constants that flow around back edges (and branches   XX
+XX  decided by them) are discovered rather than pessimistically dropped.     XX
+XX                                                                           XX
+XX  The pass tracks a three-level lattice (unknown/constant/varying) for     XX
+XX  every integral SSA definition, and executability for every flowgraph     XX
+XX  edge. Conditions that evaluate to a lattice constant keep their          XX
+XX  not-taken successor non-executable, which in turn sharpens the phi       XX
+XX  meets in the blocks downstream. Once the fixpoint is reached,            XX
+XX  constant uses are replaced in place and decided conditional branches     XX
+XX  are folded the same way redundant branch opts folds them.                XX
+XX                                                                           XX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+*/
+
+#include "jitpch.h"
+#ifdef _MSC_VER
+#pragma hdrstop
+#endif
+
+class SparseCondConstProp
+{
+    enum class LatticeKind : uint8_t
+    {
+        Unknown, // Top: no value has reached this def yet (optimistic)
+        Constant,
+        Varying // Bottom: more than one value reaches this def
+    };
+
+    struct LatticeValue
+    {
+        LatticeKind kind;
+        ssize_t     value;
+    };
+
+    Compiler* const m_comp;
+    CompAllocator   m_alloc;
+
+    // Per local, per SSA def lattice cells; rows allocated lazily.
+    LatticeValue** m_defValues;
+
+    // Executable blocks, recomputed by FloodFillExecutable each round.
+    BitVecTraits m_blockTraits;
+    BitVec       m_executable;
+
+    // For an executable BBJ_COND block whose condition is a lattice constant,
+    // the successor that will be taken; nullptr if undecided. Indexed by bbNum.
+    BasicBlock** m_takenSucc;
+
+    bool     m_latticeChanged;
+    unsigned m_numConstUses;
+    unsigned m_numFoldedBranches;
+
+public:
+    SparseCondConstProp(Compiler* comp)
+        : m_comp(comp)
+        , m_alloc(comp->getAllocator(CMK_SparseConstProp))
+        , m_defValues(nullptr)
+        , m_blockTraits(comp->fgBBNumMax + 1, comp)
+        , m_executable(BitVecOps::MakeEmpty(&m_blockTraits))
+        , m_takenSucc(nullptr)
+        , m_latticeChanged(false)
+        , m_numConstUses(0)
+        , m_numFoldedBranches(0)
+    {
+        m_defValues = m_alloc.allocate<LatticeValue*>(comp->lvaCount);
+        memset(m_defValues, 0, comp->lvaCount * sizeof(LatticeValue*));
+
+        m_takenSucc = m_alloc.allocate<BasicBlock*>(comp->fgBBNumMax + 1);
+        memset(m_takenSucc, 0, (comp->fgBBNumMax + 1) * sizeof(BasicBlock*));
+    }
+
+    //------------------------------------------------------------------------
+    // Run: propagate lattice values to a fixpoint, then rewrite the IR.
+    //
+    // Returns:
+    //    Suitable phase status.
+    //
+    PhaseStatus Run()
+    {
+        if (!Propagate())
+        {
+            return PhaseStatus::MODIFIED_NOTHING;
+        }
+
+        Transform();
+
+        JITDUMP("\nSCCP: replaced %u constant uses, folded %u branches\n", m_numConstUses, m_numFoldedBranches);
+
+        return ((m_numConstUses > 0) || (m_numFoldedBranches > 0)) ? PhaseStatus::MODIFIED_EVERYTHING
+                                                                   : PhaseStatus::MODIFIED_NOTHING;
+    }
+
+private:
+    static bool IsTrackedType(var_types type)
+    {
+        return (type == TYP_INT) || (type == TYP_LONG);
+    }
+
+    static LatticeValue Unknown()
+    {
+        return {LatticeKind::Unknown, 0};
+    }
+
+    static LatticeValue Varying()
+    {
+        return {LatticeKind::Varying, 0};
+    }
+
+    static LatticeValue Constant(ssize_t value)
+    {
+        return {LatticeKind::Constant, value};
+    }
+
+    //------------------------------------------------------------------------
+    // GetDefValue: get the lattice cell for an SSA def, or nullptr if the
+    //    local is not eligible for tracking.
+    //
+    LatticeValue* GetDefValue(unsigned lclNum, unsigned ssaNum)
+    {
+        if ((ssaNum == SsaConfig::RESERVED_SSA_NUM) || !m_comp->lvaInSsa(lclNum))
+        {
+            return nullptr;
+        }
+
+        LclVarDsc* const varDsc = m_comp->lvaGetDesc(lclNum);
+
+        if (!IsTrackedType(genActualType(varDsc->TypeGet())))
+        {
+            return nullptr;
+        }
+
+        LatticeValue* row = m_defValues[lclNum];
+        if (row == nullptr)
+        {
+            const unsigned count = varDsc->lvPerSsaData.GetCount();
+            row                  = m_alloc.allocate<LatticeValue>(count);
+
+            for (unsigned i = 0; i < count; i++)
+            {
+                // Defs with no assignment (parameters, uninitialized locals,
+                // partial "use-def" defs) can hold any value.
+                LclSsaVarDsc* const ssaDef = varDsc->GetPerSsaData(SsaConfig::FIRST_SSA_NUM + i);
+                row[i] = (ssaDef->GetAssignment() == nullptr) ? Varying() : Unknown();
+            }
+
+            m_defValues[lclNum] = row;
+        }
+
+        return &row[ssaNum - SsaConfig::FIRST_SSA_NUM];
+    }
+
+    //------------------------------------------------------------------------
+    // LowerDefValue: monotonically lower the lattice cell of an SSA def.
+    //
+    void LowerDefValue(unsigned lclNum, unsigned ssaNum, const LatticeValue& newValue)
+    {
+        LatticeValue* const cell = GetDefValue(lclNum, ssaNum);
+
+        if (cell == nullptr)
+        {
+            return;
+        }
+
+        if (cell->kind == LatticeKind::Varying)
+        {
+            return;
+        }
+
+        LatticeValue lowered = newValue;
+
+        // Guard monotonicity: a cell must never go back up the lattice, and a
+        // constant cell that sees a different constant becomes varying.
+        if ((cell->kind == LatticeKind::Constant) &&
+            ((lowered.kind == LatticeKind::Unknown) ||
+             ((lowered.kind == LatticeKind::Constant) && (lowered.value != cell->value))))
+        {
+            lowered = Varying();
+        }
+
+        if ((lowered.kind != cell->kind) || ((lowered.kind == LatticeKind::Constant) && (lowered.value != cell->value)))
+        {
+            *cell            = lowered;
+            m_latticeChanged = true;
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // Meet: standard optimistic lattice meet.
+    //
+    static LatticeValue Meet(const LatticeValue& a, const LatticeValue& b)
+    {
+        if ((a.kind == LatticeKind::Varying) || (b.kind == LatticeKind::Varying))
+        {
+            return Varying();
+        }
+        if (a.kind == LatticeKind::Unknown)
+        {
+            return b;
+        }
+        if (b.kind == LatticeKind::Unknown)
+        {
+            return a;
+        }
+        return (a.value == b.value) ? a : Varying();
+    }
+
+    //------------------------------------------------------------------------
+    // IsEdgeExecutable: is the flow edge (pred -> succ) executable under the
+    //    current branch decisions?
+    //
+    bool IsEdgeExecutable(BasicBlock* pred, BasicBlock* succ)
+    {
+        if (!BitVecOps::IsMember(&m_blockTraits, m_executable, pred->bbNum))
+        {
+            return false;
+        }
+
+        BasicBlock* const taken = m_takenSucc[pred->bbNum];
+        return (taken == nullptr) || (taken == succ);
+    }
+
+    //------------------------------------------------------------------------
+    // Truncate: normalize a folded result to its evaluation type.
+    //
+    static ssize_t Truncate(var_types type, ssize_t value)
+    {
+        return (genActualType(type) == TYP_INT) ? (ssize_t)(int32_t)value : value;
+    }
+
+    //------------------------------------------------------------------------
+    // Evaluate: compute the lattice value of an expression tree.
+    //
+    // Only integral computations whose folding cannot change observable
+    // behavior are evaluated; everything else is varying. Trees with unknown
+    // operands stay unknown so that the optimistic phi meets can resolve.
+    //
+    LatticeValue Evaluate(GenTree* tree)
+    {
+        const var_types type = genActualType(tree->TypeGet());
+
+        switch (tree->OperGet())
+        {
+            case GT_CNS_INT:
+                // Handles may be relocated; do not treat them as plain numbers.
+                if (!IsTrackedType(type) || tree->IsIconHandle())
+                {
+                    return Varying();
+                }
+                return Constant(Truncate(type, tree->AsIntCon()->IconValue()));
+
+            case GT_LCL_VAR:
+            {
+                GenTreeLclVarCommon* const lcl  = tree->AsLclVarCommon();
+                LatticeValue* const        cell = GetDefValue(lcl->GetLclNum(), lcl->GetSsaNum());
+                return (cell != nullptr) ? *cell : Varying();
+            }
+
+            case GT_COMMA:
+                return Evaluate(tree->AsOp()->gtGetOp2());
+
+            case GT_NEG:
+            case GT_NOT:
+            {
+                if (!IsTrackedType(type))
+                {
+                    return Varying();
+                }
+
+                const LatticeValue op = Evaluate(tree->AsOp()->gtGetOp1());
+                if (op.kind != LatticeKind::Constant)
+                {
+                    return op;
+                }
+
+                const ssize_t result = (tree->OperGet() == GT_NEG) ? -op.value : ~op.value;
+                return Constant(Truncate(type, result));
+            }
+
+            case GT_CAST:
+                return EvaluateCast(tree->AsCast());
+
+            case GT_ADD:
+            case GT_SUB:
+            case GT_MUL:
+            case GT_AND:
+            case GT_OR:
+            case GT_XOR:
+            case GT_LSH:
+            case GT_RSH:
+            case GT_RSZ:
+            case GT_EQ:
+            case GT_NE:
+            case GT_LT:
+            case GT_LE:
+            case GT_GE:
+            case GT_GT:
+                return EvaluateBinary(tree->AsOp());
+
+            default:
+                return Varying();
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // EvaluateCast: evaluate a non-overflow-checking integral cast.
+    //
+    LatticeValue EvaluateCast(GenTreeCast* cast)
+    {
+        if (cast->gtOverflow())
+        {
+            return Varying();
+        }
+
+        const var_types castToType = cast->CastToType();
+        const var_types srcType    = genActualType(cast->CastOp()->TypeGet());
+
+        if (!varTypeIsIntegral(castToType) || !IsTrackedType(srcType))
+        {
+            return Varying();
+        }
+
+        const LatticeValue op = Evaluate(cast->CastOp());
+        if (op.kind != LatticeKind::Constant)
+        {
+            return op;
+        }
+
+        int64_t value = (srcType == TYP_INT) ? (int64_t)(int32_t)op.value : (int64_t)op.value;
+
+        switch (castToType)
+        {
+            case TYP_BYTE:
+                value = (int8_t)value;
+                break;
+            case TYP_UBYTE:
+            case TYP_BOOL:
+                value = (uint8_t)value;
+                break;
+            case TYP_SHORT:
+                value = (int16_t)value;
+                break;
+            case TYP_USHORT:
+                value = (uint16_t)value;
+                break;
+            case TYP_INT:
+                value = (int32_t)value;
+                break;
+            case TYP_UINT:
+                value = cast->IsUnsigned() ? (int64_t)(uint32_t)value : (int64_t)(int32_t)value;
+                break;
+            case TYP_LONG:
+            case TYP_ULONG:
+                if (cast->IsUnsigned() && (srcType == TYP_INT))
+                {
+                    value = (int64_t)(uint32_t)value;
+                }
+                break;
+            default:
+                return Varying();
+        }
+
+        return Constant(Truncate(genActualType(cast->TypeGet()), (ssize_t)value));
+    }
+
+    //------------------------------------------------------------------------
+    // EvaluateBinary: evaluate an integral binary operator or relop.
+    //
+    LatticeValue EvaluateBinary(GenTreeOp* tree)
+    {
+        const var_types opType = genActualType(tree->gtGetOp1()->TypeGet());
+
+        if (!IsTrackedType(genActualType(tree->TypeGet())) || !IsTrackedType(opType))
+        {
+            return Varying();
+        }
+
+        if (tree->gtOverflowEx())
+        {
+            return Varying();
+        }
+
+        const LatticeValue op1 = Evaluate(tree->gtGetOp1());
+        const LatticeValue op2 = Evaluate(tree->gtGetOp2());
+
+        if ((op1.kind == LatticeKind::Varying) || (op2.kind == LatticeKind::Varying))
+        {
+            return Varying();
+        }
+        if ((op1.kind == LatticeKind::Unknown) || (op2.kind == LatticeKind::Unknown))
+        {
+            return Unknown();
+        }
+
+        const bool     isUnsigned = tree->IsUnsigned();
+        const int64_t  v1         = (opType == TYP_INT) ? (int64_t)(int32_t)op1.value : (int64_t)op1.value;
+        const int64_t  v2         = (opType == TYP_INT) ? (int64_t)(int32_t)op2.value : (int64_t)op2.value;
+        const uint64_t u1         = (opType == TYP_INT) ? (uint64_t)(uint32_t)op1.value : (uint64_t)op1.value;
+        const uint64_t u2         = (opType == TYP_INT) ? (uint64_t)(uint32_t)op2.value : (uint64_t)op2.value;
+        const unsigned shiftMask  = (opType == TYP_INT) ? 31 : 63;
+
+        int64_t result;
+        switch (tree->OperGet())
+        {
+            // Arithmetic wraps; evaluate in the unsigned domain to avoid UB.
+            case GT_ADD:
+                result = (int64_t)(u1 + u2);
+                break;
+            case GT_SUB:
+                result = (int64_t)(u1 - u2);
+                break;
+            case GT_MUL:
+                result = (int64_t)(u1 * u2);
+                break;
+            case GT_AND:
+                result = v1 & v2;
+                break;
+            case GT_OR:
+                result = v1 | v2;
+                break;
+            case GT_XOR:
+                result = v1 ^ v2;
+                break;
+            case GT_LSH:
+                result = (int64_t)(u1 << (op2.value & shiftMask));
+                break;
+            case GT_RSH:
+                result = v1 >> (op2.value & shiftMask);
+                break;
+            case GT_RSZ:
+                result = (int64_t)(u1 >> (op2.value & shiftMask));
+                break;
+            case GT_EQ:
+                result = (v1 == v2) ? 1 : 0;
+                break;
+            case GT_NE:
+                result = (v1 != v2) ? 1 : 0;
+                break;
+            case GT_LT:
+                result = (isUnsigned ? (u1 < u2) : (v1 < v2)) ? 1 : 0;
+                break;
+            case GT_LE:
+                result = (isUnsigned ? (u1 <= u2) : (v1 <= v2)) ? 1 : 0;
+                break;
+            case GT_GE:
+                result = (isUnsigned ? (u1 >= u2) : (v1 >= v2)) ? 1 : 0;
+                break;
+            case GT_GT:
+                result = (isUnsigned ? (u1 > u2) : (v1 > v2)) ? 1 : 0;
+                break;
+            default:
+                return Varying();
+        }
+
+        return Constant(Truncate(genActualType(tree->TypeGet()), (ssize_t)result));
+    }
+
+    //------------------------------------------------------------------------
+    // EvaluatePhi: meet the phi args that flow in over executable edges.
+    //
+    LatticeValue EvaluatePhi(BasicBlock* block, GenTreePhi* phi)
+    {
+        LatticeValue result = Unknown();
+
+        for (GenTreePhi::Use& use : phi->Uses())
+        {
+            GenTreePhiArg* const phiArg = use.GetNode()->AsPhiArg();
+
+            if (!IsEdgeExecutable(phiArg->gtPredBB, block))
+            {
+                continue;
+            }
+
+            LatticeValue* const argCell = GetDefValue(phiArg->GetLclNum(), phiArg->GetSsaNum());
+            result                      = Meet(result, (argCell != nullptr) ? *argCell : Varying());
+
+            if (result.kind == LatticeKind::Varying)
+            {
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    //------------------------------------------------------------------------
+    // EvaluateAssignment: lower the lattice cell of the def made by an ASG.
+    //
+    void EvaluateAssignment(BasicBlock* block, GenTreeOp* asg)
+    {
+        assert(asg->OperIs(GT_ASG));
+
+        GenTree* const dst = asg->gtGetOp1();
+
+        if (!dst->OperIs(GT_LCL_VAR))
+        {
+            // Partial defs through LCL_FLD lower the def cell when we can find it.
+            if (dst->OperIs(GT_LCL_FLD))
+            {
+                GenTreeLclVarCommon* const fld = dst->AsLclVarCommon();
+                LowerDefValue(fld->GetLclNum(), fld->GetSsaNum(), Varying());
+            }
+            return;
+        }
+
+        GenTreeLclVarCommon* const lclDef = dst->AsLclVarCommon();
+
+        // Partial ("use-def") defs merge with the previous value; treat as varying.
+        if ((lclDef->gtFlags & GTF_VAR_USEASG) != 0)
+        {
+            LowerDefValue(lclDef->GetLclNum(), lclDef->GetSsaNum(), Varying());
+            return;
+        }
+
+        GenTree* const     src = asg->gtGetOp2();
+        const LatticeValue value =
+            src->OperIs(GT_PHI) ? EvaluatePhi(block, src->AsPhi()) : Evaluate(src);
+
+        LowerDefValue(lclDef->GetLclNum(), lclDef->GetSsaNum(), value);
+    }
+
+    //------------------------------------------------------------------------
+    // VisitBlock: evaluate the statements of an executable block and update
+    //    the block's branch decision.
+    //
+    void VisitBlock(BasicBlock* block)
+    {
+        for (Statement* const stmt : block->Statements())
+        {
+            for (GenTree* tree = stmt->GetTreeList(); tree != nullptr; tree = tree->gtNext)
+            {
+                if (tree->OperIs(GT_ASG))
+                {
+                    EvaluateAssignment(block, tree->AsOp());
+                }
+            }
+        }
+
+        if (block->bbJumpKind != BBJ_COND)
+        {
+            return;
+        }
+
+        BasicBlock* decided = nullptr;
+
+        Statement* const lastStmt = block->lastStmt();
+        if ((lastStmt != nullptr) && lastStmt->GetRootNode()->OperIs(GT_JTRUE))
+        {
+            const LatticeValue cond = Evaluate(lastStmt->GetRootNode()->AsOp()->gtGetOp1());
+            if (cond.kind == LatticeKind::Constant)
+            {
+                decided = (cond.value != 0) ? block->bbJumpDest : block->bbNext;
+            }
+        }
+
+        if (m_takenSucc[block->bbNum] != decided)
+        {
+            m_takenSucc[block->bbNum] = decided;
+            m_latticeChanged          = true;
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // FloodFillExecutable: recompute the executable block set from the entry
+    //    block, honoring the current branch decisions.
+    //
+    void FloodFillExecutable()
+    {
+        BitVecOps::ClearD(&m_blockTraits, m_executable);
+
+        ArrayStack<BasicBlock*> worklist(m_alloc);
+        worklist.Push(m_comp->fgFirstBB);
+        BitVecOps::AddElemD(&m_blockTraits, m_executable, m_comp->fgFirstBB->bbNum);
+
+        while (!worklist.Empty())
+        {
+            BasicBlock* const block = worklist.Pop();
+
+            // Handlers are entered by flow the main graph does not model;
+            // treating their entries as executable keeps the analysis sound.
+            //
+            const unsigned numSucc = block->NumSucc(m_comp);
+            for (unsigned i = 0; i < numSucc; i++)
+            {
+                BasicBlock* const succ = block->GetSucc(i, m_comp);
+
+                if (!IsEdgeExecutable(block, succ))
+                {
+                    continue;
+                }
+
+                if (!BitVecOps::IsMember(&m_blockTraits, m_executable, succ->bbNum))
+                {
+                    BitVecOps::AddElemD(&m_blockTraits, m_executable, succ->bbNum);
+                    worklist.Push(succ);
+                }
+            }
+        }
+
+        // Flow into EH handlers is implicit; keep them executable.
+        for (EHblkDsc* const HBtab : EHClauses(m_comp))
+        {
+            MarkEHEntryExecutable(HBtab->ebdHndBeg);
+            if (HBtab->HasFilter())
+            {
+                MarkEHEntryExecutable(HBtab->ebdFilter);
+            }
+        }
+    }
+
+    void MarkEHEntryExecutable(BasicBlock* entry)
+    {
+        ArrayStack<BasicBlock*> worklist(m_alloc);
+
+        if (!BitVecOps::IsMember(&m_blockTraits, m_executable, entry->bbNum))
+        {
+            BitVecOps::AddElemD(&m_blockTraits, m_executable, entry->bbNum);
+            worklist.Push(entry);
+        }
+
+        while (!worklist.Empty())
+        {
+            BasicBlock* const block = worklist.Pop();
+
+            const unsigned numSucc = block->NumSucc(m_comp);
+            for (unsigned i = 0; i < numSucc; i++)
+            {
+                BasicBlock* const succ = block->GetSucc(i, m_comp);
+
+                if (IsEdgeExecutable(block, succ) &&
+                    !BitVecOps::IsMember(&m_blockTraits, m_executable, succ->bbNum))
+                {
+                    BitVecOps::AddElemD(&m_blockTraits, m_executable, succ->bbNum);
+                    worklist.Push(succ);
+                }
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // Propagate: iterate lattice evaluation to a fixpoint.
+    //
+    // Returns:
+    //    true if a fixpoint was reached (results are usable).
+    //
+    bool Propagate()
+    {
+        // Each round either lowers some lattice cell or changes a branch
+        // decision, so the round count is bounded; the limit is a safety net.
+        const unsigned iterationLimit = 2 * m_comp->fgBBcount + 100;
+
+        for (unsigned iteration = 0; iteration < iterationLimit; iteration++)
+        {
+            m_latticeChanged = false;
+
+            FloodFillExecutable();
+
+            for (BasicBlock* const block : m_comp->Blocks())
+            {
+                if (BitVecOps::IsMember(&m_blockTraits, m_executable, block->bbNum))
+                {
+                    VisitBlock(block);
+                }
+            }
+
+            if (!m_latticeChanged)
+            {
+                JITDUMP("SCCP: fixpoint after %u rounds\n", iteration + 1);
+                return true;
+            }
+        }
+
+        // Should not happen; bail out rather than use unconverged results.
+        JITDUMP("SCCP: no fixpoint after %u rounds, giving up\n", iterationLimit);
+        assert(!"SCCP failed to converge");
+        return false;
+    }
+
+    //------------------------------------------------------------------------
+    // Transform: rewrite constant uses and fold decided branches.
+    //
+    void Transform()
+    {
+        for (BasicBlock* const block : m_comp->Blocks())
+        {
+            if (!BitVecOps::IsMember(&m_blockTraits, m_executable, block->bbNum))
+            {
+                continue;
+            }
+
+            for (Statement* stmt = block->firstStmt(); stmt != nullptr;)
+            {
+                Statement* const next = stmt->GetNextStmt();
+
+                if (!stmt->IsPhiDefnStmt())
+                {
+                    TransformStmt(block, stmt);
+                }
+
+                stmt = next;
+            }
+
+            FoldBranch(block);
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // TransformStmt: replace constant local uses in a statement.
+    //
+    void TransformStmt(BasicBlock* block, Statement* stmt)
+    {
+        bool rewritten = false;
+
+        for (GenTree* tree = stmt->GetTreeList(); tree != nullptr; tree = tree->gtNext)
+        {
+            if (!tree->OperIs(GT_LCL_VAR) || ((tree->gtFlags & (GTF_VAR_DEF | GTF_VAR_USEASG)) != 0))
+            {
+                continue;
+            }
+
+            GenTreeLclVarCommon* const lcl  = tree->AsLclVarCommon();
+            LatticeValue* const        cell = GetDefValue(lcl->GetLclNum(), lcl->GetSsaNum());
+
+            if ((cell == nullptr) || (cell->kind != LatticeKind::Constant))
+            {
+                continue;
+            }
+
+            JITDUMP("SCCP: replacing use [%06u] of V%02u.%u in " FMT_BB " with constant\n", m_comp->dspTreeID(tree),
+                    lcl->GetLclNum(), lcl->GetSsaNum(), block->bbNum);
+
+            if (genActualType(tree->TypeGet()) == TYP_INT)
+            {
+                tree->BashToConst(static_cast<int32_t>(cell->value));
+            }
+            else
+            {
+                tree->BashToConst(static_cast<int64_t>(cell->value));
+            }
+
+            rewritten = true;
+            m_numConstUses++;
+        }
+
+        if (rewritten)
+        {
+            m_comp->gtSetStmtInfo(stmt);
+            m_comp->fgSetStmtSeq(stmt);
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // FoldBranch: fold a conditional branch whose direction is decided.
+    //
+    void FoldBranch(BasicBlock* block)
+    {
+        if ((block->bbJumpKind != BBJ_COND) || (m_takenSucc[block->bbNum] == nullptr))
+        {
+            return;
+        }
+
+        Statement* const stmt     = block->lastStmt();
+        GenTree* const   jumpTree = stmt->GetRootNode();
+
+        if (!jumpTree->OperIs(GT_JTRUE))
+        {
+            return;
+        }
+
+        GenTree* const tree = jumpTree->AsOp()->gtGetOp1();
+
+        if (!tree->OperIsCompare())
+        {
+            return;
+        }
+
+        const int relopValue = (m_takenSucc[block->bbNum] == block->bbJumpDest) ? 1 : 0;
+
+        JITDUMP("SCCP: relop [%06u] in " FMT_BB " is always %s\n", m_comp->dspTreeID(tree), block->bbNum,
+                (relopValue != 0) ? "true" : "false");
+
+        // Fold the same way redundant branch opts does: keep any side effects
+        // of the condition, then let morph collapse the now-constant JTRUE.
+        if ((tree->gtFlags & GTF_SIDE_EFFECT) != 0)
+        {
+            GenTree* const relopComma =
+                m_comp->gtNewOperNode(GT_COMMA, TYP_INT, tree, m_comp->gtNewIconNode(relopValue));
+            jumpTree->AsUnOp()->gtOp1 = relopComma;
+        }
+        else
+        {
+            tree->BashToConst(relopValue);
+        }
+
+        m_comp->fgMorphBlockStmt(block, stmt DEBUGARG(__FUNCTION__));
+        m_numFoldedBranches++;
+    }
+};
+
+//------------------------------------------------------------------------
+// optSparseCondConstProp: run sparse conditional constant propagation.
+//
+// This runs immediately after SSA construction and only when optimizations
+// are enabled (so tier-1 and above); the later VN-based passes then see the
+// simplified IR.
+//
+// Returns:
+//    Suitable phase status.
+//
+PhaseStatus Compiler::optSparseCondConstProp()
+{
+    SparseCondConstProp sccp(this);
+    return sccp.Run();
+}
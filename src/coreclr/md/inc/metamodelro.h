@@ -41,6 +41,12 @@ public:
     __checkReturn
     HRESULT PostInit(int iLevel);  // higher number : more checking
 
+    // Copies the hottest tables into one contiguous allocation and repoints
+    // the table descriptors at it. The caller owns the returned allocation
+    // (delete []) and must keep it alive as long as this MiniMd.
+    __checkReturn
+    HRESULT DensifyHotTables(_Outptr_result_maybenull_ BYTE **ppDensifiedData);
+
     // Returns TRUE if token (tk) is valid.
     // For user strings, consideres 0 as valid token.
     BOOL _IsValidToken(
@@ -60,6 +60,7 @@ HRESULT MDApplyEditAndContinue(         // S_OK or error.
 //*****************************************************************************
 MDInternalRO::MDInternalRO()
  :  m_pMethodSemanticsMap(0),
+    m_pDensifiedHotTables(0),
     m_cRefs(1)
 {
 } // MDInternalRO::MDInternalRO
@@ -75,6 +76,9 @@ MDInternalRO::~MDInternalRO()
     if (m_pMethodSemanticsMap)
         delete[] m_pMethodSemanticsMap;
     m_pMethodSemanticsMap = 0;
+    if (m_pDensifiedHotTables)
+        delete[] m_pDensifiedHotTables;
+    m_pDensifiedHotTables = 0;
 } // MDInternalRO::~MDInternalRO
 
 //*****************************************************************************
@@ -123,7 +127,17 @@ HRESULT MDInternalRO::Init(
 
     extern HRESULT _CallInitOnMemHelper(CLiteWeightStgdb<CMiniMd> *pStgdb, ULONG cbData, LPCVOID pData);
 
-    return _CallInitOnMemHelper(&m_LiteWeightStgdb, cbData, (BYTE*) pData);
+    HRESULT hr;
+    IfFailRet(_CallInitOnMemHelper(&m_LiteWeightStgdb, cbData, (BYTE*) pData));
+
+#ifndef DACCESS_COMPILE
+    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MD_DensifyHotTables))
+    {
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.DensifyHotTables(&m_pDensifiedHotTables));
+    }
+#endif
+
+    return S_OK;
 } // MDInternalRO::Init
 
 #ifndef DACCESS_COMPILE
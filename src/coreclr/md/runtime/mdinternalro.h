@@ -754,6 +754,8 @@ private:
     };
     CMethodSemanticsMap *m_pMethodSemanticsMap; // Possible array of method semantics pointers, ordered by method token.
 
+    BYTE        *m_pDensifiedHotTables; // Possible private contiguous copy of the hottest tables (code:CMiniMd::DensifyHotTables).
+
 #ifndef DACCESS_COMPILE
     class CMethodSemanticsMapSorter : public CQuickSort<CMethodSemanticsMap>
     {
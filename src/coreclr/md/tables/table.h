@@ -54,6 +54,19 @@ public:
         m_pData = NULL;
     }
 
+    // Repoints the table at data owned by the caller (see
+    // code:CMiniMd::DensifyHotTables); the caller keeps the data alive for
+    // the lifetime of the table.
+    inline void SetData(BYTE *pData)
+    {
+        m_pData = pData;
+    }
+
+    inline BYTE *GetData() const
+    {
+        return m_pData;
+    }
+
 public:
     //
     // Getters
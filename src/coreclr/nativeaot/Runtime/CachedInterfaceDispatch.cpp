@@ -448,6 +448,10 @@ bool InitializeInterfaceDispatch()
 
 COOP_PINVOKE_HELPER(PTR_Code, RhpUpdateDispatchCellCache, (InterfaceDispatchCell * pCell, PTR_Code pTargetCode, MethodTable* pInstanceType, DispatchCellInfo *pNewCellInfo))
 {
+    // Every call here is a fast-path cache miss that fell back to the resolver; together with the
+    // dispatch count maintained by the stubs this gives the cache hit rate.
+    CID_COUNTER_INC(CacheMisses);
+
     // Attempt to update the cache with this new mapping (if we have any cache at all, the initial state
     // is none).
     InterfaceDispatchCache * pCache = (InterfaceDispatchCache*)pCell->GetCache();
@@ -258,6 +258,25 @@ ds_rt_set_environment_variable (const ep_char16_t *name, const ep_char16_t *valu
     return 0xffff;
 }
 
+/*
+* Heap snapshot
+*/
+
+static
+ds_ipc_result_t
+ds_rt_create_heap_snapshot (
+    const ep_char16_t *snapshotName,
+    uint32_t flags,
+    ep_char8_t *errorMessageBuffer,
+    int32_t cbErrorMessageBuffer)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    // shipping criteria: no EVENTPIPE-NATIVEAOT-TODO left in the codebase
+    // TODO: Snapshot the GC heap
+    return DS_IPC_E_NOTSUPPORTED;
+}
+
 /*
 * DiagnosticServer.
 */
@@ -422,6 +422,25 @@ PAL_GenerateCoreDump(
     LPSTR errorMessageBuffer,
     INT cbErrorMessageBuffer);
 
+// A committed region of memory to be included in a heap snapshot
+typedef struct _PAL_HeapSnapshotRange
+{
+    const void* baseAddress;
+    SIZE_T byteSize;
+} PAL_HeapSnapshotRange;
+
+PALIMPORT
+BOOL
+PALAPI
+PAL_CreateHeapSnapshot(
+    IN LPCSTR snapshotName,
+    IN LPCVOID headerBuffer,
+    IN SIZE_T cbHeaderBuffer,
+    IN const PAL_HeapSnapshotRange* ranges,
+    IN SIZE_T rangeCount,
+    LPSTR errorMessageBuffer,
+    INT cbErrorMessageBuffer);
+
 typedef VOID (*PPAL_STARTUP_CALLBACK)(
     char *modulePath,
     HMODULE hModule,
@@ -539,10 +558,29 @@ PALAPI
 // Start the jitdump file
 PAL_PerfJitDump_Start(const char* path);
 
+// One native range in the debug info accompanying a jitdump method record.
+// perf attributes samples falling into the range to name:lineNumber, so for
+// managed code the name carries the attributed method and the line number the
+// IL offset.
+typedef struct _PerfJitDumpDebugEntry
+{
+    ULONG64 address;     // Native address the range starts at
+    ULONG lineNumber;    // Line number attributed to the range
+    const char* name;    // Null terminated name the range is attributed to
+} PerfJitDumpDebugEntry;
+
+typedef struct _PerfJitDumpDebugInfo
+{
+    ULONG64 entryCount;
+    const PerfJitDumpDebugEntry* entries;
+} PerfJitDumpDebugInfo;
+
 PALIMPORT
 int
 PALAPI
-// Log a method to the jitdump file.
+// Log a method to the jitdump file. debugInfo optionally points to a
+// PerfJitDumpDebugInfo describing the method's native ranges; unwindInfo is
+// currently unused.
 PAL_PerfJitDump_LogMethod(void* pCode, size_t codeSize, const char* symbol, void* debugInfo, void* unwindInfo);
 
 PALIMPORT
@@ -2723,6 +2761,16 @@ PALIMPORT BOOL PALAPI PAL_VirtualUnwind(CONTEXT *context, KNONVOLATILE_CONTEXT_P
 
 PALIMPORT BOOL PALAPI PAL_VirtualUnwindOutOfProc(CONTEXT *context, KNONVOLATILE_CONTEXT_POINTERS *contextPointers, PULONG64 functionStart, SIZE_T baseAddress, UnwindReadMemoryCallback readMemoryCallback);
 
+// Same as PAL_VirtualUnwindOutOfProc, but caches the unwind-relevant layout of each
+// module in the passed in cache so that walking many stacks of the same target only
+// reads the target's module headers once per module. The cache is created with
+// PAL_CreateUnwindModuleCache, is valid for a single target and is not thread safe.
+PALIMPORT BOOL PALAPI PAL_VirtualUnwindOutOfProcWithCache(CONTEXT *context, KNONVOLATILE_CONTEXT_POINTERS *contextPointers, PULONG64 functionStart, SIZE_T baseAddress, UnwindReadMemoryCallback readMemoryCallback, PVOID unwindModuleCache);
+
+PALIMPORT PVOID PALAPI PAL_CreateUnwindModuleCache();
+
+PALIMPORT VOID PALAPI PAL_DestroyUnwindModuleCache(PVOID unwindModuleCache);
+
 PALIMPORT BOOL PALAPI PAL_GetUnwindInfoSize(SIZE_T baseAddress, ULONG64 ehFrameHdrAddr, UnwindReadMemoryCallback readMemoryCallback, PULONG64 ehFrameStart, PULONG64 ehFrameSize);
 
 /* PAL_CS_NATIVE_DATA_SIZE is defined as sizeof(PAL_CRITICAL_SECTION_NATIVE_DATA) */
@@ -3057,6 +3105,20 @@ VirtualFree(
         IN SIZE_T dwSize,
         IN DWORD dwFreeType);
 
+PALIMPORT
+BOOL
+PALAPI
+PAL_AdviseHugePages(
+        IN LPVOID lpAddress,
+        IN SIZE_T dwSize);
+
+PALIMPORT
+BOOL
+PALAPI
+PAL_AdvisePrefetch(
+        IN LPVOID lpAddress,
+        IN SIZE_T dwSize);
+
 
 #if defined(HOST_OSX) && defined(HOST_ARM64)
 
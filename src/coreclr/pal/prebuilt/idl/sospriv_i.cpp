@@ -120,6 +120,8 @@ MIDL_DEFINE_GUID(IID, IID_ISOSDacInterface12,0x1b93bacc,0x8ca4,0x432d,0x94,0x3a,
 
 MIDL_DEFINE_GUID(IID, IID_ISOSDacInterface13,0x3176a8ed,0x597b,0x4f54,0xa7,0x1f,0x83,0x69,0x5c,0x6a,0x8c,0x5e);
 
+MIDL_DEFINE_GUID(IID, IID_ISOSDacInterface14,0xb52eed77,0x81fb,0x45cf,0xaa,0xe3,0x5c,0x27,0x75,0xe8,0x76,0xb6);
+
 #undef MIDL_DEFINE_GUID
 
 #ifdef __cplusplus
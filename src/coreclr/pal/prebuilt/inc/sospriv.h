@@ -3343,6 +3343,109 @@ EXTERN_C const IID IID_ISOSDacInterface13;
 #endif 	/* __ISOSDacInterface13_INTERFACE_DEFINED__ */
 
 
+#ifndef _SOS_BulkObjectData_
+#define _SOS_BulkObjectData_
+typedef struct _SOSBulkObjectData
+    {
+    CLRDATA_ADDRESS Address;
+    CLRDATA_ADDRESS MethodTable;
+    CLRDATA_ADDRESS Size;
+    } 	SOSBulkObjectData;
+#endif // _SOS_BulkObjectData_
+
+
+#ifndef __ISOSDacInterface14_INTERFACE_DEFINED__
+#define __ISOSDacInterface14_INTERFACE_DEFINED__
+
+/* interface ISOSDacInterface14 */
+/* [uuid][local][object] */
+
+
+EXTERN_C const IID IID_ISOSDacInterface14;
+
+#if defined(__cplusplus) && !defined(CINTERFACE)
+
+    MIDL_INTERFACE("b52eed77-81fb-45cf-aae3-5c2775e876b6")
+    ISOSDacInterface14 : public IUnknown
+    {
+    public:
+        virtual HRESULT STDMETHODCALLTYPE GetObjectsInRange(
+            CLRDATA_ADDRESS start,
+            CLRDATA_ADDRESS end,
+            unsigned int alignment,
+            unsigned int count,
+            SOSBulkObjectData *objects,
+            unsigned int *pFetched,
+            CLRDATA_ADDRESS *pNextObject) = 0;
+    };
+
+
+#else 	/* C style interface */
+
+
+    typedef struct ISOSDacInterface14Vtbl
+    {
+        BEGIN_INTERFACE
+
+        HRESULT ( STDMETHODCALLTYPE *QueryInterface )(
+            ISOSDacInterface14 * This,
+            /* [in] */ REFIID riid,
+            /* [annotation][iid_is][out] */
+            _COM_Outptr_  void **ppvObject);
+
+        ULONG ( STDMETHODCALLTYPE *AddRef )(
+            ISOSDacInterface14 * This);
+
+        ULONG ( STDMETHODCALLTYPE *Release )(
+            ISOSDacInterface14 * This);
+
+        HRESULT ( STDMETHODCALLTYPE *GetObjectsInRange )(
+            ISOSDacInterface14 * This,
+            CLRDATA_ADDRESS start,
+            CLRDATA_ADDRESS end,
+            unsigned int alignment,
+            unsigned int count,
+            SOSBulkObjectData *objects,
+            unsigned int *pFetched,
+            CLRDATA_ADDRESS *pNextObject);
+
+        END_INTERFACE
+    } ISOSDacInterface14Vtbl;
+
+    interface ISOSDacInterface14
+    {
+        CONST_VTBL struct ISOSDacInterface14Vtbl *lpVtbl;
+    };
+
+
+
+#ifdef COBJMACROS
+
+
+#define ISOSDacInterface14_QueryInterface(This,riid,ppvObject)	\
+    ( (This)->lpVtbl -> QueryInterface(This,riid,ppvObject) )
+
+#define ISOSDacInterface14_AddRef(This)	\
+    ( (This)->lpVtbl -> AddRef(This) )
+
+#define ISOSDacInterface14_Release(This)	\
+    ( (This)->lpVtbl -> Release(This) )
+
+
+#define ISOSDacInterface14_GetObjectsInRange(This,start,end,alignment,count,objects,pFetched,pNextObject)	\
+    ( (This)->lpVtbl -> GetObjectsInRange(This,start,end,alignment,count,objects,pFetched,pNextObject) )
+
+#endif /* COBJMACROS */
+
+
+#endif 	/* C style interface */
+
+
+
+
+#endif 	/* __ISOSDacInterface14_INTERFACE_DEFINED__ */
+
+
 /* Additional Prototypes for ALL interfaces */
 
 /* end of Additional Prototypes */
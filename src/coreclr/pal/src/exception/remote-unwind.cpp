@@ -167,8 +167,42 @@ typedef struct _libunwindInfo
     CONTEXT *Context;
     ULONG64 FunctionStart;
     UnwindReadMemoryCallback ReadMemory;
+    PVOID ModuleCache;
 } libunwindInfo;
 
+// A PT_LOAD range of a module in the target process.
+typedef struct _ModuleLoadSegment
+{
+    unw_word_t StartIp;
+    unw_word_t EndIp;
+} ModuleLoadSegment;
+
+// Unwind-relevant layout of one module in the target process: load bias, unwind
+// section locations, DT_PLTGOT and the PT_LOAD ranges. Discovering this takes a
+// series of reads of the target's ELF and program headers through the read memory
+// callback, so hosts that walk many stacks (createdump, SOS) can keep it cached
+// per module for the lifetime of a session; see PAL_CreateUnwindModuleCache.
+typedef struct _ModuleUnwindLayout
+{
+    SIZE_T BaseAddress;
+    unw_word_t LoadBias;
+    unw_word_t EhFrameHdrAddr;
+    unw_word_t EhFrameHdrLen;
+    unw_word_t ExidxFrameHdrAddr;
+    unw_word_t ExidxFrameHdrLen;
+    unw_word_t Gp;
+    int SegmentCount;
+    ModuleLoadSegment* Segments;
+    struct _ModuleUnwindLayout* Next;
+} ModuleUnwindLayout;
+
+// Module cache handed out by PAL_CreateUnwindModuleCache. Not thread safe; the
+// owning session must serialize unwinds that share a cache.
+typedef struct _ModuleUnwindCache
+{
+    ModuleUnwindLayout* Modules;
+} ModuleUnwindCache;
+
 #ifdef HOST_UNIX
 
 #define EXTRACT_BITS(value, mask)   ((value >> __builtin_ctz(mask)) & (((1 << __builtin_popcount(mask))) - 1))
@@ -2222,28 +2256,25 @@ get_proc_name(unw_addr_space_t as, unw_word_t addr, char *bufp, size_t buf_len,
     return -UNW_EINVAL;
 }
 
-static int
-find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int need_unwind_info, void *arg)
+#ifndef __APPLE__
+
+// Discover the unwind-relevant layout of the module at info->BaseAddress by
+// reading the target's ELF header, program headers and dynamic section through
+// the read memory callback. On success the caller owns layout->Segments.
+static bool
+GetModuleUnwindLayout(libunwindInfo* info, ModuleUnwindLayout* layout)
 {
-    auto *info = (libunwindInfo*)arg;
-#ifdef __APPLE__
-    bool step;
-    if (!GetProcInfo(ip, pip, info, &step, need_unwind_info)) {
-        return -UNW_EINVAL;
-    }
-    _ASSERTE(!step);
-    return UNW_ESUCCESS;
-#else
-    memset(pip, 0, sizeof(*pip));
+    memset(layout, 0, sizeof(*layout));
+    layout->BaseAddress = info->BaseAddress;
 
     Ehdr ehdr;
     if (!info->ReadMemory((void*)info->BaseAddress, &ehdr, sizeof(ehdr))) {
         ERROR("ELF: reading ehdr %p\n", info->BaseAddress);
-        return -UNW_EINVAL;
+        return false;
     }
     Phdr* phdrAddr = reinterpret_cast<Phdr*>(info->BaseAddress + ehdr.e_phoff);
     int phnum = ehdr.e_phnum;
-    TRACE("ELF: base %p ip %p e_type %d e_phnum %d e_phoff %p\n", info->BaseAddress, ip, ehdr.e_type, ehdr.e_phnum, ehdr.e_phoff);
+    TRACE("ELF: base %p e_type %d e_phnum %d e_phoff %p\n", info->BaseAddress, ehdr.e_type, ehdr.e_phnum, ehdr.e_phoff);
 
     unw_word_t loadbias = info->BaseAddress;
     for (int i = 0; i < phnum; i++)
@@ -2251,7 +2282,7 @@ find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int nee
         Phdr ph;
         if (!info->ReadMemory(phdrAddr + i, &ph, sizeof(ph))) {
             ERROR("ELF: reading phdrAddr %p\n", phdrAddr + i);
-            return -UNW_EINVAL;
+            return false;
         }
         if (ph.p_type == PT_LOAD && ph.p_offset == 0)
         {
@@ -2260,19 +2291,15 @@ find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int nee
             break;
         }
     }
+    layout->LoadBias = loadbias;
 
-    unw_word_t start_ip = (unw_word_t)-1;
-    unw_word_t end_ip = 0;
-
-    // The eh_frame header address
-    unw_word_t ehFrameHdrAddr = 0;
-    unw_word_t ehFrameHdrLen = 0;
-
-    // The arm exidx header address
-    unw_word_t exidxFrameHdrAddr = 0;
-    unw_word_t exidxFrameHdrLen = 0;
+    layout->Segments = (ModuleLoadSegment*)malloc(phnum * sizeof(ModuleLoadSegment));
+    if (layout->Segments == nullptr) {
+        ERROR("ELF: out of memory allocating segments\n");
+        return false;
+    }
 
-    // Search for the module's dynamic header and unwind frames
+    // Search for the module's dynamic header, load segments and unwind frames
     Dyn* dynamicAddr = nullptr;
 
     for (int i = 0; i < phnum; i++, phdrAddr++)
@@ -2280,7 +2307,9 @@ find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int nee
         Phdr ph;
         if (!info->ReadMemory(phdrAddr, &ph, sizeof(ph))) {
             ERROR("ELF: reading phdrAddr %p\n", phdrAddr);
-            return -UNW_EINVAL;
+            free(layout->Segments);
+            layout->Segments = nullptr;
+            return false;
         }
         TRACE("ELF: phdr %p type %d (%x) vaddr %" PRIxA " memsz %" PRIxA " paddr %" PRIxA " filesz %" PRIxA " offset %" PRIxA " align %" PRIxA "\n",
             phdrAddr, ph.p_type, ph.p_type, ph.p_vaddr, ph.p_memsz, ph.p_paddr, ph.p_filesz, ph.p_offset, ph.p_align);
@@ -2288,11 +2317,9 @@ find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int nee
         switch (ph.p_type)
         {
         case PT_LOAD:
-            if ((ip >= (loadbias + ph.p_vaddr)) && (ip < (loadbias + ph.p_vaddr + ph.p_memsz))) {
-                start_ip = loadbias + ph.p_vaddr;
-                end_ip = start_ip + ph.p_memsz;
-                TRACE("ELF: found start_ip/end_ip\n");
-            }
+            layout->Segments[layout->SegmentCount].StartIp = loadbias + ph.p_vaddr;
+            layout->Segments[layout->SegmentCount].EndIp = loadbias + ph.p_vaddr + ph.p_memsz;
+            layout->SegmentCount++;
             break;
 
         case PT_DYNAMIC:
@@ -2300,8 +2327,8 @@ find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int nee
             break;
 
         case PT_GNU_EH_FRAME:
-            ehFrameHdrAddr = loadbias + ph.p_vaddr;
-            ehFrameHdrLen = ph.p_memsz;
+            layout->EhFrameHdrAddr = loadbias + ph.p_vaddr;
+            layout->EhFrameHdrLen = ph.p_memsz;
             break;
 
 #if defined(TARGET_ARM)
@@ -2309,8 +2336,8 @@ find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int nee
 #define PT_ARM_EXIDX   0x70000001      /* See llvm ELF.h */
 #endif /* !PT_ARM_EXIDX */
         case PT_ARM_EXIDX:
-            exidxFrameHdrAddr = loadbias + ph.p_vaddr;
-            exidxFrameHdrLen = ph.p_memsz;
+            layout->ExidxFrameHdrAddr = loadbias + ph.p_vaddr;
+            layout->ExidxFrameHdrLen = ph.p_memsz;
             break;
 #endif
         }
@@ -2323,11 +2350,13 @@ find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int nee
             Dyn dyn;
             if (!info->ReadMemory(dynamicAddr, &dyn, sizeof(dyn))) {
                 ERROR("ELF: reading dynamicAddr %p\n", dynamicAddr);
-                return -UNW_EINVAL;
+                free(layout->Segments);
+                layout->Segments = nullptr;
+                return false;
             }
             if (dyn.d_tag == DT_PLTGOT) {
                 TRACE("ELF: dyn %p tag %d (%x) d_ptr %p\n", dynamicAddr, dyn.d_tag, dyn.d_tag, dyn.d_un.d_ptr);
-                pip->gp = dyn.d_un.d_ptr;
+                layout->Gp = dyn.d_un.d_ptr;
                 break;
             }
             else if (dyn.d_tag == DT_NULL) {
@@ -2337,6 +2366,91 @@ find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int nee
         }
     }
 
+    return true;
+}
+
+#endif // !__APPLE__
+
+static int
+find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int need_unwind_info, void *arg)
+{
+    auto *info = (libunwindInfo*)arg;
+#ifdef __APPLE__
+    bool step;
+    if (!GetProcInfo(ip, pip, info, &step, need_unwind_info)) {
+        return -UNW_EINVAL;
+    }
+    _ASSERTE(!step);
+    return UNW_ESUCCESS;
+#else
+    memset(pip, 0, sizeof(*pip));
+
+    ModuleUnwindLayout localLayout;
+    ModuleUnwindLayout* layout = nullptr;
+    auto* moduleCache = (ModuleUnwindCache*)info->ModuleCache;
+
+    if (moduleCache != nullptr)
+    {
+        for (layout = moduleCache->Modules; layout != nullptr; layout = layout->Next)
+        {
+            if (layout->BaseAddress == info->BaseAddress) {
+                break;
+            }
+        }
+    }
+    if (layout == nullptr)
+    {
+        if (moduleCache != nullptr)
+        {
+            layout = (ModuleUnwindLayout*)malloc(sizeof(ModuleUnwindLayout));
+            if (layout == nullptr) {
+                return -UNW_ENOMEM;
+            }
+            if (!GetModuleUnwindLayout(info, layout)) {
+                free(layout);
+                return -UNW_EINVAL;
+            }
+            layout->Next = moduleCache->Modules;
+            moduleCache->Modules = layout;
+        }
+        else
+        {
+            if (!GetModuleUnwindLayout(info, &localLayout)) {
+                return -UNW_EINVAL;
+            }
+            layout = &localLayout;
+        }
+    }
+
+    unw_word_t start_ip = (unw_word_t)-1;
+    unw_word_t end_ip = 0;
+
+    for (int i = 0; i < layout->SegmentCount; i++)
+    {
+        if ((ip >= layout->Segments[i].StartIp) && (ip < layout->Segments[i].EndIp)) {
+            start_ip = layout->Segments[i].StartIp;
+            end_ip = layout->Segments[i].EndIp;
+            TRACE("ELF: found start_ip/end_ip\n");
+            break;
+        }
+    }
+
+    // The eh_frame header address
+    unw_word_t ehFrameHdrAddr = layout->EhFrameHdrAddr;
+    unw_word_t ehFrameHdrLen = layout->EhFrameHdrLen;
+
+    // The arm exidx header address
+    unw_word_t exidxFrameHdrAddr = layout->ExidxFrameHdrAddr;
+    unw_word_t exidxFrameHdrLen = layout->ExidxFrameHdrLen;
+
+    pip->gp = layout->Gp;
+
+    if (layout == &localLayout)
+    {
+        // No cache; the layout is only borrowed for this frame.
+        free(localLayout.Segments);
+    }
+
 #ifdef FEATURE_USE_SYSTEM_LIBUNWIND
     if (ehFrameHdrAddr == 0) {
         ASSERT("ELF: No PT_GNU_EH_FRAME program header\n");
@@ -2460,10 +2574,10 @@ Parameters:
     functionStart - the pointer to return the starting address of the function or nullptr
     baseAddress - base address of the module to find the unwind info
     readMemoryCallback - reads memory from the target
+    unwindModuleCache - optional module layout cache from PAL_CreateUnwindModuleCache or nullptr
 --*/
-BOOL
-PALAPI
-PAL_VirtualUnwindOutOfProc(CONTEXT *context, KNONVOLATILE_CONTEXT_POINTERS *contextPointers, PULONG64 functionStart, SIZE_T baseAddress, UnwindReadMemoryCallback readMemoryCallback)
+static BOOL
+VirtualUnwindOutOfProc(CONTEXT *context, KNONVOLATILE_CONTEXT_POINTERS *contextPointers, PULONG64 functionStart, SIZE_T baseAddress, UnwindReadMemoryCallback readMemoryCallback, PVOID unwindModuleCache)
 {
     unw_addr_space_t addrSpace = 0;
     unw_cursor_t cursor;
@@ -2475,6 +2589,7 @@ PAL_VirtualUnwindOutOfProc(CONTEXT *context, KNONVOLATILE_CONTEXT_POINTERS *cont
     info.Context = context;
     info.FunctionStart = 0;
     info.ReadMemory = readMemoryCallback;
+    info.ModuleCache = unwindModuleCache;
 
 #ifdef __APPLE__
     unw_proc_info_t procInfo;
@@ -2562,6 +2677,74 @@ exit:
     return result;
 }
 
+BOOL
+PALAPI
+PAL_VirtualUnwindOutOfProc(CONTEXT *context, KNONVOLATILE_CONTEXT_POINTERS *contextPointers, PULONG64 functionStart, SIZE_T baseAddress, UnwindReadMemoryCallback readMemoryCallback)
+{
+    return VirtualUnwindOutOfProc(context, contextPointers, functionStart, baseAddress, readMemoryCallback, nullptr);
+}
+
+/*++
+Function:
+    PAL_VirtualUnwindOutOfProcWithCache
+
+    Same as PAL_VirtualUnwindOutOfProc, but the module layout discovered for each
+    unwound module is kept in the passed in cache and reused for subsequent frames
+    and threads, instead of being re-read from the target for every frame. The
+    cache is not thread safe; unwinds sharing a cache must be serialized.
+--*/
+BOOL
+PALAPI
+PAL_VirtualUnwindOutOfProcWithCache(CONTEXT *context, KNONVOLATILE_CONTEXT_POINTERS *contextPointers, PULONG64 functionStart, SIZE_T baseAddress, UnwindReadMemoryCallback readMemoryCallback, PVOID unwindModuleCache)
+{
+    return VirtualUnwindOutOfProc(context, contextPointers, functionStart, baseAddress, readMemoryCallback, unwindModuleCache);
+}
+
+/*++
+Function:
+    PAL_CreateUnwindModuleCache
+
+    Create a module layout cache for PAL_VirtualUnwindOutOfProcWithCache. Returns
+    nullptr on failure; callers can pass nullptr to unwind without caching.
+--*/
+PVOID
+PALAPI
+PAL_CreateUnwindModuleCache()
+{
+    ModuleUnwindCache* cache = (ModuleUnwindCache*)malloc(sizeof(ModuleUnwindCache));
+    if (cache != nullptr)
+    {
+        cache->Modules = nullptr;
+    }
+    return cache;
+}
+
+/*++
+Function:
+    PAL_DestroyUnwindModuleCache
+
+    Free a cache created by PAL_CreateUnwindModuleCache and all cached layouts.
+--*/
+VOID
+PALAPI
+PAL_DestroyUnwindModuleCache(PVOID unwindModuleCache)
+{
+    ModuleUnwindCache* cache = (ModuleUnwindCache*)unwindModuleCache;
+    if (cache == nullptr)
+    {
+        return;
+    }
+    ModuleUnwindLayout* layout = cache->Modules;
+    while (layout != nullptr)
+    {
+        ModuleUnwindLayout* next = layout->Next;
+        free(layout->Segments);
+        free(layout);
+        layout = next;
+    }
+    free(cache);
+}
+
 BOOL
 PALAPI
 PAL_GetUnwindInfoSize(SIZE_T baseAddress, ULONG64 ehFrameHdrAddr, UnwindReadMemoryCallback readMemoryCallback, PULONG64 ehFrameStart, PULONG64 ehFrameSize)
@@ -2578,6 +2761,7 @@ PAL_GetUnwindInfoSize(SIZE_T baseAddress, ULONG64 ehFrameHdrAddr, UnwindReadMemo
     info.Context = nullptr;
     info.FunctionStart = 0;
     info.ReadMemory = readMemoryCallback;
+    info.ModuleCache = nullptr;
 
     eh_frame_hdr ehFrameHdr;
     if (!info.ReadMemory((PVOID)ehFrameHdrAddr, &ehFrameHdr, sizeof(eh_frame_hdr))) {
@@ -2713,6 +2897,26 @@ PAL_VirtualUnwindOutOfProc(CONTEXT *context, KNONVOLATILE_CONTEXT_POINTERS *cont
     return FALSE;
 }
 
+BOOL
+PALAPI
+PAL_VirtualUnwindOutOfProcWithCache(CONTEXT *context, KNONVOLATILE_CONTEXT_POINTERS *contextPointers, PULONG64 functionStart, SIZE_T baseAddress, UnwindReadMemoryCallback readMemoryCallback, PVOID unwindModuleCache)
+{
+    return FALSE;
+}
+
+PVOID
+PALAPI
+PAL_CreateUnwindModuleCache()
+{
+    return NULL;
+}
+
+VOID
+PALAPI
+PAL_DestroyUnwindModuleCache(PVOID unwindModuleCache)
+{
+}
+
 BOOL
 PALAPI
 PAL_GetUnwindInfoSize(SIZE_T baseAddress, ULONG64 ehFrameHdrAddr, UnwindReadMemoryCallback readMemoryCallback, PULONG64 ehFrameStart, PULONG64 ehFrameSize)
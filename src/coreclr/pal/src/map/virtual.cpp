@@ -1287,6 +1287,68 @@ ExitVirtualProtect:
     return bRetVal;
 }
 
+/*++
+Function:
+  PAL_AdviseHugePages
+
+  Hints the kernel to back the given committed region with huge pages where
+  the platform supports it (transparent huge pages on Linux). The caller is
+  expected to pass a range aligned to the huge page size.
+
+  This is a best-effort performance hint; failure only means the region stays
+  on regular pages.
+--*/
+BOOL
+PALAPI
+PAL_AdviseHugePages(
+        IN LPVOID lpAddress,
+        IN SIZE_T dwSize)
+{
+    BOOL bRetVal = FALSE;
+
+    ENTRY("PAL_AdviseHugePages(lpAddress=%p, dwSize=%u)\n", lpAddress, dwSize);
+
+#ifdef MADV_HUGEPAGE
+    bRetVal = (madvise(lpAddress, dwSize, MADV_HUGEPAGE) == 0);
+#else
+    TRACE("Huge pages requested, but not supported in this PAL configuration\n");
+#endif
+
+    LOGEXIT("PAL_AdviseHugePages returning %s.\n", bRetVal == TRUE ? "TRUE" : "FALSE");
+    return bRetVal;
+}
+
+/*++
+Function:
+  PAL_AdvisePrefetch
+
+  Starts asynchronous readahead of the given region so that later accesses do
+  not take a major fault on every page. Most useful for file mappings on slow
+  or network-backed storage.
+
+  This is a best-effort performance hint; failure only means the pages are
+  faulted in on demand as usual.
+--*/
+BOOL
+PALAPI
+PAL_AdvisePrefetch(
+        IN LPVOID lpAddress,
+        IN SIZE_T dwSize)
+{
+    BOOL bRetVal = FALSE;
+
+    ENTRY("PAL_AdvisePrefetch(lpAddress=%p, dwSize=%u)\n", lpAddress, dwSize);
+
+#ifdef MADV_WILLNEED
+    bRetVal = (madvise(lpAddress, dwSize, MADV_WILLNEED) == 0);
+#else
+    TRACE("Prefetch requested, but not supported in this PAL configuration\n");
+#endif
+
+    LOGEXIT("PAL_AdvisePrefetch returning %s.\n", bRetVal == TRUE ? "TRUE" : "FALSE");
+    return bRetVal;
+}
+
 #if defined(HOST_OSX) && defined(HOST_ARM64)
 PALAPI VOID PAL_JitWriteProtect(bool writeEnable)
 {
@@ -17,6 +17,7 @@
 #include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
 #include <sys/types.h>
@@ -59,6 +60,7 @@ namespace
 #endif
 
         JIT_CODE_LOAD = 0,
+        JIT_CODE_DEBUG_INFO = 2,
     };
 
     uint64_t GetTimeStampNS()
@@ -131,6 +133,67 @@ namespace
         // Null terminated name
         // Optional native code
     };
+
+    struct JitCodeDebugInfoRecord
+    {
+        RecordHeader header;
+        uint64_t code_addr;
+        uint64_t nr_entry;
+        // Followed by nr_entry debug entries:
+        //   uint64_t addr;
+        //   uint32_t lineno;
+        //   uint32_t discrim;
+        //   Null terminated source name
+    };
+
+    struct DebugEntryHeader
+    {
+        uint64_t addr;
+        uint32_t lineno;
+        uint32_t discrim;
+    };
+
+    // Serialize the debug entries into a contiguous JIT_CODE_DEBUG_INFO record
+    // body. Returns a malloc'd buffer the caller must free, or nullptr if the
+    // record could not be built.
+    void* BuildDebugInfoRecord(const PerfJitDumpDebugInfo* debugInfo, uint64_t codeAddr, size_t& recordSize)
+    {
+        recordSize = sizeof(JitCodeDebugInfoRecord);
+        for (uint64_t i = 0; i < debugInfo->entryCount; i++)
+        {
+            recordSize += sizeof(DebugEntryHeader) + strlen(debugInfo->entries[i].name) + 1;
+        }
+
+        void* buffer = malloc(recordSize);
+
+        if (buffer == nullptr)
+            return nullptr;
+
+        JitCodeDebugInfoRecord* record = (JitCodeDebugInfoRecord*)buffer;
+        record->header.id = JIT_CODE_DEBUG_INFO;
+        record->header.total_size = recordSize;
+        record->header.timestamp = GetTimeStampNS();
+        record->code_addr = codeAddr;
+        record->nr_entry = debugInfo->entryCount;
+
+        char* cursor = (char*)(record + 1);
+        for (uint64_t i = 0; i < debugInfo->entryCount; i++)
+        {
+            DebugEntryHeader entryHeader;
+            entryHeader.addr = debugInfo->entries[i].address;
+            entryHeader.lineno = debugInfo->entries[i].lineNumber;
+            entryHeader.discrim = 0;
+
+            memcpy(cursor, &entryHeader, sizeof(entryHeader));
+            cursor += sizeof(entryHeader);
+
+            size_t nameLen = strlen(debugInfo->entries[i].name) + 1;
+            memcpy(cursor, debugInfo->entries[i].name, nameLen);
+            cursor += nameLen;
+        }
+
+        return buffer;
+    }
 };
 
 struct PerfJitDumpState
@@ -240,28 +303,50 @@ exit:
 
             JitCodeLoadRecord record;
 
-            size_t bytesRemaining = sizeof(JitCodeLoadRecord) + symbolLen + 1 + codeSize;
+            size_t debugRecordSize = 0;
+            void* debugRecord = nullptr;
+
+            const PerfJitDumpDebugInfo* info = (const PerfJitDumpDebugInfo*)debugInfo;
+            if (info != nullptr && info->entryCount != 0)
+            {
+                // Dropping the debug info on allocation failure keeps the
+                // method record itself intact.
+                debugRecord = BuildDebugInfoRecord(info, (uint64_t)pCode, debugRecordSize);
+
+                if (debugRecord == nullptr)
+                    debugRecordSize = 0;
+            }
+
+            size_t bytesRemaining = debugRecordSize + sizeof(JitCodeLoadRecord) + symbolLen + 1 + codeSize;
 
             record.header.timestamp = GetTimeStampNS();
             record.vma = (uint64_t) pCode;
             record.code_addr = (uint64_t) pCode;
             record.code_size = codeSize;
-            record.header.total_size = bytesRemaining;
+            record.header.total_size = sizeof(JitCodeLoadRecord) + symbolLen + 1 + codeSize;
 
-            iovec items[] = {
-                // ToDo insert debugInfo and unwindInfo record items immediately before the JitCodeLoadRecord.
-                { &record, sizeof(JitCodeLoadRecord) },
-                { (void *)symbol, symbolLen + 1 },
-                { pCode, codeSize },
-            };
-            size_t itemsCount = sizeof(items) / sizeof(items[0]);
+            iovec items[4];
+            size_t itemsCount = 0;
+
+            // perf expects a JIT_CODE_DEBUG_INFO record to immediately precede
+            // the JIT_CODE_LOAD record it describes.
+            if (debugRecord != nullptr)
+            {
+                items[itemsCount++] = { debugRecord, debugRecordSize };
+            }
+            items[itemsCount++] = { &record, sizeof(JitCodeLoadRecord) };
+            items[itemsCount++] = { (void *)symbol, symbolLen + 1 };
+            items[itemsCount++] = { pCode, codeSize };
 
             size_t itemsWritten = 0;
 
             result = pthread_mutex_lock(&mutex);
 
             if (result != 0)
+            {
+                free(debugRecord);
                 return FatalError(false);
+            }
 
             if (!enabled)
                 goto exit;
@@ -281,6 +366,7 @@ exit:
                     if (errno == EINTR)
                         continue;
 
+                    free(debugRecord);
                     return FatalError(true);
                 }
 
@@ -314,6 +400,8 @@ exit:
 exit:
             result = pthread_mutex_unlock(&mutex);
 
+            free(debugRecord);
+
             if (result != 0)
                 return FatalError(false);
         }
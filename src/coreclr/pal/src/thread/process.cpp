@@ -46,6 +46,7 @@ SET_DEFAULT_DEBUG_CHANNEL(PROCESS); // some headers have code with asserts, so d
 #include <sys/mman.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <fcntl.h>
 #include <signal.h>
 #if HAVE_PRCTL_H
 #include <sys/prctl.h>
@@ -2385,6 +2386,141 @@ PAL_GenerateCoreDump(
     return result;
 }
 
+/*++
+Function:
+  PROCWriteAll
+
+  Writes the whole buffer to the file descriptor, retrying on EINTR and
+  short writes. Only calls async-signal-safe functions so it can run in
+  a forked child.
+
+Return:
+    TRUE success
+    FALSE failed
+--*/
+static BOOL
+PROCWriteAll(int fd, const void* buffer, size_t byteSize)
+{
+    const char* data = (const char*)buffer;
+    while (byteSize > 0)
+    {
+        ssize_t written = write(fd, data, byteSize);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return FALSE;
+        }
+        data += written;
+        byteSize -= (size_t)written;
+    }
+    return TRUE;
+}
+
+/*++
+Function:
+  PAL_CreateHeapSnapshot
+
+Abstract:
+  Public entry point to serialize a snapshot of the given memory ranges
+  to a file while the process keeps running. fork() gives the writer a
+  copy-on-write view of the ranges as of the moment of the call, so the
+  caller only pays for the fork itself; the kernel copies pages lazily
+  as the parent keeps mutating them. The caller must ensure the ranges
+  are quiescent at the moment of the call (e.g. by suspending the
+  runtime across it). A second fork in the intermediate child hands the
+  writer to init for reaping, so the caller's wait is bounded by the
+  cost of the two forks rather than the file write.
+
+Parameters:
+    snapshotName - file path to write the snapshot to
+    headerBuffer / cbHeaderBuffer - caller-built header written before the ranges
+    ranges / rangeCount - committed regions to serialize in order
+
+Return:
+    TRUE success (snapshot writing started; the writer reports failures
+    only via the exit code visible to init)
+    FALSE failed
+--*/
+BOOL
+PAL_CreateHeapSnapshot(
+    LPCSTR snapshotName,
+    LPCVOID headerBuffer,
+    SIZE_T cbHeaderBuffer,
+    const PAL_HeapSnapshotRange* ranges,
+    SIZE_T rangeCount,
+    LPSTR errorMessageBuffer,
+    INT cbErrorMessageBuffer)
+{
+    _ASSERTE(errorMessageBuffer == nullptr || cbErrorMessageBuffer > 0);
+
+    if (snapshotName == nullptr || snapshotName[0] == '\0')
+    {
+        if (errorMessageBuffer != nullptr)
+        {
+            sprintf_s(errorMessageBuffer, cbErrorMessageBuffer, "Problem creating heap snapshot: no snapshot file name\n");
+        }
+        return FALSE;
+    }
+
+    pid_t intermediatepid = fork();
+    if (intermediatepid == -1)
+    {
+        if (errorMessageBuffer != nullptr)
+        {
+            sprintf_s(errorMessageBuffer, cbErrorMessageBuffer, "Problem creating heap snapshot: fork() FAILED %s (%d)\n", strerror(errno), errno);
+        }
+        return FALSE;
+    }
+    else if (intermediatepid == 0)
+    {
+        // Intermediate child: fork the writer and exit immediately so the
+        // writer is reparented to init and the parent only waits for the
+        // forks. Only async-signal-safe functions below - the forked copy
+        // of the process may hold arbitrary locks.
+        pid_t writerpid = fork();
+        if (writerpid == 0)
+        {
+            int fd = open(snapshotName, O_CREAT | O_WRONLY | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+            if (fd == -1)
+            {
+                _exit(-1);
+            }
+            if (!PROCWriteAll(fd, headerBuffer, cbHeaderBuffer))
+            {
+                _exit(-1);
+            }
+            for (SIZE_T i = 0; i < rangeCount; i++)
+            {
+                if (!PROCWriteAll(fd, ranges[i].baseAddress, ranges[i].byteSize))
+                {
+                    _exit(-1);
+                }
+            }
+            close(fd);
+            _exit(0);
+        }
+        _exit(writerpid == -1 ? -1 : 0);
+    }
+
+    // Parent waits only for the intermediate child, which exits as soon
+    // as the writer is forked.
+    int wstatus = 0;
+    int result = waitpid(intermediatepid, &wstatus, 0);
+    if (result != intermediatepid || !WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0)
+    {
+        if (errorMessageBuffer != nullptr)
+        {
+            sprintf_s(errorMessageBuffer, cbErrorMessageBuffer, "Problem creating heap snapshot: fork() of writer FAILED result %d wstatus %08x errno %s (%d)\n",
+                result, wstatus, strerror(errno), errno);
+        }
+        return FALSE;
+    }
+    return TRUE;
+}
+
 /*++
 Function:
   PROCCreateCrashDumpIfEnabled
@@ -1093,6 +1093,7 @@ DWORD WINAPI ProcessStresslogWorker(LPVOID)
         StressLogChunk* slc = StressLog::TranslateMemoryMappedPointer(tsl->curWriteChunk);
         int chunkCount = 0;
         StressMsg* prevMsg = nullptr;
+        bool fPastTimeWindow = false;
         while (true)
         {
             // printf("stress log chunk %zx\n", (size_t)slc);
@@ -1148,7 +1149,12 @@ DWORD WINAPI ProcessStresslogWorker(LPVOID)
                 {
                     if (deltaTime < s_timeFilterStart)
                     {
-                        // we know the times will only get smaller, so can stop here
+                        // we know the times will only get smaller, so can stop here -
+                        // and because we walk chunks from newest to oldest, every
+                        // remaining chunk for this thread is entirely before the time
+                        // window as well, so the chunk walk can stop too instead of
+                        // faulting in the rest of a potentially huge mapped log
+                        fPastTimeWindow = true;
                         break;
                     }
                     if (deltaTime > s_timeFilterEnd)
@@ -1184,6 +1190,8 @@ DWORD WINAPI ProcessStresslogWorker(LPVOID)
                 prevMsg = msg;
                 msg = (StressMsg*)&msg->args[numberOfArgs];
             }
+            if (fPastTimeWindow)
+                break;
             if (slc == StressLog::TranslateMemoryMappedPointer(tsl->chunkListTail) && !tsl->writeHasWrapped)
                 break;
             slc = StressLog::TranslateMemoryMappedPointer(slc->next);
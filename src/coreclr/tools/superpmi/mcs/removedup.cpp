@@ -54,6 +54,17 @@ RemoveDup::~RemoveDup()
     }
 }
 
+// Fold the printable method hash down to a 32-bit map key. The outer map does a
+// binary search on the key, so this keeps the buckets tiny (normally one entry);
+// key collisions are resolved by the full hash comparison below.
+static int methodHashToMapKey(const char* md5Buff)
+{
+    unsigned key = 5381;
+    for (int i = 0; i < MM3_HASH_BUFFER_SIZE - 1; i++)
+        key = key * 33 + (unsigned char)md5Buff[i];
+    return (int)key;
+}
+
 bool RemoveDup::unique(MethodContext* mc)
 {
     if (m_inFile == nullptr)
@@ -69,10 +80,12 @@ bool RemoveDup::unique(MethodContext* mc)
     char md5Buff[MM3_HASH_BUFFER_SIZE];
     mc->dumpMethodHashToBuffer(md5Buff, MM3_HASH_BUFFER_SIZE, /* ignoreMethodName */ true, &newInfo, newFlags);
 
-    if (m_inFile->GetIndex(newInfo.ILCodeSize) == -1)
-        m_inFile->Add(newInfo.ILCodeSize, new DenseLightWeightMap<char*>());
+    int mapKey = methodHashToMapKey(md5Buff);
+
+    if (m_inFile->GetIndex(mapKey) == -1)
+        m_inFile->Add(mapKey, new DenseLightWeightMap<char*>());
 
-    DenseLightWeightMap<char*>* ourRank = m_inFile->Get(newInfo.ILCodeSize);
+    DenseLightWeightMap<char*>* ourRank = m_inFile->Get(mapKey);
 
     for (unsigned i = 0; i < ourRank->GetCount(); i++)
     {
@@ -48,8 +48,11 @@ private:
     bool m_cleanup;
 
     // We use a hash to limit the number of comparisons we need to do.
-    // The first level key to our hash map is ILCodeSize and the second
-    // level map key is just an index and the value is an existing MC Hash.
+    // For `m_inFile`, the first level key is a 32-bit fold of the method hash,
+    // so the inner maps normally hold a single entry and only key collisions
+    // pay for a full hash comparison. For `m_inFileLegacy` (which compares
+    // entire MethodContexts), the first level key is ILCodeSize. In both cases
+    // the second level map key is just an index.
 
     LightWeightMap<int, DenseLightWeightMap<char*>*>*          m_inFile;
     LightWeightMap<int, DenseLightWeightMap<MethodContext*>*>* m_inFileLegacy;
@@ -70,6 +70,9 @@ MethodContextReader::MethodContextReader(
     const char* inputFileName, const int* indexes, int indexCount, char* hash, int offset, int increment)
     : fileHandle(INVALID_HANDLE_VALUE)
     , fileSize(0)
+    , fileMapping(nullptr)
+    , fileView(nullptr)
+    , filePos(0)
     , curMCIndex(0)
     , Indexes(indexes)
     , IndexCount(indexCount)
@@ -113,6 +116,28 @@ MethodContextReader::MethodContextReader(
     if (this->fileHandle != INVALID_HANDLE_VALUE)
     {
         GetFileSizeEx(this->fileHandle, (PLARGE_INTEGER) & this->fileSize);
+
+        // Map the file once and read all contexts out of the shared view.
+        // The page cache is then shared across every process replaying the
+        // same collection, and readers don't contend on a file pointer.
+        // Zero-length files can't be mapped; if mapping fails for any
+        // reason we fall back to ReadFile-based access.
+        if (this->fileSize > 0)
+        {
+            LARGE_INTEGER mapSize;
+            mapSize.QuadPart  = this->fileSize;
+            this->fileMapping = CreateFileMapping(this->fileHandle, nullptr, PAGE_READONLY, mapSize.u.HighPart,
+                                                  mapSize.u.LowPart, nullptr);
+            if (this->fileMapping != nullptr)
+            {
+                this->fileView = (unsigned char*)MapViewOfFile(this->fileMapping, FILE_MAP_READ, 0, 0, 0);
+                if (this->fileView == nullptr)
+                {
+                    CloseHandle(this->fileMapping);
+                    this->fileMapping = nullptr;
+                }
+            }
+        }
     }
 
     ReadExcludedMethods(mchFileName);
@@ -120,6 +145,16 @@ MethodContextReader::MethodContextReader(
 
 MethodContextReader::~MethodContextReader()
 {
+    if (fileView != nullptr)
+    {
+        UnmapViewOfFile(fileView);
+    }
+
+    if (fileMapping != nullptr)
+    {
+        CloseHandle(fileMapping);
+    }
+
     if (fileHandle != INVALID_HANDLE_VALUE)
     {
         CloseHandle(this->fileHandle);
@@ -143,12 +178,76 @@ void MethodContextReader::ReleaseLock()
 
 bool MethodContextReader::atEof()
 {
+    if (this->isMapped())
+    {
+        return this->filePos >= this->fileSize;
+    }
+
     __int64 pos = 0;
     SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos,
                      FILE_CURRENT); // LARGE_INTEGER is a crime against humanity
     return pos == this->fileSize;
 }
 
+bool MethodContextReader::isMapped()
+{
+    return this->fileView != nullptr;
+}
+
+// Parse the method context header at 'pos' in the mapping and return the
+// size of the context data that follows it.
+unsigned int MethodContextReader::GetContextSizeAt(__int64 pos)
+{
+    Assert(pos + (__int64)(2 + sizeof(unsigned int)) <= this->fileSize);
+    unsigned char* p = this->fileView + pos;
+    AssertMsg((p[0] == 'm') && (p[1] == 'c'), "Didn't find magic number");
+    unsigned int totalLen;
+    memcpy(&totalLen, p + 2, sizeof(unsigned int));
+    Assert(pos + (__int64)(2 + sizeof(unsigned int)) + totalLen + 2 <= this->fileSize);
+    return totalLen;
+}
+
+// Copy the method context at 'pos' out of the mapping. Callers own the
+// returned buffer (MethodContext::Initialize takes it over and frees it),
+// so they get a copy rather than a pointer into the shared view.
+MethodContextBuffer MethodContextReader::ReadMethodContextAt(__int64 pos)
+{
+    unsigned int   totalLen = GetContextSizeAt(pos);
+    unsigned char* buff     = new unsigned char[totalLen + 2]; // total + End Canary
+    memcpy(buff, this->fileView + pos + 2 + sizeof(unsigned int), totalLen + 2);
+    return MethodContextBuffer(buff, totalLen);
+}
+
+// Claim the next method context from the shared mapping. The cursor is
+// advanced with a compare-exchange, so concurrent readers each end up with
+// a distinct context and never block on the mutex.
+MethodContextBuffer MethodContextReader::ReadMethodContextFromView(bool justSkip)
+{
+    while (true)
+    {
+        __int64 pos = this->filePos;
+        if (pos >= this->fileSize)
+        {
+            return MethodContextBuffer();
+        }
+
+        __int64 next = pos + 2 + sizeof(unsigned int) + GetContextSizeAt(pos) + 2;
+        if (InterlockedCompareExchange64(&this->filePos, next, pos) != pos)
+        {
+            // Another reader claimed this context; retry from its new position.
+            continue;
+        }
+
+        InterlockedIncrement((LONG volatile*)&this->curMCIndex);
+
+        if (justSkip)
+        {
+            return MethodContextBuffer(0);
+        }
+        return this->ReadMethodContextAt(pos);
+    }
+}
+
 MethodContextBuffer MethodContextReader::ReadMethodContextNoLock(bool justSkip)
 {
     DWORD        bytesRead;
@@ -187,6 +286,13 @@ MethodContextBuffer MethodContextReader::ReadMethodContextNoLock(bool justSkip)
 
 MethodContextBuffer MethodContextReader::ReadMethodContext(bool acquireLock, bool justSkip)
 {
+    if (this->isMapped())
+    {
+        // The mapped path distributes work with a compare-exchange on the
+        // read cursor, so no lock is needed.
+        return this->ReadMethodContextFromView(justSkip);
+    }
+
     if (acquireLock && !this->AcquireLock())
     {
         LogError("Can't acquire the reader lock!");
@@ -413,6 +519,10 @@ double MethodContextReader::PercentComplete()
         // Best estimate I can come up with...
         return 100.0 * (double)this->curIndexPos / (double)this->IndexCount;
     }
+    if (this->isMapped())
+    {
+        return 100.0 * (double)this->filePos / (double)this->fileSize;
+    }
     this->AcquireLock();
     __int64 pos = 0;
     SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos, FILE_CURRENT);
@@ -452,6 +562,15 @@ MethodContextBuffer MethodContextReader::GetSpecificMethodContext(unsigned int m
         return MethodContextBuffer(-3);
     }
 
+    if (this->isMapped())
+    {
+        // Reads from the mapping are position-independent, so fetching a
+        // specific context needs no lock and no file pointer motion.
+        MethodContextBuffer mcb = this->ReadMethodContextAt(pos);
+        curMCIndex              = methodNumber;
+        return mcb;
+    }
+
     // Take the IO lock before we set the file pointer, so we can do this on multiple threads
     if (!this->AcquireLock())
     {
@@ -52,6 +52,16 @@ private:
     // The size of the MC/MCH file
     __int64 fileSize;
 
+    // Read-only mapping of the MC/MCH file. When mapping succeeds, all
+    // reads come out of this single shared view; fileHandle I/O is the
+    // fallback (e.g. for zero-length files).
+    HANDLE         fileMapping;
+    unsigned char* fileView;
+
+    // Read cursor into the mapping. Advanced with compare-exchange, so
+    // concurrent readers claim distinct contexts without taking the mutex.
+    volatile __int64 filePos;
+
     // Current MC index in the input MC/MCH file
     int curMCIndex;
 
@@ -99,6 +109,14 @@ private:
     MethodContextBuffer ReadMethodContext(bool acquireLock, bool justSkip = false);
     MethodContextBuffer GetSpecificMethodContext(unsigned int methodNumber);
 
+    // Helpers for the mapped path
+    unsigned int        GetContextSizeAt(__int64 pos);
+    MethodContextBuffer ReadMethodContextAt(__int64 pos);
+    MethodContextBuffer ReadMethodContextFromView(bool justSkip);
+
+    // Do we have a usable mapping of the MC/MCH file?
+    bool isMapped();
+
     MethodContextBuffer GetNextMethodContextFromIndexes();
     MethodContextBuffer GetNextMethodContextFromHash();
     MethodContextBuffer GetNextMethodContextFromOffsetIncrement();
@@ -19,6 +19,11 @@ bool ExecutableAllocator::g_isWXorXEnabled = false;
 ExecutableAllocator::FatalErrorHandler ExecutableAllocator::g_fatalErrorHandler = NULL;
 ExecutableAllocator* ExecutableAllocator::g_instance = NULL;
 
+// Number of mapping granules a new RW mapping is extended to cover. Mapping a larger
+// window lets MapRW requests for neighboring allocations in the same RX block reuse
+// the existing mapping instead of paying for another OS mapping call.
+#define EXECUTABLE_ALLOCATOR_MAP_BATCH_GRANULES 4
+
 #ifndef VARIABLE_SIZED_CACHEDMAPPING_SIZE
 #define EXECUTABLE_ALLOCATOR_CACHE_SIZE ARRAY_SIZE(m_cachedMapping)
 #else
@@ -897,6 +902,22 @@ void* ExecutableAllocator::MapRW(void* pRX, size_t size, CacheableMapping cacheM
             // Size of the block we will map
             size_t mapSize = ALIGN_UP(offset - mapOffset + size, Granularity());
 
+            // Extend the mapping towards the end of the RX block so that requests for
+            // allocations placed right after this one are served by this mapping instead
+            // of creating a new one. The extra pages are only mapped, not touched; they
+            // are not written through until their RX range is committed, which commits
+            // the shared pages for all views, so covering a not yet committed tail of
+            // the block is harmless.
+            size_t batchedMapSize = EXECUTABLE_ALLOCATOR_MAP_BATCH_GRANULES * Granularity();
+            if (batchedMapSize > pBlock->size - mapOffset)
+            {
+                batchedMapSize = pBlock->size - mapOffset;
+            }
+            if (mapSize < batchedMapSize)
+            {
+                mapSize = batchedMapSize;
+            }
+
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
             StopWatch sw2(&g_mapCreateTimeSum);
 #endif
@@ -680,11 +680,13 @@ class LoaderHeapSniffer
 //      increasing addresses, blocks will typically be freed with sequentially decreasing
 //      addresses.
 //
-// The first cut of the freelist is a single-linked list of free blocks using first-fit.
-// Assuming the above alloc-free pattern holds, the list will end up mostly sorted
-// in increasing address order. When a block is freed, we'll attempt to coalesce it
-// with the first block in the list. We could also choose to be more aggressive about
-// sorting and coalescing but this should probably catch most cases in practice.
+// The freelist is a single-linked list of free blocks kept sorted in increasing
+// address order, allocated from with first-fit. Keeping the list sorted means a
+// freed block always ends up next to any free neighbors it has, so it can be
+// coalesced with both its predecessor and its successor no matter what order
+// blocks are freed in. That matters for workloads that repeatedly load and
+// unload collectible assemblies: with LIFO insertion, interleaved free patterns
+// left the list permanently fragmented into minimum-size blocks.
 //=====================================================================================
 
 // When a block is freed, we place this structure on the first bytes of the freed block (Allocations
@@ -748,11 +750,28 @@ struct LoaderHeapFreeBlock
             // If we fail allocating the LoaderHeapFreeBlock, ignore the failure and don't insert the free block at all.
             if (pNewBlock != NULL)
             {
-                pNewBlock->m_pNext  = *ppHead;
+                // Keep the list sorted by block address so a freed block lands
+                // next to any free neighbors it has and can be coalesced below.
+                LoaderHeapFreeBlock *pPrevBlock = NULL;
+                LoaderHeapFreeBlock **ppInsert = ppHead;
+                while (*ppInsert != NULL && (*ppInsert)->m_pBlockAddress < pMem)
+                {
+                    pPrevBlock = *ppInsert;
+                    ppInsert = &pPrevBlock->m_pNext;
+                }
+
+                pNewBlock->m_pNext  = *ppInsert;
                 pNewBlock->m_dwSize = dwTotalSize;
                 pNewBlock->m_pBlockAddress = pMem;
-                *ppHead = pNewBlock;
+                *ppInsert = pNewBlock;
+
+                // Merge with the successor first so that a predecessor merge
+                // can absorb the combined block in one step.
                 MergeBlock(pNewBlock, pHeap);
+                if (pPrevBlock != NULL)
+                {
+                    MergeBlock(pPrevBlock, pHeap);
+                }
             }
 
             LOADER_HEAP_END_TRAP_FAULT
@@ -2417,4 +2436,199 @@ void AllocMemTracker::SuppressRelease()
     m_fReleased = TRUE;
 }
 
+//=====================================================================================
+// InterleavedStubCache
+//=====================================================================================
+
+InterleavedStubCache::InterleavedStubCache()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    m_pHeap           = NULL;
+    m_pSlab           = NULL;
+    m_pFreeList       = NULL;
+    m_dwStubSize      = 0;
+    m_dwStubsPerSlab  = 0;
+    m_CriticalSection = NULL;
+}
+
+void InterleavedStubCache::Init(LoaderHeap *pHeap, DWORD dwStubSize)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        INJECT_FAULT(ThrowOutOfMemory(););
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(pHeap->IsInterleaved());
+    _ASSERTE(dwStubSize != 0);
+
+    m_pHeap      = pHeap;
+    m_dwStubSize = dwStubSize;
+
+    // Refill in slabs large enough to keep threads off the heap lock during type
+    // loading bursts, but small enough that a mostly unused slab does not waste a
+    // noticeable amount of committed memory on a small (e.g. collectible) loader
+    // allocator. Interleaved allocations may not straddle a stub code page, so the
+    // slab must also fit within one.
+    m_dwStubsPerSlab = min((DWORD)32, GetStubCodePageSize() / dwStubSize);
+
+    m_CriticalSection = CreateLoaderHeapLock();
+}
+
+InterleavedStubCache::~InterleavedStubCache()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The slab memory itself belongs to the underlying heap; only the descriptors
+    // are owned by the cache.
+    StubSlab *pSlab = m_pSlab;
+    while (pSlab != NULL)
+    {
+        StubSlab *pNext = pSlab->m_pNext;
+        delete pSlab;
+        pSlab = pNext;
+    }
+
+    if (m_CriticalSection != NULL)
+    {
+        ClrDeleteCriticalSection(m_CriticalSection);
+    }
+}
+
+//=====================================================================================
+// Claims one stub from the current slab with an interlocked bump and no lock.
+// Returns NULL if there is no slab yet or the slab is exhausted. Racing with a
+// refill is benign: slab descriptors live until the cache is destroyed and m_pCur
+// never moves backwards, so a claim against a stale descriptor either fails or
+// returns a stub that has never been handed out.
+//=====================================================================================
+BYTE *InterleavedStubCache::TryClaimFromSlab()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    while (true)
+    {
+        StubSlab *pSlab = VolatileLoad(&m_pSlab);
+        if (pSlab == NULL)
+        {
+            return NULL;
+        }
+
+        BYTE *pCur = VolatileLoad(&pSlab->m_pCur);
+        if (pCur == pSlab->m_pEnd)
+        {
+            return NULL;
+        }
+
+        if (InterlockedCompareExchangeT(&pSlab->m_pCur, pCur + m_dwStubSize, pCur) == pCur)
+        {
+            return pCur;
+        }
+    }
+}
+
+TaggedMemAllocPtr InterleavedStubCache::RealAllocStub(
+#ifdef _DEBUG
+                        _In_ _In_z_ const char *szFile
+                        , int lineNum
+#endif
+                        )
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        INJECT_FAULT(ThrowOutOfMemory(););
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(m_pHeap != NULL);
+
+    BYTE *pStub = TryClaimFromSlab();
+
+    if (pStub == NULL)
+    {
+        CRITSEC_Holder csh(m_CriticalSection);
+
+        if (m_pFreeList != NULL)
+        {
+            // Prefer stubs recycled by an earlier backout.
+            pStub = m_pFreeList;
+            m_pFreeList = *GetFreeListSlot(pStub);
+            *GetFreeListSlot(pStub) = NULL;
+        }
+        else
+        {
+            // Another thread may have published a fresh slab while this one
+            // waited for the lock.
+            pStub = TryClaimFromSlab();
+
+            if (pStub == NULL)
+            {
+                // Allocate the descriptor first so that a failure cannot strand
+                // slab memory already carved out of the heap.
+                NewHolder<StubSlab> pNewSlab = new StubSlab();
+
+                size_t dwSlabSize = (size_t)m_dwStubSize * m_dwStubsPerSlab;
+                BYTE *pSlabMem = (BYTE *)(void *)m_pHeap->AllocAlignedMem(dwSlabSize, 1);
+
+                // Claim the first stub for this thread before publishing; a fresh
+                // slab always satisfies at least the allocation that carved it.
+                pNewSlab->m_pCur  = pSlabMem + m_dwStubSize;
+                pNewSlab->m_pEnd  = pSlabMem + dwSlabSize;
+                pNewSlab->m_pNext = m_pSlab;
+
+                VolatileStore(&m_pSlab, pNewSlab.GetValue());
+                pNewSlab.SuppressRelease();
+
+                pStub = pSlabMem;
+            }
+        }
+    }
+
+    TaggedMemAllocPtr tmap;
+    tmap.m_pMem            = pStub;
+    tmap.m_dwRequestedSize = m_dwStubSize;
+    tmap.m_pHeap           = this;
+    tmap.m_dwExtra         = 0;
+#ifdef _DEBUG
+    tmap.m_szFile          = szFile;
+    tmap.m_lineNum         = lineNum;
+#endif
+
+    return tmap;
+}
+
+void InterleavedStubCache::RealBackoutMem(void *pMem
+                        , size_t dwSize
+#ifdef _DEBUG
+                        , _In_ _In_z_ const char *szFile
+                        , int lineNum
+                        , _In_ _In_z_ const char *szAllocFile
+                        , int allocLineNum
+#endif
+                        )
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        FORBID_FAULT;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(dwSize == m_dwStubSize);
+
+    // Backed out stubs cannot be returned to the slab they came from, so park
+    // them on a free list threaded through their writable data slots. The next
+    // allocation that misses the slab fast path picks them up again.
+    CRITSEC_Holder csh(m_CriticalSection);
+
+    *GetFreeListSlot((BYTE *)pMem) = m_pFreeList;
+    m_pFreeList = (BYTE *)pMem;
+}
+
 #endif //#ifndef DACCESS_COMPILE
@@ -151,7 +151,13 @@ UTSemReadWrite::~UTSemReadWrite()
 
 //=======================================================================================
 //
-// Initialize the lock (its semaphore and event)
+// Initialize the lock
+//
+// The semaphore and event used to wake up waiters are created on demand at the first
+// contended acquisition (see code:UTSemReadWrite::EnsureReadWaiterSemaphore and
+// code:UTSemReadWrite::EnsureWriteWaiterEvent). Locks that are never contended - the
+// common case for the metadata readers - never allocate any kernel objects; the
+// uncontended lock and unlock paths operate purely on m_dwFlag in user space.
 //
 HRESULT
 UTSemReadWrite::Init()
@@ -163,19 +169,80 @@ UTSemReadWrite::Init()
     }
     CONTRACTL_END;
 
-
     _ASSERTE(m_hReadWaiterSemaphore == NULL);
     _ASSERTE(m_hWriteWaiterEvent == NULL);
 
-    m_hReadWaiterSemaphore = WszCreateSemaphore(NULL, 0, MAXLONG, NULL);
-    IfNullRet(m_hReadWaiterSemaphore);
-
-    m_hWriteWaiterEvent = WszCreateEvent(NULL, FALSE, FALSE, NULL);
-    IfNullRet(m_hWriteWaiterEvent);
-
     return S_OK;
 } // UTSemReadWrite::Init
 
+//=======================================================================================
+//
+// Create the semaphore used to wake up waiting readers, if it was not created yet.
+// Returns FALSE if the semaphore could not be allocated.
+//
+// Note: This has to be called before the thread registers itself as a read waiter in
+// m_dwFlag, so that any thread that observes a nonzero read waiter count also observes
+// the published semaphore.
+//
+BOOL
+UTSemReadWrite::EnsureReadWaiterSemaphore()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    if (m_hReadWaiterSemaphore != NULL)
+        return TRUE;
+
+    HANDLE hSemaphore = WszCreateSemaphore(NULL, 0, MAXLONG, NULL);
+    if (hSemaphore == NULL)
+        return FALSE;
+
+    if (InterlockedCompareExchangeT(&m_hReadWaiterSemaphore, hSemaphore, (HANDLE)NULL) != NULL)
+    {   // Another thread published its semaphore first
+        CloseHandle(hSemaphore);
+    }
+
+    return TRUE;
+} // UTSemReadWrite::EnsureReadWaiterSemaphore
+
+//=======================================================================================
+//
+// Create the event used to wake up waiting writers, if it was not created yet.
+// Returns FALSE if the event could not be allocated.
+//
+// Note: This has to be called before the thread registers itself as a write waiter in
+// m_dwFlag, so that any thread that observes a nonzero write waiter count also observes
+// the published event.
+//
+BOOL
+UTSemReadWrite::EnsureWriteWaiterEvent()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    if (m_hWriteWaiterEvent != NULL)
+        return TRUE;
+
+    HANDLE hEvent = WszCreateEvent(NULL, FALSE, FALSE, NULL);
+    if (hEvent == NULL)
+        return FALSE;
+
+    if (InterlockedCompareExchangeT(&m_hWriteWaiterEvent, hEvent, (HANDLE)NULL) != NULL)
+    {   // Another thread published its event first
+        CloseHandle(hEvent);
+    }
+
+    return TRUE;
+} // UTSemReadWrite::EnsureWriteWaiterEvent
+
 /******************************************************************************
 Function : UTSemReadWrite::LockRead
 
@@ -250,7 +317,11 @@ HRESULT UTSemReadWrite::LockRead()
         }
         else
         {   // Try to add waiting reader and then wait for signal
-            if (dwFlag == InterlockedCompareExchangeT (&m_dwFlag, dwFlag + READWAITERS_INCR, dwFlag))
+            if (!EnsureReadWaiterSemaphore())
+            {   // Could not allocate the semaphore, wait 1ms and retry
+                ClrSleepEx(1, FALSE);
+            }
+            else if (dwFlag == InterlockedCompareExchangeT (&m_dwFlag, dwFlag + READWAITERS_INCR, dwFlag))
             {
                 WaitForSingleObjectEx(m_hReadWaiterSemaphore, INFINITE, FALSE);
                 break;
@@ -338,7 +409,11 @@ HRESULT UTSemReadWrite::LockWrite()
         }
         else
         {   // Try to add waiting writer and then wait for signal
-            if (dwFlag == InterlockedCompareExchangeT (&m_dwFlag, dwFlag + WRITEWAITERS_INCR, dwFlag))
+            if (!EnsureWriteWaiterEvent())
+            {   // Could not allocate the event, wait 1ms and retry
+                ClrSleepEx(1, FALSE);
+            }
+            else if (dwFlag == InterlockedCompareExchangeT (&m_dwFlag, dwFlag + WRITEWAITERS_INCR, dwFlag))
             {
                 WaitForSingleObjectEx(m_hWriteWaiterEvent, INFINITE, FALSE);
                 break;
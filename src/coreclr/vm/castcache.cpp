@@ -12,6 +12,10 @@
 BASEARRAYREF* CastCache::s_pTableRef = NULL;
 OBJECTHANDLE CastCache::s_sentinelTable = NULL;
 DWORD CastCache::s_lastFlushSize     = INITIAL_CACHE_SIZE;
+DWORD CastCache::s_maxCacheSize      = MAXIMUM_CACHE_SIZE;
+DWORD CastCache::s_hits              = 0;
+DWORD CastCache::s_misses            = 0;
+DWORD CastCache::s_evictions         = 0;
 
 BASEARRAYREF CastCache::CreateCastCache(DWORD size)
 {
@@ -78,6 +82,63 @@ BASEARRAYREF CastCache::CreateCastCache(DWORD size)
     return table;
 }
 
+void CastCache::MigrateEntries(DWORD* oldTableData, DWORD* newTableData)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    // The new table is not published yet, so it can be written to without synchronization.
+    // Writers that race with the migration may add to the old table and have their entries
+    // lost, which is harmless for a lossy cache.
+    DWORD oldSize = CacheElementCount(oldTableData);
+    for (DWORD i = 0; i < oldSize; i++)
+    {
+        CastCacheEntry* pOldEntry = &Elements(oldTableData)[i];
+
+        // same read protocol as TryGet: version -> [entry parts] -> version
+        DWORD version1 = VolatileLoad(&pOldEntry->version);
+        if (version1 == 0 || (version1 & 1) != 0)
+        {
+            // unclaimed or mid-update, skip
+            continue;
+        }
+
+        TADDR source = pOldEntry->source;
+        TADDR targetAndResult = pOldEntry->targetAndResult;
+
+        VolatileLoadBarrier();
+        if (version1 != pOldEntry->version)
+        {
+            // changed while we were reading, skip
+            continue;
+        }
+
+        DWORD index = KeyToBucket(newTableData, source, targetAndResult & ~(TADDR)1);
+        for (DWORD j = 0; j < BUCKET_SIZE;)
+        {
+            CastCacheEntry* pNewEntry = &Elements(newTableData)[index];
+            if (pNewEntry->version == 0)
+            {
+                pNewEntry->source = source;
+                pNewEntry->targetAndResult = targetAndResult;
+                // a complete entry at distance j with versionNum 1
+                pNewEntry->version = (j << VERSION_NUM_SIZE) + 2;
+                break;
+            }
+
+            // quadratic reprobe
+            j++;
+            index = (index + j) & TableMask(newTableData);
+        }
+        // if the bucket in the new table is full, the entry is dropped
+    }
+}
+
 BOOL CastCache::MaybeReplaceCacheWithLarger(DWORD size)
 {
     CONTRACTL
@@ -94,6 +155,13 @@ BOOL CastCache::MaybeReplaceCacheWithLarger(DWORD size)
         return FALSE;
     }
 
+    DWORD* oldTableData = TableData(*s_pTableRef);
+    if (TableMask(oldTableData) != 1)
+    {
+        // carry surviving entries over, so that growing does not behave like a flush.
+        MigrateEntries(oldTableData, TableData(newTable));
+    }
+
     SetObjectReference((OBJECTREF *)s_pTableRef, newTable);
     return TRUE;
 }
@@ -111,6 +179,9 @@ void CastCache::FlushCurrentCache()
     DWORD* tableData = TableData(*s_pTableRef);
     s_lastFlushSize = max(INITIAL_CACHE_SIZE, CacheElementCount(tableData));
 
+    STRESS_LOG4(LF_CLASSLOADER, LL_INFO100, "CastCache: flushing table of size %u (hits %u misses %u evictions %u)\n",
+        CacheElementCount(tableData), s_hits, s_misses, s_evictions);
+
     SetObjectReference((OBJECTREF *)s_pTableRef, ObjectFromHandle(s_sentinelTable));
 }
 
@@ -124,6 +195,21 @@ void CastCache::Initialize()
     }
     CONTRACTL_END;
 
+    DWORD maxSize = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_MaxCastCacheSize);
+    if (maxSize > MAXIMUM_CACHE_SIZE)
+    {
+        // round up to the next power of two
+        DWORD bitCnt;
+        BitScanReverse(&bitCnt, maxSize);
+        if (maxSize & (maxSize - 1))
+        {
+            bitCnt++;
+        }
+
+        // no point in a cache that cannot fit in a 32bit mask
+        s_maxCacheSize = (DWORD)min((UINT64)1 << bitCnt, (UINT64)1 << 31);
+    }
+
     FieldDesc* pTableField = CoreLibBinder::GetField(FIELD__CASTCACHE__TABLE);
 
     GCX_COOP();
@@ -186,6 +272,8 @@ TypeHandle::CastResult CastCache::TryGet(TADDR source, TADDR target)
                     break;
                 }
 
+                // NB: ++ is not interlocked, approximate counts are fine.
+                s_hits++;
                 return TypeHandle::CastResult(entryTargetAndResult);
             }
         }
@@ -201,6 +289,8 @@ TypeHandle::CastResult CastCache::TryGet(TADDR source, TADDR target)
         index = (index + i) & TableMask(tableData);
     }
 
+    // NB: ++ is not interlocked, approximate counts are fine.
+    s_misses++;
     return TypeHandle::MaybeCast;
 }
 
@@ -333,6 +423,10 @@ void CastCache::TrySet(TADDR source, TADDR target, BOOL result)
         {
             pEntry->SetEntry(source, target, result);
             VolatileStore(&pEntry->version, newVersion + 1);
+
+            // we replaced a live entry because the cache could not grow further.
+            // NB: ++ is not interlocked, approximate counts are fine.
+            s_evictions++;
         }
     }
 }
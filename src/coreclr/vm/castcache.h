@@ -44,6 +44,9 @@
 //
 // Whenever we need to replace or resize the table, we simply allocate a new one and atomically
 // update the static handle. The old table may be still in use, but will eventually be collected by GC.
+// When growing, consistent entries of the old table are copied into the new one before it is
+// published, so a resize does not behave like a flush. Entries added to the old table while the
+// copy is in progress may be lost, which is harmless for a lossy cache.
 //
 class CastCache
 {
@@ -168,6 +171,17 @@ public:
     static void FlushCurrentCache();
     static void Initialize();
 
+    // Cumulative cache statistics. The counts are updated without interlocked
+    // operations and may miss the occasional increment, they are only meant
+    // for sizing the cache from production data.
+    static void GetStatistics(DWORD* pHits, DWORD* pMisses, DWORD* pEvictions)
+    {
+        LIMITED_METHOD_CONTRACT;
+        *pHits = s_hits;
+        *pMisses = s_misses;
+        *pEvictions = s_evictions;
+    }
+
 private:
 
 // The cache size is driven by demand and generally is fairly small. (casts are repetitive)
@@ -206,6 +220,15 @@ private:
 
     static DWORD          s_lastFlushSize;
 
+    // resize ceiling - MAXIMUM_CACHE_SIZE unless raised via MaxCastCacheSize
+    static DWORD          s_maxCacheSize;
+
+    // statistics counters
+    // NB: ++ on these is not interlocked. We are ok if we lose counts here.
+    static DWORD          s_hits;
+    static DWORD          s_misses;
+    static DWORD          s_evictions;
+
     FORCEINLINE static TypeHandle::CastResult TryGetFromCache(TADDR source, TADDR target)
     {
         CONTRACTL
@@ -251,7 +274,7 @@ private:
         CONTRACTL_END;
 
         DWORD newSize = CacheElementCount(tableData) * 2;
-        if (newSize <= MAXIMUM_CACHE_SIZE)
+        if (newSize <= s_maxCacheSize)
         {
             return MaybeReplaceCacheWithLarger(newSize);
         }
@@ -318,6 +341,7 @@ private:
 
     static BASEARRAYREF CreateCastCache(DWORD size);
     static BOOL MaybeReplaceCacheWithLarger(DWORD size);
+    static void MigrateEntries(DWORD* oldTableData, DWORD* newTableData);
     static TypeHandle::CastResult TryGet(TADDR source, TADDR target);
     static void TrySet(TADDR source, TADDR target, BOOL result);
 
@@ -5388,6 +5388,88 @@ void Module::ExpandAll()
 }
 #endif //_DEBUG && !DACCESS_COMPILE && !CROSS_COMPILE
 
+#if !defined(DACCESS_COMPILE) && !defined(CROSS_COMPILE)
+void Module::EagerPrepareInteropStubs()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    // Stub generation requires a running EE for the same reasons jitting does.
+    if (!g_fEEStarted)
+        return;
+
+    IMDInternalImport * pMDI = GetMDImport();
+
+    HENUMTypeDefInternalHolder hEnum(pMDI);
+    hEnum.EnumTypeDefInit();
+
+    mdTypeDef td;
+    while (pMDI->EnumNext(&hEnum, &td))
+    {
+        // Cheap metadata scan first so we only pay for type loads on types
+        // that actually declare P/Invoke methods.
+        bool fHasPInvokes = false;
+        {
+            HENUMInternalHolder hMethodEnum(pMDI);
+            hMethodEnum.EnumInit(mdtMethodDef, td);
+
+            mdMethodDef md;
+            while (pMDI->EnumNext(&hMethodEnum, &md))
+            {
+                DWORD dwAttrs;
+                if (SUCCEEDED(pMDI->GetMethodDefProps(md, &dwAttrs)) && IsMdPinvokeImpl(dwAttrs))
+                {
+                    fHasPInvokes = true;
+                    break;
+                }
+            }
+        }
+
+        if (!fHasPInvokes)
+            continue;
+
+        // Failures to load a type or to generate a particular stub are not fatal
+        // here - the method will simply generate its stub on first call as usual.
+        EX_TRY
+        {
+            TypeHandle th = ClassLoader::LoadTypeDefThrowing(this, td,
+                                                             ClassLoader::ThrowIfNotFound,
+                                                             ClassLoader::PermitUninstDefOrRef);
+
+            MethodTable * pMT = th.GetMethodTable();
+            if (pMT != NULL)
+            {
+                MethodTable::MethodIterator it(pMT);
+                for (; it.IsValid(); it.Next())
+                {
+                    MethodDesc * pMD = it.GetMethodDesc();
+                    if (pMD != NULL && pMD->IsNDirect())
+                    {
+                        EX_TRY
+                        {
+                            GetStubForInteropMethod(pMD);
+                        }
+                        EX_CATCH
+                        {
+                        }
+                        EX_END_CATCH(SwallowAllExceptions);
+                    }
+                }
+            }
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
+}
+#endif // !DACCESS_COMPILE && !CROSS_COMPILE
+
 //-------------------------------------------------------------------------------
 
 // Verify consistency of asmconstants.h
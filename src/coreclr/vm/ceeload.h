@@ -1521,6 +1521,11 @@ public:
     void ExpandAll();
 #endif
 
+    //Walks the module's metadata and generates interop stubs for all P/Invoke methods up
+    //front, so first calls do not block on IL stub generation. Opt-in via the
+    //EagerInteropStubs config value.
+    void EagerPrepareInteropStubs();
+
     BOOL IsIJWFixedUp() { return m_dwTransientFlags & IS_IJW_FIXED_UP; }
     void SetIsIJWFixedUp();
 
@@ -1785,7 +1790,8 @@ public:
     uint32_t GetNativeMetadataAssemblyCount();
 #endif // !defined(DACCESS_COMPILE)
 
-    // For protecting dictionary layout slot expansions
+    // For protecting dictionary and dictionary layout slot expansions of the
+    // generics this module owns (see GetExpansionCrst in genericdict.cpp)
     CrstExplicitInit        m_DictionaryCrst;
 };
 
@@ -1247,6 +1247,11 @@ void STDMETHODCALLTYPE EEShutDownHelper(BOOL fIsDllUnloading)
 
         ceeInf.JitProcessShutdownWork();  // Do anything JIT-related that needs to happen at shutdown.
 
+#ifdef FEATURE_TIERED_COMPILATION
+        // Persist the set of methods promoted to the final tier for the next run, if configured.
+        TieredCompilationManager::WritePromotionProfile();
+#endif
+
 #ifdef FEATURE_INTERPRETER
         // This will check a flag and do nothing if not enabled.
         Interpreter::PrintPostMortemData();
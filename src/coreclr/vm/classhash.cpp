@@ -470,11 +470,15 @@ EEClassHashEntry_t *EEClassHashTable::FindItem(LPCUTF8 pszNamespace, LPCUTF8 psz
     {
         LPCUTF8 rgKey[] = { pszNamespace, pszClassName };
 
-        if (CompareKeys(pSearch, rgKey))
+        // If (IsNested), then we're looking for a nested class
+        // If (pSearch->pEncloser), we've found a nested class
+        // Check this first: it's a single pointer load, while CompareKeys has
+        // to reconstruct the entry's name from metadata. Nested and top-level
+        // types with colliding hashes would otherwise pay that decode just to
+        // be rejected here.
+        if ((IsNested != FALSE) == (pSearch->GetEncloser() != NULL))
         {
-            // If (IsNested), then we're looking for a nested class
-            // If (pSearch->pEncloser), we've found a nested class
-            if ((IsNested != FALSE) == (pSearch->GetEncloser() != NULL))
+            if (CompareKeys(pSearch, rgKey))
             {
                 return pSearch;
             }
@@ -691,9 +695,11 @@ public:
         LIMITED_METHOD_CONTRACT;
         SUPPORTS_DAC;
 
+        // Compare the class names before the namespaces: types that collide on
+        // hash usually share a namespace, so the name rejects mismatches sooner.
         bReturn = (
             ((pKey1[0] == pKey2[0]) && (pKey1[1] == pKey2[1])) ||
-            ((strcmp (pKey1[0], pKey2[0]) == 0) && (strcmp (pKey1[1], pKey2[1]) == 0))
+            ((strcmp (pKey1[1], pKey2[1]) == 0) && (strcmp (pKey1[0], pKey2[0]) == 0))
             );
     }
 
@@ -1946,6 +1946,11 @@ ClassLoader::~ClassLoader()
     m_UnresolvedClassLock.Destroy();
     m_AvailableClassLock.Destroy();
     m_AvailableTypesLock.Destroy();
+
+    for (DWORD i = 0; i < AVAILABLE_TYPES_SHARDS; i++)
+    {
+        m_AvailableParamTypesLocks[i].Destroy();
+    }
 }
 
 
@@ -2014,11 +2019,21 @@ VOID ClassLoader::Init(AllocMemTracker *pamTracker)
                              CrstAvailableClass,
                              CrstFlags(CRST_REENTRANCY | CRST_DEBUGGER_THREAD));
 
-    // This lock is taken within the classloader whenever we have to insert a new param. type into the table.
+    // This lock is taken within the classloader whenever we publish a typedef
+    // type or touch a module's generic-param-to-descriptor map.
     m_AvailableTypesLock.Init(
                               CrstAvailableParamTypes,
                               CRST_DEBUGGER_THREAD);
 
+    // One writer lock per shard of the available-param-types tables. The shards
+    // share a Crst level; no code path takes more than one of them at a time.
+    for (DWORD i = 0; i < AVAILABLE_TYPES_SHARDS; i++)
+    {
+        m_AvailableParamTypesLocks[i].Init(
+                                          CrstAvailableParamTypes,
+                                          CRST_DEBUGGER_THREAD);
+    }
+
 #ifdef _DEBUG
     CorTypeInfo::CheckConsistency();
 #endif
@@ -3056,7 +3071,9 @@ TypeHandle ClassLoader::PublishType(TypeKey *pTypeKey, TypeHandle typeHnd)
         Module *pLoaderModule = ComputeLoaderModule(pTypeKey);
         EETypeHashTable *pTable = pLoaderModule->GetAvailableParamTypes();
 
-        CrstHolder ch(&pLoaderModule->GetClassLoader()->m_AvailableTypesLock);
+        // Take the lock for just the shard of the table this key hashes to, so
+        // that concurrent publication of types in other shards is not blocked.
+        CrstHolder ch(pLoaderModule->GetClassLoader()->GetAvailableParamTypesLock(HashTypeKey(pTypeKey)));
 
         // The type could have been loaded by a different thread as side-effect of avoiding deadlocks caused by LoadsTypeViolation
         TypeHandle existing = pTable->GetValue(pTypeKey);
@@ -24,6 +24,7 @@
 #include "specstrings.h"
 #include "simplerwlock.hpp"
 #include "classhash.h"
+#include "typehash.h"
 
 // SystemDomain is a friend of ClassLoader.
 class SystemDomain;
@@ -503,6 +504,13 @@ private:
 
     CrstExplicitInit        m_AvailableTypesLock;
 
+    // Writer locks for the loader modules' m_pAvailableParamTypes tables,
+    // sharded to match the tables themselves (see typehash.h). Lookups are
+    // lock-free; a thread publishing a constructed type takes only the lock
+    // for the shard its type key hashes to, so concurrent type loads that
+    // hash to different shards do not serialize on each other.
+    CrstExplicitInit        m_AvailableParamTypesLocks[AVAILABLE_TYPES_SHARDS];
+
     // Do we have any modules which need to have their classes added to
     // the available list?
     Volatile<LONG>       m_cUnhashedModules;
@@ -531,6 +539,14 @@ public:
     ClassLoader(Assembly *pAssembly);
     ~ClassLoader();
 
+    // Returns the lock guarding writes to the shard of the available-param-types
+    // tables that the given type key hash falls into.
+    CrstBase *GetAvailableParamTypesLock(DWORD dwTypeKeyHash)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return &m_AvailableParamTypesLocks[EETypeHashTable::GetShardIndex(dwTypeKeyHash)];
+    }
+
 private:
 
     VOID PopulateAvailableClassHashTable(Module *pModule,
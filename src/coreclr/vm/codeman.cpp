@@ -786,12 +786,14 @@ ExecutionManager::ReaderLockHolder::~ReaderLockHolder()
 ==============================================================================
 ExecutionManger::ReaderLockHolder and ExecutionManger::WriterLockHolder
 Protects the callers of ExecutionManager::GetRangeSection from heap deletions
-while walking RangeSections.  You need to take a reader lock before reading the
-values: m_CodeRangeList and hold it while walking the lists
+while walking RangeSections. Lookups first attempt a lock-free walk of the
+range section map (see code:RangeSectionMap); the reader lock is only taken
+when the walk reports RangeSectionLockState::NeedsLock because it ran into
+collectible code.
 
 Uses ReaderLockHolder (allows multiple reeaders with no writers)
 -----------------------------------------
-ExecutionManager::FindCodeRange
+ExecutionManager::FindCodeRangeWithLock
 ExecutionManager::FindReadyToRunModule
 ExecutionManager::EnumMemoryRegions
 AND
@@ -3146,70 +3148,96 @@ void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveFo
     }
 #endif  // USE_INDIRECT_CODEHEADER
 
+    size_t allocatedSize = sizeof(CodeHeader) + totalSize;
+
+    // Satisfy allocations that come from other allocators with their own locks
+    // before taking the code heap lock, to keep its hold time down to the code
+    // allocation itself - many threads jitting at once all funnel through it.
+
+#ifdef USE_INDIRECT_CODEHEADER
+    // for non-LCG methods allocate the real header in the low frequency heap
+    AllocMemHolder<BYTE> pRealHeaderBuffer;
+    if (!requestInfo.IsDynamicDomain())
+    {
+        // TODO: think about the CodeHeap carrying around a RealCodeHeader chunking mechanism
+        pRealHeaderBuffer = pMD->GetLoaderAllocator()->GetLowFrequencyHeap()->AllocMem(S_SIZE_T(realHeaderSize));
+    }
+#endif // USE_INDIRECT_CODEHEADER
+
+    NewArrayHolder<BYTE> pCodeHdrRWBuffer;
+    if (ExecutableAllocator::IsWXORXEnabled())
+    {
+        pCodeHdrRWBuffer = new BYTE[allocatedSize];
+    }
+
+    TADDR pCode;
+
     // Scope the lock
     {
         CrstHolder ch(&m_CodeHeapCritSec);
 
         *ppCodeHeap = NULL;
-        TADDR pCode = (TADDR) allocCodeRaw(&requestInfo, sizeof(CodeHeader), totalSize, alignment, ppCodeHeap);
+        pCode = (TADDR) allocCodeRaw(&requestInfo, sizeof(CodeHeader), totalSize, alignment, ppCodeHeap);
         _ASSERTE(*ppCodeHeap);
+    }
 
-        if (pMD->IsLCGMethod())
-        {
-            pMD->AsDynamicMethodDesc()->GetLCGMethodResolver()->m_recordCodePointer = (void*) pCode;
-        }
+    // The block is not published anywhere yet, so the code header can be
+    // initialized without holding the lock.
+
+    if (pMD->IsLCGMethod())
+    {
+        pMD->AsDynamicMethodDesc()->GetLCGMethodResolver()->m_recordCodePointer = (void*) pCode;
+    }
 
-        _ASSERTE(IS_ALIGNED(pCode, alignment));
+    _ASSERTE(IS_ALIGNED(pCode, alignment));
 
-        pCodeHdr = ((CodeHeader *)pCode) - 1;
+    pCodeHdr = ((CodeHeader *)pCode) - 1;
 
-        *pAllocatedSize = sizeof(CodeHeader) + totalSize;
+    *pAllocatedSize = allocatedSize;
 
-        if (ExecutableAllocator::IsWXORXEnabled())
-        {
-            pCodeHdrRW = (CodeHeader *)new BYTE[*pAllocatedSize];
-        }
-        else
-        {
-            pCodeHdrRW = pCodeHdr;
-        }
+    if (ExecutableAllocator::IsWXORXEnabled())
+    {
+        pCodeHdrRW = (CodeHeader *)(BYTE *)pCodeHdrRWBuffer;
+    }
+    else
+    {
+        pCodeHdrRW = pCodeHdr;
+    }
 
 #ifdef USE_INDIRECT_CODEHEADER
-        if (requestInfo.IsDynamicDomain())
-        {
-            // Set the real code header to the writeable mapping so that we can set its members via the CodeHeader methods below
-            pCodeHdrRW->SetRealCodeHeader((BYTE *)(pCodeHdrRW + 1) + ALIGN_UP(blockSize, sizeof(void*)));
-        }
-        else
-        {
-            // TODO: think about the CodeHeap carrying around a RealCodeHeader chunking mechanism
-            //
-            // allocate the real header in the low frequency heap
-            BYTE* pRealHeader = (BYTE*)(void*)pMD->GetLoaderAllocator()->GetLowFrequencyHeap()->AllocMem(S_SIZE_T(realHeaderSize));
-            pCodeHdrRW->SetRealCodeHeader(pRealHeader);
-        }
+    if (requestInfo.IsDynamicDomain())
+    {
+        // Set the real code header to the writeable mapping so that we can set its members via the CodeHeader methods below
+        pCodeHdrRW->SetRealCodeHeader((BYTE *)(pCodeHdrRW + 1) + ALIGN_UP(blockSize, sizeof(void*)));
+    }
+    else
+    {
+        pCodeHdrRW->SetRealCodeHeader(pRealHeaderBuffer);
+    }
 #endif
 
-        pCodeHdrRW->SetDebugInfo(NULL);
-        pCodeHdrRW->SetEHInfo(NULL);
-        pCodeHdrRW->SetGCInfo(NULL);
-        pCodeHdrRW->SetMethodDesc(pMD);
+    pCodeHdrRW->SetDebugInfo(NULL);
+    pCodeHdrRW->SetEHInfo(NULL);
+    pCodeHdrRW->SetGCInfo(NULL);
+    pCodeHdrRW->SetMethodDesc(pMD);
 #ifdef FEATURE_EH_FUNCLETS
-        pCodeHdrRW->SetNumberOfUnwindInfos(nUnwindInfos);
+    pCodeHdrRW->SetNumberOfUnwindInfos(nUnwindInfos);
 #endif
 
 #ifdef USE_INDIRECT_CODEHEADER
-        if (requestInfo.IsDynamicDomain())
-        {
-            *ppRealHeader = (BYTE*)pCode + ALIGN_UP(blockSize, sizeof(void*));
-        }
-        else
-        {
-            *ppRealHeader = NULL;
-        }
-#endif // USE_INDIRECT_CODEHEADER
+    if (requestInfo.IsDynamicDomain())
+    {
+        *ppRealHeader = (BYTE*)pCode + ALIGN_UP(blockSize, sizeof(void*));
+    }
+    else
+    {
+        *ppRealHeader = NULL;
     }
 
+    pRealHeaderBuffer.SuppressRelease();
+#endif // USE_INDIRECT_CODEHEADER
+    pCodeHdrRWBuffer.SuppressRelease();
+
     *ppCodeHeader = pCodeHdr;
     *ppCodeHeaderRW = pCodeHdrRW;
 }
@@ -4854,6 +4882,18 @@ BOOL ExecutionManager::IsManagedCode(PCODE currentPC, HostCallPreference hostCal
         return IsManagedCode(currentPC);
     }
 
+    // This is the profiler-sampling path, so start with a lock-free lookup.
+    // Most lookups resolve entirely within the non-collectible portion of the
+    // range section map and never need the reader lock; only fall back to it
+    // when the walk actually runs into collectible code.
+    RangeSectionLockState lockState = RangeSectionLockState::None;
+    BOOL result = IsManagedCodeWorker(currentPC, &lockState);
+
+    if (lockState != RangeSectionLockState::NeedsLock)
+    {
+        return result;
+    }
+
     ReaderLockHolder rlh(hostCallPreference);
     if (!rlh.Acquired())
     {
@@ -4862,7 +4902,7 @@ BOOL ExecutionManager::IsManagedCode(PCODE currentPC, HostCallPreference hostCal
         return FALSE;
     }
 
-    RangeSectionLockState lockState = RangeSectionLockState::ReaderLocked;
+    lockState = RangeSectionLockState::ReaderLocked;
     return IsManagedCodeWorker(currentPC, &lockState);
 #endif
 }
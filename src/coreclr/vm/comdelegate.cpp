@@ -2200,12 +2200,55 @@ FCIMPL1(PCODE, COMDelegate::GetMulticastInvoke, Object* refThisIn)
 
         ILCodeLabel *nextDelegate = pCode->NewCodeLabel();
         ILCodeLabel *endOfMethod = pCode->NewCodeLabel();
+        ILCodeLabel *generalCase = pCode->NewCodeLabel();
 
         // Get count of delegates
         pCode->EmitLoadThis();
         pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_COUNT)));
         pCode->EmitSTLOC(dwInvocationCountNum);
 
+        // Fast path for an invocation list with a single entry: invoke the lone
+        // target directly without the loop counter machinery. The debugger trace
+        // helper calls mirror the sequence the general loop would produce.
+        pCode->EmitLDLOC(dwInvocationCountNum);
+        pCode->EmitLDC(1);
+        pCode->EmitBNE_UN(generalCase);
+
+#ifdef DEBUGGING_SUPPORTED
+        pCode->EmitLoadThis();
+        pCode->EmitLDC(0);
+        pCode->EmitCALL(METHOD__STUBHELPERS__MULTICAST_DEBUGGER_TRACE_HELPER, 2, 0);
+#endif // DEBUGGING_SUPPORTED
+
+        // Load the single delegate from the invocation list
+        pCode->EmitLoadThis();
+        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_LIST)));
+        pCode->EmitLDC(0);
+        pCode->EmitLDELEM_REF();
+
+        // Load the arguments
+        UINT fastPathParamCount = 0;
+        while(fastPathParamCount < sig.NumFixedArgs())
+            pCode->EmitLDARG(fastPathParamCount++);
+
+        // call the delegate
+        pCode->EmitCALL(pCode->GetToken(pMD), sig.NumFixedArgs(), fReturnVal);
+
+        // Save return value.
+        if(fReturnVal)
+            pCode->EmitSTLOC(dwReturnValNum);
+
+#ifdef DEBUGGING_SUPPORTED
+        pCode->EmitLoadThis();
+        pCode->EmitLDC(1);
+        pCode->EmitCALL(METHOD__STUBHELPERS__MULTICAST_DEBUGGER_TRACE_HELPER, 2, 0);
+#endif // DEBUGGING_SUPPORTED
+
+        pCode->EmitBR(endOfMethod);
+
+        //Label_generalCase:
+        pCode->EmitLabel(generalCase);
+
         // initialize counter
         pCode->EmitLDC(0);
         pCode->EmitSTLOC(dwLoopCounterNum);
@@ -31,6 +31,7 @@
 #include "eventtrace.h"
 #include "finalizerthread.h"
 #include "threadsuspend.h"
+#include "jithost.h"
 
 #ifndef TARGET_UNIX
 #include "dwreport.h"
@@ -1075,6 +1076,9 @@ void ThreadDetaching()
         FreeClrDebugState(pData);
     }
 #endif // ENABLE_CONTRACTS_IMPL
+
+    // Release any jit memory slab parked on this thread.
+    JitHost::FlushThreadLocalCache();
 }
 
 
@@ -9,6 +9,7 @@
 
 #include "common.h"
 
+#include <clrconfignocache.h>
 #include "crst.h"
 #include "log.h"
 #include "corhost.h"
@@ -37,10 +38,111 @@
 #ifndef DACCESS_COMPILE
 Volatile<LONG> g_ShutdownCrstUsageCount = 0;
 
+//-----------------------------------------------------------------
+// Optional per-CrstType acquisition latency statistics, enabled with
+// DOTNET_EnableCrstStatistics. One log2-bucketed histogram per CrstType;
+// increments are racy on purpose - these are diagnostic counters and
+// occasional lost updates are preferable to interlocked traffic on every
+// lock acquisition. The data is queryable through the diagnostics server
+// (see ds_rt_runtime_lock_stats_get).
+//-----------------------------------------------------------------
+static const DWORD CRST_STATS_BUCKET_COUNT = 16;
+
+struct CrstAcquisitionStats
+{
+    ULONG64 m_acquisitions;                      // total acquisitions observed
+    ULONG64 m_buckets[CRST_STATS_BUCKET_COUNT];  // bucket i counts waits in [2^i, 2^(i+1)) microseconds
+};
+
+static CrstAcquisitionStats s_rgCrstStats[kNumberOfCrstTypes];
+
+// -1 until the configuration has been read.
+static Volatile<LONG> s_fCrstStatsEnabled = -1;
+
+static bool IsCrstStatsEnabled()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    LONG enabled = s_fCrstStatsEnabled;
+    if (enabled < 0)
+    {
+        // Crsts are entered long before the regular configuration subsystem
+        // (and its own locks) come up, so read through CLRConfigNoCache.
+        DWORD value = 0;
+        CLRConfigNoCache config = CLRConfigNoCache::Get("EnableCrstStatistics");
+        enabled = (config.IsSet() && config.TryAsInteger(10, value) && value != 0) ? 1 : 0;
+        s_fCrstStatsEnabled = enabled;
+    }
+    return enabled != 0;
+}
+
+static void CrstStatsRecordAcquisition(CrstType crstType, const LARGE_INTEGER& startTicks, const LARGE_INTEGER& endTicks)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if ((DWORD)crstType >= (DWORD)kNumberOfCrstTypes)
+        return;
+
+    static LARGE_INTEGER freq;
+    if (freq.QuadPart == 0)
+        QueryPerformanceFrequency(&freq);
+
+    ULONG64 waitInMicroseconds = (ULONG64)(endTicks.QuadPart - startTicks.QuadPart) * 1000000 / freq.QuadPart;
+
+    DWORD bucket = 0;
+    while ((waitInMicroseconds >>= 1) != 0 && bucket < CRST_STATS_BUCKET_COUNT - 1)
+        bucket++;
+
+    CrstAcquisitionStats* pStats = &s_rgCrstStats[crstType];
+    pStats->m_acquisitions++;
+    pStats->m_buckets[bucket]++;
+}
+
+//-----------------------------------------------------------------
+// Serialize the statistics for the diagnostics server. The layout is a
+// uint32_t bucket count and a uint32_t type count followed by one record per
+// CrstType, in the order of crsttypes_generated.h: the acquisition count and
+// then the bucket counters, all uint64_t.
+//-----------------------------------------------------------------
+BYTE* CrstBase::FlattenStatistics(DWORD* pcbStats)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(pcbStats != NULL);
+    } CONTRACTL_END;
+
+    *pcbStats = 0;
+
+    if (!IsCrstStatsEnabled())
+        return NULL;
+
+    DWORD cbStats = 2 * sizeof(UINT32) + kNumberOfCrstTypes * sizeof(CrstAcquisitionStats);
+    NewArrayHolder<BYTE> buffer = new (nothrow) BYTE[cbStats];
+    if (buffer == NULL)
+        return NULL;
+
+    BYTE* cursor = buffer;
+
+    UINT32 value = CRST_STATS_BUCKET_COUNT;
+    memcpy(cursor, &value, sizeof(value));
+    cursor += sizeof(value);
+
+    value = kNumberOfCrstTypes;
+    memcpy(cursor, &value, sizeof(value));
+    cursor += sizeof(value);
+
+    // Torn counter reads are acceptable for the same reason torn increments are.
+    memcpy(cursor, s_rgCrstStats, kNumberOfCrstTypes * sizeof(CrstAcquisitionStats));
+
+    *pcbStats = cbStats;
+    return buffer.Extract();
+}
+
 //-----------------------------------------------------------------
 // Initialize critical section
 //-----------------------------------------------------------------
-VOID CrstBase::InitWorker(INDEBUG_COMMA(CrstType crstType) CrstFlags flags)
+VOID CrstBase::InitWorker(CrstType crstType, CrstFlags flags)
 {
     CONTRACTL {
         THROWS;
@@ -57,6 +159,7 @@ VOID CrstBase::InitWorker(INDEBUG_COMMA(CrstType crstType) CrstFlags flags)
         InitializeCriticalSection(&m_criticalsection);
     }
 
+    m_crstType = crstType;
     SetFlags(flags);
     SetCrstInitialized();
 
@@ -319,7 +422,19 @@ void CrstBase::Enter(INDEBUG(NoLevelCheckFlag noLevelCheckFlag/* = CRST_LEVEL_CH
         }
     }
 
-    EnterCriticalSection(&m_criticalsection);
+    if (!IsCrstStatsEnabled())
+    {
+        EnterCriticalSection(&m_criticalsection);
+    }
+    else
+    {
+        LARGE_INTEGER startTicks;
+        LARGE_INTEGER endTicks;
+        QueryPerformanceCounter(&startTicks);
+        EnterCriticalSection(&m_criticalsection);
+        QueryPerformanceCounter(&endTicks);
+        CrstStatsRecordAcquisition(m_crstType, startTicks, endTicks);
+    }
 
 #ifdef _DEBUG
     PostEnter();
@@ -593,7 +708,7 @@ void CrstBase::DebugInit(CrstType crstType, CrstFlags flags)
 {
     LIMITED_METHOD_CONTRACT;
 
-    m_crstType = crstType;
+    // m_crstType was already recorded by InitWorker.
     m_tag = GetCrstName(crstType);
     m_crstlevel = GetCrstLevel(crstType);
     m_holderthreadid.Clear();
@@ -222,6 +222,15 @@ public:
     //-----------------------------------------------------------------
     void Destroy();
 
+#ifndef DACCESS_COMPILE
+    //-----------------------------------------------------------------
+    // Serialize the per-CrstType acquisition latency histograms collected
+    // when DOTNET_EnableCrstStatistics is set. Returns a new[]'d buffer the
+    // caller must delete[], or NULL when statistics are disabled.
+    //-----------------------------------------------------------------
+    static BYTE* FlattenStatistics(DWORD* pcbStats);
+#endif
+
 #ifdef _DEBUG
     //-----------------------------------------------------------------
     // Check if attempting to take the lock would violate level order.
@@ -280,7 +289,7 @@ public:
 
 protected:
 
-    VOID InitWorker(INDEBUG_COMMA(CrstType crstType) CrstFlags flags);
+    VOID InitWorker(CrstType crstType, CrstFlags flags);
 
 #ifdef _DEBUG
     void DebugInit(CrstType crstType, CrstFlags flags);
@@ -300,9 +309,9 @@ protected:
         // rest of the flags are CrstFlags
     } CrstReservedFlags;
     DWORD               m_dwFlags;            // Re-entrancy and same level
+    CrstType            m_crstType;           // Type enum, also keys the acquisition statistics
 #ifdef _DEBUG
     UINT                m_entercount;       // # of unmatched Enters.
-    CrstType            m_crstType;         // Type enum (should have a descriptive name for debugging)
     const char         *m_tag;              // Stringized form of the tag for easy debugging
     int                 m_crstlevel;        // what level is the crst in?
     EEThreadId          m_holderthreadid;   // current holder (or NULL)
@@ -443,8 +452,7 @@ public:
     {
         WRAPPER_NO_CONTRACT;
 
-        // throw away the debug-only parameter in retail
-        InitWorker(INDEBUG_COMMA(crstType) flags);
+        InitWorker(crstType, flags);
     }
 
     //-----------------------------------------------------------------
@@ -483,8 +491,7 @@ public:
 
         _ASSERTE((flags & CRST_INITIALIZED) == 0);
 
-        // throw away the debug-only parameter in retail
-        InitWorker(INDEBUG_COMMA(crstType) flags);
+        InitWorker(crstType, flags);
     }
 
     bool InitNoThrow(CrstType crstType, CrstFlags flags = CRST_DEFAULT)
@@ -499,8 +506,7 @@ public:
 
         EX_TRY
         {
-            // throw away the debug-only parameter in retail
-            InitWorker(INDEBUG_COMMA(crstType) flags);
+            InitWorker(crstType, flags);
             fSuccess = true;
         }
         EX_CATCH
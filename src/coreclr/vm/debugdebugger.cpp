@@ -917,7 +917,9 @@ void DebugStackTrace::GetStackFramesHelper(Frame *pStartFrame,
         pData->TargetThread->GetInternal() == GetThread())
     {
         // Null target thread specifies current thread.
-        GetThread()->StackWalkFrames(GetStackFramesCallback, pData, FUNCTIONSONLY, pStartFrame);
+        // LIGHTUNWIND lets the walk use the stackwalk cache, since the callback
+        // only needs the control PC and the method, not nonvolatile registers.
+        GetThread()->StackWalkFrames(GetStackFramesCallback, pData, FUNCTIONSONLY | LIGHTUNWIND, pStartFrame);
     }
     else
     {
@@ -962,7 +964,7 @@ void DebugStackTrace::GetStackFramesHelper(Frame *pStartFrame,
     LSafeToTrace:
         pThread->StackWalkFrames(GetStackFramesCallback,
                                  pData,
-                                 FUNCTIONSONLY|ALLOW_ASYNC_STACK_WALK,
+                                 FUNCTIONSONLY|LIGHTUNWIND|ALLOW_ASYNC_STACK_WALK,
                                  pStartFrame);
     }
 
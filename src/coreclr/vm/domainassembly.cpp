@@ -601,6 +601,11 @@ void DomainAssembly::Activate()
     }
 #endif //_DEBUG
 
+    if (g_pConfig->EagerInteropStubs())
+    {
+        m_pModule->EagerPrepareInteropStubs();
+    }
+
 #ifdef FEATURE_READYTORUN
     if (m_pModule->IsReadyToRun())
     {
@@ -190,6 +190,8 @@ FCFuncStart(gMetaDataImport)
     FCFuncElement("_GetGenericParamProps", MetaDataImport::GetGenericParamProps)
 
     FCFuncElement("_Enum", MetaDataImport::Enum)
+    FCFuncElement("_EnumParamDefProps", MetaDataImport::EnumParamDefProps)
+    FCFuncElement("_EnumFieldDefProps", MetaDataImport::EnumFieldDefProps)
     FCFuncElement("_GetMemberRefProps", MetaDataImport::GetMemberRefProps)
     FCFuncElement("_GetCustomAttributeProps", MetaDataImport::GetCustomAttributeProps)
     FCFuncElement("_GetFieldOffset", MetaDataImport::GetFieldOffset)
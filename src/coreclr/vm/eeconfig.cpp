@@ -117,6 +117,7 @@ HRESULT EEConfig::Init()
     fStressLog = false;
     fForceEnc = false;
     fProbeForStackOverflow = true;
+    fEagerInteropStubs = false;
 
     INDEBUG(fStressLog = true;)
 
@@ -248,6 +249,7 @@ HRESULT EEConfig::Init()
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = 10;
     dwOSR_CounterBump = 5000;
+    dwOSR_MaxTier0DwellMs = 5000;
 #endif
 
     backpatchEntryPointSlots = false;
@@ -620,6 +622,8 @@ HRESULT EEConfig::sync()
     fExpandAllOnLoad = (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ExpandAllOnLoad) != 0);
 #endif //_DEBUG
 
+    fEagerInteropStubs = (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_EagerInteropStubs) != 0);
+
 #ifdef ENABLE_STARTUP_DELAY
     {
         //I want this string in decimal
@@ -716,6 +720,13 @@ HRESULT EEConfig::sync()
         tieredCompilation_BackgroundWorkerTimeoutMs =
             CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerTimeoutMs);
 
+        tieredCompilation_BackgroundWorkerMaxWorkDurationMs =
+            CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerMaxWorkDurationMs);
+        if (tieredCompilation_BackgroundWorkerMaxWorkDurationMs == 0)
+        {
+            tieredCompilation_BackgroundWorkerMaxWorkDurationMs = 1;
+        }
+
         fTieredCompilation_CallCounting = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCounting) != 0;
 
         DWORD tieredCompilation_ConfiguredCallCountThreshold =
@@ -775,6 +786,8 @@ HRESULT EEConfig::sync()
         {
             ETW::CompilationLog::TieredCompilation::Runtime::SendSettings();
         }
+
+        TieredCompilationManager::TryLoadPromotionProfile();
     }
 #endif
 
@@ -795,6 +808,7 @@ HRESULT EEConfig::sync()
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_HitLimit);
     dwOSR_CounterBump = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_CounterBump);
+    dwOSR_MaxTier0DwellMs = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_MaxTier0DwellMs);
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -292,6 +292,61 @@ ds_rt_set_environment_variable (const ep_char16_t *name, const ep_char16_t *valu
 	return SetEnvironmentVariableW(reinterpret_cast<LPCWSTR>(name), reinterpret_cast<LPCWSTR>(value)) ? S_OK : HRESULT_FROM_WIN32(GetLastError());
 }
 
+/*
+* Heap snapshot
+*/
+
+#include "heapsnapshot.h"
+
+static
+ds_ipc_result_t
+ds_rt_create_heap_snapshot (
+	const ep_char16_t *snapshotName,
+	uint32_t flags,
+	ep_char8_t *errorMessageBuffer,
+	int32_t cbErrorMessageBuffer)
+{
+	STATIC_CONTRACT_NOTHROW;
+
+	ds_ipc_result_t result = DS_IPC_E_FAIL;
+	EX_TRY
+	{
+		if (GenerateHeapSnapshot (reinterpret_cast<LPCWSTR>(snapshotName), flags, errorMessageBuffer, cbErrorMessageBuffer))
+		{
+			result = DS_IPC_S_OK;
+		}
+	}
+	EX_CATCH {}
+	EX_END_CATCH(SwallowAllExceptions);
+	return result;
+}
+
+/*
+* Runtime lock statistics
+*/
+
+static
+ds_ipc_result_t
+ds_rt_runtime_lock_stats_get (
+	uint8_t **buffer,
+	uint32_t *buffer_len)
+{
+	STATIC_CONTRACT_NOTHROW;
+
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (buffer_len != NULL);
+
+	// The buffer is new[]'d, matching ep_rt_byte_array_free in the caller.
+	DWORD size = 0;
+	BYTE *stats = CrstBase::FlattenStatistics (&size);
+	if (stats == NULL)
+		return DS_IPC_E_NOTSUPPORTED;
+
+	*buffer = reinterpret_cast<uint8_t *>(stats);
+	*buffer_len = size;
+	return DS_IPC_S_OK;
+}
+
 /*
 * DiagnosticServer.
 */
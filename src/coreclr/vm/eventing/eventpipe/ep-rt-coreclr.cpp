@@ -83,10 +83,13 @@ ep_rt_coreclr_walk_managed_stack_for_thread (
 	// which will cause the GC to try to walk the stack while we are in the middle of walking the stack.
 	bool gc_on_transitions = GC_ON_TRANSITIONS (FALSE);
 
+	// LIGHTUNWIND enables the stackwalk cache where supported; sampling hits the
+	// same hot frames repeatedly, so cached unwind info cuts the per-frame cost.
+	// Only the IPs are collected here, so skipping the full GC info decode is safe.
 	StackWalkAction result = thread->StackWalkFrames (
 		(PSTACKWALKFRAMESCALLBACK)stack_walk_callback,
 		stack_contents,
-		ALLOW_ASYNC_STACK_WALK | FUNCTIONSONLY | HANDLESKIPPEDFRAMES | ALLOW_INVALID_OBJECTS);
+		ALLOW_ASYNC_STACK_WALK | FUNCTIONSONLY | HANDLESKIPPEDFRAMES | ALLOW_INVALID_OBJECTS | LIGHTUNWIND);
 
 	GC_ON_TRANSITIONS (gc_on_transitions);
 	return ((result == SWA_DONE) || (result == SWA_CONTINUE));
@@ -2776,6 +2776,8 @@ unsigned int ETW::TypeSystemLog::s_nEpoch = 0;
 BOOL ETW::TypeSystemLog::s_fHeapAllocEventEnabledOnStartup = FALSE;
 BOOL ETW::TypeSystemLog::s_fHeapAllocHighEventEnabledNow = FALSE;
 BOOL ETW::TypeSystemLog::s_fHeapAllocLowEventEnabledNow = FALSE;
+BOOL ETW::TypeSystemLog::s_fAllocationSamplingEnabledOnStartup = FALSE;
+BOOL ETW::TypeSystemLog::s_fAllocationSamplingEnabledNow = FALSE;
 int ETW::TypeSystemLog::s_nCustomMsBetweenEvents = 0;
 
 
@@ -2821,6 +2823,8 @@ void ETW::TypeSystemLog::PostRegistrationInit()
     // sampling is turned on
     s_fHeapAllocLowEventEnabledNow = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_GCHEAPALLOCLOW_KEYWORD);
     s_fHeapAllocHighEventEnabledNow = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_GCHEAPALLOCHIGH_KEYWORD);
+    s_fAllocationSamplingEnabledNow = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_ALLOCATIONSAMPLING_KEYWORD);
+    s_fAllocationSamplingEnabledOnStartup = s_fAllocationSamplingEnabledNow;
 
     // Snapshot the current state of the object allocated keyword (on startup), and rely
     // on this snapshot for the rest of the process run. Since these events require the
@@ -2880,6 +2884,7 @@ void ETW::TypeSystemLog::OnKeywordsChanged()
     // update our state.
     s_fHeapAllocLowEventEnabledNow = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_GCHEAPALLOCLOW_KEYWORD);
     s_fHeapAllocHighEventEnabledNow = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_GCHEAPALLOCHIGH_KEYWORD);
+    s_fAllocationSamplingEnabledNow = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_ALLOCATIONSAMPLING_KEYWORD);
 
     // FUTURE: Would be nice here to log an error event if (s_fHeapAllocLowEventEnabledNow ||
     // s_fHeapAllocHighEventEnabledNow), but !s_fHeapAllocEventEnabledOnStartup
@@ -2950,6 +2955,24 @@ BOOL ETW::TypeSystemLog::IsHeapAllocEventEnabled()
         (s_fHeapAllocHighEventEnabledNow || s_fHeapAllocLowEventEnabledNow);
 }
 
+//---------------------------------------------------------------------------------------
+//
+// Use this to decide whether to fire the AllocationSampled event. Same
+// startup-vs-now rules as IsHeapAllocEventEnabled: the event requires the slow
+// allocation helpers, which can only be chosen at startup.
+//
+// Return Value:
+//      nonzero iff we should fire the event.
+//
+
+// static
+BOOL ETW::TypeSystemLog::IsAllocationSamplingEnabled()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return s_fAllocationSamplingEnabledOnStartup && s_fAllocationSamplingEnabledNow;
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Helper that adds (or updates) the TypeLoggingInfo inside the inner hash table passed
@@ -3146,6 +3169,48 @@ void ETW::TypeSystemLog::SendObjectAllocatedEvent(Object * pObject)
     }
 }
 
+//---------------------------------------------------------------------------------------
+//
+// Fires the AllocationSampled event for an allocation the caller has already
+// decided to sample (see the byte-countdown in gchelpers.cpp). Unlike
+// SendObjectAllocatedEvent, no per-type stats are kept here; the sampling
+// decision is purely byte-based, so this only has to make the TypeID resolvable
+// and send the event.
+//
+// Arguments:
+//      * pObject - Sampled object to log
+//      * allocationKind - 0 for SOH, 1 for LOH, 2 for POH allocations
+//
+
+// static
+void ETW::TypeSystemLog::SendAllocationSampledEvent(Object * pObject, UINT32 allocationKind)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    if (!g_fEEStarted)
+        return;
+
+    TypeHandle th = pObject->GetTypeHandle();
+
+    // Log the type the first time we see it so consumers can resolve TypeID to a
+    // name through the usual BulkType events.
+    LogTypeAndParametersIfNecessary(NULL, th.AsTAddr(), kTypeLogBehaviorTakeLockAndLogIfFirstTime);
+
+    SIZE_T size = pObject->GetSize();
+    if (size < MIN_OBJECT_SIZE)
+    {
+        size = PtrAlign(size);
+    }
+
+    FireEtwAllocationSampled(GetClrInstanceId(), allocationKind, (LPVOID) th.AsTAddr(), size);
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Accessor for global hash table crst
@@ -7132,8 +7197,102 @@ VOID ETW::MethodLog::SendEventsForNgenMethods(Module *pModule, DWORD dwEventOpti
 #endif // FEATURE_READYTORUN
 }
 
+namespace ETW
+{
+    // Everything needed to emit one jitted method's rundown events after the
+    // code heap and code versioning locks have been released.
+    struct JitMethodRundownInfo
+    {
+        MethodDesc *pMD;
+        PCODE codeStart;
+        DWORD nativeCodeVersionId;
+        ReJITID ilCodeId;
+        NativeCodeVersion nativeCodeVersion;
+    };
+
+    class JitMethodsRundownSnapshot
+    {
+    public:
+        SArray<JitMethodRundownInfo> m_methods;
+    };
+}
+
+// Emits the requested events for one jitted method. Used both for methods
+// emitted while the CodeHeapIterator lock is held (collectible methods) and
+// for methods snapshotted and emitted after the locks are released.
+VOID ETW::MethodLog::SendEventsForJitMethod(const JitMethodRundownInfo &info,
+                                   DWORD dwEventOptions,
+                                   BOOL fLoadOrDCStart,
+                                   BOOL fUnloadOrDCEnd,
+                                   BOOL fSendMethodEvent,
+                                   BOOL fSendILToNativeMapEvent,
+                                   BOOL fSendRichDebugInfoEvent,
+                                   MethodDescSet *pSentMethodDetailsSet)
+{
+    CONTRACTL{
+        THROWS;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    MethodDesc * pMD = info.pMD;
+    PCODE codeStart = info.codeStart;
+
+    PrepareCodeConfig config(!info.nativeCodeVersion.IsNull() ? info.nativeCodeVersion : NativeCodeVersion(pMD), FALSE, FALSE);
+
+    // When we're called to announce loads, then the methodload event itself must
+    // precede any supplemental events, so that the method load or method jitting
+    // event is the first event the profiler sees for that MethodID (and not, say,
+    // the MethodILToNativeMap event.)
+    if (fLoadOrDCStart)
+    {
+        if (fSendMethodEvent)
+        {
+            ETW::MethodLog::SendMethodEvent(
+                pMD,
+                dwEventOptions,
+                TRUE,           // bIsJit
+                NULL,           // namespaceOrClassName
+                NULL,           // methodName
+                NULL,           // methodSignature
+                codeStart,
+                &config,
+                pSentMethodDetailsSet);
+        }
+    }
+
+    // Send any supplemental events requested for this MethodID
+    if (fSendILToNativeMapEvent)
+        ETW::MethodLog::SendMethodILToNativeMapEvent(pMD, dwEventOptions, codeStart, info.nativeCodeVersionId, info.ilCodeId);
+
+    if (fSendRichDebugInfoEvent)
+        ETW::MethodLog::SendMethodRichDebugInfo(pMD, codeStart, info.nativeCodeVersion.GetVersionId(), info.ilCodeId, pSentMethodDetailsSet);
+
+    // When we're called to announce unloads, then the methodunload event itself must
+    // come after any supplemental events, so that the method unload event is the
+    // last event the profiler sees for this MethodID
+    if (fUnloadOrDCEnd)
+    {
+        if (fSendMethodEvent)
+        {
+            ETW::MethodLog::SendMethodEvent(
+                pMD,
+                dwEventOptions,
+                TRUE,           // bIsJit
+                NULL,           // namespaceOrClassName
+                NULL,           // methodName
+                NULL,           // methodSignature
+                codeStart,
+                &config);
+        }
+    }
+}
+
 // Called be ETW::MethodLog::SendEventsForJitMethods
-// Sends the ETW events once our caller determines whether or not rejit locks can be acquired
+// Walks the jitted methods once our caller determines whether or not rejit locks
+// can be acquired. When pSnapshot is provided, methods that can safely be emitted
+// later are collected into it instead of being emitted under the CodeHeapIterator
+// lock; rundown on a large process sends events for tens of thousands of methods
+// and jitting would otherwise stall behind that.
 VOID ETW::MethodLog::SendEventsForJitMethodsHelper(LoaderAllocator *pLoaderAllocatorFilter,
                                                    DWORD dwEventOptions,
                                                    BOOL fLoadOrDCStart,
@@ -7141,7 +7300,9 @@ VOID ETW::MethodLog::SendEventsForJitMethodsHelper(LoaderAllocator *pLoaderAlloc
                                                    BOOL fSendMethodEvent,
                                                    BOOL fSendILToNativeMapEvent,
                                                    BOOL fSendRichDebugInfoEvent,
-                                                   BOOL fGetCodeIds)
+                                                   BOOL fGetCodeIds,
+                                                   JitMethodsRundownSnapshot *pSnapshot,
+                                                   MethodDescSet *pSentMethodDetailsSet)
 {
     CONTRACTL{
         THROWS;
@@ -7151,12 +7312,6 @@ VOID ETW::MethodLog::SendEventsForJitMethodsHelper(LoaderAllocator *pLoaderAlloc
     _ASSERTE(pLoaderAllocatorFilter == nullptr || pLoaderAllocatorFilter->IsCollectible());
     _ASSERTE(pLoaderAllocatorFilter == nullptr || !fGetCodeIds);
 
-    // Set of methods for which we already have sent a MethodDetails event.
-    // Only used when sending rich debug info that would otherwise send a lot
-    // of duplicate events.
-    MethodDescSet sentMethodDetailsSet;
-    MethodDescSet* pSentMethodDetailsSet = fSendRichDebugInfoEvent ? &sentMethodDetailsSet : NULL;
-
     EEJitManager::CodeHeapIterator heapIterator(pLoaderAllocatorFilter);
     while (heapIterator.Next())
     {
@@ -7170,15 +7325,17 @@ VOID ETW::MethodLog::SendEventsForJitMethodsHelper(LoaderAllocator *pLoaderAlloc
         // allocators, we don't support code versioning so we need to short circuit the call.
         // This also allows our caller to avoid having to pre-enter the relevant locks.
         // see code:#TableLockHolder
-        DWORD nativeCodeVersionId = 0;
-        ReJITID ilCodeId = 0;
-        NativeCodeVersion nativeCodeVersion;
+        JitMethodRundownInfo info;
+        info.pMD = pMD;
+        info.codeStart = codeStart;
+        info.nativeCodeVersionId = 0;
+        info.ilCodeId = 0;
 #ifdef FEATURE_CODE_VERSIONING
         if (fGetCodeIds && pMD->IsVersionable())
         {
             _ASSERTE(CodeVersionManager::IsLockOwnedByCurrentThread());
-            nativeCodeVersion = pMD->GetCodeVersionManager()->GetNativeCodeVersion(pMD, codeStart);
-            if (nativeCodeVersion.IsNull())
+            info.nativeCodeVersion = pMD->GetCodeVersionManager()->GetNativeCodeVersion(pMD, codeStart);
+            if (info.nativeCodeVersion.IsNull())
             {
                 // The code version manager hasn't been updated with the jitted code
                 if (codeStart != pMD->GetNativeCode())
@@ -7188,8 +7345,8 @@ VOID ETW::MethodLog::SendEventsForJitMethodsHelper(LoaderAllocator *pLoaderAlloc
             }
             else
             {
-                nativeCodeVersionId = nativeCodeVersion.GetVersionId();
-                ilCodeId = nativeCodeVersion.GetILCodeVersionId();
+                info.nativeCodeVersionId = info.nativeCodeVersion.GetVersionId();
+                info.ilCodeId = info.nativeCodeVersion.GetILCodeVersionId();
             }
         }
         else
@@ -7199,54 +7356,24 @@ VOID ETW::MethodLog::SendEventsForJitMethodsHelper(LoaderAllocator *pLoaderAlloc
             continue;
         }
 
-        PrepareCodeConfig config(!nativeCodeVersion.IsNull() ? nativeCodeVersion : NativeCodeVersion(pMD), FALSE, FALSE);
-
-        // When we're called to announce loads, then the methodload event itself must
-        // precede any supplemental events, so that the method load or method jitting
-        // event is the first event the profiler sees for that MethodID (and not, say,
-        // the MethodILToNativeMap event.)
-        if (fLoadOrDCStart)
+        // Methods from collectible loader allocators may not outlive the
+        // iterator, so their events are emitted here under the lock. Everything
+        // else is deferred to the snapshot when the caller asked for one.
+        if (pSnapshot != NULL && !pMD->GetLoaderAllocator()->IsCollectible())
         {
-            if (fSendMethodEvent)
-            {
-                ETW::MethodLog::SendMethodEvent(
-                    pMD,
-                    dwEventOptions,
-                    TRUE,           // bIsJit
-                    NULL,           // namespaceOrClassName
-                    NULL,           // methodName
-                    NULL,           // methodSignature
-                    codeStart,
-                    &config,
-                    pSentMethodDetailsSet);
-            }
+            pSnapshot->m_methods.Append(info);
+            continue;
         }
 
-        // Send any supplemental events requested for this MethodID
-        if (fSendILToNativeMapEvent)
-            ETW::MethodLog::SendMethodILToNativeMapEvent(pMD, dwEventOptions, codeStart, nativeCodeVersionId, ilCodeId);
-
-        if (fSendRichDebugInfoEvent)
-            ETW::MethodLog::SendMethodRichDebugInfo(pMD, codeStart, nativeCodeVersion.GetVersionId(), ilCodeId, pSentMethodDetailsSet);
-
-        // When we're called to announce unloads, then the methodunload event itself must
-        // come after any supplemental events, so that the method unload event is the
-        // last event the profiler sees for this MethodID
-        if (fUnloadOrDCEnd)
-        {
-            if (fSendMethodEvent)
-            {
-                ETW::MethodLog::SendMethodEvent(
-                    pMD,
-                    dwEventOptions,
-                    TRUE,           // bIsJit
-                    NULL,           // namespaceOrClassName
-                    NULL,           // methodName
-                    NULL,           // methodSignature
-                    codeStart,
-                    &config);
-            }
-        }
+        SendEventsForJitMethod(
+            info,
+            dwEventOptions,
+            fLoadOrDCStart,
+            fUnloadOrDCEnd,
+            fSendMethodEvent,
+            fSendILToNativeMapEvent,
+            fSendRichDebugInfoEvent,
+            pSentMethodDetailsSet);
     }
 }
 
@@ -7318,6 +7445,18 @@ VOID ETW::MethodLog::SendEventsForJitMethods(BaseDomain *pDomainFilter, LoaderAl
         // table lock that corresponds to the domain or module we're currently iterating over.
         //
 
+        // Set of methods for which we already have sent a MethodDetails event.
+        // Only used when sending rich debug info that would otherwise send a lot
+        // of duplicate events. Shared between the under-lock and post-snapshot
+        // emission passes below.
+        MethodDescSet sentMethodDetailsSet;
+        MethodDescSet* pSentMethodDetailsSet = fSendRichDebugInfoEvent ? &sentMethodDetailsSet : NULL;
+
+        // Non-collectible methods are collected under the locks and emitted
+        // afterwards so the code heap lock is not held while the bulk of the
+        // rundown events are built and written.
+        JitMethodsRundownSnapshot snapshot;
+
         // We only support getting rejit IDs when filtering by domain.
 #ifdef FEATURE_CODE_VERSIONING
         if (pDomainFilter)
@@ -7331,7 +7470,9 @@ VOID ETW::MethodLog::SendEventsForJitMethods(BaseDomain *pDomainFilter, LoaderAl
                 fSendMethodEvent,
                 fSendILToNativeMapEvent,
                 fSendRichDebugInfoEvent,
-                TRUE);
+                TRUE,
+                &snapshot,
+                pSentMethodDetailsSet);
         }
         else
 #endif
@@ -7344,7 +7485,23 @@ VOID ETW::MethodLog::SendEventsForJitMethods(BaseDomain *pDomainFilter, LoaderAl
                 fSendMethodEvent,
                 fSendILToNativeMapEvent,
                 fSendRichDebugInfoEvent,
-                FALSE);
+                FALSE,
+                &snapshot,
+                pSentMethodDetailsSet);
+        }
+
+        COUNT_T snapshotCount = snapshot.m_methods.GetCount();
+        for (COUNT_T i = 0; i < snapshotCount; i++)
+        {
+            SendEventsForJitMethod(
+                snapshot.m_methods[i],
+                dwEventOptions,
+                fLoadOrDCStart,
+                fUnloadOrDCEnd,
+                fSendMethodEvent,
+                fSendILToNativeMapEvent,
+                fSendRichDebugInfoEvent,
+                pSentMethodDetailsSet);
         }
     } EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 #endif // !DACCESS_COMPILE
@@ -7790,6 +7947,17 @@ void ETW::CompilationLog::TieredCompilation::Runtime::SendBackgroundJitStop(UINT
     FireEtwTieredCompilationBackgroundJitStop(GetClrInstanceId(), pendingMethodCount, jittedMethodCount);
 }
 
+void ETW::CompilationLog::TieredCompilation::Runtime::SendOnStackReplacement(UINT64 methodID, UINT32 ilOffset, UINT32 hitCount, UINT64 dwellTimeMs)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+    _ASSERTE(g_pConfig->TieredCompilation());
+
+    FireEtwTieredCompilationOnStackReplacement(GetClrInstanceId(), methodID, ilOffset, hitCount, dwellTimeMs);
+}
+
 #endif // !FEATURE_NATIVEAOT
 
 #ifdef FEATURE_PERFTRACING
@@ -5426,6 +5426,24 @@ ExceptionTracker* TrackerAllocator::GetTrackerMemory()
 
     _ASSERTE(NULL != m_pFirstPage);
 
+    //
+    // Steady state throw/catch on a thread is served from the thread's single
+    // entry cache, avoiding the lock and the page scan below.  The cached
+    // tracker was zeroed when it was put into the cache and kept its m_pThread,
+    // so it is ready for reuse as is.
+    //
+    {
+        ThreadExceptionState* pExState = GetThread()->GetExceptionState();
+        ExceptionTracker* pCachedTracker = pExState->m_pCachedTracker;
+        if (pCachedTracker != NULL)
+        {
+            _ASSERTE(pCachedTracker->m_pThread == GetThread());
+            pExState->m_pCachedTracker = NULL;
+            EH_LOG((LL_INFO100, "TrackerAllocator: reusing cached tracker 0x%p, thread = 0x%p\n", pCachedTracker, pCachedTracker->m_pThread));
+            RETURN pCachedTracker;
+        }
+    }
+
     Page* pPage = m_pFirstPage;
 
     ExceptionTracker* pTracker = NULL;
@@ -5508,9 +5526,33 @@ void TrackerAllocator::FreeTrackerMemory(ExceptionTracker* pTracker)
     }
     CONTRACTL_END;
 
-    // mark this entry as free
     EH_LOG((LL_INFO100, "TrackerAllocator: freeing tracker 0x%p, thread = 0x%p\n", pTracker, pTracker->m_pThread));
     CONSISTENCY_CHECK(pTracker->IsValid());
+
+    //
+    // If the owning thread is the one freeing the tracker and it has no cached
+    // tracker yet, keep this one for its next exception.  Zero it now while we
+    // still own it, preserving m_pThread: a non-NULL m_pThread is what keeps
+    // GetTrackerMemory's page scan from handing this slot to another thread.
+    // The emergency OOM tracker is embedded in the ThreadExceptionState and
+    // must go back to being marked free instead.
+    //
+    Thread* pCurThread = GetThreadNULLOk();
+    if ((pCurThread != NULL) && (pTracker->m_pThread == pCurThread))
+    {
+        ThreadExceptionState* pExState = pCurThread->GetExceptionState();
+        if ((pExState->m_pCachedTracker == NULL) && (pTracker != &pExState->m_OOMTracker))
+        {
+            const size_t cbBeforeThread = offsetof(ExceptionTracker, m_pThread);
+            const size_t ofsAfterThread = cbBeforeThread + sizeof(Thread*);
+            ZeroMemory(pTracker, cbBeforeThread);
+            ZeroMemory((BYTE*)pTracker + ofsAfterThread, sizeof(*pTracker) - ofsAfterThread);
+            pExState->m_pCachedTracker = pTracker;
+            return;
+        }
+    }
+
+    // mark this entry as free
     InterlockedExchangeT(&(pTracker->m_pThread), NULL);
 }
 
@@ -34,6 +34,7 @@ ThreadExceptionState::ThreadExceptionState()
 {
 #ifdef FEATURE_EH_FUNCLETS
     m_pCurrentTracker = NULL;
+    m_pCachedTracker = NULL;
 #endif // FEATURE_EH_FUNCLETS
 
     m_flag = TEF_None;
@@ -46,6 +47,16 @@ ThreadExceptionState::ThreadExceptionState()
 
 ThreadExceptionState::~ThreadExceptionState()
 {
+#if defined(FEATURE_EH_FUNCLETS) && !defined(DACCESS_COMPILE)
+    if (m_pCachedTracker != NULL)
+    {
+        // Return the cached tracker memory to the global pool by marking the
+        // slot as free.
+        InterlockedExchangeT(&m_pCachedTracker->m_pThread, (Thread*)NULL);
+        m_pCachedTracker = NULL;
+    }
+#endif // FEATURE_EH_FUNCLETS && !DACCESS_COMPILE
+
 #ifndef TARGET_UNIX
     // Init the UE Watson BucketTracker
     m_UEWatsonBucketTracker.ClearWatsonBucketDetails();
@@ -47,6 +47,9 @@ class ThreadExceptionState
 
 #ifdef FEATURE_EH_FUNCLETS
     friend class ExceptionTracker;
+    // TrackerAllocator needs access so that it can recycle tracker memory
+    // through m_pCachedTracker
+    friend class TrackerAllocator;
 #else
     friend class ExInfo;
 #endif // FEATURE_EH_FUNCLETS
@@ -144,6 +147,11 @@ private:
 
 #ifdef FEATURE_EH_FUNCLETS
     PTR_ExceptionTracker    m_pCurrentTracker;
+    // Single entry cache of tracker memory freed by this thread, consumed by
+    // the next exception it throws without going through the global allocator.
+    // The cached tracker keeps its m_pThread set so the allocator's page scan
+    // cannot hand the slot to another thread.
+    PTR_ExceptionTracker    m_pCachedTracker;
     ExceptionTracker        m_OOMTracker;
 public:
     PTR_ExceptionTracker    GetCurrentExceptionTracker()
@@ -31,11 +31,27 @@ CLREvent * FinalizerThread::hEventFinalizerToShutDown = NULL;
 
 HANDLE FinalizerThread::MHandles[kHandleCount];
 
+DWORD FinalizerThread::s_ParallelWorkerCount = 0;
+FinalizerThread::ParallelFinalizerWorker * FinalizerThread::s_ParallelWorkers = NULL;
+LONG FinalizerThread::s_ParallelFinalizeCount = 0;
+
 BOOL FinalizerThread::IsCurrentThreadFinalizer()
 {
     LIMITED_METHOD_CONTRACT;
 
-    return GetThreadNULLOk() == g_pFinalizerThread;
+    Thread* pThread = GetThreadNULLOk();
+    if (pThread == g_pFinalizerThread)
+    {
+        return TRUE;
+    }
+    for (DWORD i = 0; i < s_ParallelWorkerCount; i++)
+    {
+        if (s_ParallelWorkers[i].pThread == pThread)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
 }
 
 void FinalizerThread::EnableFinalization()
@@ -82,6 +98,40 @@ void CallFinalizer(Object* obj)
     }
 }
 
+// Drains the finalization queue partitions assigned to the given thread. In parallel
+// finalization mode partitions are distributed round robin over the main finalizer
+// thread (threadIndex 0) and the workers (threadIndex 1..s_ParallelWorkerCount).
+unsigned int FinalizerThread::FinalizePartitions(Thread *pThread, unsigned int threadIndex)
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    unsigned int fcount = 0;
+    unsigned int partitionCount = GCHeapUtilities::GetGCHeap()->GetFinalizationPartitionCount();
+    unsigned int threadCount = s_ParallelWorkerCount + 1;
+
+    for (unsigned int partition = threadIndex; partition < partitionCount; partition += threadCount)
+    {
+        Object* fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizableInPartition(partition);
+        while (fobj && !fQuitFinalizer)
+        {
+            fcount++;
+
+            CallFinalizer(fobj);
+
+            // thread abort could be injected by the debugger,
+            // but should not be allowed to "leak" out of expression evaluation
+            _ASSERTE(!pThread->IsAbortRequested());
+
+            pThread->InternalReset();
+
+            fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizableInPartition(partition);
+        }
+    }
+    return fcount;
+}
+
 void FinalizerThread::FinalizeAllObjects()
 {
     STATIC_CONTRACT_THROWS;
@@ -92,28 +142,205 @@ void FinalizerThread::FinalizeAllObjects()
 
     unsigned int fcount = 0;
 
-    Object* fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+    if (s_ParallelWorkerCount != 0)
+    {
+        // Wake the workers, drain this thread's share of the partitions, then wait for
+        // the workers so that anyone released by SignalFinalizationDone observes a fully
+        // drained queue. The done events are reset first so a signal left over from a
+        // cycle that exited on an exception cannot satisfy this cycle's wait.
+        for (DWORD i = 0; i < s_ParallelWorkerCount; i++)
+        {
+            s_ParallelWorkers[i].hDoneEvent.Reset();
+            s_ParallelWorkers[i].hWorkEvent.Set();
+        }
 
-    Thread *pThread = GetThread();
+        fcount += FinalizePartitions(GetThread(), 0);
+
+        GetFinalizerThread()->EnablePreemptiveGC();
+        for (DWORD i = 0; i < s_ParallelWorkerCount; i++)
+        {
+            s_ParallelWorkers[i].hDoneEvent.Wait(INFINITE, FALSE);
+        }
+        GetFinalizerThread()->DisablePreemptiveGC();
 
-    // Finalize everyone
-    while (fobj && !fQuitFinalizer)
+        fcount += (unsigned int)InterlockedExchange(&s_ParallelFinalizeCount, 0);
+    }
+    else
     {
-        fcount++;
+        Object* fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+
+        Thread *pThread = GetThread();
 
-        CallFinalizer(fobj);
+        // Finalize everyone
+        while (fobj && !fQuitFinalizer)
+        {
+            fcount++;
 
-        // thread abort could be injected by the debugger,
-        // but should not be allowed to "leak" out of expression evaluation
-        _ASSERTE(!GetFinalizerThread()->IsAbortRequested());
+            CallFinalizer(fobj);
 
-        pThread->InternalReset();
+            // thread abort could be injected by the debugger,
+            // but should not be allowed to "leak" out of expression evaluation
+            _ASSERTE(!GetFinalizerThread()->IsAbortRequested());
 
-        fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+            pThread->InternalReset();
+
+            fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+        }
     }
     FireEtwGCFinalizersEnd_V1(fcount, GetClrInstanceId());
 }
 
+VOID FinalizerThread::ParallelWorkerLoop(void *args)
+{
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    Thread *pThread = GetThread();
+
+    ParallelFinalizerWorker *pWorker = NULL;
+    unsigned int threadIndex = 0;
+    for (DWORD i = 0; i < s_ParallelWorkerCount; i++)
+    {
+        if (s_ParallelWorkers[i].pThread == pThread)
+        {
+            pWorker = &s_ParallelWorkers[i];
+            threadIndex = i + 1;
+            break;
+        }
+    }
+    _ASSERTE(pWorker != NULL);
+
+    while (!fQuitFinalizer)
+    {
+        pThread->EnablePreemptiveGC();
+        pWorker->hWorkEvent.Wait(INFINITE, FALSE);
+        pThread->DisablePreemptiveGC();
+
+        if (fQuitFinalizer)
+        {
+            pWorker->hDoneEvent.Set();
+            break;
+        }
+
+        unsigned int fcount = FinalizePartitions(pThread, threadIndex);
+        if (fcount != 0)
+        {
+            InterlockedExchangeAdd(&s_ParallelFinalizeCount, (LONG)fcount);
+        }
+
+        pWorker->hDoneEvent.Set();
+    }
+}
+
+DWORD WINAPI FinalizerThread::ParallelWorkerThreadStart(void *args)
+{
+    ClrFlsSetThreadType (ThreadType_Finalizer);
+
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    ParallelFinalizerWorker *pWorker = (ParallelFinalizerWorker*)args;
+
+    LOG((LF_GC, LL_INFO10, "Finalizer worker thread starting...\n"));
+
+    BOOL fWorkerThreadOK = pWorker->pThread->HasStarted();
+    _ASSERTE(fWorkerThreadOK);
+    _ASSERTE(GetThread() == pWorker->pThread);
+
+    if (fWorkerThreadOK)
+    {
+        INSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+        {
+            pWorker->pThread->SetBackground(TRUE);
+
+            while (!fQuitFinalizer)
+            {
+                // This will apply any policy for swallowing exceptions during normal
+                // processing, without allowing the worker thread to disappear on us.
+                ManagedThreadBase::FinalizerBase(ParallelWorkerLoop);
+
+                // If we came out on an exception we may have abandoned a drain request,
+                // so signal done to make sure the main finalizer thread is not left
+                // waiting on us.
+                if (!fQuitFinalizer)
+                    pWorker->hDoneEvent.Set();
+            }
+        }
+        UNINSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+    }
+
+    LOG((LF_GC, LL_INFO10, "Finalizer worker thread done."));
+
+    // Enable pre-emptive GC before we leave so that anybody trying to suspend
+    // us will not end up waiting forever. Like the main finalizer thread, park
+    // instead of tearing down.
+    pWorker->pThread->EnablePreemptiveGC();
+
+    while (1)
+    {
+        __SwitchToThread(INFINITE, CALLER_LIMITS_SPINNING);
+    }
+
+    return 0;
+}
+
+void FinalizerThread::CreateParallelWorkers()
+{
+    CONTRACTL{
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+    } CONTRACTL_END;
+
+    DWORD configuredCount = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_ParallelFinalizerThreadCount);
+    if (configuredCount == 0)
+    {
+        return;
+    }
+
+    // A standalone GC built against an older interface may not implement the
+    // partitioned finalization methods.
+    if ((g_gc_version_info.MajorVersion == GC_INTERFACE_MAJOR_VERSION) &&
+        (g_gc_version_info.MinorVersion < 2))
+    {
+        return;
+    }
+
+    // There is no point in running more finalizer threads than there are partitions.
+    unsigned int partitionCount = GCHeapUtilities::GetGCHeap()->GetFinalizationPartitionCount();
+    DWORD workerCount = min(configuredCount, (DWORD)(partitionCount - 1));
+    if (workerCount == 0)
+    {
+        return;
+    }
+
+    s_ParallelWorkers = new ParallelFinalizerWorker[workerCount];
+
+    for (DWORD i = 0; i < workerCount; i++)
+    {
+        ParallelFinalizerWorker *pWorker = &s_ParallelWorkers[i];
+        pWorker->hWorkEvent.CreateAutoEvent(FALSE);
+        pWorker->hDoneEvent.CreateAutoEvent(FALSE);
+        pWorker->pThread = SetupUnstartedThread();
+
+        // We don't want the thread block disappearing under us -- even if the
+        // actual thread terminates.
+        pWorker->pThread->IncExternalCount();
+
+        if (!pWorker->pThread->CreateNewThread(0, &ParallelWorkerThreadStart, pWorker, W(".NET Finalizer Worker")))
+        {
+            // Couldn't start this worker; run with the ones created so far.
+            break;
+        }
+
+        pWorker->pThread->StartThread();
+
+        // The main finalizer thread is not running yet, so nobody observes
+        // intermediate counts.
+        s_ParallelWorkerCount = i + 1;
+    }
+}
+
 void FinalizerThread::WaitForFinalizerEvent (CLREvent *event)
 {
     // Non-host environment
@@ -345,6 +572,12 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
         SignalFinalizationDone(TRUE);
     }
 
+    // Wake the parallel workers so they observe fQuitFinalizer and park.
+    for (DWORD i = 0; i < s_ParallelWorkerCount; i++)
+    {
+        s_ParallelWorkers[i].hWorkEvent.Set();
+    }
+
     if (s_InitializedFinalizerThreadForPlatform)
         Thread::CleanUpForManagedThreadInNative(GetFinalizerThread());
 }
@@ -443,6 +676,10 @@ void FinalizerThread::FinalizerThreadCreate()
     hEventFinalizerToShutDown = new CLREvent();
     hEventFinalizerToShutDown->CreateAutoEvent(FALSE);
 
+    // Start the parallel workers (if configured) before the main finalizer thread so
+    // that it never observes a partially initialized worker array.
+    CreateParallelWorkers();
+
     _ASSERTE(g_pFinalizerThread == 0);
     g_pFinalizerThread = SetupUnstartedThread();
 
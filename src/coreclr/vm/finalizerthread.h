@@ -30,9 +30,28 @@ class FinalizerThread
 
     static HANDLE MHandles[kHandleCount];
 
+    // State for the opt-in parallel finalization mode (ParallelFinalizerThreadCount).
+    // Each additional worker thread drains its own share of the GC's finalization
+    // queue partitions; the main finalizer thread drains the rest and waits for the
+    // workers before signaling that finalization is done.
+    struct ParallelFinalizerWorker
+    {
+        Thread  *pThread;
+        CLREvent hWorkEvent;
+        CLREvent hDoneEvent;
+    };
+
+    static DWORD s_ParallelWorkerCount;
+    static ParallelFinalizerWorker *s_ParallelWorkers;
+    static LONG s_ParallelFinalizeCount;
+
     static void WaitForFinalizerEvent (CLREvent *event);
 
     static void FinalizeAllObjects();
+    static unsigned int FinalizePartitions(Thread *pThread, unsigned int threadIndex);
+    static void CreateParallelWorkers();
+    static VOID ParallelWorkerLoop(void *args);
+    static DWORD WINAPI ParallelWorkerThreadStart(void *args);
 
 public:
     static Thread* GetFinalizerThread()
@@ -93,6 +93,158 @@ Object* FrozenObjectHeapManager::TryAllocateObject(PTR_MethodTable type, size_t
 #endif // !FEATURE_BASICFREEZE
 }
 
+#ifdef FEATURE_BASICFREEZE
+// Formats [pObj, pObj + size) as a free (unused array) object the same way
+// the GC does, so a partially filled range keeps the segment walkable.
+static void FormatAsFreeObject(uint8_t* pObj, size_t size)
+{
+    _ASSERT(g_pFreeObjectMethodTable != nullptr);
+    _ASSERT(size >= g_pFreeObjectMethodTable->GetBaseSize());
+
+    Object* obj = reinterpret_cast<Object*>(pObj);
+    obj->SetMethodTable(g_pFreeObjectMethodTable);
+
+    size_t* numComponentsPtr = reinterpret_cast<size_t*>(pObj + ArrayBase::GetOffsetOfNumComponents());
+    *numComponentsPtr = size - g_pFreeObjectMethodTable->GetBaseSize();
+}
+#endif // FEATURE_BASICFREEZE
+
+// Reserves arenaSize bytes on a frozen segment under a single lock acquisition
+// and commits them up front. Returns false if arenas are not supported or the
+// requested size is unreasonable for the frozen heap.
+bool FrozenObjectHeapManager::TryReserveArena(size_t arenaSize, FrozenObjectArena* arena)
+{
+    CONTRACTL
+    {
+        THROWS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END
+
+#ifndef FEATURE_BASICFREEZE
+    return false;
+#else // FEATURE_BASICFREEZE
+
+    _ASSERT(arena != nullptr);
+    _ASSERT(arena->m_Segment == nullptr);
+
+    arenaSize = ALIGN_UP(arenaSize, DATA_ALIGNMENT);
+
+    // The arena must be big enough to format as a free object and small enough
+    // to always fit in a fresh segment.
+    if ((arenaSize < MIN_OBJECT_SIZE) || (arenaSize > FOH_SEGMENT_DEFAULT_SIZE / 4))
+    {
+        return false;
+    }
+
+    CrstHolder ch(&m_Crst);
+
+    if (m_CurrentSegment == nullptr)
+    {
+        m_CurrentSegment = new FrozenObjectSegment(FOH_SEGMENT_DEFAULT_SIZE);
+        m_FrozenSegments.Append(m_CurrentSegment);
+    }
+
+    uint8_t* range = m_CurrentSegment->TryReserveRange(arenaSize);
+    if (range == nullptr)
+    {
+        // Double the reserved size to reduce the number of frozen segments in apps with lots of frozen objects
+        size_t prevSegmentSize = m_CurrentSegment->GetSize();
+        m_CurrentSegment = new FrozenObjectSegment(max(prevSegmentSize, prevSegmentSize * 2));
+        m_FrozenSegments.Append(m_CurrentSegment);
+
+        range = m_CurrentSegment->TryReserveRange(arenaSize);
+        _ASSERT(range != nullptr);
+    }
+
+    // Keep the reserved range walkable until the caller overwrites it; the
+    // caller must not leave cooperative mode before FinishArena.
+    FormatAsFreeObject(range, arenaSize);
+
+    arena->m_Segment = m_CurrentSegment;
+    arena->m_pCurrent = range;
+    arena->m_pEnd = range + arenaSize;
+    return true;
+#endif // !FEATURE_BASICFREEZE
+}
+
+// Returns whatever the caller did not use to the segment. If other allocations
+// happened after the arena was carved out, the tail can't be un-bumped and is
+// left formatted as a free object instead.
+void FrozenObjectHeapManager::FinishArena(FrozenObjectArena* arena)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END
+
+#ifdef FEATURE_BASICFREEZE
+    _ASSERT(arena != nullptr);
+
+    if (arena->m_Segment == nullptr)
+    {
+        return;
+    }
+
+    CrstHolder ch(&m_Crst);
+
+    if (arena->m_pCurrent != arena->m_pEnd)
+    {
+        if (!arena->m_Segment->TryRollbackTo(arena->m_pCurrent, arena->m_pEnd))
+        {
+            FormatAsFreeObject(arena->m_pCurrent, (size_t)(arena->m_pEnd - arena->m_pCurrent));
+        }
+    }
+
+    arena->m_Segment = nullptr;
+    arena->m_pCurrent = nullptr;
+    arena->m_pEnd = nullptr;
+#endif // FEATURE_BASICFREEZE
+}
+
+#ifdef FEATURE_BASICFREEZE
+Object* FrozenObjectArena::TryAllocateObject(PTR_MethodTable type, size_t objectSize)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END
+
+    _ASSERT(m_Segment != nullptr);
+    _ASSERT(type != nullptr);
+    _ASSERT(objectSize >= MIN_OBJECT_SIZE);
+    _ASSERT(IS_ALIGNED(m_pCurrent, DATA_ALIGNMENT));
+
+#ifdef FEATURE_64BIT_ALIGNMENT
+    if (type->RequiresAlign8())
+    {
+        // Align8 objects are not supported yet
+        return nullptr;
+    }
+#endif
+
+    const size_t spaceLeft = (size_t)(m_pEnd - m_pCurrent);
+
+    // What remains after this object must be either nothing or big enough to
+    // re-format as a free object in FinishArena.
+    if ((spaceLeft < objectSize) ||
+        ((spaceLeft - objectSize != 0) && (spaceLeft - objectSize < MIN_OBJECT_SIZE)))
+    {
+        return nullptr;
+    }
+
+    Object* object = reinterpret_cast<Object*>(m_pCurrent);
+    object->SetMethodTable(type);
+
+    m_pCurrent += objectSize;
+    return object;
+}
+#endif // FEATURE_BASICFREEZE
+
 // Reserve sizeHint bytes of memory for the given frozen segment.
 // The requested size can be be ignored in case of memory pressure and FOH_SEGMENT_DEFAULT_SIZE is used instead.
 FrozenObjectSegment::FrozenObjectSegment(size_t sizeHint) :
@@ -202,3 +354,58 @@ Object* FrozenObjectSegment::TryAllocateObject(PTR_MethodTable type, size_t obje
 
     return object;
 }
+
+// Carves size bytes out of the segment in one step, committing as many chunks
+// as the range needs. Unlike TryAllocateObject the range may span multiple
+// commit chunks. Returns nullptr if the segment doesn't have the room.
+uint8_t* FrozenObjectSegment::TryReserveRange(size_t size)
+{
+    _ASSERT(m_pStart != nullptr && m_Size > 0 && m_SegmentHandle != nullptr); // Expected to be inited
+    _ASSERT(IS_ALIGNED(m_pCurrent, DATA_ALIGNMENT));
+    _ASSERT(m_pCurrent >= m_pStart + sizeof(ObjHeader));
+
+    const size_t spaceUsed = (size_t)(m_pCurrent - m_pStart);
+    const size_t spaceLeft = m_Size - spaceUsed;
+
+    // Test if we have a room for the range (including extra sizeof(ObjHeader) for next object)
+    if (spaceLeft - sizeof(ObjHeader) < size)
+    {
+        return nullptr;
+    }
+
+    while (spaceUsed + size + sizeof(ObjHeader) > m_SizeCommitted)
+    {
+        // Make sure we don't go out of bounds during this commit
+        _ASSERT(m_SizeCommitted + FOH_COMMIT_SIZE <= m_Size);
+
+        if (ClrVirtualAlloc(m_pStart + m_SizeCommitted, FOH_COMMIT_SIZE, MEM_COMMIT, PAGE_READWRITE) == nullptr)
+        {
+            ThrowOutOfMemory();
+        }
+        m_SizeCommitted += FOH_COMMIT_SIZE;
+    }
+
+    uint8_t* range = m_pCurrent;
+    m_pCurrent += size;
+
+    GCHeapUtilities::GetGCHeap()->UpdateFrozenSegment(m_SegmentHandle, m_pCurrent, m_pStart + m_SizeCommitted);
+
+    return range;
+}
+
+// Un-bumps the allocation pointer to pNewCurrent if the segment hasn't moved
+// past pExpectedCurrent; returns false if other allocations got in between.
+bool FrozenObjectSegment::TryRollbackTo(uint8_t* pNewCurrent, uint8_t* pExpectedCurrent)
+{
+    _ASSERT(pNewCurrent >= m_pStart + sizeof(ObjHeader));
+    _ASSERT(pNewCurrent <= pExpectedCurrent);
+
+    if (m_pCurrent != pExpectedCurrent)
+    {
+        return false;
+    }
+
+    m_pCurrent = pNewCurrent;
+    GCHeapUtilities::GetGCHeap()->UpdateFrozenSegment(m_SegmentHandle, m_pCurrent, m_pStart + m_SizeCommitted);
+    return true;
+}
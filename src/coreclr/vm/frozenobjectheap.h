@@ -22,12 +22,15 @@
 //
 
 class FrozenObjectSegment;
+class FrozenObjectArena;
 
 class FrozenObjectHeapManager
 {
 public:
     FrozenObjectHeapManager();
     Object* TryAllocateObject(PTR_MethodTable type, size_t objectSize, bool publish = true);
+    bool TryReserveArena(size_t arenaSize, FrozenObjectArena* arena);
+    void FinishArena(FrozenObjectArena* arena);
 
 private:
     Crst m_Crst;
@@ -35,11 +38,39 @@ private:
     FrozenObjectSegment* m_CurrentSegment;
 };
 
+// A bump-pointer window on a frozen segment, reserved (and committed) under a
+// single lock acquisition via FrozenObjectHeapManager::TryReserveArena so that
+// bulk interning doesn't pay per-object lock and commit traffic.
+//
+// The caller allocates from the arena without any locking and must stay in
+// cooperative mode from the reservation until FinishArena is called, which
+// returns the unused tail to the segment (or formats it as a free object if
+// the segment has moved on). Arena allocations are never published; callers
+// that store references into frozen objects must publish them explicitly.
+class FrozenObjectArena
+{
+    friend class FrozenObjectHeapManager;
+
+public:
+    Object* TryAllocateObject(PTR_MethodTable type, size_t objectSize);
+
+private:
+    FrozenObjectSegment* m_Segment = nullptr;
+
+    // Next object starts here (same convention as FrozenObjectSegment::m_pCurrent)
+    uint8_t* m_pCurrent = nullptr;
+
+    // End of the reserved range
+    uint8_t* m_pEnd = nullptr;
+};
+
 class FrozenObjectSegment
 {
 public:
     FrozenObjectSegment(size_t sizeHint);
     Object* TryAllocateObject(PTR_MethodTable type, size_t objectSize);
+    uint8_t* TryReserveRange(size_t size);
+    bool TryRollbackTo(uint8_t* pNewCurrent, uint8_t* pExpectedCurrent);
 
     size_t GetSize() const
     {
@@ -45,6 +45,11 @@ extern "C" bool g_sw_ww_enabled_for_gc_heap;
 
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
+// The version of the IGCHeap interface reported by the loaded GC. A standalone GC
+// built against an older minor version can still be loaded, so callers of IGCHeap
+// methods added in later minor versions must check this before using them.
+extern VersionInfo g_gc_version_info;
+
 // g_gc_dac_vars is a structure of pointers to GC globals that the
 // DAC uses. It is not exposed directly to the DAC.
 extern GcDacVars g_gc_dac_vars;
@@ -305,6 +305,73 @@ inline void LogAlloc(Object* object)
 #define LogAlloc( object)
 #endif
 
+// Sampling state for ObjectAllocated profiler callbacks. When
+// DOTNET_ProfAPI_ObjectAllocatedSamplingKB is nonzero, each thread runs a byte
+// countdown over its allocations and only the allocation that exhausts the budget
+// is reported, so always-on allocation attribution does not pay for a callback per
+// object. The interval is read once on first use; 0 (the default) keeps the
+// documented callback-per-object behavior.
+static Volatile<LONG> s_profAllocSamplingIntervalKB = -1;
+static thread_local size_t t_profAllocSamplingBudget = 0;
+
+static bool ShouldNotifyProfilerOfAllocation(size_t size)
+{
+    WRAPPER_NO_CONTRACT;
+
+    LONG intervalKB = s_profAllocSamplingIntervalKB;
+    if (intervalKB == -1)
+    {
+        intervalKB = (LONG)CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_ProfAPI_ObjectAllocatedSamplingKB);
+        s_profAllocSamplingIntervalKB = intervalKB;
+    }
+
+    if (intervalKB == 0)
+        return true;
+
+    size_t budget = t_profAllocSamplingBudget;
+    if (budget > size)
+    {
+        t_profAllocSamplingBudget = budget - size;
+        return false;
+    }
+
+    t_profAllocSamplingBudget = (size_t)intervalKB * 1024;
+    return true;
+}
+
+#ifdef FEATURE_EVENT_TRACE
+// Sampling state for the AllocationSampled event. Each thread runs a byte
+// countdown over its allocations and only the allocation that exhausts the
+// budget is reported, so a continuously attached session observes roughly one
+// event per DOTNET_AllocationSamplingRateKB kilobytes allocated per thread.
+static Volatile<LONG> s_eventAllocSamplingRateKB = -1;
+static thread_local size_t t_eventAllocSamplingBudget = 0;
+
+static bool ShouldSampleAllocationEvent(size_t size)
+{
+    WRAPPER_NO_CONTRACT;
+
+    LONG rateKB = s_eventAllocSamplingRateKB;
+    if (rateKB == -1)
+    {
+        rateKB = (LONG)CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_AllocationSamplingRateKB);
+        if (rateKB <= 0)
+            rateKB = 100;
+        s_eventAllocSamplingRateKB = rateKB;
+    }
+
+    size_t budget = t_eventAllocSamplingBudget;
+    if (budget > size)
+    {
+        t_eventAllocSamplingBudget = budget - size;
+        return false;
+    }
+
+    t_eventAllocSamplingBudget = (size_t)rateKB * 1024;
+    return true;
+}
+#endif // FEATURE_EVENT_TRACE
+
 // signals completion of the object to GC and sends events if necessary
 template <class TObj>
 void PublishObjectAndNotify(TObj* &orObject, GC_ALLOC_FLAGS flags)
@@ -322,7 +389,9 @@ void PublishObjectAndNotify(TObj* &orObject, GC_ALLOC_FLAGS flags)
 
     // Notify the profiler of the allocation
     // do this after initializing bounds so callback has size information
-    if (TrackAllocations() ||
+    // Large and pinned object tracking is opted into separately and is rare, so only
+    // the general allocation callback is subject to sampling.
+    if ((TrackAllocations() && ShouldNotifyProfilerOfAllocation(orObject->GetSize())) ||
         (TrackLargeAllocations() && flags & GC_ALLOC_LARGE_OBJECT_HEAP) ||
 		(TrackPinnedAllocations() && flags & GC_ALLOC_PINNED_OBJECT_HEAP))
     {
@@ -339,6 +408,15 @@ void PublishObjectAndNotify(TObj* &orObject, GC_ALLOC_FLAGS flags)
     {
         ETW::TypeSystemLog::SendObjectAllocatedEvent(orObject);
     }
+
+    // Send the byte-countdown sampled allocation event
+    if (ETW::TypeSystemLog::IsAllocationSamplingEnabled() && ShouldSampleAllocationEvent(orObject->GetSize()))
+    {
+        UINT32 allocationKind =
+            (flags & GC_ALLOC_LARGE_OBJECT_HEAP) ? 1 :
+            (flags & GC_ALLOC_PINNED_OBJECT_HEAP) ? 2 : 0;
+        ETW::TypeSystemLog::SendAllocationSampledEvent((Object*)orObject, allocationKind);
+    }
 #endif // FEATURE_EVENT_TRACE
 }
 
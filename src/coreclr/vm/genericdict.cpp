@@ -106,6 +106,32 @@ DictionaryLayout::GetDictionarySizeFromLayout(
 }
 
 #ifndef DACCESS_COMPILE
+//---------------------------------------------------------------------------------------
+//
+// The dictionary layout of a generic type or method is shared by all of its
+// instantiations, so an expansion has to serialize against other expansions of the
+// same layout and its dictionaries, but not against expansions of unrelated
+// generics. Key the lock off the module that owns the shared layout instead of a
+// single process-wide crst: readers never take it (they only ever see fully
+// published dictionary arrays), and writers only contend when they are genuinely
+// growing the same generic.
+//
+static CrstBase* GetExpansionCrst(MethodTable* pMT)
+{
+    WRAPPER_NO_CONTRACT;
+    return &pMT->GetCanonicalMethodTable()->GetLoaderModule()->m_DictionaryCrst;
+}
+
+static CrstBase* GetExpansionCrst(MethodDesc* pMD)
+{
+    WRAPPER_NO_CONTRACT;
+    // For wrapper stubs the layout hangs off the wrapped method desc (see
+    // IMD_GetDictionaryLayout), so use the layout owner to pick the lock.
+    if (pMD->IsWrapperStub())
+        pMD = pMD->GetWrappedMethodDesc();
+    return &pMD->GetLoaderModule()->m_DictionaryCrst;
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Find a token in the dictionary layout and return the offsets of indirections
@@ -130,7 +156,8 @@ BOOL DictionaryLayout::FindTokenWorker(LoaderAllocator*                 pAllocat
                                        CORINFO_RUNTIME_LOOKUP*          pResult,
                                        WORD*                            pSlotOut,
                                        DWORD                            scanFromSlot /* = 0 */,
-                                       BOOL                             useEmptySlotIfFound /* = FALSE */)
+                                       BOOL                             useEmptySlotIfFound /* = FALSE */,
+                                       CrstBase*                        pExpansionCrst /* = NULL */)
 
 {
     CONTRACTL
@@ -231,8 +258,8 @@ BOOL DictionaryLayout::FindTokenWorker(LoaderAllocator*                 pAllocat
                 return FALSE;
             }
 
-            // A lock should be taken by FindToken before being allowed to use an empty slot in the layout
-            _ASSERT(SystemDomain::SystemModule()->m_DictionaryCrst.OwnedByCurrentThread());
+            // The layout owner's lock should be taken by FindToken before being allowed to use an empty slot in the layout
+            _ASSERT(pExpansionCrst != NULL && pExpansionCrst->OwnedByCurrentThread());
 
             PVOID pResultSignature = pSigBuilder == NULL ? pSig : CreateSignatureWithSlotData(pSigBuilder, pAllocator, slot);
             pDictLayout->m_slots[iSlot].m_signature = pResultSignature;
@@ -263,13 +290,14 @@ DictionaryLayout* DictionaryLayout::ExpandDictionaryLayout(LoaderAllocator*
                                                            int                              nFirstOffset,
                                                            DictionaryEntrySignatureSource   signatureSource,
                                                            CORINFO_RUNTIME_LOOKUP*          pResult,
-                                                           WORD*                            pSlotOut)
+                                                           WORD*                            pSlotOut,
+                                                           CrstBase*                        pExpansionCrst)
 {
     CONTRACTL
     {
         STANDARD_VM_CHECK;
         INJECT_FAULT(ThrowOutOfMemory(););
-        PRECONDITION(SystemDomain::SystemModule()->m_DictionaryCrst.OwnedByCurrentThread());
+        PRECONDITION(pExpansionCrst != NULL && pExpansionCrst->OwnedByCurrentThread());
         PRECONDITION(CheckPointer(pResult) && CheckPointer(pSlotOut));
     }
     CONTRACTL_END
@@ -336,14 +364,15 @@ BOOL DictionaryLayout::FindToken(MethodTable*                       pMT,
     if (FindTokenWorker(pAllocator, pMT->GetNumGenericArgs(), pMT->GetClass()->GetDictionaryLayout(), pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, pResult, pSlotOut, 0, FALSE))
         return TRUE;
 
-    CrstHolder ch(&SystemDomain::SystemModule()->m_DictionaryCrst);
+    CrstBase* pExpansionCrst = GetExpansionCrst(pMT);
+    CrstHolder ch(pExpansionCrst);
     {
         // Try again under lock in case another thread already expanded the dictionaries or filled an empty slot
-        if (FindTokenWorker(pMT->GetLoaderAllocator(), pMT->GetNumGenericArgs(), pMT->GetClass()->GetDictionaryLayout(), pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, pResult, pSlotOut, *pSlotOut, TRUE))
+        if (FindTokenWorker(pMT->GetLoaderAllocator(), pMT->GetNumGenericArgs(), pMT->GetClass()->GetDictionaryLayout(), pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, pResult, pSlotOut, *pSlotOut, TRUE, pExpansionCrst))
             return TRUE;
 
         DictionaryLayout* pOldLayout = pMT->GetClass()->GetDictionaryLayout();
-        DictionaryLayout* pNewLayout = ExpandDictionaryLayout(pAllocator, pOldLayout, pMT->GetNumGenericArgs(), pSigBuilder, pSig, nFirstOffset, signatureSource, pResult, pSlotOut);
+        DictionaryLayout* pNewLayout = ExpandDictionaryLayout(pAllocator, pOldLayout, pMT->GetNumGenericArgs(), pSigBuilder, pSig, nFirstOffset, signatureSource, pResult, pSlotOut, pExpansionCrst);
         if (pNewLayout == NULL)
         {
             pResult->signature = pSigBuilder == NULL ? pSig : CreateSignatureWithSlotData(pSigBuilder, pAllocator, 0);
@@ -383,14 +412,15 @@ BOOL DictionaryLayout::FindToken(MethodDesc*                        pMD,
     if (FindTokenWorker(pAllocator, pMD->GetNumGenericMethodArgs(), pMD->GetDictionaryLayout(), pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, pResult, pSlotOut, 0, FALSE))
         return TRUE;
 
-    CrstHolder ch(&SystemDomain::SystemModule()->m_DictionaryCrst);
+    CrstBase* pExpansionCrst = GetExpansionCrst(pMD);
+    CrstHolder ch(pExpansionCrst);
     {
         // Try again under lock in case another thread already expanded the dictionaries or filled an empty slot
-        if (FindTokenWorker(pAllocator, pMD->GetNumGenericMethodArgs(), pMD->GetDictionaryLayout(), pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, pResult, pSlotOut, *pSlotOut, TRUE))
+        if (FindTokenWorker(pAllocator, pMD->GetNumGenericMethodArgs(), pMD->GetDictionaryLayout(), pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, pResult, pSlotOut, *pSlotOut, TRUE, pExpansionCrst))
             return TRUE;
 
         DictionaryLayout* pOldLayout = pMD->GetDictionaryLayout();
-        DictionaryLayout* pNewLayout = ExpandDictionaryLayout(pAllocator, pOldLayout, pMD->GetNumGenericMethodArgs(), pSigBuilder, pSig, nFirstOffset, signatureSource, pResult, pSlotOut);
+        DictionaryLayout* pNewLayout = ExpandDictionaryLayout(pAllocator, pOldLayout, pMD->GetNumGenericMethodArgs(), pSigBuilder, pSig, nFirstOffset, signatureSource, pResult, pSlotOut, pExpansionCrst);
         if (pNewLayout == NULL)
         {
             pResult->signature = pSigBuilder == NULL ? pSig : CreateSignatureWithSlotData(pSigBuilder, pAllocator, 0);
@@ -501,7 +531,7 @@ Dictionary* Dictionary::GetMethodDictionaryWithSizeCheck(MethodDesc* pMD, ULONG
         // Only expand the dictionary if the current slot we're trying to use is beyond the size of the dictionary
 
         // Take lock and check for size again, just in case another thread already resized the dictionary
-        CrstHolder ch(&SystemDomain::SystemModule()->m_DictionaryCrst);
+        CrstHolder ch(GetExpansionCrst(pMD));
 
         pDictionary = pMD->GetMethodDictionary();
         currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
@@ -559,7 +589,7 @@ Dictionary* Dictionary::GetTypeDictionaryWithSizeCheck(MethodTable* pMT, ULONG s
         // Only expand the dictionary if the current slot we're trying to use is beyond the size of the dictionary
 
         // Take lock and check for size again, just in case another thread already resized the dictionary
-        CrstHolder ch(&SystemDomain::SystemModule()->m_DictionaryCrst);
+        CrstHolder ch(GetExpansionCrst(pMT));
 
         pDictionary = pMT->GetDictionary();
         currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
@@ -718,7 +748,7 @@ Dictionary::PopulateEntry(
 
 #if _DEBUG
         // Lock is needed because dictionary pointers can get updated during dictionary size expansion
-        CrstHolder ch(&SystemDomain::SystemModule()->m_DictionaryCrst);
+        CrstHolder ch(GetExpansionCrst(pMT));
 
         // MethodTable is expected to be normalized
         Dictionary* pDictionary = pMT->GetDictionary();
@@ -48,6 +48,7 @@ class Module;
 class BaseDomain;
 class SigTypeContext;
 class SigBuilder;
+class CrstBase;
 
 enum DictionaryEntryKind
 {
@@ -120,7 +121,8 @@ private:
                                 CORINFO_RUNTIME_LOOKUP*             pResult,
                                 WORD*                               pSlotOut,
                                 DWORD                               scanFromSlot,
-                                BOOL                                useEmptySlotIfFound);
+                                BOOL                                useEmptySlotIfFound,
+                                CrstBase*                           pExpansionCrst = NULL);
 
 
     static DictionaryLayout* ExpandDictionaryLayout(LoaderAllocator*                pAllocator,
@@ -131,7 +133,8 @@ private:
                                                     int                             nFirstOffset,
                                                     DictionaryEntrySignatureSource  signatureSource,
                                                     CORINFO_RUNTIME_LOOKUP*         pResult,
-                                                    WORD*                           pSlotOut);
+                                                    WORD*                           pSlotOut,
+                                                    CrstBase*                       pExpansionCrst);
 
     static PVOID CreateSignatureWithSlotData(SigBuilder* pSigBuilder, LoaderAllocator* pAllocator, WORD slot);
 
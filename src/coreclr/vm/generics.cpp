@@ -329,6 +329,10 @@ ClassLoader::CreateTypeHandleForNonCanonicalGenericInstantiation(
     // Non non-virtual slots
     pMT->ClearFlag(MethodTable::enum_flag_HasSingleNonVirtualSlot);
 
+    // The interface bitmap is rebuilt below once this instantiation's own
+    // interface map has been filled in; do not advertise the canonical one.
+    pMT->ClearFlag(MethodTable::enum_flag_HasInterfaceBitmap);
+
     pMT->SetBaseSize(pOldMT->GetBaseSize());
     pMT->SetParentMethodTable(pOldMT->GetParentMethodTable());
     pMT->SetCanonicalMethodTable(pOldMT);
@@ -449,6 +453,11 @@ ClassLoader::CreateTypeHandleForNonCanonicalGenericInstantiation(
     // Fill in interface map pointer
     pMT->SetInterfaceMap(wNumInterfaces, pInterfaceMap);
 
+    // cbIMap included the bitmap word whenever the canonical method table carried
+    // one, so there is room to rebuild the filter over this map's entries.
+    if (pOldMT->HasInterfaceBitmap())
+        pMT->BuildInterfaceBitmap();
+
     // Copy across extra flags for these interfaces as well. We may need additional memory for this.
     PVOID pExtraInterfaceInfo = NULL;
     SIZE_T cbExtraInterfaceInfo = MethodTable::GetExtraInterfaceInfoSize(wNumInterfaces);
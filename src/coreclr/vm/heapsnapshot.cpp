@@ -0,0 +1,190 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// heapsnapshot.cpp
+//
+
+#include "common.h"
+#include "heapsnapshot.h"
+#include "gcheaputilities.h"
+#include "threadsuspend.h"
+
+#ifdef TARGET_UNIX
+
+namespace
+{
+    const uint32_t HeapSnapshotMagic = 0x50534847; // 'GHSP' in little endian
+    const uint32_t HeapSnapshotFormatVersion = 1;
+
+    // Upper bound on the number of generation ranges recorded. Each heap
+    // contributes a handful of ranges per generation, so this covers machines
+    // with hundreds of server GC heaps.
+    const size_t MaxSnapshotRanges = 4096;
+
+    // The snapshot file starts with this header, followed by rangeCount
+    // HeapSnapshotRangeEntry records, followed by the raw contents of each
+    // range in the same order.
+    struct HeapSnapshotHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t pointerSize;
+        uint32_t rangeCount;
+    };
+
+    struct HeapSnapshotRangeEntry
+    {
+        uint64_t baseAddress;
+        uint64_t byteSize;
+    };
+
+    struct HeapSnapshotWalkContext
+    {
+        PAL_HeapSnapshotRange* ranges;
+        size_t rangeCount;
+        bool overflowed;
+    };
+
+    // gen_walk_fn callback - records one committed generation range. Runs
+    // while the EE is suspended, so it must not allocate.
+    void CollectGenerationRange(void* context, int generation, uint8_t* rangeStart, uint8_t* rangeEnd, uint8_t* rangeReserved)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        HeapSnapshotWalkContext* walkContext = (HeapSnapshotWalkContext*)context;
+        if (rangeEnd <= rangeStart)
+        {
+            return;
+        }
+        if (walkContext->rangeCount >= MaxSnapshotRanges)
+        {
+            walkContext->overflowed = true;
+            return;
+        }
+        walkContext->ranges[walkContext->rangeCount].baseAddress = rangeStart;
+        walkContext->ranges[walkContext->rangeCount].byteSize = (SIZE_T)(rangeEnd - rangeStart);
+        walkContext->rangeCount++;
+    }
+}
+
+#endif // TARGET_UNIX
+
+bool GenerateHeapSnapshot(
+    LPCWSTR snapshotName,
+    uint32_t flags,
+    char* errorMessageBuffer,
+    int32_t cbErrorMessageBuffer)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(errorMessageBuffer == nullptr || cbErrorMessageBuffer > 0);
+
+#ifdef TARGET_UNIX
+    if (flags != 0)
+    {
+        if (errorMessageBuffer != nullptr)
+        {
+            sprintf_s(errorMessageBuffer, cbErrorMessageBuffer, "Problem creating heap snapshot: unsupported flags 0x%08x\n", flags);
+        }
+        return false;
+    }
+
+    MAKE_UTF8PTR_FROMWIDE_NOTHROW(snapshotNameUtf8, snapshotName);
+    if (snapshotNameUtf8 == nullptr)
+    {
+        return false;
+    }
+
+    // The diagnostics server thread has no Thread object; it needs one to
+    // suspend the runtime.
+    if (GetThreadNULLOk() == nullptr)
+    {
+        HRESULT hr = S_OK;
+        if (SetupThreadNoThrow(&hr) == nullptr)
+        {
+            if (errorMessageBuffer != nullptr)
+            {
+                sprintf_s(errorMessageBuffer, cbErrorMessageBuffer, "Problem creating heap snapshot: thread setup FAILED %08x\n", hr);
+            }
+            return false;
+        }
+    }
+
+    // Allocate everything up front - no allocation while the EE is suspended.
+    // The header blob is the fixed header immediately followed by the range
+    // table, so the PAL can write it with a single buffer.
+    NewArrayHolder<PAL_HeapSnapshotRange> ranges = new (nothrow) PAL_HeapSnapshotRange[MaxSnapshotRanges];
+    NewArrayHolder<uint8_t> headerBlob = new (nothrow) uint8_t[sizeof(HeapSnapshotHeader) + MaxSnapshotRanges * sizeof(HeapSnapshotRangeEntry)];
+    if (ranges == nullptr || headerBlob == nullptr)
+    {
+        if (errorMessageBuffer != nullptr)
+        {
+            sprintf_s(errorMessageBuffer, cbErrorMessageBuffer, "Problem creating heap snapshot: out of memory\n");
+        }
+        return false;
+    }
+
+    HeapSnapshotWalkContext walkContext;
+    walkContext.ranges = ranges;
+    walkContext.rangeCount = 0;
+    walkContext.overflowed = false;
+
+    bool result = false;
+
+    // Suspend the runtime so the heap is quiescent while the range table is
+    // collected and the writer is forked. The pause ends as soon as the fork
+    // returns - the copy-on-write child serializes the heap on its own time.
+    ThreadSuspend::SuspendEE(ThreadSuspend::SUSPEND_OTHER);
+
+    GCHeapUtilities::GetGCHeap()->DiagDescrGenerations(CollectGenerationRange, &walkContext);
+
+    if (walkContext.overflowed)
+    {
+        if (errorMessageBuffer != nullptr)
+        {
+            sprintf_s(errorMessageBuffer, cbErrorMessageBuffer, "Problem creating heap snapshot: more than %zu heap ranges\n", MaxSnapshotRanges);
+        }
+    }
+    else
+    {
+        HeapSnapshotHeader* header = (HeapSnapshotHeader*)headerBlob.GetValue();
+        header->magic = HeapSnapshotMagic;
+        header->version = HeapSnapshotFormatVersion;
+        header->pointerSize = (uint32_t)sizeof(void*);
+        header->rangeCount = (uint32_t)walkContext.rangeCount;
+
+        HeapSnapshotRangeEntry* rangeTable = (HeapSnapshotRangeEntry*)(headerBlob.GetValue() + sizeof(HeapSnapshotHeader));
+        for (size_t i = 0; i < walkContext.rangeCount; i++)
+        {
+            rangeTable[i].baseAddress = (uint64_t)(size_t)ranges[i].baseAddress;
+            rangeTable[i].byteSize = (uint64_t)ranges[i].byteSize;
+        }
+
+        result = PAL_CreateHeapSnapshot(
+            snapshotNameUtf8,
+            headerBlob,
+            sizeof(HeapSnapshotHeader) + walkContext.rangeCount * sizeof(HeapSnapshotRangeEntry),
+            ranges,
+            walkContext.rangeCount,
+            errorMessageBuffer,
+            cbErrorMessageBuffer) != FALSE;
+    }
+
+    ThreadSuspend::RestartEE(FALSE, TRUE);
+
+    return result;
+#else // TARGET_UNIX
+    if (errorMessageBuffer != nullptr)
+    {
+        sprintf_s(errorMessageBuffer, cbErrorMessageBuffer, "Problem creating heap snapshot: not supported on this platform\n");
+    }
+    return false;
+#endif // TARGET_UNIX
+}
@@ -0,0 +1,22 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// heapsnapshot.h
+//
+
+#ifndef __HEAPSNAPSHOT_H__
+#define __HEAPSNAPSHOT_H__
+
+// Serializes a snapshot of the committed GC heap ranges to the given file
+// while the process keeps running. The runtime is suspended only long enough
+// to collect the range table and fork a writer process that inherits a
+// copy-on-write view of the heap; the file write proceeds in the writer.
+// Only supported on Unix hosts. The flags argument is reserved and must be 0.
+bool GenerateHeapSnapshot(
+    LPCWSTR snapshotName,
+    uint32_t flags,
+    char* errorMessageBuffer,
+    int32_t cbErrorMessageBuffer);
+
+#endif // __HEAPSNAPSHOT_H__
@@ -278,13 +278,33 @@ namespace
     private:
         friend struct InteropLibImports::RuntimeCallContext;
         SHash<Traits> _hashMap;
+
+        // Lock-free lookup map layered over _hashMap for the hot path. Keyed by the
+        // external object's identity; stored values are the context instances. The
+        // map is initialized in async mode so lookups require no lock, while all
+        // mutations occur either under _lock or during runtime suspension - the
+        // same rules _hashMap mutations already follow.
+        PtrHashMap _fastCache;
         Crst _lock;
         ExtObjCxtRefCache* _refCache;
 
+        static BOOL CompareCacheEntry(UPTR probe, UPTR stored)
+        {
+            WRAPPER_NO_CONTRACT;
+
+            // The probe value is supplied by the lookup caller, see PtrHashMap for the shift details.
+            const ExternalObjectContext::Key* key = (const ExternalObjectContext::Key*)(probe << 1);
+            ExternalObjectContext* cxt = (ExternalObjectContext*)stored;
+            return *key == cxt->GetKey();
+        }
+
         ExtObjCxtCache()
             : _lock(CrstExternalObjectContextCache, CRST_UNSAFE_COOPGC)
             , _refCache(GetAppDomain()->GetRCWRefCache())
-        { }
+        {
+            LockOwner lock = {&_lock, IsOwnerOfCrst};
+            _fastCache.Init(CompareCacheEntry, TRUE /* fAsyncMode */, &lock);
+        }
         ~ExtObjCxtCache() = default;
 
     public:
@@ -448,6 +468,28 @@ namespace
             RETURN _hashMap.Lookup(key);
         }
 
+        ExternalObjectContext* FindLockFree(_In_ IUnknown* identity, _In_ const ExternalObjectContext::Key& key)
+        {
+            CONTRACT(ExternalObjectContext*)
+            {
+                NOTHROW;
+                GC_NOTRIGGER;
+                MODE_COOPERATIVE;
+                PRECONDITION(identity != NULL);
+                POSTCONDITION(CheckPointer(RETVAL, NULL_OK));
+            }
+            CONTRACT_END;
+
+            // Since this thread is in cooperative mode and all removals occur either
+            // under the lock or while the runtime is suspended, an instance found
+            // here cannot be reclaimed while the caller is using it.
+            LPVOID val = _fastCache.LookupValue((UPTR)identity, (LPVOID)&key);
+            if (val == (LPVOID)INVALIDENTRY)
+                RETURN NULL;
+
+            RETURN reinterpret_cast<ExternalObjectContext*>(val);
+        }
+
         ExternalObjectContext* Add(_In_ ExternalObjectContext* cxt)
         {
             CONTRACT(ExternalObjectContext*)
@@ -464,6 +506,7 @@ namespace
             CONTRACT_END;
 
             _hashMap.Add(cxt);
+            _fastCache.InsertValue((UPTR)cxt->Identity, cxt);
             RETURN cxt;
         }
 
@@ -510,6 +553,9 @@ namespace
             CONTRACTL_END;
 
             _hashMap.Remove(cxt->GetKey());
+
+            ExternalObjectContext::Key key = cxt->GetKey();
+            _fastCache.DeleteValue((UPTR)cxt->Identity, (LPVOID)&key);
         }
 
         void DetachNotPromotedEOCs()
@@ -822,9 +868,15 @@ namespace
         bool uniqueInstance = !!(flags & CreateObjectFlags::CreateObjectFlags_UniqueInstance);
         if (!uniqueInstance)
         {
-            bool objectFound = false;
+            // Query the external object cache without taking the lock first. This is
+            // the common case once a wrapper for the identity has been created.
+            extObjCxt = cache->FindLockFree(identity, cacheKey);
+
+            bool objectFound = extObjCxt != NULL;
+            if (extObjCxt == NULL || extObjCxt->IsSet(ExternalObjectContext::Flags_Detached))
             {
-                // Query the external object cache
+                // Fall back to querying under the lock on a miss, since a racing
+                // insert may be in flight, or to clean up a detached entry.
                 ExtObjCxtCache::LockHolder lock(cache);
                 extObjCxt = cache->Find(cacheKey);
 
@@ -1833,14 +1833,16 @@ HCIMPL1(void*, JIT_GetSharedNonGCThreadStaticBaseOptimized, UINT32 staticBlockIn
 
     if (t_threadStaticBlocksSize <= staticBlockIndex)
     {
+        // Grow the index table geometrically, copying the existing entries forward.
+        // Indices handed out to jitted code stay valid across every growth.
         UINT32 newThreadStaticBlocksSize = max(2 * t_threadStaticBlocksSize, staticBlockIndex + 1);
-        void** newThreadStaticBlocks = (void**) new PTR_BYTE[newThreadStaticBlocksSize * sizeof(PTR_BYTE)];
-        memset(newThreadStaticBlocks + t_threadStaticBlocksSize, 0, (newThreadStaticBlocksSize - t_threadStaticBlocksSize) * sizeof(PTR_BYTE));
+        void** newThreadStaticBlocks = new void*[newThreadStaticBlocksSize];
+        memset(newThreadStaticBlocks + t_threadStaticBlocksSize, 0, (newThreadStaticBlocksSize - t_threadStaticBlocksSize) * sizeof(void*));
 
         if (t_threadStaticBlocksSize > 0)
         {
-            memcpy(newThreadStaticBlocks, t_threadStaticBlocks, t_threadStaticBlocksSize * sizeof(PTR_BYTE));
-            delete t_threadStaticBlocks;
+            memcpy(newThreadStaticBlocks, t_threadStaticBlocks, t_threadStaticBlocksSize * sizeof(void*));
+            delete[] t_threadStaticBlocks;
         }
 
         t_threadStaticBlocksSize = newThreadStaticBlocksSize;
@@ -5095,13 +5097,34 @@ void JIT_Patchpoint(int* counter, int ilOffset)
         const int hitCount = InterlockedIncrement(&ppInfo->m_patchpointCount);
         const int hitLogLevel = (hitCount == 1) ? LL_INFO10 : LL_INFO1000;
 
+        // Remember when this patchpoint first called back, so that we can bound
+        // (and later report) the time the loop spends in unoptimized code.
+        if (ppInfo->m_firstHitTime == 0)
+        {
+            InterlockedCompareExchange64(&ppInfo->m_firstHitTime, (LONGLONG)::GetTickCount64(), 0);
+        }
+
         LOG((LF_TIEREDCOMPILATION, hitLogLevel, "Jit_Patchpoint: patchpoint [%d] (0x%p) hit %d in Method=0x%pM (%s::%s) [il offset %d] (limit %d)\n",
             ppId, ip, hitCount, pMD, pMD->m_pszDebugClassName, pMD->m_pszDebugMethodName, ilOffset, hitLimit));
 
-        // Defer, if we haven't yet reached the limit
+        // Defer, if we haven't yet reached the limit...
         if (hitCount < hitLimit)
         {
-            goto DONE;
+            // ...unless this loop has already dwelt in Tier0 code longer than the
+            // configured budget. The counter-based limit escalates loops whose
+            // trip count is high; the dwell budget catches loops that drain their
+            // counter slowly (few helper callbacks per unit time) and would
+            // otherwise run unoptimized for a long time.
+            const DWORD dwellBudgetMs = g_pConfig->OSR_MaxTier0DwellMs();
+            const ULONGLONG dwellMs = ::GetTickCount64() - (ULONGLONG)ppInfo->m_firstHitTime;
+
+            if ((dwellBudgetMs == 0) || (dwellMs < dwellBudgetMs))
+            {
+                goto DONE;
+            }
+
+            LOG((LF_TIEREDCOMPILATION, LL_INFO10, "Jit_Patchpoint: patchpoint [%d] (0x%p) dwell budget exceeded (%llu ms) at count %d\n",
+                ppId, ip, dwellMs, hitCount));
         }
 
         // Third, make sure no other thread is trying to create the OSR method.
@@ -5160,6 +5183,20 @@ void JIT_Patchpoint(int* counter, int ilOffset)
     // If we get here, we have code to transition to...
     _ASSERTE(osrMethodCode != NULL);
 
+    // Report the transition and how long this loop ran unoptimized, so that
+    // Tier0 dwell time can be quantified from a trace.
+    if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
+    {
+        ULONGLONG dwellMs = 0;
+        if (ppInfo->m_firstHitTime != 0)
+        {
+            dwellMs = ::GetTickCount64() - (ULONGLONG)ppInfo->m_firstHitTime;
+        }
+
+        ETW::CompilationLog::TieredCompilation::Runtime::SendOnStackReplacement(
+            (UINT64)(TADDR)pMD, (UINT32)ilOffset, (UINT32)ppInfo->m_patchpointCount, dwellMs);
+    }
+
     {
         Thread *pThread = GetThread();
 
@@ -5874,6 +5911,51 @@ HCIMPL1(void, JIT_CountProfile64, volatile LONG64* pCounter)
 }
 HCIMPLEND
 
+// Records the raw result of an idempotent helper call. Unlike the class
+// and method profile helpers above, the recorded values are opaque to the
+// runtime; the JIT decides how to interpret them.
+//
+HCIMPL2(void, JIT_ValueProfile32, intptr_t val, ICorJitInfo::ValueHistogram32* valueProfile)
+{
+    FCALL_CONTRACT;
+    FC_GC_POLL_NOT_NEEDED();
+
+    size_t sampleIndex;
+    if (!CheckSample(&valueProfile->Count, &sampleIndex))
+    {
+        return;
+    }
+
+#ifdef _DEBUG
+    PgoManager::VerifyAddress(valueProfile);
+    PgoManager::VerifyAddress(valueProfile + 1);
+#endif
+
+    valueProfile->ValueTable[sampleIndex] = (uint64_t)val;
+}
+HCIMPLEND
+
+// Version of helper above used when the count is 64-bit
+HCIMPL2(void, JIT_ValueProfile64, intptr_t val, ICorJitInfo::ValueHistogram64* valueProfile)
+{
+    FCALL_CONTRACT;
+    FC_GC_POLL_NOT_NEEDED();
+
+    size_t sampleIndex;
+    if (!CheckSample(&valueProfile->Count, &sampleIndex))
+    {
+        return;
+    }
+
+#ifdef _DEBUG
+    PgoManager::VerifyAddress(valueProfile);
+    PgoManager::VerifyAddress(valueProfile + 1);
+#endif
+
+    valueProfile->ValueTable[sampleIndex] = (uint64_t)val;
+}
+HCIMPLEND
+
 //========================================================================
 //
 //      INTEROP HELPERS
@@ -59,10 +59,27 @@ void JitHost::freeStringConfigValue(const WCHAR* value)
 // - On finalizer thread, release the extra memory that was not used recently.
 //
 
+thread_local JitHost::Slab* JitHost::t_pCachedSlab;
+
 void* JitHost::allocateSlab(size_t size, size_t* pActualSize)
 {
     size = max(size, sizeof(Slab));
 
+    InterlockedIncrement(&m_cSlabsRequested);
+
+    // First try the slab parked on this thread by the previous compilation.
+    // This path takes no lock and keeps warmed pages on the threads that are
+    // jitting back-to-back, such as the tiering background worker.
+    Slab* pThreadSlab = t_pCachedSlab;
+    if (pThreadSlab != NULL && pThreadSlab->size >= size && pThreadSlab->size <= 4 * size)
+    {
+        t_pCachedSlab = NULL;
+        *pActualSize = pThreadSlab->size;
+
+        InterlockedIncrement(&m_cSlabsReused);
+        return pThreadSlab;
+    }
+
     Thread* pCurrentThread = GetThreadNULLOk();
     if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL)
     {
@@ -102,6 +119,7 @@ void* JitHost::allocateSlab(size_t size, size_t* pActualSize)
             m_totalCached -= p->size;
             *pActualSize = p->size;
 
+            InterlockedIncrement(&m_cSlabsReused);
             return p;
         }
     }
@@ -116,6 +134,19 @@ void JitHost::freeSlab(void* slab, size_t actualSize)
 
     if (actualSize < 0x100000) // Do not cache blocks that are more than 1MB
     {
+        // Park the slab on this thread if its slot is empty; the next
+        // compilation here will likely want a similar amount of memory.
+        if (t_pCachedSlab == NULL)
+        {
+            Slab* pSlab = (Slab*)slab;
+            pSlab->pNext = NULL;
+            pSlab->size = actualSize;
+            pSlab->affinity = GetThreadNULLOk();
+
+            t_pCachedSlab = pSlab;
+            return;
+        }
+
         CrstHolder lock(&m_jitSlabAllocatorCrst);
 
         if (m_totalCached < g_pConfig->JitHostMaxSlabCache()) // Do not cache more than maximum allowed value
@@ -134,6 +165,21 @@ void JitHost::freeSlab(void* slab, size_t actualSize)
     delete [] (BYTE*)slab;
 }
 
+// Called during thread detach. A slab parked on a dying thread would otherwise
+// become unreachable. Free it directly; thread detach must not take locks or
+// allocate, so the slab cannot be handed back to the shared lists here.
+void JitHost::FlushThreadLocalCache()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    Slab* pSlab = t_pCachedSlab;
+    if (pSlab != NULL)
+    {
+        t_pCachedSlab = NULL;
+        delete [] (BYTE*)pSlab;
+    }
+}
+
 void JitHost::init()
 {
     m_jitSlabAllocatorCrst.Init(CrstLeafLock);
@@ -155,6 +201,10 @@ void JitHost::reclaim()
             return;
         m_lastFlush = ticks;
 
+        // Report how well the slab cache is doing. Reuse rate is reused/requested.
+        STRESS_LOG2(LF_JIT, LL_INFO1000, "JitHost slab cache: %d slabs requested, %d reused\n",
+            m_cSlabsRequested, m_cSlabsReused);
+
         // Flush all slabs in m_pPreviousCachedList
         for (;;)
         {
@@ -17,12 +17,22 @@ private:
         Thread* affinity;
     };
 
+    // The most recently freed slab is parked on the freeing thread and handed
+    // back without taking the lock; see allocateSlab. At most one slab per
+    // thread lives here, outside the shared lists and the cache budget.
+    static thread_local Slab* t_pCachedSlab;
+
     CrstStatic m_jitSlabAllocatorCrst;
     Slab* m_pCurrentCachedList;
     Slab* m_pPreviousCachedList;
     size_t m_totalCached;
     DWORD m_lastFlush;
 
+    // Slab cache effectiveness counters, updated with interlocked operations
+    // and reported periodically from reclaim().
+    LONG m_cSlabsRequested;
+    LONG m_cSlabsReused;
+
     JitHost() {}
     JitHost(const JitHost& other) = delete;
     JitHost& operator=(const JitHost& other) = delete;
@@ -41,6 +51,7 @@ public:
 
     static void Init() { s_theJitHost.init(); }
     static void Reclaim() { s_theJitHost.reclaim(); }
+    static void FlushThreadLocalCache();
 
     static ICorJitHost* getJitHost() { return &s_theJitHost; }
 };
@@ -5744,6 +5744,7 @@ bool __stdcall TrackAllocationsEnabled()
 #endif // PROFILING_SUPPORTED
 #ifdef FEATURE_EVENT_TRACE
         || ETW::TypeSystemLog::IsHeapAllocEventEnabled()
+        || ETW::TypeSystemLog::IsAllocationSamplingEnabled()
 #endif // FEATURE_EVENT_TRACE
         );
 }
@@ -12218,6 +12219,15 @@ void CEEJitInfo::allocMem (AllocMemArgs *pArgs)
 
     JIT_TO_EE_TRANSITION();
 
+    // Hot/cold splitting of jitted code is not supported: the JIT never sees
+    // CORJIT_FLAG_PROCSPLIT at runtime, so it should not ask for a cold
+    // section here. Supporting one would need much more than an allocation:
+    // a disjoint cold range must be findable by JitCodeToMethodInfo (its own
+    // RangeSection and a cold-to-hot mapping like the one prejitted code
+    // carries), covered by chained unwind info registered per fragment, and
+    // understood by the GC info decoder, the debugger, and the EH clause
+    // lookup, all of which today assume one contiguous region per method.
+    // Until then, ignore any cold code request.
     _ASSERTE(pArgs->coldCodeSize == 0);
     if (pArgs->coldCodeBlock)
     {
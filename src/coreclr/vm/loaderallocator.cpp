@@ -30,6 +30,8 @@ LoaderAllocator::LoaderAllocator(bool collectible) :
     m_pStubHeap = NULL;
     m_pPrecodeHeap = NULL;
     m_pExecutableHeap = NULL;
+    m_pFixupPrecodeStubCache = NULL;
+    m_pNewStubPrecodeStubCache = NULL;
 #ifdef FEATURE_READYTORUN
     m_pDynamicHelpersHeap = NULL;
 #endif
@@ -1210,6 +1212,14 @@ void LoaderAllocator::Init(BaseDomain *pDomain, BYTE *pExecutableHeapMemory)
                                                                        FixupPrecode::GenerateCodePage,
                                                                        FixupPrecode::CodeSize);
 
+    // Slab caches that let Precode::Allocate claim precodes from the interleaved
+    // heaps above without taking the heap lock on every allocation.
+    m_pNewStubPrecodeStubCache = new (&m_NewStubPrecodeStubCacheInstance) InterleavedStubCache();
+    m_pNewStubPrecodeStubCache->Init(m_pNewStubPrecodeHeap, StubPrecode::CodeSize);
+
+    m_pFixupPrecodeStubCache = new (&m_FixupPrecodeStubCacheInstance) InterleavedStubCache();
+    m_pFixupPrecodeStubCache->Init(m_pFixupPrecodeHeap, FixupPrecode::CodeSize);
+
     // Initialize the EE marshaling data to NULL.
     m_pMarshalingData = NULL;
 
@@ -1392,6 +1402,18 @@ void LoaderAllocator::Terminate()
         m_pPrecodeHeap = NULL;
     }
 
+    if (m_pFixupPrecodeStubCache != NULL)
+    {
+        m_pFixupPrecodeStubCache->~InterleavedStubCache();
+        m_pFixupPrecodeStubCache = NULL;
+    }
+
+    if (m_pNewStubPrecodeStubCache != NULL)
+    {
+        m_pNewStubPrecodeStubCache->~InterleavedStubCache();
+        m_pNewStubPrecodeStubCache = NULL;
+    }
+
     if (m_pFixupPrecodeHeap != NULL)
     {
         m_pFixupPrecodeHeap->~LoaderHeap();
@@ -306,6 +306,8 @@ protected:
     BYTE                m_PrecodeHeapInstance[sizeof(CodeFragmentHeap)];
     BYTE                m_FixupPrecodeHeapInstance[sizeof(LoaderHeap)];
     BYTE                m_NewStubPrecodeHeapInstance[sizeof(LoaderHeap)];
+    BYTE                m_FixupPrecodeStubCacheInstance[sizeof(InterleavedStubCache)];
+    BYTE                m_NewStubPrecodeStubCacheInstance[sizeof(InterleavedStubCache)];
     PTR_LoaderHeap      m_pLowFrequencyHeap;
     PTR_LoaderHeap      m_pHighFrequencyHeap;
     PTR_LoaderHeap      m_pStubHeap; // stubs for PInvoke, remoting, etc
@@ -316,6 +318,8 @@ protected:
 #endif
     PTR_LoaderHeap      m_pFixupPrecodeHeap;
     PTR_LoaderHeap      m_pNewStubPrecodeHeap;
+    PTR_InterleavedStubCache m_pFixupPrecodeStubCache;
+    PTR_InterleavedStubCache m_pNewStubPrecodeStubCache;
     //****************************************************************************************
     OBJECTHANDLE        m_hLoaderAllocatorObjectHandle;
     FuncPtrStubs *      m_pFuncPtrStubs; // for GetMultiCallableAddrOfCode()
@@ -614,6 +618,18 @@ public:
         return m_pFixupPrecodeHeap;
     }
 
+    PTR_InterleavedStubCache GetNewStubPrecodeStubCache()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_pNewStubPrecodeStubCache;
+    }
+
+    PTR_InterleavedStubCache GetFixupPrecodeStubCache()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_pFixupPrecodeStubCache;
+    }
+
     PTR_CodeFragmentHeap GetDynamicHelpersHeap();
 
     FuncPtrStubs * GetFuncPtrStubs();
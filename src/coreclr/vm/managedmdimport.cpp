@@ -218,6 +218,90 @@ MDImpl3(void, MetaDataImport::Enum, mdToken type, mdToken tkParent, MetadataEnum
 }
 FCIMPLEND
 
+//
+// Bulk props enumerators. Like Enum, these fill a MetadataEnumResult in a
+// single transition, but each element is a fixed-size record carrying the props
+// along with the token, so enumerating the members of a type does not have to
+// come back across the boundary once per row for the props.
+//
+
+MDImpl2(void, MetaDataImport::EnumParamDefProps, mdMethodDef tkMethodDef, MetadataEnumResult * pResult)
+{
+    CONTRACTL {
+        FCALL_CHECK;
+        PRECONDITION(pResult != NULL);
+    }
+    CONTRACTL_END;
+
+    HELPER_METHOD_FRAME_BEGIN_0();
+    {
+        IMDInternalImport *_pScope = pScope;
+
+        HENUMInternalHolder hEnum(pScope);
+        hEnum.EnumInit(mdtParamDef, tkMethodDef);
+
+        ULONG count = hEnum.EnumGetCount();
+
+        static_assert_no_msg(sizeof(ParamDefPropsRecord) == 3 * sizeof(int));
+
+        ParamDefPropsRecord* arRecord = (ParamDefPropsRecord*)EnsureResultSize(pResult, 3 * count);
+        for (COUNT_T i = 0; i < count; i++)
+        {
+            mdParamDef pd;
+            if (!_pScope->EnumNext(&hEnum, &pd))
+                break;
+
+            USHORT usSequence;
+            DWORD dwAttr;
+            LPCSTR szName;
+            IfFailThrow(_pScope->GetParamDefProps(pd, &usSequence, &dwAttr, &szName));
+
+            arRecord[i].m_paramDef = pd;
+            arRecord[i].m_sequence = (INT32)usSequence;
+            arRecord[i].m_attributes = (INT32)dwAttr;
+        }
+    }
+    HELPER_METHOD_FRAME_END();
+}
+FCIMPLEND
+
+MDImpl2(void, MetaDataImport::EnumFieldDefProps, mdTypeDef tkTypeDef, MetadataEnumResult * pResult)
+{
+    CONTRACTL {
+        FCALL_CHECK;
+        PRECONDITION(pResult != NULL);
+    }
+    CONTRACTL_END;
+
+    HELPER_METHOD_FRAME_BEGIN_0();
+    {
+        IMDInternalImport *_pScope = pScope;
+
+        HENUMInternalHolder hEnum(pScope);
+        hEnum.EnumInit(mdtFieldDef, tkTypeDef);
+
+        ULONG count = hEnum.EnumGetCount();
+
+        static_assert_no_msg(sizeof(FieldDefPropsRecord) == 2 * sizeof(int));
+
+        FieldDefPropsRecord* arRecord = (FieldDefPropsRecord*)EnsureResultSize(pResult, 2 * count);
+        for (COUNT_T i = 0; i < count; i++)
+        {
+            mdFieldDef fd;
+            if (!_pScope->EnumNext(&hEnum, &fd))
+                break;
+
+            DWORD dwAttr;
+            IfFailThrow(_pScope->GetFieldDefProps(fd, &dwAttr));
+
+            arRecord[i].m_fieldDef = fd;
+            arRecord[i].m_attributes = (INT32)dwAttr;
+        }
+    }
+    HELPER_METHOD_FRAME_END();
+}
+FCIMPLEND
+
 #if defined(_MSC_VER) && defined(TARGET_X86)
 #pragma optimize("y", on)		// Small critical routines, don't put in EBP frame
 #endif
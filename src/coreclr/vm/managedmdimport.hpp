@@ -31,6 +31,21 @@ typedef struct
     int smallResult[16];
 } MetadataEnumResult;
 
+// Fixed-size records returned by the bulk props enumerators. They are packed
+// into a MetadataEnumResult, so each record must be a whole number of ints.
+typedef struct
+{
+    mdParamDef m_paramDef;
+    INT32 m_sequence;
+    INT32 m_attributes;
+} ParamDefPropsRecord;
+
+typedef struct
+{
+    mdFieldDef m_fieldDef;
+    INT32 m_attributes;
+} FieldDefPropsRecord;
+
 #define MDDecl0(RET, NAME) static FCDECL1(RET, NAME, IMDInternalImport* pScope)
 #define MDDecl1(RET, NAME, arg0) static FCDECL2(RET, NAME, IMDInternalImport* pScope, arg0)
 #define MDDecl2(RET, NAME, arg0, arg1) static FCDECL3(RET, NAME, IMDInternalImport* pScope, arg0, arg1)
@@ -70,6 +85,8 @@ public:
     //// EnumXXX
     ////
     MDDecl3(void, Enum, mdToken type, mdToken tkParent, MetadataEnumResult * pResult);
+    MDDecl2(void, EnumParamDefProps, mdMethodDef tkMethodDef, MetadataEnumResult * pResult);
+    MDDecl2(void, EnumFieldDefProps, mdTypeDef tkTypeDef, MetadataEnumResult * pResult);
     MDDecl3(void, GetCustomAttributeProps, mdCustomAttribute cv, mdToken* ptkType, ConstArray* ppBlob);
 
     ////
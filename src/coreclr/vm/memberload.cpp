@@ -815,7 +815,10 @@ MethodDesc * MemberLoader::GetMethodDescFromMethodSpec(Module * pModule,
     }
     CONTRACTL_END;
 
-    CQuickBytes qbGenericMethodArgs;
+    // The loaded instantiation is only needed for the duration of this call, so carve
+    // it from the thread's stacking allocator. The holder rolls the arena back to its
+    // checkpoint on exit, so steady-state member resolution does no heap allocation here.
+    ACQUIRE_STACKING_ALLOCATOR(pStackingAllocator);
 
     mdMemberRef GenericMemberRef;
     PCCOR_SIGNATURE pSig;
@@ -849,7 +852,7 @@ MethodDesc * MemberLoader::GetMethodDescFromMethodSpec(Module * pModule,
         COMPlusThrowHR(COR_E_OVERFLOW);
     }
 
-    TypeHandle *genericMethodArgs = reinterpret_cast<TypeHandle *>(qbGenericMethodArgs.AllocThrows(cbAllocSize));
+    TypeHandle *genericMethodArgs = reinterpret_cast<TypeHandle *>(pStackingAllocator->Alloc(S_UINT32(cbAllocSize)));
 
     for (uint32_t i = 0; i < nGenericMethodArgs; i++)
     {
@@ -1345,9 +1348,12 @@ MemberLoader::FindPropertyMethod(MethodTable * pMT, LPCUTF8 pszName, EnumPropert
         "set_%s"
     };
 
-    CQuickBytes qbMethName;
+    // The decorated name is only needed for the lookup below; the stacking
+    // allocator hands the space back when the holder goes out of scope.
+    ACQUIRE_STACKING_ALLOCATOR(pStackingAllocator);
+
     size_t len = strlen(pszName) + strlen(aFormatStrings[Method]) + 1;
-    LPUTF8 strMethName = (LPUTF8) qbMethName.AllocThrows(len);
+    LPUTF8 strMethName = (LPUTF8) pStackingAllocator->Alloc(S_UINT32((UINT32)len));
     sprintf_s(strMethName, len, aFormatStrings[Method], pszName);
 
     return FindMethodByName(pMT, strMethName, flags);
@@ -1374,9 +1380,11 @@ MemberLoader::FindEventMethod(MethodTable * pMT, LPCUTF8 pszName, EnumEventMetho
         "raise_%s"
     };
 
-    CQuickBytes qbMethName;
+    // See FindPropertyMethod for why the stacking allocator is used here.
+    ACQUIRE_STACKING_ALLOCATOR(pStackingAllocator);
+
     size_t len = strlen(pszName) + strlen(aFormatStrings[Method]) + 1;
-    LPUTF8 strMethName = (LPUTF8) qbMethName.AllocThrows(len);
+    LPUTF8 strMethName = (LPUTF8) pStackingAllocator->Alloc(S_UINT32((UINT32)len));
     sprintf_s(strMethName, len, aFormatStrings[Method], pszName);
 
     return FindMethodByName(pMT, strMethName, flags);
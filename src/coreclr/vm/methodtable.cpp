@@ -361,6 +361,27 @@ const BYTE MethodTable::c_OptionalMembersStartOffsets[] = {
 #undef MULTIPURPOSE_SLOT_OFFSET
 
 
+//==========================================================================================
+// Verify the hot-header contract documented next to the MethodTable field declarations:
+// every field read on the allocation, cast-check and virtual-dispatch paths must land
+// within the first cache line, and the fixed fields must not grow past it (growing them
+// would push the first vtable indirection chunk onto a second line for every type).
+// Debug builds carry debug_m_szClassName and intentionally do not make this guarantee.
+
+class CheckMethodTableLayout
+{
+#if defined(HOST_64BIT) && !defined(_DEBUG)
+    static_assert_no_msg(sizeof(MethodTable) <= CACHE_LINE_SIZE);
+    static_assert_no_msg(offsetof(MethodTable, m_dwFlags) == 0);
+    static_assert_no_msg(offsetof(MethodTable, m_BaseSize) < CACHE_LINE_SIZE);
+    static_assert_no_msg(offsetof(MethodTable, m_wNumVirtuals) < CACHE_LINE_SIZE);
+    static_assert_no_msg(offsetof(MethodTable, m_wNumInterfaces) < CACHE_LINE_SIZE);
+    static_assert_no_msg(offsetof(MethodTable, m_pParentMethodTable) < CACHE_LINE_SIZE);
+    static_assert_no_msg(offsetof(MethodTable, m_pPerInstInfo) < CACHE_LINE_SIZE);
+    static_assert_no_msg(offsetof(MethodTable, m_pInterfaceMap) < CACHE_LINE_SIZE);
+#endif // HOST_64BIT && !_DEBUG
+};
+
 //==========================================================================================
 // Optimization intended for MethodTable::GetModule, MethodTable::GetDispatchMap and MethodTable::GetNonVirtualSlotsPtr
 
@@ -939,6 +960,31 @@ void MethodTable::SetInterfaceMap(WORD wNumInterfaces, InterfaceInfo_t* iMap)
     m_pInterfaceMap = iMap;
 }
 
+//==========================================================================================
+void MethodTable::BuildInterfaceBitmap()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(HasInterfaceMap());
+    }
+    CONTRACTL_END;
+
+    TADDR bitmap = 0;
+    InterfaceInfo_t* pMap = GetInterfaceMap();
+    for (DWORD i = 0; i < GetNumInterfaces(); i++)
+    {
+        bitmap |= (TADDR)1 << GetInterfaceBitmapBit(pMap[i].GetMethodTable());
+    }
+
+    // the word right after the interface map entries was reserved by AllocateNewMT
+    *(TADDR*)(pMap + GetNumInterfaces()) = bitmap;
+
+    // do not advertise the filter before it is filled in
+    SetFlag(enum_flag_HasInterfaceBitmap);
+}
+
 //==========================================================================================
 // Called after GetExtraInterfaceInfoSize above to setup a new MethodTable with the additional memory to track
 // extra interface info. If there are a non-zero number of interfaces implemented on this class but
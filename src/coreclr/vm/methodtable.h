@@ -528,6 +528,7 @@ class MethodTable
     friend class EEClass;
     friend class MethodTableBuilder;
     friend class CheckAsmOffsets;
+    friend class CheckMethodTableLayout;
 #if defined(DACCESS_COMPILE)
     friend class NativeImageDumper;
 #endif
@@ -1882,6 +1883,30 @@ public:
         return (m_wNumInterfaces != 0);
     }
 
+    // A one-word bloom filter over the method tables in the interface map, stored
+    // immediately after the map entries so it shares a cache line with the data the
+    // cast check walks anyway. A clear bit proves a non-generic interface is not in
+    // the map without touching the map itself; a set bit means the map must be
+    // searched. The filter says nothing about generic interfaces because their map
+    // entries can be updated in place from an approximate instantiation to the
+    // exact one after the filter is built.
+    inline BOOL HasInterfaceBitmap()
+    {
+        LIMITED_METHOD_DAC_CONTRACT;
+        return GetFlag(enum_flag_HasInterfaceBitmap);
+    }
+
+    // which filter bit represents the given interface
+    static inline DWORD GetInterfaceBitmapBit(MethodTable* pIntfMT);
+
+    inline BOOL InterfaceBitmapMayContain(MethodTable* pIntfMT);
+
+#ifndef DACCESS_COMPILE
+    // Computes the filter from the current interface map entries and publishes it.
+    // Called during type building, after the interface map is filled.
+    void BuildInterfaceBitmap();
+#endif
+
     // Where possible, use this iterator over the interface map instead of accessing the map directly
     // That way we can easily change the implementation of the map
     class InterfaceMapIterator
@@ -3422,7 +3447,7 @@ private:
 
         enum_flag_ICastable                   = 0x00400000, // class implements ICastable interface
 
-        enum_flag_Unused_1                    = 0x00800000,
+        enum_flag_HasInterfaceBitmap          = 0x00800000, // one-word bloom filter over the interface map is stored after the map entries
 
         enum_flag_ContainsPointers            = 0x01000000,
 
@@ -3556,6 +3581,14 @@ private:
 private:
     /*
      * This stuff must be first in the struct and should fit on a cache line - don't move it. Used by the GC.
+     *
+     * The fields below form the hot header of the MethodTable: everything that object
+     * allocation (m_dwFlags, m_BaseSize), cast checks (m_wNumInterfaces, m_pParentMethodTable,
+     * m_pInterfaceMap) and virtual dispatch (the vtable indirections that immediately follow
+     * the fixed fields) touch has to stay within the first cache line in release 64-bit
+     * builds. CheckMethodTableLayout in methodtable.cpp enforces this at compile time.
+     * Cold, loader-only state belongs in EEClass or MethodTableWriteableData instead;
+     * do not add fields here.
      */
     // struct
     // {
@@ -977,6 +977,8 @@ inline DWORD MethodTable::GetInterfaceMapSize()
     LIMITED_METHOD_DAC_CONTRACT;
 
     DWORD cbIMap = GetNumInterfaces() * sizeof(InterfaceInfo_t);
+    // The interface bitmap word lives immediately after the map entries.
+    cbIMap += (HasInterfaceBitmap() ? sizeof(TADDR) : 0);
 #ifdef FEATURE_COMINTEROP
     cbIMap += (HasDynamicInterfaceMap() ? sizeof(DWORD_PTR) : 0);
 #endif
@@ -1369,6 +1371,31 @@ inline void MethodTable::SetIsArray(CorElementType arrayType)
     _ASSERTE(GetInternalCorElementType() == arrayType);
 }
 
+//==========================================================================================
+inline DWORD MethodTable::GetInterfaceBitmapBit(MethodTable* pIntfMT)
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+
+    // fibonacci hash of the pointer; take the top bits, they are the best mixed
+    TADDR addr = dac_cast<TADDR>(pIntfMT);
+#ifdef HOST_64BIT
+    return (DWORD)((addr * 11400714819323198485llu) >> 58);
+#else
+    return (DWORD)((addr * 2654435769ul) >> 27);
+#endif
+}
+
+//==========================================================================================
+inline BOOL MethodTable::InterfaceBitmapMayContain(MethodTable* pIntfMT)
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+    _ASSERTE(HasInterfaceBitmap());
+
+    // the filter word lives right after the interface map entries
+    TADDR bitmap = *dac_cast<PTR_TADDR>(dac_cast<TADDR>(GetInterfaceMap() + GetNumInterfaces()));
+    return (bitmap & ((TADDR)1 << GetInterfaceBitmapBit(pIntfMT))) != 0;
+}
+
 //==========================================================================================
 FORCEINLINE BOOL MethodTable::ImplementsInterfaceInline(MethodTable *pInterface)
 {
@@ -1389,6 +1416,11 @@ FORCEINLINE BOOL MethodTable::ImplementsInterfaceInline(MethodTable *pInterface)
     if (numInterfaces == 0)
         return FALSE;
 
+    // A clear filter bit settles the common negative check with a single test
+    // instead of a walk over the whole map.
+    if (!pInterface->HasInstantiation() && HasInterfaceBitmap() && !InterfaceBitmapMayContain(pInterface))
+        return FALSE;
+
     InterfaceInfo_t *pInfo = GetInterfaceMap();
 
     do
@@ -4980,7 +4980,8 @@ MethodTableBuilder::ValidateMethods()
         // The RVA is only valid/testable if it has not been overwritten
         // for something like edit-and-continue
         // Complete validation of non-zero RVAs is done later inside MethodDesc::GetILHeader.
-        if ((it.RVA() == 0) && (pModule->GetDynamicIL(it.Token(), FALSE) == NULL))
+        if (!bmtProp->fNoSanityChecks &&
+            (it.RVA() == 0) && (pModule->GetDynamicIL(it.Token(), FALSE) == NULL))
         {
             // for IL code that is implemented here must have a valid code RVA
             // this came up due to a linker bug where the ImplFlags/DescrOffset were
@@ -4996,7 +4997,7 @@ MethodTableBuilder::ValidateMethods()
 
         if (IsMdRTSpecialName(it.Attrs()))
         {
-            if (IsMdVirtual(it.Attrs()))
+            if (!bmtProp->fNoSanityChecks && IsMdVirtual(it.Attrs()))
             {   // Virtual specialname methods are illegal
                 BuildMethodTableThrowException(IDS_CLASSLOAD_GENERAL);
             }
@@ -5006,30 +5007,35 @@ MethodTableBuilder::ValidateMethods()
 
             if (IsMdStatic(it.Attrs()))
             {   // The only rtSpecialName static method allowed is the .cctor
-                if (!curSig.ExactlyEqual(cctorSig))
+                if (curSig.ExactlyEqual(cctorSig))
+                {
+                    // Remember it for later
+                    bmtVT->pCCtor = *it;
+                }
+                else if (!bmtProp->fNoSanityChecks)
                 {   // Bad method
                     BuildMethodTableThrowException(IDS_CLASSLOAD_GENERAL);
                 }
-
-                // Remember it for later
-                bmtVT->pCCtor = *it;
             }
             else
             {
-                if(!MethodSignature::NamesEqual(curSig, defaultCtorSig))
-                {   // The only rtSpecialName instance methods allowed are .ctors
-                    BuildMethodTableThrowException(IDS_CLASSLOAD_GENERAL);
-                }
+                if (!bmtProp->fNoSanityChecks)
+                {
+                    if(!MethodSignature::NamesEqual(curSig, defaultCtorSig))
+                    {   // The only rtSpecialName instance methods allowed are .ctors
+                        BuildMethodTableThrowException(IDS_CLASSLOAD_GENERAL);
+                    }
 
-                // .ctor must return void
-                MetaSig methodMetaSig(curSig.GetSignature(),
-                                        static_cast<DWORD>(curSig.GetSignatureLength()),
-                                        curSig.GetModule(),
-                                        NULL);
+                    // .ctor must return void
+                    MetaSig methodMetaSig(curSig.GetSignature(),
+                                            static_cast<DWORD>(curSig.GetSignatureLength()),
+                                            curSig.GetModule(),
+                                            NULL);
 
-                if (methodMetaSig.GetReturnType() != ELEMENT_TYPE_VOID)
-                {   // All constructors must have a void return type
-                    BuildMethodTableThrowException(IDS_CLASSLOAD_GENERAL);
+                    if (methodMetaSig.GetReturnType() != ELEMENT_TYPE_VOID)
+                    {   // All constructors must have a void return type
+                        BuildMethodTableThrowException(IDS_CLASSLOAD_GENERAL);
+                    }
                 }
 
                 // See if this is a default constructor.  If so, remember it for later.
@@ -5041,7 +5047,7 @@ MethodTableBuilder::ValidateMethods()
         }
 
         // Make sure that fcalls have a 0 rva.  This is assumed by the prejit fixup logic
-        if (it.MethodType() == METHOD_TYPE_FCALL && it.RVA() != 0)
+        if (!bmtProp->fNoSanityChecks && it.MethodType() == METHOD_TYPE_FCALL && it.RVA() != 0)
         {
             BuildMethodTableThrowException(BFA_ECALLS_MUST_HAVE_ZERO_RVA, it.Token());
         }
@@ -5053,7 +5059,7 @@ MethodTableBuilder::ValidateMethods()
             {
                 // No need to set code address, pre stub used automatically.
             }
-            else
+            else if (!bmtProp->fNoSanityChecks)
             {
                 if (IsMiNative(it.ImplFlags()))
                 {
@@ -5067,7 +5073,7 @@ MethodTableBuilder::ValidateMethods()
                 }
             }
         }
-        else
+        else if (!bmtProp->fNoSanityChecks)
         {
             if (IsMiNative(it.ImplFlags()) && IsGlobalClass())
             {
@@ -5086,7 +5092,8 @@ MethodTableBuilder::ValidateMethods()
 
         // Vararg methods are not allowed inside generic classes
         // and nor can they be generic methods.
-        if (bmtGenerics->GetNumGenericArgs() > 0 || (it.MethodType() == METHOD_TYPE_INSTANTIATED) )
+        if (!bmtProp->fNoSanityChecks &&
+            (bmtGenerics->GetNumGenericArgs() > 0 || (it.MethodType() == METHOD_TYPE_INSTANTIATED)))
         {
             DWORD cMemberSignature;
             PCCOR_SIGNATURE pMemberSignature = it.GetSig(&cMemberSignature);
@@ -5102,7 +5109,8 @@ MethodTableBuilder::ValidateMethods()
             }
         }
 
-        if (IsMdVirtual(it.Attrs()) && IsMdPublic(it.Attrs()) && it.Name() == NULL)
+        if (!bmtProp->fNoSanityChecks &&
+            IsMdVirtual(it.Attrs()) && IsMdPublic(it.Attrs()) && it.Name() == NULL)
         {
             BuildMethodTableThrowException(IDS_CLASSLOAD_NOMETHOD_NAME);
         }
@@ -10268,6 +10276,19 @@ MethodTable * MethodTableBuilder::AllocateNewMT(
 
     cbTotalSize += S_SIZE_T(dwNumInterfaces) * S_SIZE_T(sizeof(InterfaceInfo_t));
 
+    // Reserve one word right after the interface map entries for the interface
+    // bitmap, filled in by MethodTable::BuildInterfaceBitmap once the map entries
+    // are set. Keeping it adjacent to the map lets the filter share a cache line
+    // with the data the cast check walks on a filter hit. Extensible RCW's store
+    // dynamically added interfaces right after the static entries instead, so
+    // they do not get a bitmap.
+    if (dwNumInterfaces != 0
+#ifdef FEATURE_COMINTEROP
+        && !fHasDynamicInterfaceMap
+#endif
+        )
+        cbTotalSize += S_SIZE_T(sizeof(TADDR));
+
 #ifdef FEATURE_COMINTEROP
     // DynamicInterfaceMap have an extra DWORD added to the end of the normal interface
     // map. This will be used to store the count of dynamically added interfaces
@@ -10785,6 +10806,13 @@ MethodTableBuilder::SetupMethodTable2(
 
             pInterfaces[i].SetMethodTable(pEntry->GetInterfaceType()->GetMethodTable());
         }
+
+#ifdef FEATURE_COMINTEROP
+        if (!fHasDynamicInterfaceMap)
+#endif
+        {
+            pMT->BuildInterfaceBitmap();
+        }
     }
 
     pMT->SetCl(GetCl());
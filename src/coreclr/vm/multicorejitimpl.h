@@ -43,6 +43,9 @@ const int      HEADER_D_COUNTER  = 3;               // Extra 32-bit counters in
 const int      MULTICOREJITLIFE  = 60 * 1000;       // 60 seconds
 const int      MAX_WALKBACK      = 128;
 
+const unsigned MAX_PLAYER_HELPER_THREADS  = 7;      // Upper bound on extra playback compilation threads
+const unsigned PLAYER_METHOD_QUEUE_DEPTH  = 64;     // Method records buffered between the player thread and helpers
+
 enum
 {
     MULTICOREJIT_PROFILE_VERSION   = 102,
@@ -260,12 +263,29 @@ public:
 class PlayerModuleInfo;
 
 // MulticoreJitProfilePlayer manages background thread, playing back profile, storing result into code stoage, and gather statistics information
+//
+// The profile is walked by a single player thread, which alone loads modules and resolves
+// dependencies. Method records whose module is ready are handed through a small ring buffer to
+// helper threads, so compilation is spread over the available cores instead of being serialized
+// behind the profile walk. When the buffer is full, the player thread compiles inline, which
+// gives natural backpressure.
 
 class MulticoreJitProfilePlayer
 {
 friend class MulticoreJitRecorder;
 
 private:
+
+    // A method record parsed from the profile, ready for compilation; the signature points into
+    // m_pFileBuffer, which outlives the helper threads
+    struct PlayerMethodRecord
+    {
+        unsigned       moduleIndex;
+        unsigned       token;            // method token for non-generic methods
+        const BYTE   * signature;        // binary signature for generic methods, NULL otherwise
+        unsigned       signatureLength;
+    };
+
     AssemblyBinder                   * m_pBinder;
     LONG                               m_nMySession;
     unsigned                           m_nStartTime;
@@ -285,6 +305,18 @@ private:
     unsigned                           m_moduleCount;
     PlayerModuleInfo                 * m_pModules;
 
+    CrstExplicitInit                   m_crstQueue;             // protects the ring buffer below
+    bool                               m_fQueueLockCreated;
+    PlayerMethodRecord                 m_queue[PLAYER_METHOD_QUEUE_DEPTH];
+    unsigned                           m_queueHead;
+    unsigned                           m_queueTail;
+    Volatile<bool>                     m_fQueueClosed;
+    CLREvent                           m_queueEvent;            // auto-reset, signaled when work is queued or the queue is closed
+    CLREvent                           m_helpersDoneEvent;      // manual, set by the last helper thread to exit
+    LONG                               m_nRunningHelpers;
+    unsigned                           m_nHelperThreads;        // helper threads successfully started
+    bool                               m_fParallelPlay;
+
     HRESULT HandleModuleRecord(const ModuleRecord * pMod);
     HRESULT HandleModuleInfoRecord(unsigned moduleTo, unsigned level);
     HRESULT HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token);
@@ -294,11 +326,19 @@ private:
     bool CompileMethodDesc(Module * pModule, MethodDesc * pMD);
     HRESULT PlayProfile();
 
+    void StartHelperThreads();
+    void StopHelperThreads();
+    bool TryEnqueueMethodRecord(const PlayerMethodRecord & rec);
+    bool TryDequeueMethodRecord(PlayerMethodRecord & rec);
+    void ExecuteMethodRecord(const PlayerMethodRecord & rec);
+    void HelperThreadProc();
+
     bool ShouldAbort(bool fast) const;
 
     HRESULT JITThreadProc(Thread * pThread);
 
     static DWORD WINAPI StaticJITThreadProc(void *args);
+    static DWORD WINAPI StaticHelperThreadProc(void *args);
 
     void TraceSummary();
 
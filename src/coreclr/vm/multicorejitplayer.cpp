@@ -382,6 +382,14 @@ MulticoreJitProfilePlayer::MulticoreJitProfilePlayer(AssemblyBinder * pBinder, L
     m_pFileBuffer        = NULL;
     m_nFileSize          = 0;
 
+    m_fQueueLockCreated  = false;
+    m_queueHead          = 0;
+    m_queueTail          = 0;
+    m_fQueueClosed       = false;
+    m_nRunningHelpers    = 0;
+    m_nHelperThreads     = 0;
+    m_fParallelPlay      = false;
+
     m_nStartTime         = GetTickCount();
 }
 
@@ -400,6 +408,11 @@ MulticoreJitProfilePlayer::~MulticoreJitProfilePlayer()
     {
         delete [] m_pFileBuffer;
     }
+
+    if (m_fQueueLockCreated)
+    {
+        m_crstQueue.Destroy();
+    }
 }
 
 
@@ -864,12 +877,12 @@ HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned mod
 
         if (mod.IsModuleLoaded() && mod.m_enableJit)
         {
-            Module * pModule = mod.m_pModule;
+            PlayerMethodRecord rec = { moduleIndex, token, NULL, 0 };
 
-            // Similar to Module::FindMethod + Module::FindMethodThrowing,
-            // except it calls GetMethodDescFromMemberDefOrRefOrSpec with strictMetadataChecks=FALSE to allow generic instantiation
-            MethodDesc * pMethod = MemberLoader::GetMethodDescFromMemberDefOrRefOrSpec(pModule, token, NULL, FALSE, FALSE);
-            CompileMethodInfoRecord(pModule, pMethod, false);
+            if (! TryEnqueueMethodRecord(rec))
+            {
+                ExecuteMethodRecord(rec); // No helper available or queue full, compile on this thread
+            }
         }
         else
         {
@@ -909,21 +922,12 @@ HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned module
 
         if (mod.IsModuleLoaded() && mod.m_enableJit)
         {
-            Module * pModule = mod.m_pModule;
+            PlayerMethodRecord rec = { moduleIndex, 0, signature, length };
 
-            SigTypeContext typeContext;   // empty type context
-            ZapSig::Context zapSigContext(pModule, (void *)this, ZapSig::MulticoreJitTokens);
-            MethodDesc * pMethod = NULL;
-            EX_TRY
+            if (! TryEnqueueMethodRecord(rec))
             {
-                pMethod = ZapSig::DecodeMethod(pModule, (PCCOR_SIGNATURE)signature, &typeContext, &zapSigContext);
+                ExecuteMethodRecord(rec); // No helper available or queue full, compile on this thread
             }
-            EX_CATCH
-            {
-            }
-            EX_END_CATCH(SwallowAllExceptions);
-
-            CompileMethodInfoRecord(pModule, pMethod, true);
         }
         else
         {
@@ -983,6 +987,282 @@ void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodD
     m_stats.m_nFilteredMethods++;
 }
 
+
+// Resolve and compile one parsed method record. Runs on the player thread when no helper is
+// available, otherwise on a helper thread. The module table is only appended to by the player
+// thread, and a record is queued only after its module is loaded, so helpers read stable entries.
+// Statistic counters are diagnostic only and may race under parallel playback.
+void MulticoreJitProfilePlayer::ExecuteMethodRecord(const PlayerMethodRecord & rec)
+{
+    STANDARD_VM_CONTRACT;
+
+    Module * pModule = m_pModules[rec.moduleIndex].m_pModule;
+
+    if (rec.signature == NULL)
+    {
+        // Similar to Module::FindMethod + Module::FindMethodThrowing,
+        // except it calls GetMethodDescFromMemberDefOrRefOrSpec with strictMetadataChecks=FALSE to allow generic instantiation
+        MethodDesc * pMethod = MemberLoader::GetMethodDescFromMemberDefOrRefOrSpec(pModule, rec.token, NULL, FALSE, FALSE);
+        CompileMethodInfoRecord(pModule, pMethod, false);
+    }
+    else
+    {
+        SigTypeContext typeContext;   // empty type context
+        ZapSig::Context zapSigContext(pModule, (void *)this, ZapSig::MulticoreJitTokens);
+        MethodDesc * pMethod = NULL;
+        EX_TRY
+        {
+            pMethod = ZapSig::DecodeMethod(pModule, (PCCOR_SIGNATURE)rec.signature, &typeContext, &zapSigContext);
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+
+        CompileMethodInfoRecord(pModule, pMethod, true);
+    }
+}
+
+
+bool MulticoreJitProfilePlayer::TryEnqueueMethodRecord(const PlayerMethodRecord & rec)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (! m_fParallelPlay)
+    {
+        return false;
+    }
+
+    {
+        CrstHolder holder(& m_crstQueue);
+
+        if ((m_queueTail - m_queueHead) >= PLAYER_METHOD_QUEUE_DEPTH)
+        {
+            return false; // Queue full, caller compiles inline for natural backpressure
+        }
+
+        m_queue[m_queueTail % PLAYER_METHOD_QUEUE_DEPTH] = rec;
+        m_queueTail ++;
+    }
+
+    m_queueEvent.Set();
+
+    return true;
+}
+
+
+bool MulticoreJitProfilePlayer::TryDequeueMethodRecord(PlayerMethodRecord & rec)
+{
+    WRAPPER_NO_CONTRACT;
+
+    CrstHolder holder(& m_crstQueue);
+
+    if (m_queueHead == m_queueTail)
+    {
+        return false;
+    }
+
+    rec = m_queue[m_queueHead % PLAYER_METHOD_QUEUE_DEPTH];
+    m_queueHead ++;
+
+    return true;
+}
+
+
+// Start helper threads to compile method records queued by the player thread, one per processor
+// left after the application and the player thread are accounted for. Failure to start helpers
+// is not fatal; playback just proceeds with fewer threads.
+void MulticoreJitProfilePlayer::StartHelperThreads()
+{
+    STANDARD_VM_CONTRACT;
+
+    unsigned helperCount = (unsigned) CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitPlayerHelperThreads);
+
+    if (helperCount == 0)
+    {
+        unsigned processorCount = g_SystemInfo.dwNumberOfProcessors;
+
+        helperCount = (processorCount > 2) ? (processorCount - 2) : 0;
+    }
+
+    if (helperCount > MAX_PLAYER_HELPER_THREADS)
+    {
+        helperCount = MAX_PLAYER_HELPER_THREADS;
+    }
+
+    if (helperCount == 0)
+    {
+        return;
+    }
+
+    EX_TRY
+    {
+        m_crstQueue.Init(CrstMulticoreJitHash);
+        m_fQueueLockCreated = true;
+
+        m_queueEvent.CreateAutoEvent(FALSE);
+        m_helpersDoneEvent.CreateManualEvent(FALSE);
+
+        m_fParallelPlay = true;
+
+        for (unsigned i = 0; i < helperCount; i ++)
+        {
+            Thread * pThread = SetupUnstartedThread();
+
+            if (! pThread->CreateNewThread(0, StaticHelperThreadProc, this))
+            {
+                break;
+            }
+
+            InterlockedIncrement(& m_nRunningHelpers);
+
+            if (pThread->StartThread() > 0)
+            {
+                m_nHelperThreads ++;
+            }
+            else
+            {
+                InterlockedDecrement(& m_nRunningHelpers);
+                break;
+            }
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    if (m_nHelperThreads == 0)
+    {
+        m_fParallelPlay = false;
+    }
+
+    MulticoreJitTrace(("StartHelperThreads: %d helper threads", m_nHelperThreads));
+
+    _FireEtwMulticoreJit(W("HELPERTHREADS"), W(""), m_nHelperThreads, 0, 0);
+}
+
+
+// Close the queue and wait for all helper threads to drain it and exit; they must not outlive
+// this object
+void MulticoreJitProfilePlayer::StopHelperThreads()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (! m_fParallelPlay)
+    {
+        return;
+    }
+
+    {
+        CrstHolder holder(& m_crstQueue);
+
+        m_fQueueClosed = true;
+    }
+
+    m_queueEvent.Set();
+
+    if (m_nRunningHelpers != 0)
+    {
+        GCX_PREEMP();
+
+        m_helpersDoneEvent.Wait(INFINITE, FALSE);
+    }
+}
+
+
+void MulticoreJitProfilePlayer::HelperThreadProc()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+
+    while (true)
+    {
+        PlayerMethodRecord rec;
+
+        if (TryDequeueMethodRecord(rec))
+        {
+            // Scope failures to a single method, as on the player thread
+            EX_TRY
+            {
+                ExecuteMethodRecord(rec);
+            }
+            EX_CATCH
+            {
+            }
+            EX_END_CATCH(SwallowAllExceptions);
+
+            continue;
+        }
+
+        if (m_fQueueClosed || ShouldAbort(true))
+        {
+            // Wake the next helper so that shutdown cascades through the auto-reset event
+            m_queueEvent.Set();
+            break;
+        }
+
+        m_queueEvent.Wait(1000, FALSE); // Re-check the session periodically in case it is aborted
+    }
+}
+
+
+DWORD WINAPI MulticoreJitProfilePlayer::StaticHelperThreadProc(void *args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+        ENTRY_POINT;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    MulticoreJitProfilePlayer * pPlayer = (MulticoreJitProfilePlayer *) args;
+
+    Thread * pThread = GetThread();
+
+    if ((pThread != NULL) && pThread->HasStarted())
+    {
+        // Disable calling managed code in background thread
+        ThreadStateNCStackHolder holder(TRUE, Thread::TSNC_CallingManagedCodeDisabled);
+
+        // Run as background thread, so ThreadStore::WaitForOtherThreads will not wait for it
+        pThread->SetBackground(TRUE);
+
+        pPlayer->HelperThreadProc();
+    }
+
+    // The player thread deletes the player once the last helper signals, so do not touch the
+    // player after this point
+    if (InterlockedDecrement(& pPlayer->m_nRunningHelpers) == 0)
+    {
+        pPlayer->m_helpersDoneEvent.Set();
+    }
+
+    if (pThread != NULL)
+    {
+        DestroyThread(pThread);
+    }
+
+    return 0;
+}
+
+
 void MulticoreJitProfilePlayer::TraceSummary()
 {
     LIMITED_METHOD_CONTRACT;
@@ -1126,6 +1406,8 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
         FireEtwThreadCreated((ULONGLONG) pThread, (ULONGLONG) GetAppDomain(), 1, pThread->GetThreadId(), pThread->GetOSThreadId(), GetClrInstanceId());
     }
 
+    StartHelperThreads();
+
     const BYTE * pBuffer = m_pFileBuffer;
 
     unsigned nSize = m_nFileSize;
@@ -1356,6 +1638,10 @@ HRESULT MulticoreJitProfilePlayer::JITThreadProc(Thread * pThread)
     }
     EX_END_CATCH(SwallowAllExceptions);
 
+    // Helper threads may still be draining the queue, even if playback aborted; wait for them
+    // here since they must not outlive this object
+    StopHelperThreads();
+
     return (DWORD) m_stats.m_hr;
 }
 
@@ -20,10 +20,11 @@
 //
 struct PerPatchpointInfo
 {
-    PerPatchpointInfo() : 
+    PerPatchpointInfo() :
         m_osrMethodCode(0),
         m_patchpointCount(0),
-        m_flags(0)
+        m_flags(0),
+        m_firstHitTime(0)
 #if _DEBUG
         , m_patchpointId(0)
 #endif
@@ -44,6 +45,9 @@ struct PerPatchpointInfo
     LONG m_patchpointCount;
     // Status of this patchpoint
     LONG m_flags;
+    // Tick count of the first helper call, used to bound and report the time
+    // spent running unoptimized code before the OSR transition. 0 if not yet hit.
+    LONGLONG m_firstHitTime;
 
 #if _DEBUG
     int m_patchpointId;
@@ -664,6 +664,17 @@ FlatImageLayout::FlatImageLayout(PEImage* pOwner)
         m_FileView.Assign(view);
         addr = (LPVOID)((size_t)view + offset - mapBegin);
 
+#ifdef HOST_UNIX
+        // If requested, kick off asynchronous readahead of the file contents
+        // now, so the layout conversion and metadata walks that follow do not
+        // take a major fault on every page. This matters most for container
+        // cold starts where the image sits on a slow overlay filesystem.
+        if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PrefetchAssemblyImages) != 0)
+        {
+            PAL_AdvisePrefetch(view, (SIZE_T)mapSize);
+        }
+#endif // HOST_UNIX
+
         if (uncompressedSize > 0)
         {
 #if defined(CORECLR_EMBEDDED)
@@ -807,6 +818,53 @@ void* FlatImageLayout::LoadImageByCopyingParts(SIZE_T* m_imageParts) const
     // when loading by copying we have only one part to free.
     m_imageParts[0] = AllocatedPart(base);
 
+#ifdef HOST_UNIX
+    // If requested, ask the OS to back the executable sections of ReadyToRun
+    // images with huge pages to reduce iTLB misses in large images. The advice
+    // must be given before the copy below populates the pages so they can be
+    // faulted in as huge pages. Only the huge-page-aligned interior of each
+    // section is advised - the per-section protection switch at the end of this
+    // method would split any huge page straddling a section boundary anyway -
+    // and non-executable sections stay on regular pages.
+    if (HasReadyToRunHeader()
+        && g_fAllowNativeImages
+        && CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_HugePagesForR2RCode) != 0)
+    {
+        const SIZE_T hugePageSize = 2 * 1024 * 1024;
+#ifdef LOGGING
+        SIZE_T cbExecutable = 0;
+        SIZE_T cbAdvised = 0;
+#endif // LOGGING
+
+        IMAGE_SECTION_HEADER* pSection = IMAGE_FIRST_SECTION(FindNTHeaders());
+        IMAGE_SECTION_HEADER* pSectionEnd = pSection + VAL16(FindNTHeaders()->FileHeader.NumberOfSections);
+        for (; pSection < pSectionEnd; pSection++)
+        {
+            if ((pSection->Characteristics & IMAGE_SCN_MEM_EXECUTE) == 0)
+                continue;
+
+            SIZE_T start = (SIZE_T)base + VAL32(pSection->VirtualAddress);
+            SIZE_T end = start + VAL32(pSection->Misc.VirtualSize);
+#ifdef LOGGING
+            cbExecutable += end - start;
+#endif // LOGGING
+
+            SIZE_T alignedStart = ALIGN_UP(start, hugePageSize);
+            SIZE_T alignedEnd = ALIGN_DOWN(end, hugePageSize);
+            if ((alignedStart < alignedEnd)
+                && PAL_AdviseHugePages((LPVOID)alignedStart, alignedEnd - alignedStart))
+            {
+#ifdef LOGGING
+                cbAdvised += alignedEnd - alignedStart;
+#endif // LOGGING
+            }
+        }
+
+        LOG((LF_LOADER, LL_INFO100, "PEImage: advised huge pages for %zu of %zu executable bytes in \"%ws\"\n",
+            cbAdvised, cbExecutable, m_pOwner->GetPath().GetUnicode()));
+    }
+#endif // HOST_UNIX
+
     // We're going to copy everything first, and write protect what we need to later.
 
     // First, copy headers
@@ -10,6 +10,7 @@
 #include <clrconfignocache.h>
 #include "perfmap.h"
 #include "perfinfo.h"
+#include "debuginfostore.h"
 #include "pal.h"
 
 
@@ -22,6 +23,7 @@
 Volatile<bool> PerfMap::s_enabled = false;
 PerfMap * PerfMap::s_Current = nullptr;
 bool PerfMap::s_ShowOptimizationTiers = false;
+bool PerfMap::s_EmitJitDumpDebugInfo = false;
 unsigned PerfMap::s_StubsMapped = 0;
 
 enum 
@@ -83,7 +85,8 @@ void PerfMap::Initialize()
         {
             s_ShowOptimizationTiers = true;
         }
-        
+
+        s_EmitJitDumpDebugInfo = true;
         s_enabled = true;
     }
 }
@@ -236,6 +239,100 @@ void PerfMap::LogImage(PEAssembly * pPEAssembly)
 }
 
 
+// Log the method to the jitdump file with debug info mapping its native
+// ranges back to managed code. perf models debug info as file/line pairs, so
+// each range is attributed to a "file" named after the managed method it came
+// from and a "line" carrying the IL offset. When the JIT recorded rich debug
+// info (DOTNET_RichDebugInfo), ranges produced by inlined code are attributed
+// to the inlinee, which lets perf report split inlinee samples out of the
+// root method's flat symbol; otherwise the ordinary IL boundary mappings are
+// emitted against the root method for line-level attribution.
+static void LogMethodToJitDump(MethodDesc* pMethod, PCODE pCode, size_t codeSize, const char* symbol)
+{
+    CONTRACTL{
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+        PRECONDITION(pMethod != nullptr);
+    } CONTRACTL_END;
+
+    auto fpNew = [](void* data, size_t numBytes)
+    {
+        return new (nothrow) BYTE[numBytes];
+    };
+
+    DebugInfoRequest request;
+    request.InitFromStartingAddr(pMethod, pCode);
+
+    ICorDebugInfo::InlineTreeNode* inlineTree = nullptr;
+    ULONG32 numInlineTree = 0;
+    ICorDebugInfo::RichOffsetMapping* richMappings = nullptr;
+    ULONG32 numRichMappings = 0;
+    ICorDebugInfo::OffsetMapping* boundaries = nullptr;
+    ULONG32 numBoundaries = 0;
+
+    NewArrayHolder<SString> names;
+    NewArrayHolder<PerfJitDumpDebugEntry> entries;
+    ULONG64 entryCount = 0;
+
+    if (DebugInfoManager::GetRichDebugInfo(request, fpNew, nullptr, &inlineTree, &numInlineTree, &richMappings, &numRichMappings) &&
+        numInlineTree > 0 && numRichMappings > 0)
+    {
+        // Resolve a name per inline tree node up front; node 0 is the root.
+        names = new SString[numInlineTree];
+        names[0].SetUTF8(symbol);
+        for (ULONG32 i = 1; i < numInlineTree; i++)
+        {
+            MethodDesc* pInlinee = reinterpret_cast<MethodDesc*>(inlineTree[i].Method);
+            if (pInlinee != nullptr)
+            {
+                pInlinee->GetFullMethodInfo(names[i]);
+            }
+        }
+
+        entries = new PerfJitDumpDebugEntry[numRichMappings];
+        for (ULONG32 i = 0; i < numRichMappings; i++)
+        {
+            ULONG32 inlinee = richMappings[i].Inlinee;
+            if (inlinee >= numInlineTree || names[inlinee].IsEmpty())
+            {
+                inlinee = 0;
+            }
+
+            uint32_t ilOffset = richMappings[i].ILOffset;
+
+            entries[entryCount].address = (ULONG64)pCode + richMappings[i].NativeOffset;
+            entries[entryCount].lineNumber = ilOffset < (uint32_t)ICorDebugInfo::MAX_MAPPING_VALUE ? ilOffset : 0;
+            entries[entryCount].name = names[inlinee].GetUTF8();
+            entryCount++;
+        }
+    }
+    else if (DebugInfoManager::GetBoundariesAndVars(request, fpNew, nullptr, &numBoundaries, &boundaries, nullptr, nullptr) &&
+        numBoundaries > 0)
+    {
+        entries = new PerfJitDumpDebugEntry[numBoundaries];
+        for (ULONG32 i = 0; i < numBoundaries; i++)
+        {
+            uint32_t ilOffset = boundaries[i].ilOffset;
+
+            entries[entryCount].address = (ULONG64)pCode + boundaries[i].nativeOffset;
+            entries[entryCount].lineNumber = ilOffset < (uint32_t)ICorDebugInfo::MAX_MAPPING_VALUE ? ilOffset : 0;
+            entries[entryCount].name = symbol;
+            entryCount++;
+        }
+    }
+
+    PerfJitDumpDebugInfo debugInfo;
+    debugInfo.entryCount = entryCount;
+    debugInfo.entries = entries;
+
+    PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, symbol, entryCount != 0 ? &debugInfo : nullptr, nullptr);
+
+    delete[] (BYTE*)inlineTree;
+    delete[] (BYTE*)richMappings;
+    delete[] (BYTE*)boundaries;
+}
+
 // Log a method to the map.
 void PerfMap::LogJITCompiledMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, PrepareCodeConfig *pConfig)
 {
@@ -281,7 +378,14 @@ void PerfMap::LogJITCompiledMethod(MethodDesc * pMethod, PCODE pCode, size_t cod
         {
             s_Current->WriteLine(line);
         }
-        PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetUTF8(), nullptr, nullptr);
+        if (s_EmitJitDumpDebugInfo)
+        {
+            LogMethodToJitDump(pMethod, pCode, codeSize, name.GetUTF8());
+        }
+        else
+        {
+            PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetUTF8(), nullptr, nullptr);
+        }
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 
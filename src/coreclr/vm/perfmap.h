@@ -24,6 +24,10 @@ private:
     // Indicates whether optimization tiers should be shown for methods in perf maps
     static bool s_ShowOptimizationTiers;
 
+    // Indicates whether jitdump records should carry debug info mapping native
+    // ranges back to methods and IL offsets
+    static bool s_EmitJitDumpDebugInfo;
+
     // Set to true if an error is encountered when writing to the file.
     static unsigned s_StubsMapped;
 
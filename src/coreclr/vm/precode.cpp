@@ -246,12 +246,14 @@ Precode* Precode::Allocate(PrecodeType t, MethodDesc* pMD,
 
     if (t == PRECODE_FIXUP)
     {
-        pPrecode = (Precode*)pamTracker->Track(pLoaderAllocator->GetFixupPrecodeHeap()->AllocAlignedMem(size, 1));
+        _ASSERTE(size == pLoaderAllocator->GetFixupPrecodeStubCache()->GetStubSize());
+        pPrecode = (Precode*)pamTracker->Track(pLoaderAllocator->GetFixupPrecodeStubCache()->AllocStub());
         pPrecode->Init(pPrecode, t, pMD, pLoaderAllocator);
     }
     else if (t == PRECODE_STUB || t == PRECODE_NDIRECT_IMPORT)
     {
-        pPrecode = (Precode*)pamTracker->Track(pLoaderAllocator->GetNewStubPrecodeHeap()->AllocAlignedMem(size, 1));
+        _ASSERTE(size == pLoaderAllocator->GetNewStubPrecodeStubCache()->GetStubSize());
+        pPrecode = (Precode*)pamTracker->Track(pLoaderAllocator->GetNewStubPrecodeStubCache()->AllocStub());
         pPrecode->Init(pPrecode, t, pMD, pLoaderAllocator);
     }
     else
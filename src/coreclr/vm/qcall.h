@@ -107,6 +107,28 @@
 //
 //      return retVal;
 // }
+//
+//
+// Streamlined QCalls without a GC transition
+// ------------------------------------------
+//
+// QCalls that are guaranteed to be short-running, non-blocking and non-throwing can avoid the cost of the
+// GC mode switch and the exception handling setup entirely. The managed DllImport declaration is annotated
+// with [SuppressGCTransition], which makes the generated stub flip the thread into unmanaged code without
+// erecting an InlinedCallFrame or leaving cooperative mode. On the unmanaged side such QCalls use
+// QCALL_CONTRACT_NO_GC_TRANSITION instead of QCALL_CONTRACT and must not use BEGIN_QCALL/END_QCALL.
+//
+// Because the thread stays in cooperative mode for the duration of the call, these QCalls must obey the
+// same rules as any other cooperative-mode leaf code:
+//
+//  - They must not trigger a GC, block, or wait on any lock that a GC-holding thread may own. A thread
+//    stuck in such a QCall delays GC suspension for the whole process.
+//  - They must not throw. There is no managed exception dispatcher installed, so any exception would
+//    take down the process.
+//  - They should complete in well under a microsecond in the typical case. Longer-running work belongs
+//    in a regular QCall where the thread is visible to the suspension logic.
+//
+// Only a handful of very hot, trivial entrypoints meet this bar. When in doubt, use a regular QCall.
 
 
 #ifdef TARGET_UNIX
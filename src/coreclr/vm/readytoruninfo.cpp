@@ -717,6 +717,8 @@ ReadyToRunInfo::ReadyToRunInfo(Module * pModule, LoaderAllocator* pLoaderAllocat
     m_pHeader(pHeader),
     m_pNativeImage(pModule != NULL ? pNativeImage: NULL), // m_pNativeImage is only set for composite image components, not the composite R2R info itself
     m_readyToRunCodeDisabled(FALSE),
+    m_pMethodDefOffsets(NULL),
+    m_nMethodDefOffsets(0),
     m_Crst(CrstReadyToRunEntryPointToMethodDescMap),
     m_pPersistentInlineTrackingMap(NULL),
     m_pNextR2RForUnrelatedCode(NULL)
@@ -830,6 +832,28 @@ ReadyToRunInfo::ReadyToRunInfo(Module * pModule, LoaderAllocator* pLoaderAllocat
     if (pEntryPointsDir != NULL)
     {
         m_methodDefEntryPoints = NativeArray(&m_nativeReader, pEntryPointsDir->VirtualAddress);
+
+        // Optionally flatten the sparse native format array into a rid-indexed
+        // table so the hot method-def lookup in GetEntryPoint is a single load
+        // instead of a multi-step decode. Costs 4 bytes per method def, so it
+        // is opt-in for startup-sensitive apps with many R2R methods.
+        if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_ReadyToRun_FlatMethodDefIndex) != 0)
+        {
+            uint nMethodDefs = m_methodDefEntryPoints.GetCount();
+            if (nMethodDefs != 0)
+            {
+                DWORD* pMethodDefOffsets = (DWORD*)(void*)pamTracker->Track(
+                    pLoaderAllocator->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(nMethodDefs) * S_SIZE_T(sizeof(DWORD))));
+                for (uint i = 0; i < nMethodDefs; i++)
+                {
+                    uint offset;
+                    // Entries are biased by one so that zero means "no entry point".
+                    pMethodDefOffsets[i] = m_methodDefEntryPoints.TryGetAt(i, &offset) ? (DWORD)(offset + 1) : 0;
+                }
+                m_nMethodDefOffsets = nMethodDefs;
+                m_pMethodDefOffsets = pMethodDefOffsets;
+            }
+        }
     }
 
     m_pSectionDelayLoadMethodCallThunks = m_pComposite->FindSection(ReadyToRunSectionType::DelayLoadMethodCallThunks);
@@ -1133,6 +1157,17 @@ PCODE ReadyToRunInfo::GetEntryPoint(MethodDesc * pMD, PrepareCodeConfig* pConfig
         if (offset == (uint)-1)
             goto done;
     }
+    else if (m_pMethodDefOffsets != NULL)
+    {
+        if ((DWORD)(rid - 1) >= m_nMethodDefOffsets)
+            goto done;
+
+        DWORD encodedOffset = m_pMethodDefOffsets[rid - 1];
+        if (encodedOffset == 0)
+            goto done;
+
+        offset = encodedOffset - 1;
+    }
     else
     {
         if (!m_methodDefEntryPoints.TryGetAt(rid - 1, &offset))
@@ -80,6 +80,13 @@ class ReadyToRunInfo
 
     NativeFormat::NativeReader      m_nativeReader;
     NativeFormat::NativeArray       m_methodDefEntryPoints;
+
+    // Optional rid-indexed flattening of m_methodDefEntryPoints so the hot
+    // method-def entry point lookup is a single load instead of a walk of the
+    // native format encoding. Entries are biased by one; zero means the method
+    // has no precompiled code. See the constructor.
+    PTR_DWORD                       m_pMethodDefOffsets;
+    DWORD                           m_nMethodDefOffsets;
     NativeFormat::NativeHashtable   m_instMethodEntryPoints;
     NativeFormat::NativeHashtable   m_availableTypesHashtable;
     NativeFormat::NativeHashtable   m_pgoInstrumentationDataHashtable;
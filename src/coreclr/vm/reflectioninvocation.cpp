@@ -469,6 +469,15 @@ public:
     }
 };
 
+// Invokes a method through reflection. The signature-dependent work that can be
+// computed once per method is already cached: the arg iterator flags and stack
+// size live on the Signature object (see ArgIteratorForMethodInvoke) and the
+// argument types are pre-resolved in the Signature's type array, so per-call
+// work here is limited to building the transition block and coercing the byref
+// arguments. Specializing repeated invocations further (e.g. emitting a
+// per-signature invoker thunk) is a job for the managed reflection layer,
+// which can count invocations and emit IL; this entry point has no view of
+// call frequency.
 FCIMPL4(Object*, RuntimeMethodHandle::InvokeMethod,
     Object *target,
     PVOID* args, // An array of byrefs
@@ -564,6 +564,13 @@ HRESULT ReJitManager::UpdateActiveILVersions(
     //contains them was unloaded.
     SHash<CodeActivationBatchTraits> mgrToCodeActivationBatch;
     CDynArray<CodeVersionManager::CodePublishError> errorRecords;
+
+    // Modules with an R2R inline tracking map, collected lazily and at most once per
+    // request. Attach-time requests can cover tens of thousands of methods and
+    // iterating the assembly list once per method dominated the cost of large batches.
+    CDynArray<Module*> nativeImageModules;
+    bool fCollectedNativeImageModules = false;
+
     for (ULONG i = 0; i < cFunctions; i++)
     {
         Module * pModule = reinterpret_cast< Module * >(rgModuleIDs[i]);
@@ -619,7 +626,32 @@ HRESULT ReJitManager::UpdateActiveILVersions(
 
         if ((flags & COR_PRF_REJIT_BLOCK_INLINING) == COR_PRF_REJIT_BLOCK_INLINING)
         {
-            hr = UpdateNativeInlinerActiveILVersions(&mgrToCodeActivationBatch, pModule, rgMethodDefs[i], fIsRevert, flags);
+            if (!fCollectedNativeImageModules)
+            {
+                fCollectedNativeImageModules = true;
+
+                // TODO: is the default domain enough for coreclr?
+                AppDomain::AssemblyIterator domainAssemblyIterator = SystemDomain::System()->DefaultDomain()->IterateAssembliesEx((AssemblyIterationFlags) (kIncludeLoaded | kIncludeExecution));
+                CollectibleAssemblyHolder<DomainAssembly *> pDomainAssembly;
+                while (domainAssemblyIterator.Next(pDomainAssembly.This()))
+                {
+                    _ASSERTE(pDomainAssembly != NULL);
+                    _ASSERTE(pDomainAssembly->GetAssembly() != NULL);
+
+                    Module * pNativeImageModule = pDomainAssembly->GetModule();
+                    if (pNativeImageModule->HasReadyToRunInlineTrackingMap())
+                    {
+                        Module ** ppModule = nativeImageModules.Append();
+                        if (ppModule == NULL)
+                        {
+                            return E_OUTOFMEMORY;
+                        }
+                        *ppModule = pNativeImageModule;
+                    }
+                }
+            }
+
+            hr = UpdateNativeInlinerActiveILVersions(&mgrToCodeActivationBatch, pModule, rgMethodDefs[i], fIsRevert, flags, &nativeImageModules);
             if (FAILED(hr))
             {
                 return hr;
@@ -783,7 +815,8 @@ HRESULT ReJitManager::UpdateNativeInlinerActiveILVersions(
     Module                             *pInlineeModule,
     mdMethodDef                         inlineeMethodDef,
     BOOL                                fIsRevert,
-    COR_PRF_REJIT_FLAGS                 flags)
+    COR_PRF_REJIT_FLAGS                 flags,
+    CDynArray<Module*>                 *pNativeImageModules)
 {
     CONTRACTL
     {
@@ -797,45 +830,40 @@ HRESULT ReJitManager::UpdateNativeInlinerActiveILVersions(
     _ASSERTE(pMgrToCodeActivationBatch != NULL);
     _ASSERTE(pInlineeModule != NULL);
     _ASSERTE(RidFromToken(inlineeMethodDef) != 0);
+    _ASSERTE(pNativeImageModules != NULL);
 
     HRESULT hr = S_OK;
 
-    // Iterate through all modules, for any that are NGEN or R2R need to check if there are inliners there and call
-    // RequestReJIT on them
-    // TODO: is the default domain enough for coreclr?
-    AppDomain::AssemblyIterator domainAssemblyIterator = SystemDomain::System()->DefaultDomain()->IterateAssembliesEx((AssemblyIterationFlags) (kIncludeLoaded | kIncludeExecution));
-    CollectibleAssemblyHolder<DomainAssembly *> pDomainAssembly;
+    // Check all NGEN or R2R modules with inline tracking info for inliners of this
+    // method and call RequestReJIT on them. The caller collected the module list once
+    // for the whole request.
     NativeImageInliningIterator inlinerIter;
-    while (domainAssemblyIterator.Next(pDomainAssembly.This()))
+    for (int modIndex = 0; modIndex < pNativeImageModules->Count(); modIndex++)
     {
-        _ASSERTE(pDomainAssembly != NULL);
-        _ASSERTE(pDomainAssembly->GetAssembly() != NULL);
+        Module * pModule = (*pNativeImageModules)[modIndex];
+        _ASSERTE(pModule->HasReadyToRunInlineTrackingMap());
 
-        Module * pModule = pDomainAssembly->GetModule();
-        if (pModule->HasReadyToRunInlineTrackingMap())
-        {
-            inlinerIter.Reset(pModule, MethodInModule(pInlineeModule, inlineeMethodDef));
+        inlinerIter.Reset(pModule, MethodInModule(pInlineeModule, inlineeMethodDef));
 
-            while (inlinerIter.Next())
+        while (inlinerIter.Next())
+        {
+            MethodInModule inliner = inlinerIter.GetMethod();
             {
-                MethodInModule inliner = inlinerIter.GetMethod();
+                CodeVersionManager *pCodeVersionManager = pModule->GetCodeVersionManager();
+                CodeVersionManager::LockHolder codeVersioningLockHolder;
+                ILCodeVersion ilVersion = pCodeVersionManager->GetActiveILCodeVersion(inliner.m_module, inliner.m_methodDef);
+                if (!ilVersion.HasDefaultIL())
                 {
-                    CodeVersionManager *pCodeVersionManager = pModule->GetCodeVersionManager();
-                    CodeVersionManager::LockHolder codeVersioningLockHolder;
-                    ILCodeVersion ilVersion = pCodeVersionManager->GetActiveILCodeVersion(inliner.m_module, inliner.m_methodDef);
-                    if (!ilVersion.HasDefaultIL())
-                    {
-                        // This method has already been ReJITted, no need to request another ReJIT at this point.
-                        // The ReJITted method will be in the JIT inliner check below.
-                        continue;
-                    }
+                    // This method has already been ReJITted, no need to request another ReJIT at this point.
+                    // The ReJITted method will be in the JIT inliner check below.
+                    continue;
                 }
+            }
 
-                hr = UpdateActiveILVersion(pMgrToCodeActivationBatch, inliner.m_module, inliner.m_methodDef, fIsRevert, flags);
-                if (FAILED(hr))
-                {
-                    ReportReJITError(inliner.m_module, inliner.m_methodDef, NULL, hr);
-                }
+            hr = UpdateActiveILVersion(pMgrToCodeActivationBatch, inliner.m_module, inliner.m_methodDef, fIsRevert, flags);
+            if (FAILED(hr))
+            {
+                ReportReJITError(inliner.m_module, inliner.m_methodDef, NULL, hr);
             }
         }
     }
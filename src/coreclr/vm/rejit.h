@@ -192,7 +192,8 @@ private:
         Module             *pInlineeModule,
         mdMethodDef         inlineeMethodDef,
         BOOL                fIsRevert,
-        COR_PRF_REJIT_FLAGS flags);
+        COR_PRF_REJIT_FLAGS flags,
+        CDynArray<Module*> *pNativeImageModules);
 
     static HRESULT UpdateJitInlinerActiveILVersions(
         SHash<CodeActivationBatchTraits> *pMgrToCodeActivationBatch,
@@ -36,7 +36,7 @@ SpinLock::SpinLock()
     m_Initialized = UnInitialized;
 }
 
-void SpinLock::Init(LOCK_TYPE type, bool RequireCoopGC)
+void SpinLock::Init(LOCK_TYPE type, bool RequireCoopGC, bool Queued)
 {
     CONTRACTL
     {
@@ -48,6 +48,7 @@ void SpinLock::Init(LOCK_TYPE type, bool RequireCoopGC)
     if (m_Initialized == Initialized)
     {
         _ASSERTE (type == m_LockType);
+        _ASSERTE (Queued == !!m_queued);
         _ASSERTE (RequireCoopGC == m_requireCoopGCMode);
 
         // We have initialized this spinlock.
@@ -74,10 +75,13 @@ void SpinLock::Init(LOCK_TYPE type, bool RequireCoopGC)
 
     {
         m_lock = 0;
+        m_ticketNext = 0;
+        m_ticketServing = 0;
+        m_queued = Queued;
     }
 
-#ifdef _DEBUG
     m_LockType = type;
+#ifdef _DEBUG
     m_requireCoopGCMode = RequireCoopGC;
 #endif
 
@@ -136,7 +140,11 @@ void SpinLock::GetLock()
         // Not CLR Sync hosted, so we use interlocked operations on
         // m_lock to acquire the lock.  This will automatically cause
         // us to call EE_LOCK_TAKEN(this);
-        if (!GetLockNoWait())
+        if (m_queued)
+        {
+            AcquireQueued();
+        }
+        else if (!GetLockNoWait())
         {
             SpinToAcquire();
         }
@@ -163,6 +171,19 @@ BOOL SpinLock::GetLockNoWait()
     CONTRACTL_END;
 
     {
+        if (m_queued)
+        {
+            // Only take a ticket if it would be granted immediately.
+            LONG serving = VolatileLoad(&m_ticketServing);
+            if (VolatileLoad(&m_ticketNext) == serving &&
+                InterlockedCompareExchange(&m_ticketNext, serving + 1, serving) == serving)
+            {
+                EE_LOCK_TAKEN(this);
+                return 1;
+            }
+            return 0;
+        }
+
         if (VolatileLoad(&m_lock) == 0 && InterlockedExchange (&m_lock, 1) == 0)
         {
             EE_LOCK_TAKEN(this);
@@ -194,7 +215,16 @@ void SpinLock::FreeLock()
 #endif
 
     {
-        VolatileStore(&m_lock, (LONG)0);
+        if (m_queued)
+        {
+            // Only the owner writes m_ticketServing, so a plain release store
+            // hands the lock to the next ticket holder.
+            VolatileStore(&m_ticketServing, m_ticketServing + 1);
+        }
+        else
+        {
+            VolatileStore(&m_lock, (LONG)0);
+        }
     }
 
     EE_LOCK_RELEASED(this);
@@ -252,6 +282,8 @@ SpinLock::SpinToAcquire()
         __SwitchToThread(0, backoffs++);
     }
 
+    SpinLockTelemetry::RecordAcquisition (m_LockType, ulSpins);
+
 #ifdef _DEBUG
     //profile info
     SpinLockProfiler::IncrementCollisions (m_LockType);
@@ -261,6 +293,135 @@ SpinLock::SpinToAcquire()
 
 } // SpinLock::SpinToAcquire ()
 
+//----------------------------------------------------------------------------
+// SpinLock::AcquireQueued
+//
+//  Ticket order acquisition for locks initialized as queued. Waiters are
+//  granted the lock strictly in arrival order, which trades a little
+//  uncontended throughput for bounded waiting - no thread can be starved by
+//  later arrivals winning the release race.
+//
+void
+SpinLock::AcquireQueued()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    LONG ticket = InterlockedIncrement(&m_ticketNext) - 1;
+
+    if (VolatileLoad(&m_ticketServing) == ticket)
+    {
+        EE_LOCK_TAKEN(this);
+        return;
+    }
+
+    DWORD backoffs = 0;
+    ULONG ulSpins = 0;
+    YieldProcessorNormalizationInfo normalizationInfo;
+
+    while (VolatileLoad(&m_ticketServing) != ticket)
+    {
+        for (ULONG i = ulSpins + 10000;
+             ulSpins < i;
+             ulSpins++)
+        {
+            YieldProcessorNormalized(normalizationInfo); // indicate to the processor that we are spinning
+
+            if (VolatileLoad(&m_ticketServing) == ticket)
+            {
+                break;
+            }
+        }
+
+        if (VolatileLoad(&m_ticketServing) == ticket)
+        {
+            break;
+        }
+
+        //backoff
+        __SwitchToThread(0, backoffs++);
+    }
+
+    EE_LOCK_TAKEN(this);
+
+    SpinLockTelemetry::RecordAcquisition (m_LockType, ulSpins);
+
+#ifdef _DEBUG
+    //profile info
+    SpinLockProfiler::IncrementCollisions (m_LockType);
+    SpinLockProfiler::IncrementSpins (m_LockType, ulSpins);
+    SpinLockProfiler::IncrementBackoffs (backoffs);
+#endif
+
+} // SpinLock::AcquireQueued ()
+
+//----------------------------------------------------------------------------
+// SpinLockTelemetry
+//
+
+ULONG SpinLockTelemetry::s_ulSpinHistogram [LOCK_TYPE_DEFAULT + 1][SpinLockTelemetry::BUCKET_COUNT] = { { 0 } };
+ULONG SpinLockTelemetry::s_ulSamples [LOCK_TYPE_DEFAULT + 1] = { 0 };
+
+// -1 until the config value has been read
+static Volatile<LONG> s_fSpinLockTelemetryEnabled = -1;
+
+bool SpinLockTelemetry::IsEnabled()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    LONG fEnabled = s_fSpinLockTelemetryEnabled;
+    if (fEnabled == -1)
+    {
+        fEnabled = (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_SpinLockContentionTelemetry) != 0);
+        s_fSpinLockTelemetryEnabled = fEnabled;
+    }
+
+    return fEnabled != 0;
+}
+
+void SpinLockTelemetry::RecordAcquisition(LOCK_TYPE type, ULONG ulSpins)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(type <= LOCK_TYPE_DEFAULT);
+
+    if (ulSpins == 0 || !IsEnabled())
+        return;
+
+    unsigned bucket = 0;
+    for (ULONG threshold = 1024; bucket < BUCKET_COUNT - 1 && ulSpins >= threshold; threshold <<= 2)
+        bucket++;
+
+    InterlockedIncrement((LONG*)&s_ulSpinHistogram[type][bucket]);
+
+    // Periodically report the histogram so the log carries a running picture
+    // of how long waiters spin on this lock type.
+    ULONG samples = (ULONG)InterlockedIncrement((LONG*)&s_ulSamples[type]);
+    if ((samples & 0x3FF) == 0)
+    {
+        STRESS_LOG7(LF_SYNC, LL_INFO100,
+            "SpinLock type %d spins per contended acquisition: <1K %d  <4K %d  <16K %d  <64K %d  <256K %d  more %d\n",
+            type,
+            s_ulSpinHistogram[type][0], s_ulSpinHistogram[type][1], s_ulSpinHistogram[type][2],
+            s_ulSpinHistogram[type][3], s_ulSpinHistogram[type][4], s_ulSpinHistogram[type][5]);
+    }
+}
+
 #ifdef _DEBUG
 // If a GC is not allowed when we enter the lock, we'd better not do anything inside
 // the lock that could provoke a GC.  Otherwise other threads attempting to block
@@ -153,6 +153,13 @@ private:
         LONG                m_lock;     // LONG used in interlocked exchange
     };
 
+    // Ticket state, used instead of m_lock when the lock is initialized as
+    // queued. Tickets are granted in order, so contended acquisitions are FIFO
+    // rather than a free-for-all on every release.
+    LONG                m_ticketNext;
+    LONG                m_ticketServing;
+    BOOL                m_queued;
+
     enum SpinLockState
     {
         UnInitialized,
@@ -163,9 +170,9 @@ private:
     Volatile<SpinLockState>      m_Initialized; // To verify initialized
                                         // And initialize once
 
-#ifdef _DEBUG
     LOCK_TYPE           m_LockType;     // lock type to track statistics
 
+#ifdef _DEBUG
     // Check for dead lock situation.
     bool                m_requireCoopGCMode;
     EEThreadId          m_holdingThreadId;
@@ -175,7 +182,7 @@ public:
     SpinLock ();
 
     //Init method, initialize lock and _DEBUG flags
-    void Init(LOCK_TYPE type, bool RequireCoopGC = FALSE);
+    void Init(LOCK_TYPE type, bool RequireCoopGC = FALSE, bool Queued = FALSE);
 
     //-----------------------------------------------------------------
     // Is the current thread the owner?
@@ -186,6 +193,7 @@ public:
 
 private:
     void SpinToAcquire (); // out of line call spins
+    void AcquireQueued (); // ticket order acquisition for queued locks
 
 #ifdef _DEBUG
     void dbg_PreEnterLock();
@@ -227,6 +235,29 @@ public:
 };
 
 
+//----------------------------------------------------------------------------
+// class SpinLockTelemetry
+//  per-lock-type histograms of spin counts for contended acquisitions,
+//  reported through the stress log. Off by default; enable with
+//  DOTNET_SpinLockContentionTelemetry=1.
+//
+//----------------------------------------------------------------------------
+class SpinLockTelemetry
+{
+    // Buckets are spins per contended acquisition:
+    // <1K, <4K, <16K, <64K, <256K and everything above.
+    static const unsigned BUCKET_COUNT = 6;
+
+    static ULONG s_ulSpinHistogram [LOCK_TYPE_DEFAULT + 1][BUCKET_COUNT];
+    static ULONG s_ulSamples [LOCK_TYPE_DEFAULT + 1];
+
+    static bool IsEnabled ();
+
+public:
+
+    static void RecordAcquisition (LOCK_TYPE type, ULONG ulSpins);
+};
+
 typedef SpinLock::Holder SpinLockHolder;
 #define TAKE_SPINLOCK_AND_DONOT_TRIGGER_GC(lock) \
                         SpinLockHolder __spinLockHolder(lock);\
@@ -463,9 +463,21 @@ size_t BitMapSize (size_t cacheSize)
 //
 // ***************************************************************************
 
+SyncBlockCache::SyncBlockMemoryStripe::SyncBlockMemoryStripe()
+    // Same flags as m_CacheLock - see the NOTE on its initializer below.
+    : m_Lock(CrstSyncBlockCache, (CrstFlags) (CRST_UNSAFE_ANYMODE | CRST_DEBUGGER_THREAD)),
+      m_FreeBlockList(NULL),
+      m_FreeCount(0),
+      m_ActiveCount(0),
+      m_SyncBlocks(0),
+      m_FreeSyncBlock(0),
+      m_InflationCount(0)
+{
+    LIMITED_METHOD_CONTRACT;
+}
+
 SyncBlockCache::SyncBlockCache()
     : m_pCleanupBlockList(NULL),
-      m_FreeBlockList(NULL),
 
       // NOTE: CRST_UNSAFE_ANYMODE prevents a GC mode switch when entering this crst.
       // If you remove this flag, we will switch to preemptive mode when entering
@@ -474,10 +486,6 @@ SyncBlockCache::SyncBlockCache()
       // So be sure to update the contracts if you remove this flag.
       m_CacheLock(CrstSyncBlockCache, (CrstFlags) (CRST_UNSAFE_ANYMODE | CRST_DEBUGGER_THREAD)),
 
-      m_FreeCount(0),
-      m_ActiveCount(0),
-      m_SyncBlocks(0),
-      m_FreeSyncBlock(0),
       m_FreeSyncTableIndex(1),
       m_FreeSyncTableList(0),
       m_SyncTableSize(SYNC_TABLE_INITIAL_SIZE),
@@ -509,17 +517,21 @@ SyncBlockCache::~SyncBlockCache()
     }
     CONTRACTL_END;
 
-    // Clear the list the fast way.
-    m_FreeBlockList = NULL;
     //<TODO>@todo we can clear this fast too I guess</TODO>
     m_pCleanupBlockList = NULL;
 
-    // destruct all arrays
-    while (m_SyncBlocks)
+    for (DWORD stripe = 0; stripe < SYNCBLOCK_CACHE_STRIPES; stripe++)
     {
-        SyncBlockArray *next = m_SyncBlocks->m_Next;
-        delete m_SyncBlocks;
-        m_SyncBlocks = next;
+        // Clear the list the fast way.
+        m_MemoryStripes[stripe].m_FreeBlockList = NULL;
+
+        // destruct all arrays
+        while (m_MemoryStripes[stripe].m_SyncBlocks)
+        {
+            SyncBlockArray *next = m_MemoryStripes[stripe].m_SyncBlocks->m_Next;
+            delete m_MemoryStripes[stripe].m_SyncBlocks;
+            m_MemoryStripes[stripe].m_SyncBlocks = next;
+        }
     }
 
     // Also, now is a good time to clean up all the old tables which we discarded
@@ -751,9 +763,10 @@ SyncBlock* SyncBlockCache::GetNextCleanupSyncBlock()
 }
 
 
-// returns and removes the next free syncblock from the list
-// the cache lock must be entered to call this
-SyncBlock *SyncBlockCache::GetNextFreeSyncBlock()
+// returns and removes the next free syncblock from the object's allocation
+// stripe. Takes the stripe lock internally; the cache lock must NOT be held,
+// since the stripe locks are leaves.
+SyncBlock *SyncBlockCache::GetNextFreeSyncBlock(Object *obj)
 {
     CONTRACTL
     {
@@ -764,21 +777,27 @@ SyncBlock *SyncBlockCache::GetNextFreeSyncBlock()
     }
     CONTRACTL_END;
 
+    _ASSERTE(!m_CacheLock.OwnedByCurrentThread());
+
 #ifdef _DEBUG  // Instrumentation for OOM fault injection testing
     delete new char;
 #endif
 
+    SyncBlockMemoryStripe *pStripe = &m_MemoryStripes[GetStripeForObject(obj)];
+    CrstHolder ch(&pStripe->m_Lock);
+
     SyncBlock       *psb;
-    SLink           *plst = m_FreeBlockList;
+    SLink           *plst = pStripe->m_FreeBlockList;
 
-    m_ActiveCount++;
+    pStripe->m_ActiveCount++;
+    pStripe->m_InflationCount++;
 
     if (plst)
     {
-        m_FreeBlockList = m_FreeBlockList->m_pNext;
+        pStripe->m_FreeBlockList = plst->m_pNext;
 
         // shouldn't be 0
-        m_FreeCount--;
+        pStripe->m_FreeCount--;
 
         // get the actual sync block pointer
         psb = (SyncBlock *) (((BYTE *) plst) - offsetof(SyncBlock, m_Link));
@@ -787,7 +806,7 @@ SyncBlock *SyncBlockCache::GetNextFreeSyncBlock()
     }
     else
     {
-        if ((m_SyncBlocks == NULL) || (m_FreeSyncBlock >= MAXSYNCBLOCK))
+        if ((pStripe->m_SyncBlocks == NULL) || (pStripe->m_FreeSyncBlock >= MAXSYNCBLOCK))
         {
 #ifdef DUMP_SB
 //            LogSpewAlways("Allocating new syncblock array\n");
@@ -797,11 +816,11 @@ SyncBlock *SyncBlockCache::GetNextFreeSyncBlock()
             if (!newsyncblocks)
                 COMPlusThrowOM ();
 
-            newsyncblocks->m_Next = m_SyncBlocks;
-            m_SyncBlocks = newsyncblocks;
-            m_FreeSyncBlock = 0;
+            newsyncblocks->m_Next = pStripe->m_SyncBlocks;
+            pStripe->m_SyncBlocks = newsyncblocks;
+            pStripe->m_FreeSyncBlock = 0;
         }
-        return &(((SyncBlock*)m_SyncBlocks->m_Blocks)[m_FreeSyncBlock++]);
+        return &(((SyncBlock*)pStripe->m_SyncBlocks->m_Blocks)[pStripe->m_FreeSyncBlock++]);
     }
 
 }
@@ -1003,18 +1022,12 @@ void SyncBlockCache::DeleteSyncBlock(SyncBlock *psb)
     // operator delete).
     delete psb;
 
-    //synchronizer with the consumers,
-    // <TODO>@todo we don't really need a lock here, we can come up
-    // with some simple algo to avoid taking a lock </TODO>
-    {
-        SyncBlockCache::LockHolder lh(this);
-
-        DeleteSyncBlockMemory(psb);
-    }
+    DeleteSyncBlockMemory(psb);
 }
 
 
-// returns the sync block memory to the free pool but does not destruct sync block (must own cache lock already)
+// returns the sync block memory to its stripe's free pool but does not destruct
+// the sync block (takes the stripe lock internally)
 void    SyncBlockCache::DeleteSyncBlockMemory(SyncBlock *psb)
 {
     CONTRACTL
@@ -1026,11 +1039,14 @@ void    SyncBlockCache::DeleteSyncBlockMemory(SyncBlock *psb)
     }
     CONTRACTL_END
 
-    m_ActiveCount--;
-    m_FreeCount++;
+    SyncBlockMemoryStripe *pStripe = &m_MemoryStripes[GetStripeForBlock(psb)];
+    CrstHolder ch(&pStripe->m_Lock);
+
+    pStripe->m_ActiveCount--;
+    pStripe->m_FreeCount++;
 
-    psb->m_Link.m_pNext = m_FreeBlockList;
-    m_FreeBlockList = &psb->m_Link;
+    psb->m_Link.m_pNext = pStripe->m_FreeBlockList;
+    pStripe->m_FreeBlockList = &psb->m_Link;
 
 }
 
@@ -1050,11 +1066,15 @@ void SyncBlockCache::GCDeleteSyncBlock(SyncBlock *psb)
     // operator delete).
     delete psb;
 
-    m_ActiveCount--;
-    m_FreeCount++;
+    // Called during GC with mutator threads stopped, so each stripe's free
+    // list can be scavenged without taking its lock.
+    SyncBlockMemoryStripe *pStripe = &m_MemoryStripes[GetStripeForBlock(psb)];
 
-    psb->m_Link.m_pNext = m_FreeBlockList;
-    m_FreeBlockList = &psb->m_Link;
+    pStripe->m_ActiveCount--;
+    pStripe->m_FreeCount++;
+
+    psb->m_Link.m_pNext = pStripe->m_FreeBlockList;
+    pStripe->m_FreeBlockList = &psb->m_Link;
 }
 
 void SyncBlockCache::GCWeakPtrScan(HANDLESCANPROC scanProc, uintptr_t lp1, uintptr_t lp2)
@@ -1451,6 +1471,15 @@ void DumpSyncBlockCache()
 
     LogSpewAlways("Dumping SyncBlockCache size %u\n", pCache->m_FreeSyncTableIndex);
 
+    for (DWORD stripe = 0; stripe < SYNCBLOCK_CACHE_STRIPES; stripe++)
+    {
+        LogSpewAlways("Stripe %2.2u: %u inflations, %u active, %u free\n",
+                      stripe,
+                      pCache->m_MemoryStripes[stripe].m_InflationCount,
+                      pCache->m_MemoryStripes[stripe].m_ActiveCount,
+                      pCache->m_MemoryStripes[stripe].m_FreeCount);
+    }
+
     static int dumpSBStyle = -1;
     if (dumpSBStyle == -1)
         dumpSBStyle = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_SBDumpStyle);
@@ -1593,15 +1622,20 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // From here on, spin against this lock's own adaptive budget. Locks
+            // whose hold times exceed the spin window keep a small budget and
+            // send threads to wait sooner.
+            const DWORD awareLockSpinCount = awareLock->GetAdaptiveSpinCount();
+
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < awareLockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= awareLockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1610,6 +1644,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->NoteSpinAcquired();
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
@@ -1621,8 +1656,11 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
 
             if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
             {
+                awareLock->NoteSpinAcquired();
                 return AwareLock::EnterHelperResult_Entered;
             }
+
+            awareLock->NoteSpinExhausted();
             break;
         }
 
@@ -2138,6 +2176,13 @@ SyncBlock *ObjHeader::GetSyncBlock()
 
     //Need to get it from the cache
     {
+        // Grab the sync block memory from the allocation stripe before taking
+        // the cache lock - the stripe locks are leaves and are never held
+        // together with it. If it turns out another thread beat us to the
+        // inflation, the holder returns the memory to its stripe after the
+        // cache lock has been released.
+        SyncBlockMemoryHolder syncBlockMemoryHolder(SyncBlockCache::GetSyncBlockCache()->GetNextFreeSyncBlock(GetBaseObject()));
+
         SyncBlockCache::LockHolder lh(SyncBlockCache::GetSyncBlockCache());
 
         //Try one more time
@@ -2145,8 +2190,6 @@ SyncBlock *ObjHeader::GetSyncBlock()
         if (syncBlock)
             RETURN syncBlock;
 
-
-        SyncBlockMemoryHolder syncBlockMemoryHolder(SyncBlockCache::GetSyncBlockCache()->GetNextFreeSyncBlock());
         syncBlock = syncBlockMemoryHolder;
 
         if ((indx = GetHeaderSyncBlockIndex()) == 0)
@@ -2518,6 +2561,89 @@ double ComputeElapsedTimeInNanosecond(LARGE_INTEGER startTicks, LARGE_INTEGER en
     return (elapsedTicks * NsPerSecond) / freq.QuadPart;
 }
 
+// Contention summary aggregation.
+//
+// Under heavy lock storms the per-contention Start/Stop events can overwhelm a
+// tracing session. Sessions that only need attribution can instead enable the
+// ContentionSummary keyword, which aggregates contention counts and wait times
+// per lock in a small fixed table and periodically flushes the totals as
+// ContentionLockSummary events. Entries are keyed by the AwareLock pointer with
+// the associated object pointer captured opportunistically (same staleness
+// semantics as the LockCreated event). The table is best-effort: a bounded
+// linear probe avoids unbounded work on the contention path, and contentions
+// that do not find a slot are simply not aggregated.
+struct ContentionSummaryEntry
+{
+    AwareLock* volatile m_lock;
+    void* volatile m_object;
+    LONGLONG volatile m_count;
+    LONGLONG volatile m_waitNs;
+};
+
+static const SIZE_T ContentionSummaryTableSize = 64; // must be a power of two
+static const SIZE_T ContentionSummaryMaxProbe = 4;
+static const ULONGLONG ContentionSummaryFlushIntervalMs = 5000;
+
+static ContentionSummaryEntry s_contentionSummaryTable[ContentionSummaryTableSize];
+static LONGLONG volatile s_contentionSummaryLastFlushMs = 0;
+
+static void RecordContentionForSummary(AwareLock* pLock, void* pObject, LONGLONG waitTimeNs)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    SIZE_T slot = (((SIZE_T)pLock) >> 4) & (ContentionSummaryTableSize - 1);
+    for (SIZE_T probe = 0; probe < ContentionSummaryMaxProbe; probe++)
+    {
+        ContentionSummaryEntry* pEntry = &s_contentionSummaryTable[(slot + probe) & (ContentionSummaryTableSize - 1)];
+
+        AwareLock* pEntryLock = pEntry->m_lock;
+        if (pEntryLock == NULL)
+        {
+            pEntryLock = InterlockedCompareExchangeT(&pEntry->m_lock, pLock, (AwareLock*)NULL);
+            if (pEntryLock == NULL)
+            {
+                pEntryLock = pLock;
+            }
+        }
+
+        if (pEntryLock == pLock)
+        {
+            pEntry->m_object = pObject;
+            InterlockedIncrement64(&pEntry->m_count);
+            InterlockedExchangeAdd64(&pEntry->m_waitNs, waitTimeNs);
+            return;
+        }
+    }
+
+    // Bucket full - drop this contention from the summary.
+}
+
+static void FlushContentionSummaries()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (SIZE_T i = 0; i < ContentionSummaryTableSize; i++)
+    {
+        ContentionSummaryEntry* pEntry = &s_contentionSummaryTable[i];
+        if (pEntry->m_lock == NULL)
+        {
+            continue;
+        }
+
+        LONGLONG count = InterlockedExchange64(&pEntry->m_count, 0);
+        LONGLONG waitNs = InterlockedExchange64(&pEntry->m_waitNs, 0);
+        if (count != 0)
+        {
+            FireEtwContentionLockSummary(
+                GetClrInstanceId(),
+                pEntry->m_lock,
+                pEntry->m_object,
+                (ULONGLONG)count,
+                (ULONGLONG)waitNs);
+        }
+    }
+}
+
 BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 {
     STATIC_CONTRACT_THROWS;
@@ -2542,11 +2668,15 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 
     LARGE_INTEGER startTicks = { {0} };
     bool isContentionKeywordEnabled = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_CONTENTION_KEYWORD);
+    bool isContentionSummaryEnabled = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_CONTENTIONSUMMARY_KEYWORD);
 
-    if (isContentionKeywordEnabled)
+    if (isContentionKeywordEnabled || isContentionSummaryEnabled)
     {
         QueryPerformanceCounter(&startTicks);
+    }
 
+    if (isContentionKeywordEnabled)
+    {
         if (InterlockedCompareExchangeT(&m_emittedLockCreatedEvent, 1, 0) == 0)
         {
             FireEtwLockCreated(this, OBJECTREFToObject(obj), GetClrInstanceId());
@@ -2636,7 +2766,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
             {
                 bool acquiredLock = false;
                 YieldProcessorNormalizationInfo normalizationInfo;
-                const DWORD spinCount = g_SpinConstants.dwMonitorSpinCount;
+                const DWORD spinCount = GetAdaptiveSpinCount();
                 for (DWORD spinIteration = 0; spinIteration < spinCount; ++spinIteration)
                 {
                     if (m_lockState.InterlockedTry_LockAndUnregisterWaiterAndObserveWakeSignal(this))
@@ -2649,8 +2779,10 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
                 }
                 if (acquiredLock)
                 {
+                    NoteSpinAcquired();
                     break;
                 }
+                NoteSpinExhausted();
             }
 
             if (m_lockState.InterlockedObserveWakeSignal_Try_LockAndUnregisterWaiter(this))
@@ -2688,15 +2820,35 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
     GCPROTECT_END();
     DecrementTransientPrecious();
 
-    if (isContentionKeywordEnabled)
+    if (isContentionKeywordEnabled || isContentionSummaryEnabled)
     {
         LARGE_INTEGER endTicks;
         QueryPerformanceCounter(&endTicks);
 
         double elapsedTimeInNanosecond = ComputeElapsedTimeInNanosecond(startTicks, endTicks);
 
-        // Fire a contention end event for a managed contention
-        FireEtwContentionStop_V1(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId(), elapsedTimeInNanosecond);
+        if (isContentionKeywordEnabled)
+        {
+            // Fire a contention end event for a managed contention
+            FireEtwContentionStop_V1(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId(), elapsedTimeInNanosecond);
+        }
+
+        if (isContentionSummaryEnabled)
+        {
+            // obj is safe to read here - we are back in cooperative mode and obj
+            // was protected across the wait.
+            RecordContentionForSummary(this, OBJECTREFToObject(obj), (LONGLONG)elapsedTimeInNanosecond);
+
+            // The flush is driven from the contention slow path itself rather than a
+            // dedicated timer thread; a single thread wins the CAS per interval.
+            ULONGLONG nowMs = CLRGetTickCount64();
+            LONGLONG lastFlushMs = s_contentionSummaryLastFlushMs;
+            if (nowMs - (ULONGLONG)lastFlushMs >= ContentionSummaryFlushIntervalMs &&
+                InterlockedCompareExchange64(&s_contentionSummaryLastFlushMs, (LONGLONG)nowMs, lastFlushMs) == lastFlushMs)
+            {
+                FlushContentionSummaries();
+            }
+        }
     }
 
 
@@ -450,6 +450,11 @@ private:
     DWORD m_waiterStarvationStartTimeMs;
     int m_emittedLockCreatedEvent;
 
+    // Per-lock spin budget, seeded from the global monitor spin count and
+    // adjusted by acquisition outcomes (see NoteSpinAcquired/NoteSpinExhausted),
+    // so locks with long hold times stop sending threads into futile spins.
+    DWORD m_adaptiveSpinCount;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
 
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
@@ -463,7 +468,8 @@ private:
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
           m_waiterStarvationStartTimeMs(0),
-          m_emittedLockCreatedEvent(0)
+          m_emittedLockCreatedEvent(0),
+          m_adaptiveSpinCount(g_SpinConstants.dwMonitorSpinCount)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -542,6 +548,13 @@ private: // friend access is required for this unsafe function
 public:
     static void SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration);
 
+    // Per-lock adaptive spin budget. Acquiring the lock by spinning grows the
+    // budget back toward the global monitor spin count; exhausting the budget
+    // without acquiring the lock halves it.
+    DWORD GetAdaptiveSpinCount() const;
+    void NoteSpinAcquired();
+    void NoteSpinExhausted();
+
     // Helper encapsulating the fast path entering monitor. Returns what kind of result was achieved.
     bool TryEnterHelper(Thread* pCurThread);
 
@@ -1290,6 +1303,10 @@ extern void DumpSyncBlockCache();
 
 typedef DPTR(SyncBlockCache) PTR_SyncBlockCache;
 
+// Number of independent stripes the sync block memory pool is split into.
+// Must be a power of two.
+#define SYNCBLOCK_CACHE_STRIPES 16
+
 // The SyncBlockCache is the data structure that manages SyncBlocks
 // as well as SyncTableEntries (See explaintation at top of this file).
 //
@@ -1307,13 +1324,46 @@ class SyncBlockCache
 
 
   private:
+    // The sync block memory pool is striped so that inflation storms on
+    // distinct objects do not all serialize on m_CacheLock. Each stripe has
+    // its own lock, free list and backing arrays; allocations pick a stripe
+    // by hash of the object address and frees return a block to the stripe
+    // that hashes from the block address. The stripe locks are leaves - they
+    // are never held together with m_CacheLock or with each other.
+    //
+    // Note that the SyncTableEntry table itself is NOT striped: slot handout
+    // and entry publication stay under m_CacheLock because Grow() copies the
+    // whole table (and the ephemeral bitmap) wholesale, which is only safe
+    // if no other entry writer can run concurrently.
+    struct SyncBlockMemoryStripe
+    {
+        Crst        m_Lock;             // guards this stripe only
+        SLink*      m_FreeBlockList;    // list of free sync blocks
+        DWORD       m_FreeCount;        // count of free sync blocks
+        DWORD       m_ActiveCount;      // number active
+        SyncBlockArray *m_SyncBlocks;   // Array of new SyncBlocks.
+        DWORD       m_FreeSyncBlock;    // Next Free Syncblock in the array
+        DWORD       m_InflationCount;   // sync blocks handed out from this stripe (monotonic)
+
+        SyncBlockMemoryStripe();
+    };
+
+    static DWORD GetStripeForObject(Object *obj)
+    {
+        LIMITED_METHOD_CONTRACT;
+        // Drop the low bits that are identical for all objects anyway.
+        return (DWORD)(((SIZE_T)obj >> 6) & (SYNCBLOCK_CACHE_STRIPES - 1));
+    }
+
+    static DWORD GetStripeForBlock(SyncBlock *psb)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (DWORD)(((SIZE_T)psb >> 6) & (SYNCBLOCK_CACHE_STRIPES - 1));
+    }
+
     PTR_SLink   m_pCleanupBlockList;    // list of sync blocks that need cleanup
-    SLink*      m_FreeBlockList;        // list of free sync blocks
     Crst        m_CacheLock;            // cache lock
-    DWORD       m_FreeCount;            // count of active sync blocks
-    DWORD       m_ActiveCount;          // number active
-    SyncBlockArray *m_SyncBlocks;       // Array of new SyncBlocks.
-    DWORD       m_FreeSyncBlock;        // Next Free Syncblock in the array
+    SyncBlockMemoryStripe m_MemoryStripes[SYNCBLOCK_CACHE_STRIPES];
 
         // The next variables deal with SyncTableEntries.  Instead of having the object-header
         // point directly at SyncBlocks, the object points at a syncTableEntry, which in turn points
@@ -1366,8 +1416,8 @@ class SyncBlockCache
     static void Start();
     static void Stop();
 
-    // returns and removes next from free list
-    SyncBlock* GetNextFreeSyncBlock();
+    // returns and removes next from the object's allocation stripe
+    SyncBlock* GetNextFreeSyncBlock(Object *obj);
     // returns and removes the next from cleanup list
     SyncBlock* GetNextCleanupSyncBlock();
     // inserts a syncblock into the cleanup list
@@ -1379,7 +1429,8 @@ class SyncBlockCache
     // return sync block to cache or delete
     void    DeleteSyncBlock(SyncBlock *sb);
 
-    // returns the sync block memory to the free pool but does not destruct sync block (must own cache lock already)
+    // returns the sync block memory to its stripe's free pool but does not destruct
+    // the sync block (takes the stripe lock internally)
     void    DeleteSyncBlockMemory(SyncBlock *sb);
 
     // return sync block to cache or delete, called from GC
@@ -1406,7 +1457,12 @@ class SyncBlockCache
 
     DWORD GetActiveCount()
     {
-        return m_ActiveCount;
+        // Only the aggregate is meaningful: a block may be freed to a
+        // different stripe than the one that handed it out.
+        DWORD count = 0;
+        for (DWORD i = 0; i < SYNCBLOCK_CACHE_STRIPES; i++)
+            count += m_MemoryStripes[i].m_ActiveCount;
+        return count;
     }
 
     // Encapsulate a CrstHolder, so that clients of our lock don't have to know
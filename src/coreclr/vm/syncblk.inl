@@ -457,6 +457,44 @@ FORCEINLINE bool AwareLock::ShouldStopPreemptingWaiters() const
         GetTickCount() - waiterStarvationStartTimeMs >= WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters;
 }
 
+FORCEINLINE DWORD AwareLock::GetAdaptiveSpinCount() const
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Cap at the global count; SpinWait's back-off is tuned against it
+    return min(m_adaptiveSpinCount, g_SpinConstants.dwMonitorSpinCount);
+}
+
+FORCEINLINE void AwareLock::NoteSpinAcquired()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Spinning paid off, so grow this lock's spin budget back toward the
+    // global limit. Updates to the count are racy but benign; it is only a
+    // heuristic.
+    DWORD adaptiveSpinCount = m_adaptiveSpinCount;
+    const DWORD maxSpinCount = g_SpinConstants.dwMonitorSpinCount;
+    if (adaptiveSpinCount < maxSpinCount)
+    {
+        m_adaptiveSpinCount = min(adaptiveSpinCount + maxSpinCount / 16 + 1, maxSpinCount);
+    }
+}
+
+FORCEINLINE void AwareLock::NoteSpinExhausted()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The spin budget was used up without acquiring the lock, so this lock's
+    // hold times are likely longer than the spin window. Halve the budget so
+    // threads move to waiting sooner, keeping a floor of one iteration so the
+    // budget can recover if hold times shrink again.
+    DWORD adaptiveSpinCount = m_adaptiveSpinCount;
+    if (adaptiveSpinCount > 1)
+    {
+        m_adaptiveSpinCount = adaptiveSpinCount / 2;
+    }
+}
+
 FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration)
 {
     WRAPPER_NO_CONTRACT;
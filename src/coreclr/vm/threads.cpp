@@ -7692,6 +7692,20 @@ Frame * Thread::NotifyFrameChainOfExceptionUnwind(Frame* pStartFrame, LPVOID pvL
 //
 //+----------------------------------------------------------------------------
 
+#ifdef HOST_WINDOWS
+// The fast-path thread-static block index table (see
+// JIT_GetSharedNonGCThreadStaticBaseOptimized in jithelpers.cpp)
+#ifdef _MSC_VER
+__declspec(selectany) __declspec(thread) uint32_t t_maxThreadStaticBlocks;
+__declspec(selectany) __declspec(thread) uint32_t t_threadStaticBlocksSize;
+__declspec(selectany) __declspec(thread) void** t_threadStaticBlocks;
+#else
+EXTERN_C __thread uint32_t t_maxThreadStaticBlocks;
+EXTERN_C __thread uint32_t t_threadStaticBlocksSize;
+EXTERN_C __thread void** t_threadStaticBlocks;
+#endif
+#endif // HOST_WINDOWS
+
 void Thread::DeleteThreadStaticData()
 {
     CONTRACTL {
@@ -7701,6 +7715,20 @@ void Thread::DeleteThreadStaticData()
     CONTRACTL_END;
 
     m_ThreadLocalBlock.FreeTable();
+
+#ifdef HOST_WINDOWS
+    // The thread-static block index table lives in this thread's TLS, so it can
+    // only be freed when the thread is shutting itself down. If the thread is
+    // terminated from elsewhere the table is unreachable and stays allocated
+    // until process exit, same as the TLS block itself.
+    if (this == GetThreadNULLOk())
+    {
+        delete[] t_threadStaticBlocks;
+        t_threadStaticBlocks = NULL;
+        t_threadStaticBlocksSize = 0;
+        t_maxThreadStaticBlocks = 0;
+    }
+#endif // HOST_WINDOWS
 }
 
 //+----------------------------------------------------------------------------
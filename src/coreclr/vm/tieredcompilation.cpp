@@ -36,9 +36,9 @@
 // queue another threadpool work item if m_methodsToOptimize hasn't been drained.
 //
 // The background thread enters at StaticBackgroundWorkCallback(), enters the
-// appdomain, and then begins calling OptimizeMethod on each method in the
-// queue. For each method we jit it, then update the precode so that future
-// entrypoint callers will run the new code.
+// appdomain, and then begins jitting each method in the queue. Jitted methods
+// are published in small batches (ActivateCodeVersions), updating the precodes
+// so that future entrypoint callers will run the new code.
 //
 // # Error handling
 //
@@ -59,6 +59,11 @@ CLREvent TieredCompilationManager::s_backgroundWorkAvailableEvent;
 bool TieredCompilationManager::s_isBackgroundWorkerRunning = false;
 bool TieredCompilationManager::s_isBackgroundWorkerProcessingWork = false;
 
+LPWSTR TieredCompilationManager::s_promotionProfilePath = nullptr;
+UINT64* TieredCompilationManager::s_promotionProfileKeys = nullptr;
+UINT32 TieredCompilationManager::s_promotionProfileKeyCount = 0;
+SArray<UINT64>* TieredCompilationManager::s_recordedPromotions = nullptr;
+
 // Called at AppDomain construction
 TieredCompilationManager::TieredCompilationManager() :
     m_countOfMethodsToOptimize(0),
@@ -111,6 +116,19 @@ NativeCodeVersion::OptimizationTier TieredCompilationManager::GetInitialOptimiza
         return NativeCodeVersion::OptimizationTierOptimized;
     }
 
+#ifndef DACCESS_COMPILE
+    if (s_promotionProfileKeyCount != 0 &&
+#ifdef FEATURE_PGO
+        !g_pConfig->TieredPGO() &&
+#endif
+        IsMethodInPromotionProfile(pMethodDesc))
+    {
+        // The method was promoted to the final tier by a previous run recorded in the promotion profile, skip the
+        // lower tiers entirely. This is not done with tiered PGO since it would skip the instrumented tiers.
+        return NativeCodeVersion::OptimizationTier1;
+    }
+#endif // !DACCESS_COMPILE
+
 #ifdef FEATURE_PGO
     if (g_pConfig->TieredPGO())
     {
@@ -506,7 +524,7 @@ void TieredCompilationManager::BackgroundWorkerStart()
     LARGE_INTEGER li;
     QueryPerformanceFrequency(&li);
     UINT64 ticksPerS = li.QuadPart;
-    UINT64 maxWorkDurationTicks = ticksPerS * 50 / 1000; // 50 ms
+    UINT64 maxWorkDurationTicks = ticksPerS * g_pConfig->TieredCompilation_BackgroundWorkerMaxWorkDurationMs() / 1000; // 50 ms by default
     UINT64 minWorkDurationTicks = min(ticksPerS * processorCount / 1000, maxWorkDurationTicks); // <proc count> ms (capped)
     UINT64 workDurationTicks = minWorkDurationTicks;
 
@@ -730,6 +748,9 @@ bool TieredCompilationManager::DoBackgroundWork(
     _ASSERTE(workDurationTicks >= minWorkDurationTicks);
     _ASSERTE(workDurationTicks <= maxWorkDurationTicks);
 
+    // Methods queued since the last batch are in threshold-trip order, reorder them by expected benefit
+    PrioritizeMethodsToOptimize();
+
     if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
     {
         UINT32 countOfMethodsToOptimize = m_countOfMethodsToOptimize;
@@ -743,6 +764,13 @@ bool TieredCompilationManager::DoBackgroundWork(
     bool sendStopEvent = true;
     bool allMethodsJitted = false;
     UINT32 jittedMethodCount = 0;
+
+    // Jitted code versions whose activation has been deferred so that a wave of
+    // promotions publishes entry points in batches (see ActivateCodeVersions)
+    const UINT32 MaxPendingActivationCount = 16;
+    NativeCodeVersion pendingActivations[MaxPendingActivationCount];
+    UINT32 pendingActivationCount = 0;
+
     LARGE_INTEGER li;
     QueryPerformanceCounter(&li);
     UINT64 startTicks = li.QuadPart;
@@ -817,10 +845,21 @@ bool TieredCompilationManager::DoBackgroundWork(
             }
             EX_END_CATCH(RethrowTerminalExceptions);
 
+            // Completing call counting typically queues a burst of methods, prioritize it before jitting
+            PrioritizeMethodsToOptimize();
             continue;
         }
 
-        OptimizeMethod(nativeCodeVersionToOptimize);
+        _ASSERTE(nativeCodeVersionToOptimize.GetMethodDesc()->IsEligibleForTieredCompilation());
+        if (CompileCodeVersion(nativeCodeVersionToOptimize))
+        {
+            pendingActivations[pendingActivationCount++] = nativeCodeVersionToOptimize;
+            if (pendingActivationCount == MaxPendingActivationCount)
+            {
+                ActivateCodeVersions(pendingActivations, pendingActivationCount);
+                pendingActivationCount = 0;
+            }
+        }
         ++jittedMethodCount;
 
         // Yield the thread periodically to give preference to possibly more important work
@@ -852,6 +891,10 @@ bool TieredCompilationManager::DoBackgroundWork(
             ETW::CompilationLog::TieredCompilation::Runtime::SendBackgroundJitStop(countOfMethodsToOptimize, jittedMethodCount);
         }
 
+        // Publish everything jitted so far before yielding the thread
+        ActivateCodeVersions(pendingActivations, pendingActivationCount);
+        pendingActivationCount = 0;
+
         UINT64 beforeSleepTicks = currentTicks;
         ClrSleepEx(0, false);
 
@@ -899,6 +942,9 @@ bool TieredCompilationManager::DoBackgroundWork(
         startTicks = previousTicks = currentTicks;
     } while (!IsTieringDelayActive());
 
+    ActivateCodeVersions(pendingActivations, pendingActivationCount);
+    pendingActivationCount = 0;
+
     if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled() && sendStopEvent)
     {
         UINT32 countOfMethodsToOptimize = m_countOfMethodsToOptimize;
@@ -928,19 +974,6 @@ bool TieredCompilationManager::DoBackgroundWork(
     return allMethodsJitted;
 }
 
-// Jit compiles and installs new optimized code for a method.
-// Called on a background thread.
-void TieredCompilationManager::OptimizeMethod(NativeCodeVersion nativeCodeVersion)
-{
-    STANDARD_VM_CONTRACT;
-
-    _ASSERTE(nativeCodeVersion.GetMethodDesc()->IsEligibleForTieredCompilation());
-    if (CompileCodeVersion(nativeCodeVersion))
-    {
-        ActivateCodeVersion(nativeCodeVersion);
-    }
-}
-
 // Compiles new optimized code for a method.
 // Called on a background thread.
 BOOL TieredCompilationManager::CompileCodeVersion(NativeCodeVersion nativeCodeVersion)
@@ -985,39 +1018,165 @@ BOOL TieredCompilationManager::CompileCodeVersion(NativeCodeVersion nativeCodeVe
     return pCode != NULL;
 }
 
-// Updates the MethodDesc and precode so that future invocations of a method will
-// execute the native code pointed to by pCode.
+// Updates the MethodDescs and precodes so that future invocations of a batch of
+// jitted methods will execute their new native code. Publishing in bulk takes the
+// slot backpatch and code versioning locks once per batch instead of once per
+// method, which matters during warmup waves when many methods promote back to back.
 // Called on a background thread.
-void TieredCompilationManager::ActivateCodeVersion(NativeCodeVersion nativeCodeVersion)
+void TieredCompilationManager::ActivateCodeVersions(NativeCodeVersion* nativeCodeVersions, UINT32 count)
 {
     STANDARD_VM_CONTRACT;
 
-    MethodDesc* pMethod = nativeCodeVersion.GetMethodDesc();
+    if (count == 0)
+    {
+        return;
+    }
 
-    // If the ilParent version is active this will activate the native code version now.
-    // Otherwise if the ilParent version becomes active again in the future the native
-    // code version will activate then.
-    ILCodeVersion ilParent;
-    HRESULT hr = S_OK;
     {
-        bool mayHaveEntryPointSlotsToBackpatch = pMethod->MayHaveEntryPointSlotsToBackpatch();
-        MethodDescBackpatchInfoTracker::ConditionalLockHolder slotBackpatchLockHolder(mayHaveEntryPointSlotsToBackpatch);
+        MethodDescBackpatchInfoTracker::ConditionalLockHolder slotBackpatchLockHolder;
         CodeVersionManager::LockHolder codeVersioningLockHolder;
 
-        // As long as we are exclusively using any non-JumpStamp publishing for tiered compilation
-        // methods this first attempt should succeed
-        ilParent = nativeCodeVersion.GetILCodeVersion();
-        hr = ilParent.SetActiveNativeCodeVersion(nativeCodeVersion);
-        LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::ActivateCodeVersion Method=0x%pM (%s::%s), code version id=0x%x. SetActiveNativeCodeVersion ret=0x%x\n",
-            pMethod, pMethod->m_pszDebugClassName, pMethod->m_pszDebugMethodName,
-            nativeCodeVersion.GetVersionId(),
-            hr));
+        for (UINT32 i = 0; i < count; i++)
+        {
+            NativeCodeVersion nativeCodeVersion = nativeCodeVersions[i];
+            MethodDesc* pMethod = nativeCodeVersion.GetMethodDesc();
+
+            // If the ilParent version is active this will activate the native code version now.
+            // Otherwise if the ilParent version becomes active again in the future the native
+            // code version will activate then.
+            //
+            // As long as we are exclusively using any non-JumpStamp publishing for tiered compilation
+            // methods this first attempt should succeed
+            ILCodeVersion ilParent = nativeCodeVersion.GetILCodeVersion();
+            HRESULT hr = ilParent.SetActiveNativeCodeVersion(nativeCodeVersion);
+            LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::ActivateCodeVersions Method=0x%pM (%s::%s), code version id=0x%x. SetActiveNativeCodeVersion ret=0x%x\n",
+                pMethod, pMethod->m_pszDebugClassName, pMethod->m_pszDebugMethodName,
+                nativeCodeVersion.GetVersionId(),
+                hr));
+            if (FAILED(hr))
+            {
+                STRESS_LOG2(LF_TIEREDCOMPILATION, LL_INFO10, "TieredCompilationManager::ActivateCodeVersions: "
+                    "Method %pM failed to publish native code for native code version %d\n",
+                    pMethod, nativeCodeVersion.GetVersionId());
+            }
+        }
     }
-    if (FAILED(hr))
+
+    // RecordPromotion takes the tiered compilation lock, so do this outside the scope above
+    for (UINT32 i = 0; i < count; i++)
+    {
+        if (nativeCodeVersions[i].IsFinalTier())
+        {
+            RecordPromotion(nativeCodeVersions[i].GetMethodDesc());
+        }
+    }
+}
+
+namespace
+{
+    struct WeightedMethodToOptimize
+    {
+        SListElem<NativeCodeVersion> *elem;
+        UINT32 weight;
+    };
+
+    class WeightedMethodSorter : public CQuickSort<WeightedMethodToOptimize>
+    {
+    public:
+        WeightedMethodSorter(WeightedMethodToOptimize *pBase, SSIZE_T count)
+            : CQuickSort<WeightedMethodToOptimize>(pBase, count)
+        {
+            LIMITED_METHOD_CONTRACT;
+        }
+
+        int Compare(WeightedMethodToOptimize *first, WeightedMethodToOptimize *second)
+        {
+            LIMITED_METHOD_CONTRACT;
+
+            // Sort by descending weight so that the methods expected to benefit most are rejitted first
+            if (first->weight > second->weight)
+            {
+                return -1;
+            }
+            return first->weight < second->weight ? 1 : 0;
+        }
+    };
+}
+
+// Reorders the optimization queue so that the methods expected to benefit most from optimized code are
+// rejitted first. A deploy-style warmup trips a large burst of call counters at about the same time, and
+// jitting that burst in threshold-trip order can leave the hottest and largest methods running tier 0 code
+// for a long while. The call counting stubs count down from a fixed threshold and don't record an
+// invocation rate, so IL code size is used to approximate the expected benefit.
+// This runs on the background thread.
+void TieredCompilationManager::PrioritizeMethodsToOptimize()
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(GetThread() == s_backgroundWorkerThread);
+
+    // Only the background thread removes entries, so the count read without the lock is a lower bound
+    UINT32 count = m_countOfMethodsToOptimize;
+    if (count < 2)
+    {
+        return;
+    }
+
+    NewArrayHolder<WeightedMethodToOptimize> weightedMethods = new (nothrow) WeightedMethodToOptimize[count];
+    if (weightedMethods == nullptr)
+    {
+        // Prioritization is best-effort, keep the queue in its current order
+        return;
+    }
+
+    UINT32 drainedCount = 0;
     {
-        STRESS_LOG2(LF_TIEREDCOMPILATION, LL_INFO10, "TieredCompilationManager::ActivateCodeVersion: "
-            "Method %pM failed to publish native code for native code version %d\n",
-            pMethod, nativeCodeVersion.GetVersionId());
+        LockHolder tieredCompilationLockHolder;
+
+        SListElem<NativeCodeVersion> *elem;
+        while (drainedCount < count && (elem = m_methodsToOptimize.RemoveHead()) != nullptr)
+        {
+            weightedMethods[drainedCount].elem = elem;
+            weightedMethods[drainedCount].weight = 0;
+            ++drainedCount;
+        }
+
+        // m_countOfMethodsToOptimize is intentionally left unchanged, the entries are only parked here
+        // briefly and are all reinserted below
+    }
+
+    // Compute the weights outside the lock. From here to the reinsertion below nothing may throw, as a
+    // parked entry that is not reinserted would be lost and m_countOfMethodsToOptimize would never drain
+    // to zero.
+    for (UINT32 i = 0; i < drainedCount; ++i)
+    {
+        MethodDesc *methodDesc = weightedMethods[i].elem->GetValue().GetMethodDesc();
+        EX_TRY
+        {
+            if (methodDesc->IsIL() && !methodDesc->IsUnboxingStub() && methodDesc->GetRVA() != 0)
+            {
+                COR_ILMETHOD_DECODER header(methodDesc->GetILHeader());
+                weightedMethods[i].weight = header.GetCodeSize();
+            }
+        }
+        EX_CATCH
+        {
+            STRESS_LOG2(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::PrioritizeMethodsToOptimize: "
+                "Exception getting IL size for method %pM, hr=0x%x\n",
+                methodDesc, GET_EXCEPTION()->GetHR());
+        }
+        EX_END_CATCH(RethrowTerminalExceptions);
+    }
+
+    WeightedMethodSorter sorter(weightedMethods, drainedCount);
+    sorter.Sort();
+
+    {
+        LockHolder tieredCompilationLockHolder;
+
+        for (UINT32 i = drainedCount; i != 0; --i)
+        {
+            m_methodsToOptimize.InsertHead(weightedMethods[i - 1].elem);
+        }
     }
 }
 
@@ -1047,6 +1206,275 @@ NativeCodeVersion TieredCompilationManager::GetNextMethodToOptimize()
     return NativeCodeVersion();
 }
 
+//
+// Cross-run promotion profile
+//
+// When TC_PromotionProfilePath is configured, the set of methods promoted to the final tier is written to a
+// compact file at shutdown, and a later run of the same binaries reads it and starts those methods at tier 1
+// so they don't re-learn their hotness through call counting. Methods are identified by a hash of the owning
+// module's simple name combined with the methodDef token, so the profile survives rebasing and is resilient
+// (though not immune) to binary changes; a hash collision only affects the initial tier choice.
+//
+
+namespace
+{
+    struct PromotionProfileHeader
+    {
+        UINT32 m_magic;
+        UINT32 m_version;
+        UINT32 m_count;
+    };
+
+    const UINT32 PromotionProfileMagic = 0x50504354; // 'TCPP'
+    const UINT32 PromotionProfileVersion = 1;
+    const UINT32 PromotionProfileMaxCount = 1 << 20;
+
+    class PromotionProfileKeySorter : public CQuickSort<UINT64>
+    {
+    public:
+        PromotionProfileKeySorter(UINT64 *pBase, SSIZE_T count) : CQuickSort<UINT64>(pBase, count)
+        {
+            LIMITED_METHOD_CONTRACT;
+        }
+
+        int Compare(UINT64 *first, UINT64 *second)
+        {
+            LIMITED_METHOD_CONTRACT;
+            if (*first < *second)
+            {
+                return -1;
+            }
+            return *first > *second ? 1 : 0;
+        }
+    };
+
+    UINT64 GetPromotionProfileKey(MethodDesc *pMethodDesc)
+    {
+        WRAPPER_NO_CONTRACT;
+        _ASSERTE(!pMethodDesc->IsNoMetadata());
+
+        UINT64 moduleNameHash = HashStringA(pMethodDesc->GetModule()->GetSimpleName());
+        return (moduleNameHash << 32) | pMethodDesc->GetMemberDef();
+    }
+}
+
+// Reads the promotion profile recorded by a previous run, if one is configured and exists. Called once
+// during startup while the runtime is still single-threaded, everything here is best-effort.
+void TieredCompilationManager::TryLoadPromotionProfile()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(s_promotionProfilePath == nullptr);
+
+    LPWSTR path = nullptr;
+    if (FAILED(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_PromotionProfilePath, &path)) || path == nullptr)
+    {
+        return;
+    }
+
+    s_promotionProfilePath = path;
+
+    FileHandleHolder file = WszCreateFile(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        // No profile yet, this run will record one
+        return;
+    }
+
+    PromotionProfileHeader header;
+    DWORD bytesRead;
+    if (!ReadFile(file, &header, sizeof(header), &bytesRead, NULL) ||
+        bytesRead != sizeof(header) ||
+        header.m_magic != PromotionProfileMagic ||
+        header.m_version != PromotionProfileVersion ||
+        header.m_count == 0 ||
+        header.m_count > PromotionProfileMaxCount)
+    {
+        return;
+    }
+
+    NewArrayHolder<UINT64> keys = new (nothrow) UINT64[header.m_count];
+    if (keys == nullptr)
+    {
+        return;
+    }
+
+    DWORD byteCount = header.m_count * (DWORD)sizeof(UINT64);
+    if (!ReadFile(file, keys, byteCount, &bytesRead, NULL) || bytesRead != byteCount)
+    {
+        return;
+    }
+
+    // Sort the keys so that lookups can binary search. The file is written in recording order.
+    PromotionProfileKeySorter sorter(keys, header.m_count);
+    sorter.Sort();
+
+    s_promotionProfileKeys = keys.Extract();
+    s_promotionProfileKeyCount = header.m_count;
+
+    STRESS_LOG1(LF_TIEREDCOMPILATION, LL_INFO10, "TieredCompilationManager::TryLoadPromotionProfile: "
+        "Loaded %u promoted methods\n", header.m_count);
+}
+
+bool TieredCompilationManager::IsKeyInLoadedPromotionProfile(UINT64 key)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    UINT64 *keys = s_promotionProfileKeys;
+    UINT32 low = 0;
+    UINT32 high = s_promotionProfileKeyCount;
+    while (low < high)
+    {
+        UINT32 mid = low + (high - low) / 2;
+        if (keys[mid] < key)
+        {
+            low = mid + 1;
+        }
+        else if (keys[mid] > key)
+        {
+            high = mid;
+        }
+        else
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TieredCompilationManager::IsMethodInPromotionProfile(MethodDesc *pMethodDesc)
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(s_promotionProfileKeyCount != 0);
+
+    if (pMethodDesc->IsNoMetadata())
+    {
+        return false;
+    }
+
+    return IsKeyInLoadedPromotionProfile(GetPromotionProfileKey(pMethodDesc));
+}
+
+// Records a method promoted to the final tier during this run. Runs on the background worker thread.
+// Methods seeded from a loaded profile skip call counting and don't come through here; they are carried
+// forward when the profile is written.
+void TieredCompilationManager::RecordPromotion(MethodDesc *pMethodDesc)
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(GetThread() == s_backgroundWorkerThread);
+
+    if (s_promotionProfilePath == nullptr || pMethodDesc->IsNoMetadata())
+    {
+        return;
+    }
+
+    UINT64 key = GetPromotionProfileKey(pMethodDesc);
+
+    EX_TRY
+    {
+        LockHolder tieredCompilationLockHolder;
+
+        if (s_recordedPromotions == nullptr)
+        {
+            s_recordedPromotions = new SArray<UINT64>();
+        }
+        s_recordedPromotions->Append(key);
+    }
+    EX_CATCH
+    {
+        // Profile recording is best-effort
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+}
+
+// Writes the union of the loaded profile and the promotions recorded during this run. Called once at
+// shutdown; everything here is best-effort.
+void TieredCompilationManager::WritePromotionProfile()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (s_promotionProfilePath == nullptr)
+    {
+        return;
+    }
+
+    SArray<UINT64> *recordedPromotions;
+    {
+        LockHolder tieredCompilationLockHolder;
+
+        recordedPromotions = s_recordedPromotions;
+        s_recordedPromotions = nullptr;
+    }
+
+    NewHolder<SArray<UINT64>> recordedPromotionsHolder = recordedPromotions;
+    COUNT_T recordedCount = recordedPromotions == nullptr ? 0 : recordedPromotions->GetCount();
+    if (recordedCount == 0)
+    {
+        // Nothing new was promoted, the existing profile (if any) is already up to date
+        return;
+    }
+
+    NewArrayHolder<UINT64> keys = new (nothrow) UINT64[(SIZE_T)s_promotionProfileKeyCount + recordedCount];
+    if (keys == nullptr)
+    {
+        return;
+    }
+
+    UINT32 totalCount = 0;
+    for (UINT32 i = 0; i < s_promotionProfileKeyCount; ++i)
+    {
+        keys[totalCount++] = s_promotionProfileKeys[i];
+    }
+
+    UINT64 *recorded = recordedPromotions->GetElements();
+    for (COUNT_T i = 0; i < recordedCount; ++i)
+    {
+        if (!IsKeyInLoadedPromotionProfile(recorded[i]))
+        {
+            keys[totalCount++] = recorded[i];
+        }
+    }
+
+    if (totalCount > PromotionProfileMaxCount)
+    {
+        totalCount = PromotionProfileMaxCount;
+    }
+
+    FileHandleHolder file =
+        WszCreateFile(s_promotionProfilePath, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    PromotionProfileHeader header;
+    header.m_magic = PromotionProfileMagic;
+    header.m_version = PromotionProfileVersion;
+    header.m_count = totalCount;
+
+    DWORD bytesWritten;
+    if (WriteFile(file, &header, sizeof(header), &bytesWritten, NULL) && bytesWritten == sizeof(header))
+    {
+        DWORD byteCount = totalCount * (DWORD)sizeof(UINT64);
+        WriteFile(file, keys, byteCount, &bytesWritten, NULL);
+    }
+
+    STRESS_LOG1(LF_TIEREDCOMPILATION, LL_INFO10, "TieredCompilationManager::WritePromotionProfile: "
+        "Wrote %u promoted methods\n", totalCount);
+}
+
 //static
 CORJIT_FLAGS TieredCompilationManager::GetJitFlags(PrepareCodeConfig *config)
 {
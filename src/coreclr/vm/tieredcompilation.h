@@ -69,15 +69,28 @@ private:
 public:
     void AsyncCompleteCallCounting();
 
+#ifndef DACCESS_COMPILE
+    // Cross-run promotion profile: when TC_PromotionProfilePath is configured, the set of methods promoted
+    // to the final tier is persisted at shutdown, and a later run of the same binaries pre-seeds those
+    // methods at tier 1 so they skip tier 0 entirely.
+public:
+    static void TryLoadPromotionProfile();
+    static void WritePromotionProfile();
+private:
+    static bool IsMethodInPromotionProfile(MethodDesc* pMethodDesc);
+    static bool IsKeyInLoadedPromotionProfile(UINT64 key);
+    static void RecordPromotion(MethodDesc* pMethodDesc);
+#endif // !DACCESS_COMPILE
+
 private:
     static DWORD StaticBackgroundWorkCallback(void* args);
     bool DoBackgroundWork(UINT64 *workDurationTicksRef, UINT64 minWorkDurationTicks, UINT64 maxWorkDurationTicks);
 
 private:
-    void OptimizeMethod(NativeCodeVersion nativeCodeVersion);
+    void PrioritizeMethodsToOptimize();
     NativeCodeVersion GetNextMethodToOptimize();
     BOOL CompileCodeVersion(NativeCodeVersion nativeCodeVersion);
-    void ActivateCodeVersion(NativeCodeVersion nativeCodeVersion);
+    void ActivateCodeVersions(NativeCodeVersion* nativeCodeVersions, UINT32 count);
 
 #ifndef DACCESS_COMPILE
 public:
@@ -119,6 +132,11 @@ private:
     static CLREvent s_backgroundWorkAvailableEvent;
     static bool s_isBackgroundWorkerRunning;
     static bool s_isBackgroundWorkerProcessingWork;
+
+    static LPWSTR s_promotionProfilePath;
+    static UINT64* s_promotionProfileKeys;      // sorted keys loaded from the profile file
+    static UINT32 s_promotionProfileKeyCount;
+    static SArray<UINT64>* s_recordedPromotions; // methods promoted during this run, guarded by s_lock
 #endif // !DACCESS_COMPILE
 
 private:
@@ -36,7 +36,17 @@ EETypeHashTable *EETypeHashTable::Create(LoaderAllocator* pAllocator, Module *pM
     LoaderHeap *pHeap = pAllocator->GetLowFrequencyHeap();
     EETypeHashTable *pThis = (EETypeHashTable*)pamTracker->Track(pHeap->AllocMem((S_SIZE_T)sizeof(EETypeHashTable)));
 
-    new (pThis) EETypeHashTable(pModule, pHeap, dwNumBuckets);
+    new (pThis) EETypeHashTable();
+
+    // Spread the requested bucket count across the shards; each shard grows
+    // independently once its own load factor is exceeded.
+    DWORD dwShardBuckets = max(dwNumBuckets / AVAILABLE_TYPES_SHARDS, (DWORD)1);
+
+    for (DWORD i = 0; i < AVAILABLE_TYPES_SHARDS; i++)
+    {
+        EETypeHashShard *pShard = (EETypeHashShard*)pamTracker->Track(pHeap->AllocMem((S_SIZE_T)sizeof(EETypeHashShard)));
+        pThis->m_pShards[i] = new (pShard) EETypeHashShard(pModule, pHeap, dwShardBuckets);
+    }
 
 #ifdef _DEBUG
     pThis->InitUnseal();
@@ -57,8 +67,8 @@ LoaderAllocator *EETypeHashTable::GetLoaderAllocator()
     }
     else
     {
-        _ASSERTE(m_pModule != NULL);
-        return GetModule()->GetLoaderAllocator();
+        _ASSERTE(m_pShards[0]->GetModule() != NULL);
+        return m_pShards[0]->GetModule()->GetLoaderAllocator();
     }
 }
 
@@ -88,6 +98,7 @@ void EETypeHashTable::Iterator::Init()
         m_pTable->Seal(); // The table cannot be changing while it is being iterated
 #endif
 
+    m_dwShard = 0;
     m_fIterating = false;
 }
 
@@ -121,19 +132,34 @@ BOOL EETypeHashTable::FindNext(Iterator *it, EETypeHashEntry **ppEntry)
 
     if (!it->m_fIterating)
     {
-        BaseInitIterator(&it->m_sIterator);
+        it->m_dwShard = 0;
+        m_pShards[0]->BaseInitIterator(&it->m_sIterator);
         it->m_fIterating = true;
     }
 
-    *ppEntry = it->m_sIterator.Next();
-    return *ppEntry ? TRUE : FALSE;
+    // Walk the current shard to exhaustion, then move on to the next one.
+    while ((*ppEntry = it->m_sIterator.Next()) == NULL)
+    {
+        if (++it->m_dwShard == AVAILABLE_TYPES_SHARDS)
+            return FALSE;
+
+        m_pShards[it->m_dwShard]->BaseInitIterator(&it->m_sIterator);
+    }
+
+    return TRUE;
 }
 
 DWORD EETypeHashTable::GetCount()
 {
     LIMITED_METHOD_CONTRACT;
 
-    return BaseGetElementCount();
+    DWORD dwCount = 0;
+    for (DWORD i = 0; i < AVAILABLE_TYPES_SHARDS; i++)
+    {
+        dwCount += m_pShards[i]->BaseGetElementCount();
+    }
+
+    return dwCount;
 }
 
 static DWORD HashTypeHandle(TypeHandle t);
@@ -265,7 +291,7 @@ DWORD HashTypeKey(TypeKey* pKey)
     }
 }
 
-// Look up a value in the hash table
+// Look up a value in a shard of the hash table
 //
 // The logic is subtle: type handles in the hash table may not be
 // restored, but we need to compare components of the types (rank and
@@ -275,7 +301,7 @@ DWORD HashTypeKey(TypeKey* pKey)
 // We avoid restoring types during search by cracking the signature
 // encoding used by the zapper for out-of-module types e.g. in the
 // instantiation of an instantiated type.
-EETypeHashEntry_t *EETypeHashTable::FindItem(TypeKey* pKey)
+EETypeHashEntry_t *EETypeHashShard::FindItem(TypeKey* pKey, DWORD dwHash)
 {
     CONTRACTL
     {
@@ -290,7 +316,6 @@ EETypeHashEntry_t *EETypeHashTable::FindItem(TypeKey* pKey)
 
     EETypeHashEntry_t *  result = NULL;
 
-    DWORD           dwHash = HashTypeKey(pKey);
     EETypeHashEntry_t * pSearch;
     CorElementType kind = pKey->GetKind();
     LookupContext sContext;
@@ -380,7 +405,7 @@ EETypeHashEntry_t *EETypeHashTable::FindItem(TypeKey* pKey)
     return result;
 }
 
-BOOL EETypeHashTable::CompareInstantiatedType(TypeHandle t, Module *pModule, mdTypeDef token, Instantiation inst)
+BOOL EETypeHashShard::CompareInstantiatedType(TypeHandle t, Module *pModule, mdTypeDef token, Instantiation inst)
 {
     CONTRACTL
     {
@@ -436,7 +461,7 @@ BOOL EETypeHashTable::CompareInstantiatedType(TypeHandle t, Module *pModule, mdT
     return TRUE;
 }
 
-BOOL EETypeHashTable::CompareFnPtrType(TypeHandle t, BYTE callConv, DWORD numArgs, TypeHandle *retAndArgTypes)
+BOOL EETypeHashShard::CompareFnPtrType(TypeHandle t, BYTE callConv, DWORD numArgs, TypeHandle *retAndArgTypes)
 {
     CONTRACTL
     {
@@ -489,7 +514,8 @@ TypeHandle EETypeHashTable::GetValue(TypeKey *pKey)
     }
     CONTRACTL_END;
 
-    EETypeHashEntry_t *pItem = FindItem(pKey);
+    DWORD dwHash = HashTypeKey(pKey);
+    EETypeHashEntry_t *pItem = m_pShards[GetShardIndex(dwHash)]->FindItem(pKey, dwHash);
 
     if (pItem)
     {
@@ -529,21 +555,40 @@ VOID EETypeHashTable::InsertValue(TypeHandle data)
         PRECONDITION(CheckPointer(data));
         PRECONDITION(!data.IsGenericTypeDefinition()); // Generic type defs live in typedef table (availableClasses)
         PRECONDITION(data.HasInstantiation() || data.HasTypeParam() || data.IsFnPtrType()); // It's an instantiated type or an array/ptr/byref type
-        PRECONDITION(m_pModule == NULL || GetModule()->IsTenured()); // Destruct won't destruct m_pAvailableParamTypes for non-tenured modules - so make sure no one tries to insert one before the Module has been tenured
+        PRECONDITION(m_pShards[0]->GetModule() == NULL || m_pShards[0]->GetModule()->IsTenured()); // Destruct won't destruct m_pAvailableParamTypes for non-tenured modules - so make sure no one tries to insert one before the Module has been tenured
     }
     CONTRACTL_END
 
-    EETypeHashEntry_t * pNewEntry = (EETypeHashEntry_t*)BaseAllocateEntry(NULL);
+    DWORD dwHash = HashTypeHandle(data);
+    EETypeHashShard *pShard = m_pShards[GetShardIndex(dwHash)];
+
+    EETypeHashEntry_t * pNewEntry = (EETypeHashEntry_t*)pShard->BaseAllocateEntry(NULL);
 
     pNewEntry->SetTypeHandle(data);
 
-    BaseInsertEntry(HashTypeHandle(data), pNewEntry);
+    pShard->BaseInsertEntry(dwHash, pNewEntry);
 }
 
 #endif // #ifndef DACCESS_COMPILE
 
 #ifdef DACCESS_COMPILE
-void EETypeHashTable::EnumMemoryRegionsForEntry(EETypeHashEntry_t *pEntry, CLRDataEnumMemoryFlags flags)
+
+void EETypeHashTable::EnumMemoryRegions(CLRDataEnumMemoryFlags flags)
+{
+    SUPPORTS_DAC;
+
+    DacEnumMemoryRegion(dac_cast<TADDR>(this), sizeof(EETypeHashTable));
+
+    for (DWORD i = 0; i < AVAILABLE_TYPES_SHARDS; i++)
+    {
+        if (m_pShards[i].IsValid())
+        {
+            m_pShards[i]->EnumMemoryRegions(flags);
+        }
+    }
+}
+
+void EETypeHashShard::EnumMemoryRegionsForEntry(EETypeHashEntry_t *pEntry, CLRDataEnumMemoryFlags flags)
 {
     SUPPORTS_DAC;
 
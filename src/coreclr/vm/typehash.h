@@ -11,6 +11,8 @@
 
 #include "dacenumerablehash.h"
 
+class TypeKey;
+
 //========================================================================================
 // This hash table is used by class loaders to look up constructed types:
 // arrays, pointers and instantiations of user-defined generic types.
@@ -24,10 +26,23 @@
 // - for an instantiated type, the typedef module, typedef token, and instantiation
 // - for an array/pointer type, the CorElementType, rank, and type parameter
 //
+// The table is split into independently growable shards selected by the top bits
+// of the type key hash. Lookups are lock-free (see the synchronization notes on
+// DacEnumerableHash); writers serialize per shard on the matching lock in
+// ClassLoader::m_AvailableParamTypesLocks, so threads publishing constructed
+// types that hash to different shards do not contend with each other.
+//
 //========================================================================================
 
 DWORD HashTypeKey(TypeKey* pKey);
 
+// Number of shards in each EETypeHashTable (and of the writer locks in
+// ClassLoader that mirror them). A shard is selected by the top bits of the
+// type key hash; the bits used for bucket selection within a shard are
+// independent of these.
+#define AVAILABLE_TYPES_SHARD_BITS 4
+#define AVAILABLE_TYPES_SHARDS     (1 << AVAILABLE_TYPES_SHARD_BITS)
+
 // One of these is present for each element in the table
 // It simply chains together (hash,data) pairs
 typedef DPTR(struct EETypeHashEntry) PTR_EETypeHashEntry;
@@ -57,9 +72,33 @@ private:
 } EETypeHashEntry_t;
 
 
+// A single shard of the type hash table. Each shard is a self-contained
+// DacEnumerableHash with its own bucket list and growth policy; all access
+// goes through the owning EETypeHashTable below.
+typedef DPTR(class EETypeHashShard) PTR_EETypeHashShard;
+class EETypeHashShard : public DacEnumerableHashTable<EETypeHashShard, EETypeHashEntry, 2>
+{
+    friend class EETypeHashTable;
+
+#ifndef DACCESS_COMPILE
+    EETypeHashShard(Module *pModule, LoaderHeap *pHeap, DWORD cInitialBuckets) :
+        DacEnumerableHashTable<EETypeHashShard, EETypeHashEntry, 2>(pModule, pHeap, cInitialBuckets) {}
+#endif
+
+public:
+#ifdef DACCESS_COMPILE
+    void EnumMemoryRegionsForEntry(EETypeHashEntry_t *pEntry, CLRDataEnumMemoryFlags flags);
+#endif
+
+private:
+    EETypeHashEntry_t * FindItem(TypeKey* pKey, DWORD dwHash);
+    BOOL CompareInstantiatedType(TypeHandle t, Module *pModule, mdTypeDef token, Instantiation inst);
+    BOOL CompareFnPtrType(TypeHandle t, BYTE callConv, DWORD numArgs, TypeHandle *retAndArgTypes);
+};
+
 // The type hash table itself
 typedef DPTR(class EETypeHashTable) PTR_EETypeHashTable;
-class EETypeHashTable : public DacEnumerableHashTable<EETypeHashTable, EETypeHashEntry, 2>
+class EETypeHashTable
 {
 
 public:
@@ -79,23 +118,32 @@ public:
 
 private:
 #ifndef DACCESS_COMPILE
-    EETypeHashTable();
+    EETypeHashTable() {}
     ~EETypeHashTable();
 #endif
 public:
     static EETypeHashTable *Create(LoaderAllocator *pAllocator, Module *pModule, DWORD dwNumBuckets, AllocMemTracker *pamTracker);
 
-private:
+    // Returns the shard (and matching ClassLoader lock) index for a type key
+    // hash. Kept in one place so the table and the lock selection in
+    // ClassLoader::GetAvailableParamTypesLock can never disagree.
+    static DWORD GetShardIndex(DWORD dwHash)
+    {
+        LIMITED_METHOD_DAC_CONTRACT;
+        return dwHash >> (32 - AVAILABLE_TYPES_SHARD_BITS);
+    }
 
-#ifndef DACCESS_COMPILE
-    EETypeHashTable(Module *pModule, LoaderHeap *pHeap, DWORD cInitialBuckets) :
-        DacEnumerableHashTable<EETypeHashTable, EETypeHashEntry, 2>(pModule, pHeap, cInitialBuckets) {}
-#endif
+private:
     void               operator delete(void *p);
 
+    // The shards, each allocated from the owning loader heap at creation time.
+    PTR_EETypeHashShard m_pShards[AVAILABLE_TYPES_SHARDS];
+
 public:
     // Insert a value in the hash table, key implicit in data
-    // Value must not be present in the table already
+    // Value must not be present in the table already. The caller must hold the
+    // ClassLoader shard lock matching the key's hash (writers to a given shard
+    // must be serialized; readers take no lock).
     VOID InsertValue(TypeHandle data);
 
     // Look up a value in the hash table, key explicit in pKey
@@ -121,7 +169,8 @@ public:
         void Init();
 
         EETypeHashTable    *m_pTable;
-        BaseIterator        m_sIterator;
+        EETypeHashShard::BaseIterator m_sIterator;
+        DWORD               m_dwShard;
         bool                m_fIterating;
     };
 
@@ -130,16 +179,11 @@ public:
     DWORD GetCount();
 
 #ifdef DACCESS_COMPILE
-    void EnumMemoryRegionsForEntry(EETypeHashEntry_t *pEntry, CLRDataEnumMemoryFlags flags);
+    void EnumMemoryRegions(CLRDataEnumMemoryFlags flags);
 #endif
 
 private:
-    EETypeHashEntry_t * FindItem(TypeKey* pKey);
-    BOOL CompareInstantiatedType(TypeHandle t, Module *pModule, mdTypeDef token, Instantiation inst);
-    BOOL CompareFnPtrType(TypeHandle t, BYTE callConv, DWORD numArgs, TypeHandle *retAndArgTypes);
-    BOOL GrowHashTable();
     LoaderAllocator* GetLoaderAllocator();
 };
 
 #endif /* _TYPE_HASH_H */
-
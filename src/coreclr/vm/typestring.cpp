@@ -686,6 +686,162 @@ void TypeString::AppendType(SString& ss, TypeHandle ty, DWORD format)
     RETURN;
 }
 
+#ifndef DACCESS_COMPILE
+
+//
+// Formatted type name cache
+//
+// Exception construction and diagnostic logging tend to format the same closed
+// types over and over, and formatting a generic type walks its whole
+// instantiation. Keep a small direct-mapped cache of (TypeHandle, format) ->
+// formatted name so that repeat requests become a lookup and a copy. Entries
+// live for the process lifetime, so types from collectible assemblies are
+// never cached - an entry can then never outlive its LoaderAllocator.
+//
+
+struct CachedTypeName
+{
+    TADDR   th;
+    DWORD   format;
+    WCHAR*  name;       // null terminated, owned by the cache
+};
+
+static const unsigned TYPE_NAME_CACHE_SIZE = 64;            // direct mapped, must be a power of two
+static const COUNT_T  TYPE_NAME_CACHE_MAX_LENGTH = 1024;    // don't keep pathological names alive
+
+static CachedTypeName s_typeNameCache[TYPE_NAME_CACHE_SIZE];
+static LONG s_typeNameCacheLock = 0;
+
+#ifdef _DEBUG
+static unsigned s_typeNameCacheHits = 0;
+static unsigned s_typeNameCacheMisses = 0;
+#endif
+
+static unsigned TypeNameCacheIndex(TypeHandle ty, DWORD format)
+{
+    LIMITED_METHOD_CONTRACT;
+    return (unsigned)(((ty.AsTAddr() >> 3) ^ format) & (TYPE_NAME_CACHE_SIZE - 1));
+}
+
+static bool IsTypeNameCacheable(TypeHandle ty)
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (ty.IsNull())
+        return false;
+
+    LoaderAllocator* pLoaderAllocator = ty.GetLoaderAllocator();
+    return (pLoaderAllocator != NULL) && !pLoaderAllocator->IsCollectible();
+}
+
+// The lock only guards short copies - never allocate, log or call out while
+// holding it.
+static void AcquireTypeNameCacheLock()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    while (InterlockedCompareExchange(&s_typeNameCacheLock, 1, 0) != 0)
+    {
+        YieldProcessor();
+    }
+}
+
+static void ReleaseTypeNameCacheLock()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    InterlockedExchange(&s_typeNameCacheLock, 0);
+}
+
+// Appends the cached name for (ty, format) to ss and returns true on a hit.
+static bool TryAppendCachedTypeName(SString& ss, TypeHandle ty, DWORD format)
+{
+    CONTRACTL
+    {
+        THROWS;         // SString::Append
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!IsTypeNameCacheable(ty))
+        return false;
+
+    WCHAR buffer[TYPE_NAME_CACHE_MAX_LENGTH + 1];
+    bool hit = false;
+
+    AcquireTypeNameCacheLock();
+
+    CachedTypeName* pEntry = &s_typeNameCache[TypeNameCacheIndex(ty, format)];
+    if (pEntry->name != NULL && pEntry->th == ty.AsTAddr() && pEntry->format == format)
+    {
+        wcscpy_s(buffer, ARRAY_SIZE(buffer), pEntry->name);
+        hit = true;
+    }
+
+#ifdef _DEBUG
+    if (hit)
+        s_typeNameCacheHits++;
+    else
+        s_typeNameCacheMisses++;
+#endif
+
+    ReleaseTypeNameCacheLock();
+
+#ifdef _DEBUG
+    if (((s_typeNameCacheHits + s_typeNameCacheMisses) & 0x3FF) == 0)
+    {
+        LOG((LF_CLASSLOADER, LL_INFO10000, "TypeString: formatted name cache: %u hits, %u misses\n",
+            s_typeNameCacheHits, s_typeNameCacheMisses));
+    }
+#endif
+
+    if (hit)
+        ss.Append(buffer);
+
+    return hit;
+}
+
+// Publishes the formatted name for (ty, format). Failure to cache is not
+// interesting - the caller already has the name.
+static void InsertCachedTypeName(TypeHandle ty, DWORD format, const WCHAR* pName, COUNT_T length)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!IsTypeNameCacheable(ty))
+        return;
+
+    if (length == 0 || length > TYPE_NAME_CACHE_MAX_LENGTH)
+        return;
+
+    WCHAR* pNewName = new (nothrow) WCHAR[length + 1];
+    if (pNewName == NULL)
+        return;
+
+    memcpy(pNewName, pName, length * sizeof(WCHAR));
+    pNewName[length] = W('\0');
+
+    AcquireTypeNameCacheLock();
+
+    CachedTypeName* pEntry = &s_typeNameCache[TypeNameCacheIndex(ty, format)];
+    WCHAR* pOldName = pEntry->name;
+    pEntry->th = ty.AsTAddr();
+    pEntry->format = format;
+    pEntry->name = pNewName;
+
+    ReleaseTypeNameCacheLock();
+
+    delete [] pOldName;
+}
+
+#endif // !DACCESS_COMPILE
+
 void TypeString::AppendType(SString& ss, TypeHandle ty, Instantiation typeInstantiation, DWORD format)
 {
     CONTRACT_VOID
@@ -696,6 +852,27 @@ void TypeString::AppendType(SString& ss, TypeHandle ty, Instantiation typeInstan
     }
     CONTRACT_END
 
+#ifndef DACCESS_COMPILE
+    if (typeInstantiation.IsEmpty())
+    {
+        if (TryAppendCachedTypeName(ss, ty, format))
+            RETURN;
+
+        StackSString name;
+        {
+            TypeNameBuilder tnb(&name);
+            if ((format & FormatAngleBrackets) != 0)
+                tnb.SetUseAngleBracketsForGenerics(TRUE);
+            AppendType(tnb, ty, typeInstantiation, format);
+        }
+
+        InsertCachedTypeName(ty, format, name.GetUnicode(), name.GetCount());
+        ss.Append(name);
+
+        RETURN;
+    }
+#endif // !DACCESS_COMPILE
+
     {
         TypeNameBuilder tnb(&ss);
         if ((format & FormatAngleBrackets) != 0)
@@ -71,6 +71,7 @@ UINT32 g_chained_lookup_external_call_counter = 0;   //# of hits in an external
 UINT32 g_chained_lookup_external_miss_counter = 0;   //# of misses in an external chained lookup
 
 UINT32 g_chained_entry_promoted = 0;    //# of times a cache entry is promoted to the start of the chain
+UINT32 g_chained_entry_evicted = 0;     //# of times a cache entry is dropped from the tail of an overlong chain
 
 UINT32 g_bucket_space = 0;              //# of bytes in caches and tables, not including the stubs themselves
 UINT32 g_bucket_space_dead = 0;         //# of bytes of abandoned buckets not yet recycled
@@ -306,6 +307,21 @@ void VirtualCallStubManager::LoggingDump()
 #endif // STUB_LOGGING
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "chained_entry_promoted", g_chained_entry_promoted);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "chained_entry_evicted", g_chained_entry_evicted);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+
+        // chain depth histogram - buckets with deep chains indicate megamorphic call sites
+        sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), "\r\nchain depth histogram\r\n");
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+
+        size_t chainDepthCounts[CALL_STUB_CACHE_MAX_CHAIN + 1];
+        g_resolveCache->GetChainDepthHistogram(chainDepthCounts, ARRAY_SIZE(chainDepthCounts));
+        for (size_t depth = 0; depth < ARRAY_SIZE(chainDepthCounts); depth++)
+        {
+            sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), "\tdepth %s%zu %30zu\r\n",
+                    (depth == ARRAY_SIZE(chainDepthCounts) - 1) ? ">=" : "  ", depth, chainDepthCounts[depth]);
+            WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        }
 #endif // CHAIN_LOOKUP
 
 #ifdef STUB_LOGGING
@@ -3464,6 +3480,23 @@ BOOL DispatchCache::Insert(ResolveCacheElem* elem, InsertKind insertKind)
 #endif // !CHAIN_LOOKUP
         SetCacheEntry(idx, elem);
         stats.insert_cache_write++;
+
+#ifdef CHAIN_LOOKUP
+        // Bound the chain at CALL_STUB_CACHE_MAX_CHAIN entries so that a
+        // megamorphic bucket does not degrade every lookup into a long
+        // linear walk. PromoteChainEntry keeps the hot entries at the front,
+        // so the tail holds the least recently hit ones. The dropped entry
+        // stays allocated and is re-inserted if its tuple misses again.
+        ResolveCacheElem* pLast = elem;
+        for (UINT32 depth = 1; (depth < CALL_STUB_CACHE_MAX_CHAIN) && (pLast->Next() != empty); depth++)
+            pLast = pLast->pNext;
+
+        if (pLast->Next() != empty)
+        {
+            pLast->pNext = empty;
+            g_chained_entry_evicted++;
+        }
+#endif // CHAIN_LOOKUP
     }
 
     LOG((LF_STUBS, LL_INFO1000, "%8s Insert(token" FMT_ADDR "MethodTable" FMT_ADDR ") at [%03x] %7s %5s \n",
@@ -3518,11 +3551,25 @@ void DispatchCache::PromoteChainEntry(ResolveCacheElem* elem)
         return;
     }
 
+    // The bucket may have been cleared or the element evicted from the
+    // chain since the lookup that found it.
+    if (curElem == empty)
+    {
+        return;
+    }
+
     // Now loop through the chain to find the element that is
     // point to the element we're promoting so we can remove
     // it from the chain.
     while (curElem->Next() != elem)
     {
+        if (curElem->Next() == empty)
+        {
+            // The element was dropped from the tail of the chain by a
+            // concurrent insert after we looked it up. It will be
+            // re-inserted on a later miss, nothing to promote.
+            return;
+        }
         curElem = curElem->pNext;
         CONSISTENCY_CHECK(curElem != NULL);
     }
@@ -843,6 +843,11 @@ extern UINT32 STUB_COLLIDE_MONO_PCT;
 #define CALL_STUB_CACHE_NUM_BITS 12 //10
 #define CALL_STUB_CACHE_SIZE 4096 //1024
 #define CALL_STUB_CACHE_MASK (CALL_STUB_CACHE_SIZE-1)
+// Maximum number of entries kept in one chain of the resolve cache.
+// Megamorphic call sites would otherwise grow unbounded chains, and every
+// VSD_ResolveWorker fallback pays for the linear walk. Entries dropped from
+// the tail are simply re-inserted on a later miss.
+#define CALL_STUB_CACHE_MAX_CHAIN 8
 #define CALL_STUB_CACHE_PROBES 5
 //min sizes for BucketTable and buckets and the growth and hashing constants
 #define CALL_STUB_MIN_BUCKETS 32
@@ -1159,6 +1164,23 @@ public:
         *used = count;
     }
 
+    // Histogram of chain depths, a proxy for the degree of polymorphism of the
+    // call sites hashing into each bucket. counts[i] is the number of buckets
+    // with a chain of exactly i entries; the last slot accumulates deeper chains.
+    inline void GetChainDepthHistogram(size_t *counts, size_t numCounts)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        memset(counts, 0, numCounts * sizeof(size_t));
+        for (size_t i = 0; i < CALL_STUB_CACHE_SIZE; i++)
+        {
+            size_t depth = 0;
+            for (ResolveCacheElem* pCurElem = cache[i]; pCurElem != empty; pCurElem = pCurElem->Next())
+                depth++;
+            counts[min(depth, numCounts - 1)]++;
+        }
+    }
+
     inline void *GetCacheBaseAddr()
         { LIMITED_METHOD_CONTRACT; return &cache[0]; }
     inline size_t GetCacheCount()
@@ -225,6 +225,37 @@ ds_rt_set_environment_variable (const ep_char16_t *name, const ep_char16_t *valu
 	return success ? DS_IPC_S_OK : DS_IPC_E_FAIL;
 }
 
+/*
+* Heap snapshot
+*/
+
+static
+inline
+ds_ipc_result_t
+ds_rt_create_heap_snapshot (
+	const ep_char16_t *snapshotName,
+	uint32_t flags,
+	ep_char8_t *errorMessageBuffer,
+	int32_t cbErrorMessageBuffer)
+{
+	// TODO: Implement.
+	return DS_IPC_E_NOTSUPPORTED;
+}
+
+/*
+* Runtime lock statistics
+*/
+
+static
+inline
+ds_ipc_result_t
+ds_rt_runtime_lock_stats_get (
+	uint8_t **buffer,
+	uint32_t *buffer_len)
+{
+	return DS_IPC_E_NOTSUPPORTED;
+}
+
 /*
 * DiagnosticServer.
 */
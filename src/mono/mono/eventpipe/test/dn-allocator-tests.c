@@ -0,0 +1,209 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+#define _CRTDBG_MAP_ALLOC
+#include <stdlib.h>
+#include <crtdbg.h>
+#endif
+
+#include <eglib/test/test.h>
+#include <containers/dn-allocator.h>
+#include <containers/dn-vector.h>
+
+#ifdef _CRTDBG_MAP_ALLOC
+static _CrtMemState dn_allocator_memory_start_snapshot;
+static _CrtMemState dn_allocator_memory_end_snapshot;
+static _CrtMemState dn_allocator_memory_diff_snapshot;
+#endif
+
+static
+RESULT
+test_allocator_setup (void)
+{
+#ifdef _CRTDBG_MAP_ALLOC
+	_CrtMemCheckpoint (&dn_allocator_memory_start_snapshot);
+#endif
+	return OK;
+}
+
+static
+RESULT
+test_allocator_arena_alloc (void)
+{
+	dn_allocator_arena_t arena;
+
+	if (!dn_allocator_arena_init (&arena, 256))
+		return FAILED ("init arena");
+
+	uint8_t *ptr = (uint8_t *)dn_allocator_alloc ((dn_allocator_t *)&arena, 64);
+	if (!ptr)
+		return FAILED ("arena alloc failed");
+
+	memset (ptr, 0xaa, 64);
+
+	if (dn_allocator_arena_used_bytes (&arena) == 0)
+		return FAILED ("used bytes not accounted");
+	if (dn_allocator_arena_reserved_bytes (&arena) < 64)
+		return FAILED ("reserved bytes not accounted");
+
+	dn_allocator_arena_dispose (&arena);
+
+	return OK;
+}
+
+static
+RESULT
+test_allocator_arena_chaining (void)
+{
+	dn_allocator_arena_t arena;
+
+	if (!dn_allocator_arena_init (&arena, 64))
+		return FAILED ("init arena");
+
+	// Force several chained blocks and verify allocations stay intact.
+	uint8_t *ptrs [100];
+	for (uint32_t i = 0; i < 100; i++) {
+		ptrs [i] = (uint8_t *)dn_allocator_alloc ((dn_allocator_t *)&arena, 32);
+		if (!ptrs [i])
+			return FAILED ("arena alloc failed");
+		memset (ptrs [i], (int)i, 32);
+	}
+
+	for (uint32_t i = 0; i < 100; i++) {
+		for (uint32_t j = 0; j < 32; j++) {
+			if (ptrs [i][j] != (uint8_t)i)
+				return FAILED ("allocation was overwritten");
+		}
+	}
+
+	if (dn_allocator_arena_reserved_bytes (&arena) < 100 * 32)
+		return FAILED ("reserved bytes didn't cover allocations");
+
+	dn_allocator_arena_dispose (&arena);
+
+	return OK;
+}
+
+static
+RESULT
+test_allocator_arena_realloc (void)
+{
+	dn_allocator_arena_t arena;
+
+	if (!dn_allocator_arena_init (&arena, 128))
+		return FAILED ("init arena");
+
+	uint8_t *ptr = (uint8_t *)dn_allocator_alloc ((dn_allocator_t *)&arena, 16);
+	if (!ptr)
+		return FAILED ("arena alloc failed");
+
+	memset (ptr, 0x5c, 16);
+
+	uint8_t *new_ptr = (uint8_t *)dn_allocator_realloc ((dn_allocator_t *)&arena, ptr, 512);
+	if (!new_ptr)
+		return FAILED ("arena realloc failed");
+
+	for (uint32_t i = 0; i < 16; i++) {
+		if (new_ptr [i] != 0x5c)
+			return FAILED ("realloc didn't preserve data");
+	}
+
+	dn_allocator_arena_dispose (&arena);
+
+	return OK;
+}
+
+static
+RESULT
+test_allocator_arena_reset (void)
+{
+	dn_allocator_arena_t arena;
+
+	if (!dn_allocator_arena_init (&arena, 64))
+		return FAILED ("init arena");
+
+	for (uint32_t i = 0; i < 100; i++) {
+		if (!dn_allocator_alloc ((dn_allocator_t *)&arena, 32))
+			return FAILED ("arena alloc failed");
+	}
+
+	size_t reserved = dn_allocator_arena_reserved_bytes (&arena);
+
+	dn_allocator_arena_reset (&arena);
+
+	if (dn_allocator_arena_used_bytes (&arena) != 0)
+		return FAILED ("reset didn't clear used bytes");
+	if (dn_allocator_arena_reserved_bytes (&arena) != reserved)
+		return FAILED ("reset released blocks");
+
+	// A second round of the same allocations must reuse the kept blocks.
+	for (uint32_t i = 0; i < 100; i++) {
+		if (!dn_allocator_alloc ((dn_allocator_t *)&arena, 32))
+			return FAILED ("arena alloc failed after reset");
+	}
+
+	if (dn_allocator_arena_reserved_bytes (&arena) != reserved)
+		return FAILED ("allocations after reset didn't reuse blocks");
+
+	dn_allocator_arena_dispose (&arena);
+
+	return OK;
+}
+
+static
+RESULT
+test_allocator_arena_vector (void)
+{
+	dn_allocator_arena_t arena;
+
+	if (!dn_allocator_arena_init (&arena, 128))
+		return FAILED ("init arena");
+
+	dn_vector_custom_alloc_params_t params = {0, };
+	params.allocator = (dn_allocator_t *)&arena;
+
+	dn_vector_t *vector = dn_vector_custom_alloc_t (&params, int32_t);
+	if (!vector)
+		return FAILED ("alloc vector from arena");
+
+	for (int32_t i = 0; i < 1000; i++)
+		dn_vector_push_back (vector, i);
+
+	for (int32_t i = 0; i < 1000; i++) {
+		if (*dn_vector_index_t (vector, int32_t, i) != i)
+			return FAILED ("vector value didn't match");
+	}
+
+	dn_vector_free (vector);
+	dn_allocator_arena_dispose (&arena);
+
+	return OK;
+}
+
+static
+RESULT
+test_allocator_teardown (void)
+{
+#ifdef _CRTDBG_MAP_ALLOC
+	_CrtMemCheckpoint (&dn_allocator_memory_end_snapshot);
+	if ( _CrtMemDifference(&dn_allocator_memory_diff_snapshot, &dn_allocator_memory_start_snapshot, &dn_allocator_memory_end_snapshot) ) {
+		_CrtMemDumpStatistics( &dn_allocator_memory_diff_snapshot );
+		return FAILED ("memory leak detected!");
+	}
+#endif
+	return OK;
+}
+
+static Test dn_allocator_tests [] = {
+	{"test_allocator_setup", test_allocator_setup},
+	{"test_allocator_arena_alloc", test_allocator_arena_alloc},
+	{"test_allocator_arena_chaining", test_allocator_arena_chaining},
+	{"test_allocator_arena_realloc", test_allocator_arena_realloc},
+	{"test_allocator_arena_reset", test_allocator_arena_reset},
+	{"test_allocator_arena_vector", test_allocator_arena_vector},
+	{"test_allocator_teardown", test_allocator_teardown},
+	{NULL, NULL}
+};
+
+DEFINE_TEST_GROUP_INIT(dn_allocator_tests_init, dn_allocator_tests)
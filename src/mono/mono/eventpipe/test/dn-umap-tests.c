@@ -569,9 +569,25 @@ test_umap_reserve (void)
 
 	dn_umap_reserve (map, 1000);
 
+	if (map->_internal._bucket_count < 1000)
+		return FAILED ("reserve didn't grow bucket array");
+
+	uint32_t bucket_count = map->_internal._bucket_count;
+
 	for (uint32_t i = 0; i < 1000; i++)
 		dn_umap_insert (map, INT32_TO_POINTER (i), INT32_TO_POINTER (i));
 
+	for (uint32_t i = 0; i < 1000; i++) {
+		dn_umap_it_t it = dn_umap_find (map, INT32_TO_POINTER (i));
+		if (dn_umap_it_end (it) || dn_umap_it_value_t (it, uint32_t) != i)
+			return FAILED ("value didn't match after reserve");
+	}
+
+	dn_umap_reserve (map, 10);
+
+	if (map->_internal._bucket_count != bucket_count)
+		return FAILED ("reserve shrunk bucket array");
+
 	dn_umap_free (map);
 
 	return OK;
@@ -1189,6 +1189,69 @@ test_vector_big (void)
 	return OK;
 }
 
+static
+uint32_t
+DN_CALLBACK_CALLTYPE
+test_vector_calc_capacity_func (uint32_t capacity)
+{
+	return capacity;
+}
+
+static
+RESULT
+test_vector_calc_capacity (void)
+{
+	dn_vector_t vector;
+	int32_t i;
+
+	dn_vector_custom_init_params_t params = {0,};
+	params.capacity = 2;
+	params.calc_capacity = test_vector_calc_capacity_func;
+
+	if (!dn_vector_custom_init_t (&vector, &params, int32_t))
+		return FAILED ("init vector");
+
+	for (i = 0; i < 100; i++)
+		dn_vector_push_back (&vector, i);
+
+	if (dn_vector_capacity (&vector) != 100)
+		return FAILED ("custom growth policy wasn't used");
+
+	for (i = 0; i < 100; i++)
+		if (*dn_vector_index_t (&vector, int32_t, i) != i)
+			return FAILED ("vector value didn't match");
+
+	dn_vector_dispose (&vector);
+
+	return OK;
+}
+
+static
+RESULT
+test_vector_inline_capacity (void)
+{
+	int32_t i;
+
+	DN_VECTOR_INLINE_CAPACITY_INIT (vector, int32_t, 16);
+
+	for (i = 0; i < 16; i++)
+		dn_vector_push_back (&vector, i);
+
+	if (vector.data < __vector_buffer_vector || vector.data >= __vector_buffer_vector + sizeof (__vector_buffer_vector))
+		return FAILED ("vector data didn't use inline storage");
+
+	for (i = 16; i < 100; i++)
+		dn_vector_push_back (&vector, i);
+
+	for (i = 0; i < 100; i++)
+		if (*dn_vector_index_t (&vector, int32_t, i) != i)
+			return FAILED ("vector value didn't match");
+
+	dn_vector_dispose (&vector);
+
+	return OK;
+}
+
 static
 RESULT
 test_vector_teardown (void)
@@ -1246,6 +1309,8 @@ static Test dn_vector_tests [] = {
 	{"test_vector_foreach_it", test_vector_foreach_it},
 	{"test_vector_foreach_rev_it", test_vector_foreach_rev_it},
 	{"test_vector_big", test_vector_big},
+	{"test_vector_calc_capacity", test_vector_calc_capacity},
+	{"test_vector_inline_capacity", test_vector_inline_capacity},
 	{"test_vector_teardown", test_vector_teardown},
 	{NULL, NULL}
 };
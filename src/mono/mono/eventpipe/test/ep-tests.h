@@ -4,6 +4,7 @@
 #include <eglib/test/test.h>
 
 // Container type tests.
+DEFINE_TEST_GROUP_INIT_H(dn_allocator_tests_init);
 DEFINE_TEST_GROUP_INIT_H(dn_vector_tests_init);
 DEFINE_TEST_GROUP_INIT_H(dn_vector_ptr_tests_init);
 DEFINE_TEST_GROUP_INIT_H(dn_fwd_list_tests_init);
@@ -27,6 +28,7 @@ DEFINE_TEST_GROUP_INIT_H(ep_teardown_tests_init);
 
 const
 static Group test_groups [] = {
+	{"allocator", dn_allocator_tests_init},
 	{"vector", dn_vector_tests_init},
 	{"ptr-vector", dn_vector_ptr_tests_init},
 	{"fwd_list", dn_fwd_list_tests_init},
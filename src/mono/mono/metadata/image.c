@@ -1399,6 +1399,11 @@ mono_image_storage_open (const char *fname)
 	if (!storage->raw_data) {
 		storage->fileio_used = TRUE;
 		storage->raw_data = (char *)mono_file_map_fileio (storage->raw_data_len, MONO_MMAP_READ|MONO_MMAP_PRIVATE, mono_file_map_fd (filed), 0, &storage->raw_data_handle);
+	} else {
+		/* The PE headers and metadata streams are read right after mapping; ask
+		 * the OS to read the image ahead instead of demand-faulting it one page
+		 * at a time, which adds up when many assemblies are opened on startup. */
+		mono_madvise_willneed (storage->raw_data, storage->raw_data_len);
 	}
 #endif
 	mono_file_map_close (filed);
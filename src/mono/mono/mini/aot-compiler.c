@@ -348,6 +348,8 @@ typedef struct MonoAotCompile {
 	MonoMemPool *mempool;
 	MonoAotStats stats;
 	int method_index;
+	/* Index of the next entry of 'methods' to compile, protected by 'mutex' */
+	guint next_compile_index;
 	char *static_linking_symbol;
 	mono_mutex_t mutex;
 	gboolean gas_line_numbers;
@@ -9738,13 +9740,29 @@ compile_method (MonoAotCompile *acfg, MonoMethod *method)
 static mono_thread_start_return_t WINAPI
 compile_thread_main (gpointer user_data)
 {
-	MonoAotCompile *acfg = ((MonoAotCompile **)user_data) [0];
-	GPtrArray *methods = ((GPtrArray **)user_data) [1];
+	MonoAotCompile *acfg = (MonoAotCompile *)user_data;
 
 	mono_thread_set_name_constant_ignore_error (mono_thread_internal_current (), "AOT compiler", MonoSetThreadNameFlag_Permanent);
 
-	for (guint i = 0; i < methods->len; ++i)
-		compile_method (acfg, (MonoMethod *)g_ptr_array_index (methods, i));
+	while (TRUE) {
+		MonoMethod *method;
+
+		/*
+		 * Pick up the next method under the lock: compile_method () can append newly
+		 * discovered methods to acfg->methods, and g_ptr_array_add () can reallocate
+		 * the array, so it cannot be indexed concurrently without the lock.
+		 */
+		mono_acfg_lock (acfg);
+		if (acfg->next_compile_index == acfg->methods->len) {
+			mono_acfg_unlock (acfg);
+			break;
+		}
+		method = (MonoMethod *)g_ptr_array_index (acfg->methods, acfg->next_compile_index);
+		acfg->next_compile_index ++;
+		mono_acfg_unlock (acfg);
+
+		compile_method (acfg, method);
+	}
 
 	return 0;
 }
@@ -11231,7 +11249,7 @@ mono_aot_get_array_helper_from_wrapper (MonoMethod *method)
 #if !defined(DISABLE_AOT) && !defined(DISABLE_JIT)
 
 typedef struct HashEntry {
-    guint32 key, value, index;
+    guint32 hash, key, value, index;
 	struct HashEntry *next;
 } HashEntry;
 
@@ -11312,7 +11330,8 @@ emit_extra_methods (MonoAotCompile *acfg)
 		key = info_offsets [i];
 		value = get_method_index (acfg, method);
 
-		hash = mono_aot_method_hash (method) % table_size;
+		guint32 hash_full = mono_aot_method_hash (method);
+		hash = hash_full % table_size;
 		//printf ("X: %s %x\n", mono_method_get_full_name (method), mono_aot_method_hash (method));
 
 		chain_lengths [hash] ++;
@@ -11320,6 +11339,7 @@ emit_extra_methods (MonoAotCompile *acfg)
 		max_method_index = MAX (max_method_index, value);
 
 		new_entry = (HashEntry *)mono_mempool_alloc0 (acfg->mempool, sizeof (HashEntry));
+		new_entry->hash = hash_full;
 		new_entry->key = key;
 		new_entry->value = value;
 
@@ -11340,17 +11360,20 @@ emit_extra_methods (MonoAotCompile *acfg)
 
 	//printf ("MAX: %d\n", max_chain_length);
 
+	/* Full hashes let the runtime skip decoding method refs for colliding entries */
+	int hash_len = 4;
 	int key_len = 4;
 	int value_len = max_method_index < 65536 ? 2 : 4;
 	int next_len = table->len < 65536 ? 2 : 4;
 
-	buf_size = table->len * 12 + 20;
+	buf_size = table->len * 16 + 24;
 	p = buf = (guint8 *)g_malloc (buf_size);
 	/* Hash size */
 	encode_int (table_size, p, &p);
 	/* Number of rows */
 	encode_int (table->len, p, &p);
 	/* Column sizes */
+	encode_int (hash_len, p, &p);
 	encode_int (key_len, p, &p);
 	encode_int (value_len, p, &p);
 	encode_int (next_len, p, &p);
@@ -11358,15 +11381,18 @@ emit_extra_methods (MonoAotCompile *acfg)
 	for (guint i = 0; i < table->len; ++i) {
 		entry = (HashEntry *)g_ptr_array_index (table, i);
 
+		guint32 hash_full = 0;
 		int key = 0;
 		int value = 0;
 		int next = 0;
 		if (entry != NULL) {
+			hash_full = entry->hash;
 			key = entry->key;
 			value = entry->value;
 			if (entry->next)
 				next = entry->next->index;
 		}
+		encode_uint_len (hash_full, hash_len, p, &p);
 		encode_uint_len (key, key_len, p, &p);
 		encode_uint_len (value, value_len, p, &p);
 		encode_uint_len (next, next_len, p, &p);
@@ -12929,65 +12955,41 @@ collect_methods (MonoAotCompile *acfg)
 static void
 compile_methods (MonoAotCompile *acfg)
 {
-	int methods_len;
-
-	if (acfg->aot_opts.nthreads > 0) {
-		GPtrArray *frag;
-		int len;
+	if (acfg->aot_opts.nthreads > 0 && acfg->methods->len > 0) {
 		GPtrArray *threads;
 		MonoThreadHandle *thread_handle;
-		gpointer *user_data;
-		MonoMethod **methods;
+		int nthreads;
 
-		methods_len = acfg->methods->len;
+		nthreads = MIN (acfg->aot_opts.nthreads, (int)acfg->methods->len);
 
-		len = acfg->methods->len / acfg->aot_opts.nthreads;
-		g_assert (len > 0);
 		/*
-		 * Partition the list of methods into fragments, and hand it to threads to
-		 * process.
+		 * The threads drain a shared work queue: each one picks up the next
+		 * unprocessed entry of acfg->methods, including the methods appended by
+		 * compile_method () while the threads are running. This balances the load
+		 * better than handing each thread a fixed fragment of the initial list,
+		 * since per-method compile times vary by orders of magnitude.
 		 */
 		threads = g_ptr_array_new ();
-		/* Make a copy since acfg->methods is modified by compile_method () */
-		methods = g_new0 (MonoMethod*, methods_len);
-		//memcpy (methods, g_ptr_array_index (acfg->methods, 0), sizeof (MonoMethod*) * methods_len);
-		for (int i = 0; i < methods_len; ++i)
-			methods [i] = (MonoMethod *)g_ptr_array_index (acfg->methods, i);
-		int idx = 0;
-		while (idx < methods_len) {
+		for (int i = 0; i < nthreads; ++i) {
 			ERROR_DECL (error);
 			MonoInternalThread *thread;
 
-			frag = g_ptr_array_new ();
-			for (int j = 0; j < len; ++j) {
-				if (idx < methods_len) {
-					g_ptr_array_add (frag, methods [idx]);
-					idx ++;
-				}
-			}
-
-			user_data = g_new0 (gpointer, 3);
-			user_data [0] = acfg;
-			user_data [1] = frag;
-
-			thread = mono_thread_create_internal ((MonoThreadStart)compile_thread_main, user_data, MONO_THREAD_CREATE_FLAGS_NONE, error);
+			thread = mono_thread_create_internal ((MonoThreadStart)compile_thread_main, acfg, MONO_THREAD_CREATE_FLAGS_NONE, error);
 			mono_error_assert_ok (error);
 
 			thread_handle = mono_threads_open_thread_handle (thread->handle);
 			g_ptr_array_add (threads, thread_handle);
 		}
-		g_free (methods);
 
 		for (guint i = 0; i < threads->len; ++i) {
 			mono_thread_info_wait_one_handle ((MonoThreadHandle*)g_ptr_array_index (threads, i), MONO_INFINITE_WAIT, FALSE);
 			mono_threads_close_thread_handle ((MonoThreadHandle*)g_ptr_array_index (threads, i));
 		}
-	} else {
-		methods_len = 0;
+		g_ptr_array_free (threads, TRUE);
 	}
 
-	/* Compile methods added by compile_method () or all methods if nthreads == 0 */
-	for (guint i = methods_len; i < acfg->methods->len; ++i) {
+	/* Compile any methods left over by the threads, or all methods if nthreads == 0 */
+	for (guint i = acfg->next_compile_index; i < acfg->methods->len; ++i) {
 		/* This can add new methods to acfg->methods */
 		compile_method (acfg, (MonoMethod *)g_ptr_array_index (acfg->methods, i));
 	}
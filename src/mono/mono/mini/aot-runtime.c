@@ -4449,29 +4449,44 @@ find_aot_method_in_amodule (MonoAotModule *code_amodule, MonoMethod *method, gui
 
 	table = code_amodule->extra_method_table;
 	guint32 hash_table_size = table [0];
-	int key_len = table [2];
-	int value_len = table [3];
-	int next_len = table [4];
-	int entry_size = key_len + value_len + next_len;
+	int hash_len = table [2];
+	int key_len = table [3];
+	int value_len = table [4];
+	int next_len = table [5];
+	int entry_size = hash_len + key_len + value_len + next_len;
 
 	hash = hash_full % hash_table_size;
 
-	guint8 *data = (guint8*)(table + 5);
+	guint8 *data = (guint8*)(table + 6);
 	guint8 *entry = data + (hash * entry_size);
-	guint32 key, value, next;
+	guint32 entry_hash, key, value, next;
 
 	index = 0xffffff;
 	while (TRUE) {
 		MonoMethod *m;
 		guint8 *p, *orig_p;
 
-		key = decode_uint_with_len (key_len, entry);
-		value = decode_uint_with_len (value_len, entry + key_len);
-		next = decode_uint_with_len (next_len, entry + key_len + value_len);
+		entry_hash = decode_uint_with_len (hash_len, entry);
+		key = decode_uint_with_len (key_len, entry + hash_len);
+		value = decode_uint_with_len (value_len, entry + hash_len + key_len);
+		next = decode_uint_with_len (next_len, entry + hash_len + key_len + value_len);
 
 		if (key == 0)
 			return 0xffffff;
 
+		/*
+		 * Entries which collide only modulo the table size can be skipped without
+		 * decoding their method ref, which is by far the most expensive part of
+		 * the lookup.
+		 */
+		if (entry_hash != hash_full) {
+			if (next != 0) {
+				entry = data + (next * entry_size);
+				continue;
+			}
+			break;
+		}
+
 		p = code_amodule->blob + key;
 		orig_p = p;
 
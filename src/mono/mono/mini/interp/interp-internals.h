@@ -287,6 +287,8 @@ typedef struct {
 	gint32 added_pop_count;
 	gint32 inlined_methods;
 	gint32 inline_failures;
+	gint32 hot_code_allocated;
+	gint32 hot_code_reserved;
 } MonoInterpStats;
 
 extern MonoInterpStats mono_interp_stats;
@@ -769,6 +769,49 @@ get_virtual_method_fast (InterpMethod *imethod, MonoVTable *vtable, int offset)
 	}
 }
 
+typedef struct {
+	MonoVTable *vtable;
+	InterpMethod *target_imethod;
+} InterpVirtualCallCache;
+
+/*
+ * Per-call-site monomorphic cache for MINT_CALLVIRT_FAST. The cache slot in the
+ * caller's data items starts out NULL and is filled with an immutable entry on the
+ * first call; as long as the receiver vtable seen at the site doesn't change we
+ * skip the method table lookup and, for interface and generic virtual calls, the
+ * linear search of the slot list. A site that sees a second receiver type reverts
+ * permanently to get_virtual_method_fast so polymorphic sites don't allocate a new
+ * entry on every call. Updates of the slot are racy, which at worst loses caching
+ * at a site or leaks an entry into the caller's memory manager.
+ */
+static InterpMethod*
+get_virtual_method_cached (InterpMethod *imethod, MonoVTable *vtable, int offset, MonoMethod *caller, gpointer *cache)
+{
+	InterpVirtualCallCache *entry = (InterpVirtualCallCache*)*cache;
+
+	if (entry) {
+		if ((gsize)entry & 0x1)
+			/* Multiple receiver types seen at this site */
+			return get_virtual_method_fast (imethod, vtable, offset);
+		if (entry->vtable == vtable)
+			return entry->target_imethod;
+	}
+
+	InterpMethod *target_imethod = get_virtual_method_fast (imethod, vtable, offset);
+	if (!entry) {
+		entry = (InterpVirtualCallCache*) mono_mem_manager_alloc0 (m_method_get_mem_manager (caller), sizeof (InterpVirtualCallCache));
+		entry->vtable = vtable;
+		entry->target_imethod = target_imethod;
+		// The entry is not yet visible to other threads so its contents are stable
+		mono_interp_register_imethod_patch_site ((gpointer*)&entry->target_imethod);
+		mono_memory_barrier ();
+		*cache = entry;
+	} else {
+		*cache = (gpointer)(gsize)0x1;
+	}
+	return target_imethod;
+}
+
 // Returns the size it uses on the interpreter stack
 static int
 stackval_size (MonoType *type, gboolean pinvoke)
@@ -4203,9 +4246,10 @@ main_loop:
 			this_arg = LOCAL_VAR (call_args_offset, MonoObject*);
 
 			slot = (gint16)ip [4];
-			ip += 5;
+			gpointer *cache = (gpointer*)&frame->imethod->data_items [ip [5]];
+			ip += 6;
 			// FIXME push/pop LMF
-			cmethod = get_virtual_method_fast (cmethod, this_arg->vtable, slot);
+			cmethod = get_virtual_method_cached (cmethod, this_arg->vtable, slot, frame->imethod->method, cache);
 			if (m_class_is_valuetype (cmethod->method->klass)) {
 				/* unbox */
 				gpointer unboxed = mono_object_unbox_internal (this_arg);
@@ -5373,6 +5417,30 @@ MINT_IN_CASE(MINT_BRTRUE_I8_SP) ZEROP_SP(gint64, !=); MINT_IN_BREAK;
 		MINT_IN_CASE(MINT_XOR_I8)
 			BINOP(gint64, ^);
 			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_AND_I4_IMM)
+			LOCAL_VAR (ip [1], gint32) = LOCAL_VAR (ip [2], gint32) & (gint16)ip [3];
+			ip += 4;
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_AND_I8_IMM)
+			LOCAL_VAR (ip [1], gint64) = LOCAL_VAR (ip [2], gint64) & (gint16)ip [3];
+			ip += 4;
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_OR_I4_IMM)
+			LOCAL_VAR (ip [1], gint32) = LOCAL_VAR (ip [2], gint32) | (gint16)ip [3];
+			ip += 4;
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_OR_I8_IMM)
+			LOCAL_VAR (ip [1], gint64) = LOCAL_VAR (ip [2], gint64) | (gint16)ip [3];
+			ip += 4;
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_XOR_I4_IMM)
+			LOCAL_VAR (ip [1], gint32) = LOCAL_VAR (ip [2], gint32) ^ (gint16)ip [3];
+			ip += 4;
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_XOR_I8_IMM)
+			LOCAL_VAR (ip [1], gint64) = LOCAL_VAR (ip [2], gint64) ^ (gint16)ip [3];
+			ip += 4;
+			MINT_IN_BREAK;
 
 #define SHIFTOP(datatype, op) \
 	LOCAL_VAR (ip [1], datatype) = LOCAL_VAR (ip [2], datatype) op LOCAL_VAR (ip [3], gint32); \
@@ -6622,6 +6690,19 @@ MINT_IN_CASE(MINT_BRTRUE_I8_SP) ZEROP_SP(gint64, !=); MINT_IN_BREAK;
 			ip += 6;
 			MINT_IN_BREAK;
 		}
+		MINT_IN_CASE(MINT_STELEM_VT_NOREF) {
+			MonoArray *o = LOCAL_VAR (ip [1], MonoArray*);
+			NULL_CHECK (o);
+			guint32 aindex = LOCAL_VAR (ip [2], guint32);
+			if (aindex >= mono_array_length_internal (o))
+				THROW_EX (interp_get_exception_index_out_of_range (frame, ip), ip);
+
+			guint16 size = ip [4];
+			char *dst_addr = mono_array_addr_with_size_fast ((MonoArray *) o, size, aindex);
+			memcpy (dst_addr, locals + ip [3], size);
+			ip += 5;
+			MINT_IN_BREAK;
+		}
 		MINT_IN_CASE(MINT_CONV_OVF_I4_U4) {
 			gint32 val = LOCAL_VAR (ip [2], gint32);
 			if (val < 0)
@@ -8689,6 +8770,8 @@ register_interp_stats (void)
 	mono_counters_register ("Emitted instructions", MONO_COUNTER_INTERP | MONO_COUNTER_INT, &mono_interp_stats.emitted_instructions);
 	mono_counters_register ("Methods inlined", MONO_COUNTER_INTERP | MONO_COUNTER_INT, &mono_interp_stats.inlined_methods);
 	mono_counters_register ("Inline failures", MONO_COUNTER_INTERP | MONO_COUNTER_INT, &mono_interp_stats.inline_failures);
+	mono_counters_register ("Hot code bytes allocated", MONO_COUNTER_INTERP | MONO_COUNTER_INT, &mono_interp_stats.hot_code_allocated);
+	mono_counters_register ("Hot code bytes reserved", MONO_COUNTER_INTERP | MONO_COUNTER_INT, &mono_interp_stats.hot_code_reserved);
 }
 
 #undef MONO_EE_CALLBACK
@@ -657,7 +657,7 @@ jiterp_get_opcode_value (InterpInst *ins, gboolean *inside_branch_block)
 
 	if (table_value == VALUE_ABORT_OUTSIDE_BRANCH_BLOCK) {
 		return *inside_branch_block ? VALUE_LOW : VALUE_ABORT;
-	} else if (table_value == VALUE_ABORT_OUTSIDE_BRANCH_BLOCK) {
+	} else if (table_value == VALUE_ABORT_OUTSIDE_BRANCH_BLOCK_NONE) {
 		return *inside_branch_block ? VALUE_NONE : VALUE_ABORT;
 	} else if (table_value == VALUE_BEGIN_BRANCH_BLOCK) {
 		*inside_branch_block = TRUE;
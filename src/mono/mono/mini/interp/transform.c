@@ -41,6 +41,57 @@
 
 MonoInterpStats mono_interp_stats;
 
+/*
+ * Opcode streams of tier-promoted methods are allocated from this dedicated arena
+ * instead of the per-image mempool, so the hot code ends up packed together in a
+ * few pages instead of being scattered in load order among all the other mempool
+ * allocations. Chunks are never freed, which is fine since only methods that were
+ * actually observed hot get here.
+ */
+#define HOT_CODE_CHUNK_SIZE (64 * 1024)
+
+static mono_mutex_t hot_code_mutex;
+static guint8 *hot_code_chunk;
+static int hot_code_chunk_pos;
+
+static gboolean
+should_use_hot_code_arena (TransformData *td)
+{
+	// Only tier-promoted methods go to the arena. With tiering disabled every
+	// method is transformed as optimized, so grouping would be meaningless.
+	// Wrappers are optimized from the start, not because they were observed hot.
+	// Code of collectible ALCs has to die with its memory manager, so it stays
+	// in the mempool.
+	return mono_interp_tiering_enabled () && td->optimized &&
+			td->method->wrapper_type == MONO_WRAPPER_NONE &&
+			!td->mem_manager->collectible;
+}
+
+static gpointer
+hot_code_arena_alloc (int size)
+{
+	gpointer res;
+
+	size = ALIGN_TO (size, MONO_ABI_SIZEOF (gpointer));
+	if (size > HOT_CODE_CHUNK_SIZE)
+		return NULL;
+
+	mono_os_mutex_lock (&hot_code_mutex);
+	if (!hot_code_chunk || hot_code_chunk_pos + size > HOT_CODE_CHUNK_SIZE) {
+		hot_code_chunk = (guint8*)g_malloc0 (HOT_CODE_CHUNK_SIZE);
+		hot_code_chunk_pos = 0;
+		// The gap between the reserved and the allocated counter is the space
+		// wasted at chunk tails.
+		UnlockedAdd (&mono_interp_stats.hot_code_reserved, HOT_CODE_CHUNK_SIZE);
+	}
+	res = hot_code_chunk + hot_code_chunk_pos;
+	hot_code_chunk_pos += size;
+	mono_os_mutex_unlock (&hot_code_mutex);
+
+	UnlockedAdd (&mono_interp_stats.hot_code_allocated, size);
+	return res;
+}
+
 #define DEBUG 0
 
 static const char *stack_type_string [] = { "I4", "I8", "R4", "R8", "O ", "VT", "MP", "F " };
@@ -3655,6 +3706,8 @@ interp_transform_call (TransformData *td, MonoMethod *method, MonoMethod *target
 			} else if (is_virtual) {
 				interp_add_ins (td, MINT_CALLVIRT_FAST);
 				td->last_ins->data [1] = get_virt_method_slot (target_method);
+				/* Inline cache slot */
+				td->last_ins->data [2] = get_data_item_index_nonshared (td, NULL);
 			} else {
 				interp_add_ins (td, MINT_CALL);
 			}
@@ -6874,9 +6927,14 @@ generate_code (TransformData *td, MonoMethod *method, MonoMethodHeader *header,
 					int size = mono_class_value_size (klass, NULL);
 					g_assert (size < G_MAXUINT16);
 
-					handle_stelem (td, MINT_STELEM_VT);
-					td->last_ins->data [0] = get_data_item_index (td, klass);
-					td->last_ins->data [1] = GINT_TO_UINT16 (size);
+					if (m_class_has_references (klass)) {
+						handle_stelem (td, MINT_STELEM_VT);
+						td->last_ins->data [0] = get_data_item_index (td, klass);
+						td->last_ins->data [1] = GINT_TO_UINT16 (size);
+					} else {
+						handle_stelem (td, MINT_STELEM_VT_NOREF);
+						td->last_ins->data [0] = GINT_TO_UINT16 (size);
+					}
 					break;
 				}
 				default: {
@@ -8398,7 +8456,12 @@ generate_compacted_code (InterpMethod *rtm, TransformData *td)
 	size = compute_native_offset_estimates (td);
 
 	// Generate the compacted stream of instructions
-	td->new_code = ip = (guint16*)mono_mem_manager_alloc0 (td->mem_manager, size * sizeof (guint16));
+	td->new_code = NULL;
+	if (should_use_hot_code_arena (td))
+		td->new_code = (guint16*)hot_code_arena_alloc (size * sizeof (guint16));
+	if (!td->new_code)
+		td->new_code = (guint16*)mono_mem_manager_alloc0 (td->mem_manager, size * sizeof (guint16));
+	ip = td->new_code;
 
 	if (td->patchpoint_data_n) {
 		g_assert (mono_interp_tiering_enabled ());
@@ -9853,7 +9916,10 @@ interp_super_instructions (TransformData *td)
 					}
 				}
 			} else if (opcode == MINT_ADD_I4 || opcode == MINT_ADD_I8 ||
-					opcode == MINT_MUL_I4 || opcode == MINT_MUL_I8) {
+					opcode == MINT_MUL_I4 || opcode == MINT_MUL_I8 ||
+					opcode == MINT_AND_I4 || opcode == MINT_AND_I8 ||
+					opcode == MINT_OR_I4 || opcode == MINT_OR_I8 ||
+					opcode == MINT_XOR_I4 || opcode == MINT_XOR_I8) {
 				int sreg = -1;
 				int sreg_imm = -1;
 				gint16 imm;
@@ -9871,6 +9937,12 @@ interp_super_instructions (TransformData *td)
 						case MINT_ADD_I8: binop = MINT_ADD_I8_IMM; break;
 						case MINT_MUL_I4: binop = MINT_MUL_I4_IMM; break;
 						case MINT_MUL_I8: binop = MINT_MUL_I8_IMM; break;
+						case MINT_AND_I4: binop = MINT_AND_I4_IMM; break;
+						case MINT_AND_I8: binop = MINT_AND_I8_IMM; break;
+						case MINT_OR_I4: binop = MINT_OR_I4_IMM; break;
+						case MINT_OR_I8: binop = MINT_OR_I8_IMM; break;
+						case MINT_XOR_I4: binop = MINT_XOR_I4_IMM; break;
+						case MINT_XOR_I8: binop = MINT_XOR_I8_IMM; break;
 						default: g_assert_not_reached ();
 					}
 					InterpInst *new_inst = interp_insert_ins (td, ins, binop);
@@ -9972,6 +10044,31 @@ interp_super_instructions (TransformData *td)
 								}
 							}
 						}
+					} else if (amount_def != NULL && td->local_ref_count [amount_var] == 1 && amount_def->opcode == MINT_AND_I4_IMM) {
+						// and.imm + shl -> shl_and_imm
+						// The and.imm comes from the ldc + and fusion done earlier in this pass,
+						// which already consumed the constant.
+						int new_opcode = -1;
+						if (opcode == MINT_SHL_I4 && amount_def->data [0] == 31)
+							new_opcode = MINT_SHL_AND_I4;
+						else if (opcode == MINT_SHL_I8 && amount_def->data [0] == 63)
+							new_opcode = MINT_SHL_AND_I8;
+
+						if (new_opcode != -1) {
+							InterpInst *new_inst = interp_insert_ins (td, ins, new_opcode);
+							new_inst->dreg = ins->dreg;
+							new_inst->sregs [0] = ins->sregs [0];
+							new_inst->sregs [1] = amount_def->sregs [0];
+
+							local_ref_count [amount_var]--;
+
+							interp_clear_ins (amount_def);
+							interp_clear_ins (ins);
+							if (td->verbose_level) {
+								g_print ("superins: ");
+								dump_interp_inst (new_inst);
+							}
+						}
 					}
 				}
 			} else if (opcode == MINT_DIV_UN_I4 || opcode == MINT_DIV_UN_I8) {
@@ -11034,6 +11131,7 @@ tiered_patcher (MiniTieredPatchPointContext *ctx, gpointer patchsite)
 void
 mono_interp_transform_init (void)
 {
+	mono_os_mutex_init (&hot_code_mutex);
 #ifdef ENABLE_EXPERIMENT_TIERED
 	mini_tiered_register_callsite_patcher (tiered_patcher, TIERED_PATCH_KIND_INTERP);
 #endif
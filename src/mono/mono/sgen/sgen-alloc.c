@@ -70,6 +70,36 @@ static guint64 bytes_allocated_detached = 0;
 #define TLAB_TEMP_END	(__thread_info__->tlab_temp_end)
 #define TLAB_REAL_END	(__thread_info__->tlab_real_end)
 
+/* Upper bound for adaptive per-thread TLAB growth, as a multiple of the configured size. */
+#define TLAB_MAX_SIZE_FACTOR	16
+
+/*
+ * The TLAB refill size adapts to each thread's allocation rate: refilling while
+ * a TLAB from the current collection cycle is still live doubles the size, up
+ * to TLAB_MAX_SIZE_FACTOR times the configured one, and every minor collection
+ * halves it back towards the configured size (see sgen_clear_tlabs ()). Hot
+ * allocator threads therefore take the allocation lock less often, while
+ * mostly idle threads keep small TLABs and don't strand nursery space.
+ */
+static guint32
+get_tlab_refill_size (SgenThreadInfo *info)
+{
+	guint32 tlab_size = info->tlab_alloc_size;
+	if (!tlab_size)
+		tlab_size = info->tlab_alloc_size = sgen_tlab_size;
+	return tlab_size;
+}
+
+static void
+grow_tlab_refill_size (SgenThreadInfo *info)
+{
+	guint32 max_size = sgen_tlab_size * TLAB_MAX_SIZE_FACTOR;
+	if (info->tlab_alloc_size < max_size) {
+		info->tlab_alloc_size = MIN (info->tlab_alloc_size * 2, max_size);
+		sgen_binary_protocol_tlab_resize ((gpointer)(gsize) mono_thread_info_get_tid (info), info->tlab_alloc_size);
+	}
+}
+
 static void
 increment_thread_allocation_counter (size_t byte_size)
 {
@@ -269,20 +299,25 @@ sgen_alloc_obj_nolock (GCVTable vtable, size_t size)
 				zero_tlab_if_necessary (p, size);
 			} else {
 				size_t alloc_size = 0;
-				if (TLAB_START)
+				guint32 tlab_size = get_tlab_refill_size (__thread_info__);
+				gboolean had_tlab = TLAB_START != NULL;
+				if (had_tlab)
 					SGEN_LOG (3, "Retire TLAB: %p-%p [%ld]", TLAB_START, TLAB_REAL_END, (long)(TLAB_REAL_END - TLAB_NEXT - size));
 				sgen_nursery_retire_region (p, available_in_tlab);
 
-				p = (void **)sgen_nursery_alloc_range (sgen_tlab_size, size, &alloc_size);
+				p = (void **)sgen_nursery_alloc_range (tlab_size, size, &alloc_size);
 				if (!p) {
 					/* See comment above in similar case. */
-					sgen_ensure_free_space (sgen_tlab_size, GENERATION_NURSERY);
+					sgen_ensure_free_space (tlab_size, GENERATION_NURSERY);
 					if (!sgen_degraded_mode)
-						p = (void **)sgen_nursery_alloc_range (sgen_tlab_size, size, &alloc_size);
+						p = (void **)sgen_nursery_alloc_range (tlab_size, size, &alloc_size);
 				}
 				if (!p)
 					return alloc_degraded (vtable, size, TRUE);
 
+				if (had_tlab)
+					grow_tlab_refill_size (__thread_info__);
+
 				increment_thread_allocation_counter (TLAB_NEXT - TLAB_START);
 
 				/* Allocate a new TLAB from the current nursery fragment */
@@ -381,13 +416,18 @@ sgen_try_alloc_obj_nolock (GCVTable vtable, size_t size)
 			zero_tlab_if_necessary (p, size);
 		} else {
 			size_t alloc_size = 0;
+			guint32 tlab_size = get_tlab_refill_size (__thread_info__);
+			gboolean had_tlab = TLAB_START != NULL;
 
 			sgen_nursery_retire_region (p, available_in_tlab);
-			new_next = (char *)sgen_nursery_alloc_range (sgen_tlab_size, size, &alloc_size);
+			new_next = (char *)sgen_nursery_alloc_range (tlab_size, size, &alloc_size);
 			p = (void**)new_next;
 			if (!p)
 				return NULL;
 
+			if (had_tlab)
+				grow_tlab_refill_size (__thread_info__);
+
 			increment_thread_allocation_counter (TLAB_NEXT - TLAB_START);
 
 			TLAB_START = (char*)new_next;
@@ -529,6 +569,12 @@ sgen_clear_tlabs (void)
 		info->tlab_next = NULL;
 		info->tlab_temp_end = NULL;
 		info->tlab_real_end = NULL;
+		/* Decay the adaptive TLAB size so threads that stopped allocating
+		 * return to the configured size. */
+		if (info->tlab_alloc_size > sgen_tlab_size) {
+			info->tlab_alloc_size = MAX (info->tlab_alloc_size / 2, sgen_tlab_size);
+			sgen_binary_protocol_tlab_resize ((gpointer)(gsize) mono_thread_info_get_tid (info), info->tlab_alloc_size);
+		}
 	} FOREACH_THREAD_END
 
 	sgen_set_bytes_allocated_attached (total_bytes_allocated_globally);
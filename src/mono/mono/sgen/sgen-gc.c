@@ -3077,6 +3077,7 @@ void*
 sgen_thread_attach (SgenThreadInfo* info)
 {
 	info->tlab_start = info->tlab_next = info->tlab_temp_end = info->tlab_real_end = NULL;
+	info->tlab_alloc_size = sgen_tlab_size;
 
 	sgen_client_thread_attach (info);
 
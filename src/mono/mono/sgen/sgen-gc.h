@@ -425,6 +425,13 @@ struct _SgenThreadInfo {
 	char *tlab_temp_end;
 	char *tlab_real_end;
 
+	/*
+	 * Size of the next TLAB refill for this thread. Grows on repeated refills
+	 * within a collection cycle and decays back towards sgen_tlab_size at each
+	 * minor collection (see sgen-alloc.c).
+	 */
+	guint32 tlab_alloc_size;
+
 	/* Total bytes allocated by this thread in its lifetime so far. */
 	gint64 total_bytes_allocated;
 };
@@ -127,6 +127,9 @@ mword sgen_los_memory_usage_total = 0;
 
 static LOSSection *los_sections = NULL;
 static LOSFreeChunks *los_fast_free_lists [LOS_NUM_FAST_SIZES]; /* 0 is for larger sizes */
+/* Bit i is set iff los_fast_free_lists [i] is nonempty, so the allocator can
+ * jump to the smallest bin that fits instead of probing empty ones. */
+static guint32 los_fast_free_mask = 0;
 static mword los_num_objects = 0;
 static int los_num_sections = 0;
 
@@ -209,6 +212,24 @@ add_free_chunk (LOSFreeChunks *free_chunks, size_t size)
 		num_chunks = 0;
 	free_chunks->next_size = los_fast_free_lists [num_chunks];
 	los_fast_free_lists [num_chunks] = free_chunks;
+	los_fast_free_mask |= 1u << num_chunks;
+}
+
+/* The exact-size bins hold chunks of one size each, so the first nonempty bin
+ * at or above the request always satisfies it. */
+static size_t
+first_nonempty_bin (guint32 mask)
+{
+#if defined(__GNUC__)
+	return __builtin_ctz (mask);
+#else
+	size_t i = 0;
+	while (!(mask & 1)) {
+		mask >>= 1;
+		++i;
+	}
+	return i;
+#endif
 }
 
 static LOSFreeChunks*
@@ -289,15 +310,21 @@ get_los_section_memory (size_t size)
  retry:
 	if (num_chunks >= LOS_NUM_FAST_SIZES) {
 		free_chunks = get_from_size_list (&los_fast_free_lists [0], size);
+		if (!los_fast_free_lists [0])
+			los_fast_free_mask &= ~1u;
 	} else {
-		size_t i;
-		for (i = num_chunks; i < LOS_NUM_FAST_SIZES; ++i) {
+		guint32 mask = los_fast_free_mask & ~((1u << num_chunks) - 1) & ~1u;
+		if (mask) {
+			size_t i = first_nonempty_bin (mask);
 			free_chunks = get_from_size_list (&los_fast_free_lists [i], size);
-			if (free_chunks)
-				break;
+			if (!los_fast_free_lists [i])
+				los_fast_free_mask &= ~(1u << i);
 		}
-		if (!free_chunks)
+		if (!free_chunks) {
 			free_chunks = get_from_size_list (&los_fast_free_lists [0], size);
+			if (!los_fast_free_lists [0])
+				los_fast_free_mask &= ~1u;
+		}
 	}
 
 	if (free_chunks) {
@@ -320,9 +347,7 @@ get_los_section_memory (size_t size)
 		return NULL;
 
 	free_chunks = (LOSFreeChunks*)((char*)section + LOS_CHUNK_SIZE);
-	free_chunks->size = LOS_SECTION_SIZE - LOS_CHUNK_SIZE;
-	free_chunks->next_size = los_fast_free_lists [0];
-	los_fast_free_lists [0] = free_chunks;
+	add_free_chunk (free_chunks, LOS_SECTION_SIZE - LOS_CHUNK_SIZE);
 
 	section->num_free_chunks = LOS_SECTION_NUM_CHUNKS;
 
@@ -528,6 +553,7 @@ sgen_los_sweep (void)
 	/* Try to free memory */
 	for (i = 0; i < LOS_NUM_FAST_SIZES; ++i)
 		los_fast_free_lists [i] = NULL;
+	los_fast_free_mask = 0;
 
 	prev = NULL;
 	section = los_sections;
@@ -50,6 +50,7 @@ enum {
 #define SGEN_WORKER_MIN_SECTIONS_SIGNAL 4
 
 static guint64 stat_workers_num_finished;
+static guint64 stat_workers_num_sections_stolen;
 
 static gboolean
 set_state (WorkerData *data, State old_state, State new_state)
@@ -244,7 +245,7 @@ workers_steal_work (WorkerData *data)
 	int generation = sgen_get_current_collection_generation ();
 	GrayQueueSection *section = NULL;
 	WorkerContext *context = data->context;
-	int i, current_worker;
+	int i, current_worker, victim_worker = 0;
 
 	if ((generation == GENERATION_OLD && !major->is_parallel) ||
 			(generation == GENERATION_NURSERY && !minor->is_parallel))
@@ -257,12 +258,17 @@ workers_steal_work (WorkerData *data)
 
 	for (i = 1; i < context->active_workers_num && !section; i++) {
 		int steal_worker = (current_worker + i) % context->active_workers_num;
-		if (state_is_working_or_enqueued (context->workers_data [steal_worker].state))
+		if (state_is_working_or_enqueued (context->workers_data [steal_worker].state)) {
 			section = sgen_gray_object_steal_section (&context->workers_data [steal_worker].private_gray_queue);
+			victim_worker = steal_worker;
+		}
 	}
 
 	if (section) {
 		sgen_gray_object_enqueue_section (&data->private_gray_queue, section, TRUE);
+		stat_workers_num_sections_stolen++;
+		/* Worker indexes are 1 based, since 0 is logically considered gc thread */
+		sgen_binary_protocol_worker_steal (current_worker + 1, victim_worker + 1, generation);
 		return TRUE;
 	}
 
@@ -413,6 +419,7 @@ sgen_workers_create_context (int generation, int num_workers)
 
 	if (!stat_inited) {
 		mono_counters_register ("# workers finished", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_workers_num_finished);
+		mono_counters_register ("# worker sections stolen", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_workers_num_sections_stolen);
 		stat_inited = TRUE;
 	}
 }
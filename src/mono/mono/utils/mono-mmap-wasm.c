@@ -229,4 +229,9 @@ mono_mprotect (void *addr, size_t length, int flags)
 	return 0;
 }
 
+void
+mono_madvise_willneed (void *addr, size_t length)
+{
+}
+
 #endif
@@ -300,6 +300,12 @@ mono_mprotect (void *addr, size_t length, int flags)
 	return VirtualProtect (addr, length, prot, &oldprot) == 0;
 }
 
+void
+mono_madvise_willneed (void *addr, size_t length)
+{
+	// Mapped views are demand-faulted efficiently enough on Windows; no hint issued.
+}
+
 #else
 
 #include <mono/utils/mono-compiler.h>
@@ -455,6 +455,24 @@ mono_mprotect (void *addr, size_t length, int flags)
 	return mprotect (addr, length, prot);
 }
 
+/**
+ * mono_madvise_willneed:
+ * \param addr memory address
+ * \param length size of the memory area
+ * Hint the OS that the pages in the given range will be accessed soon, so
+ * they can be read ahead in bulk instead of demand-faulted one page at a
+ * time. Best effort; a no-op where no madvise equivalent is available.
+ */
+void
+mono_madvise_willneed (void *addr, size_t length)
+{
+#if defined(HAVE_MADVISE) && defined(MADV_WILLNEED)
+	madvise (addr, length, MADV_WILLNEED);
+#elif defined(POSIX_MADV_WILLNEED)
+	posix_madvise (addr, length, POSIX_MADV_WILLNEED);
+#endif
+}
+
 #else
 
 /* dummy malloc-based implementation */
@@ -506,6 +524,11 @@ mono_mprotect (void *addr, size_t length, int flags)
 	return 0;
 }
 
+void
+mono_madvise_willneed (void *addr, size_t length)
+{
+}
+
 #endif // HAVE_MMAP
 
 #endif // HOST_WIN32
@@ -74,6 +74,7 @@ MONO_API void* mono_file_map_fileio   (size_t length, int flags, int fd, guint64
 MONO_API int   mono_file_unmap_fileio (void *addr, void *handle);
 #endif
 MONO_API int   mono_mprotect   (void *addr, size_t length, int flags);
+MONO_API void  mono_madvise_willneed (void *addr, size_t length);
 
 MONO_API const char* mono_mem_account_type_name (MonoMemAccountType type);
 MONO_API void  mono_mem_account_register_counters (void);
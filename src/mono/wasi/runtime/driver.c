@@ -376,6 +376,12 @@ mono_wasm_load_runtime (const char *unused, int debug_level)
 {
 	const char *interp_opts = "";
 
+	// When a pre-initialization snapshot (see dotnet_wasi_preinitialize in main.c)
+	// is restored, linear memory already contains the fully started runtime;
+	// initializing it a second time would fail in mono_jit_init_version.
+	if (root_domain)
+		return;
+
     char* invariant_globalization = monoeg_g_getenv ("DOTNET_SYSTEM_GLOBALIZATION_INVARIANT");
     if (strcmp(invariant_globalization, "true") != 0 && strcmp(invariant_globalization, "1") != 0)
 	    load_icu_data();
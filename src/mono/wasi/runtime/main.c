@@ -1,4 +1,4 @@
-﻿#include <string.h>
+#include <string.h>
 #include <driver.h>
 #include <mono/metadata/assembly.h>
 
@@ -10,20 +10,46 @@ const char* dotnet_wasi_getentrypointassemblyname();
 WASI_AFTER_RUNTIME_LOADED_DECLARATIONS
 #endif
 
+// Entry method resolved during pre-initialization. Lives in linear memory, so
+// it survives into the snapshot and lets main() skip assembly loading.
+static MonoMethod* preinitialized_entry_method;
+
+// Wizer-style pre-initialization hook: a snapshotting tool (e.g. wizer) invokes
+// this export at build time and captures the resulting linear memory and table
+// state into the module, so deployed instances restore with the runtime already
+// started and jump straight to the managed entrypoint. Any interpreter
+// transform output produced while pre-initializing is captured along with the
+// rest of the heap. Note that WASI ambient state (environment, preopened
+// directories) observed here is the build-time one.
+__attribute__((export_name("wizer.initialize")))
+void
+dotnet_wasi_preinitialize()
+{
+	mono_wasm_load_runtime("", 0);
+
+	MonoAssembly* assembly = mono_assembly_open(dotnet_wasi_getentrypointassemblyname(), NULL);
+	if (assembly)
+		preinitialized_entry_method = mono_wasi_assembly_get_entry_point (assembly);
+}
+
 int main(int argc, char * argv[]) {
 
 #ifdef WASI_AFTER_RUNTIME_LOADED_CALLS
 	// This is supplied from the MSBuild itemgroup @(WasiAfterRuntimeLoaded)
 	WASI_AFTER_RUNTIME_LOADED_CALLS
 #endif
+	// No-op when restored from a pre-initialized snapshot
 	mono_wasm_load_runtime("", 0);
 
-	const char* assembly_name = dotnet_wasi_getentrypointassemblyname();
-	MonoAssembly* assembly = mono_assembly_open(assembly_name, NULL);
-	MonoMethod* entry_method = mono_wasi_assembly_get_entry_point (assembly);
+	MonoMethod* entry_method = preinitialized_entry_method;
 	if (!entry_method) {
-		fprintf(stderr, "Could not find entrypoint in assembly %s\n", assembly_name);
-		exit(1);
+		const char* assembly_name = dotnet_wasi_getentrypointassemblyname();
+		MonoAssembly* assembly = mono_assembly_open(assembly_name, NULL);
+		entry_method = mono_wasi_assembly_get_entry_point (assembly);
+		if (!entry_method) {
+			fprintf(stderr, "Could not find entrypoint in assembly %s\n", assembly_name);
+			exit(1);
+		}
 	}
 
 	MonoObject* out_exc;
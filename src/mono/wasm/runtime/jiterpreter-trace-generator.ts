@@ -1961,6 +1961,12 @@ const unopTable : { [opcode: number]: OpRec3 | undefined } = {
     [MintOpcode.MINT_MUL_I4_IMM]: [WasmOpcode.i32_mul,   WasmOpcode.i32_load, WasmOpcode.i32_store],
     [MintOpcode.MINT_ADD_I8_IMM]: [WasmOpcode.i64_add,   WasmOpcode.i64_load, WasmOpcode.i64_store],
     [MintOpcode.MINT_MUL_I8_IMM]: [WasmOpcode.i64_mul,   WasmOpcode.i64_load, WasmOpcode.i64_store],
+    [MintOpcode.MINT_AND_I4_IMM]: [WasmOpcode.i32_and,   WasmOpcode.i32_load, WasmOpcode.i32_store],
+    [MintOpcode.MINT_AND_I8_IMM]: [WasmOpcode.i64_and,   WasmOpcode.i64_load, WasmOpcode.i64_store],
+    [MintOpcode.MINT_OR_I4_IMM]:  [WasmOpcode.i32_or,    WasmOpcode.i32_load, WasmOpcode.i32_store],
+    [MintOpcode.MINT_OR_I8_IMM]:  [WasmOpcode.i64_or,    WasmOpcode.i64_load, WasmOpcode.i64_store],
+    [MintOpcode.MINT_XOR_I4_IMM]: [WasmOpcode.i32_xor,   WasmOpcode.i32_load, WasmOpcode.i32_store],
+    [MintOpcode.MINT_XOR_I8_IMM]: [WasmOpcode.i64_xor,   WasmOpcode.i64_load, WasmOpcode.i64_store],
 
     [MintOpcode.MINT_NEG_R4]:     [WasmOpcode.f32_neg,   WasmOpcode.f32_load, WasmOpcode.f32_store],
     [MintOpcode.MINT_NEG_R8]:     [WasmOpcode.f64_neg,   WasmOpcode.f64_load, WasmOpcode.f64_store],
@@ -2425,6 +2431,9 @@ function emit_unop (builder: WasmBuilder, ip: MintOpcodePtr, opcode: MintOpcode)
 
         case MintOpcode.MINT_ADD_I4_IMM:
         case MintOpcode.MINT_MUL_I4_IMM:
+        case MintOpcode.MINT_AND_I4_IMM:
+        case MintOpcode.MINT_OR_I4_IMM:
+        case MintOpcode.MINT_XOR_I4_IMM:
         case MintOpcode.MINT_SHL_I4_IMM:
         case MintOpcode.MINT_SHR_I4_IMM:
         case MintOpcode.MINT_SHR_UN_I4_IMM:
@@ -2436,6 +2445,9 @@ function emit_unop (builder: WasmBuilder, ip: MintOpcodePtr, opcode: MintOpcode)
 
         case MintOpcode.MINT_ADD_I8_IMM:
         case MintOpcode.MINT_MUL_I8_IMM:
+        case MintOpcode.MINT_AND_I8_IMM:
+        case MintOpcode.MINT_OR_I8_IMM:
+        case MintOpcode.MINT_XOR_I8_IMM:
         case MintOpcode.MINT_SHL_I8_IMM:
         case MintOpcode.MINT_SHR_I8_IMM:
         case MintOpcode.MINT_SHR_UN_I8_IMM:
@@ -3168,6 +3180,16 @@ function emit_arrayop (builder: WasmBuilder, frame: NativePointer, ip: MintOpcod
             builder.callImport("value_copy");
             return true;
         }
+        case MintOpcode.MINT_STELEM_VT_NOREF: {
+            const elementSize = getArgU16(ip, 4);
+            // dest
+            append_getelema1(builder, ip, objectOffset, indexOffset, elementSize);
+            // src
+            append_ldloca(builder, valueOffset, 0);
+            // memcpy (dst_addr, locals + ip [3], size);
+            append_memmove_dest_src(builder, elementSize);
+            return true;
+        }
         default:
             return false;
     }
@@ -78,6 +78,27 @@ fixed_or_malloc_free (
 	dn_allocator_fixed_or_malloc_data_t *data,
 	void *block);
 
+static void *
+arena_vtable_alloc (
+	dn_allocator_t *allocator,
+	size_t size);
+
+static void *
+arena_vtable_realloc (
+	dn_allocator_t *allocator,
+	void *block,
+	size_t size);
+
+static void
+arena_vtable_free (
+	dn_allocator_t *allocator,
+	void *block);
+
+static void *
+arena_alloc (
+	dn_allocator_arena_data_t *data,
+	size_t size);
+
 static dn_allocator_vtable_t fixed_vtable = {
 	fixed_vtable_alloc,
 	fixed_vtable_realloc,
@@ -90,6 +111,14 @@ static dn_allocator_vtable_t fixed_or_malloc_vtable = {
 	fixed_or_malloc_vtable_free,
 };
 
+static dn_allocator_vtable_t arena_vtable = {
+	arena_vtable_alloc,
+	arena_vtable_realloc,
+	arena_vtable_free,
+};
+
+#define ARENA_DEFAULT_BLOCK_SIZE 1024
+
 static void *
 fixed_vtable_alloc (
 	dn_allocator_t *allocator,
@@ -267,6 +296,92 @@ fixed_or_malloc_free (
 		free (block);
 }
 
+static void *
+arena_vtable_alloc (
+	dn_allocator_t *allocator,
+	size_t size)
+{
+	return arena_alloc (&((dn_allocator_arena_t *)allocator)->_data, size);
+}
+
+static void *
+arena_vtable_realloc (
+	dn_allocator_t *allocator,
+	void *block,
+	size_t size)
+{
+	dn_allocator_arena_data_t *data = &((dn_allocator_arena_t *)allocator)->_data;
+
+	if (!block)
+		return arena_alloc (data, size);
+
+	// Old size is stored in front of the block, like in the fixed allocator.
+	size_t old_size = *(size_t *)((uint8_t *)block - DN_ALLOCATOR_MEM_ALIGN8);
+	if (size <= old_size)
+		return block;
+
+	void *result = arena_alloc (data, size);
+	if (result)
+		memcpy (result, block, old_size);
+
+	return result;
+}
+
+static void
+arena_vtable_free (
+	dn_allocator_t *allocator,
+	void *block)
+{
+	DN_UNREFERENCED_PARAMETER (allocator);
+	DN_UNREFERENCED_PARAMETER (block);
+
+	// Arena memory is reclaimed by reset/dispose.
+}
+
+static void *
+arena_alloc (
+	dn_allocator_arena_data_t *data,
+	size_t size)
+{
+	size_t aligned_size = DN_ALLOCATOR_ALIGN_SIZE (size + DN_ALLOCATOR_MEM_ALIGN8, DN_ALLOCATOR_MEM_ALIGN8);
+
+	while (!data->_current || (size_t)(data->_current->_end - data->_ptr) < aligned_size) {
+		// Reuse blocks kept alive over a reset before chaining a new one.
+		if (data->_current && data->_current->_next) {
+			data->_current = data->_current->_next;
+			data->_ptr = data->_current->_begin;
+			continue;
+		}
+
+		size_t block_size = data->_next_block_size > aligned_size ? data->_next_block_size : aligned_size;
+
+		dn_allocator_arena_block_t *block = (dn_allocator_arena_block_t *)malloc (sizeof (dn_allocator_arena_block_t) + block_size);
+		if (!block)
+			return NULL;
+
+		block->_next = NULL;
+		block->_begin = (uint8_t *)(block + 1);
+		block->_end = block->_begin + block_size;
+
+		if (data->_current)
+			data->_current->_next = block;
+		else
+			data->_first = block;
+
+		data->_current = block;
+		data->_ptr = block->_begin;
+		data->_reserved_bytes += block_size;
+		data->_next_block_size = block_size * 2;
+	}
+
+	uint8_t *ptr = data->_ptr;
+	data->_ptr += aligned_size;
+	data->_used_bytes += aligned_size;
+
+	*(size_t *)ptr = size;
+	return ptr + DN_ALLOCATOR_MEM_ALIGN8;
+}
+
 dn_allocator_fixed_t *
 dn_allocator_fixed_init (
 	dn_allocator_fixed_t *allocator,
@@ -302,6 +417,44 @@ dn_allocator_fixed_or_malloc_reset(dn_allocator_fixed_or_malloc_t *allocator)
 	return allocator;
 }
 
+dn_allocator_arena_t *
+dn_allocator_arena_init (
+	dn_allocator_arena_t *allocator,
+	size_t initial_block_size)
+{
+	memset (&allocator->_data, 0, sizeof (allocator->_data));
+
+	allocator->_data._next_block_size = initial_block_size != 0 ? initial_block_size : ARENA_DEFAULT_BLOCK_SIZE;
+	allocator->_vtable = &arena_vtable;
+
+	return allocator;
+}
+
+dn_allocator_arena_t *
+dn_allocator_arena_reset (dn_allocator_arena_t *allocator)
+{
+	allocator->_data._current = allocator->_data._first;
+	allocator->_data._ptr = allocator->_data._first ? allocator->_data._first->_begin : NULL;
+	allocator->_data._used_bytes = 0;
+
+	return allocator;
+}
+
+void
+dn_allocator_arena_dispose (dn_allocator_arena_t *allocator)
+{
+	dn_allocator_arena_block_t *block = allocator->_data._first;
+	while (block) {
+		dn_allocator_arena_block_t *next = block->_next;
+		free (block);
+		block = next;
+	}
+
+	size_t next_block_size = allocator->_data._next_block_size;
+	memset (&allocator->_data, 0, sizeof (allocator->_data));
+	allocator->_data._next_block_size = next_block_size;
+}
+
 dn_allocator_fixed_or_malloc_t *
 dn_allocator_fixed_or_malloc_init (
 	dn_allocator_fixed_or_malloc_t *allocator,
@@ -20,6 +20,9 @@ typedef struct _dn_allocator_fixed_t dn_allocator_fixed_t;
 typedef struct _dn_allocator_fixed_data_t dn_allocator_fixed_data_t;
 typedef struct _dn_allocator_fixed_or_malloc_t dn_allocator_fixed_or_malloc_t;
 typedef struct _dn_allocator_fixed_data_t dn_allocator_fixed_or_malloc_data_t;
+typedef struct _dn_allocator_arena_t dn_allocator_arena_t;
+typedef struct _dn_allocator_arena_block_t dn_allocator_arena_block_t;
+typedef struct _dn_allocator_arena_data_t dn_allocator_arena_data_t;
 
 struct _dn_allocator_vtable_t {
 	void *(*_alloc)(dn_allocator_t *, size_t);
@@ -47,6 +50,31 @@ struct _dn_allocator_fixed_or_malloc_t {
 	dn_allocator_fixed_or_malloc_data_t _data;
 };
 
+struct _dn_allocator_arena_block_t {
+	dn_allocator_arena_block_t *_next;
+	uint8_t *_begin;
+	uint8_t *_end;
+};
+
+struct _dn_allocator_arena_data_t {
+	dn_allocator_arena_block_t *_first;
+	dn_allocator_arena_block_t *_current;
+	uint8_t *_ptr;
+	size_t _next_block_size;
+	size_t _reserved_bytes;
+	size_t _used_bytes;
+};
+
+// Chained-arena allocator. Allocations bump a pointer within the current
+// block; exhausted blocks chain to new ones of geometrically growing size.
+// Individual frees are no-ops, dn_allocator_arena_reset reclaims everything
+// in O(1) while keeping the blocks for reuse, dn_allocator_arena_dispose
+// releases the blocks.
+struct _dn_allocator_arena_t {
+	dn_allocator_vtable_t *_vtable;
+	dn_allocator_arena_data_t _data;
+};
+
 static inline void *
 dn_allocator_alloc (
 	dn_allocator_t *allocator,
@@ -96,6 +124,31 @@ dn_allocator_fixed_or_malloc_init (
 dn_allocator_fixed_or_malloc_t *
 dn_allocator_fixed_or_malloc_reset (dn_allocator_fixed_or_malloc_t *allocator);
 
+dn_allocator_arena_t *
+dn_allocator_arena_init (
+	dn_allocator_arena_t *allocator,
+	size_t initial_block_size);
+
+dn_allocator_arena_t *
+dn_allocator_arena_reset (dn_allocator_arena_t *allocator);
+
+void
+dn_allocator_arena_dispose (dn_allocator_arena_t *allocator);
+
+// Total bytes of block storage held by the arena; survives reset.
+static inline size_t
+dn_allocator_arena_reserved_bytes (const dn_allocator_arena_t *allocator)
+{
+	return allocator->_data._reserved_bytes;
+}
+
+// Bytes handed out since init or the last reset.
+static inline size_t
+dn_allocator_arena_used_bytes (const dn_allocator_arena_t *allocator)
+{
+	return allocator->_data._used_bytes;
+}
+
 #define DN_ALLOCATOR_FIXED_OR_MALLOC(var_name, buffer_size) \
 	uint8_t __buffer_##var_name [buffer_size]; \
 	dn_allocator_fixed_or_malloc_t var_name; \
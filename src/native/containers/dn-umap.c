@@ -582,7 +582,16 @@ dn_umap_reserve (
 {
 	DN_ASSERT (map);
 
-	umap_do_rehash (map, count);
+	if (count < map->_internal._node_count)
+		count = map->_internal._node_count;
+
+	// Round to the prime spacing used by automatic rehashing so the modulo
+	// distribution matches, and never shrink an already larger table.
+	uint32_t new_bucket_count = umap_spaced_primes_closest (count);
+	if (new_bucket_count <= map->_internal._bucket_count)
+		return;
+
+	umap_do_rehash (map, new_bucket_count);
 }
 
 bool
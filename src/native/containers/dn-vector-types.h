@@ -11,6 +11,7 @@ typedef int32_t (DN_CALLBACK_CALLTYPE *dn_vector_compare_func_t) (const void *a,
 typedef bool (DN_CALLBACK_CALLTYPE *dn_vector_equal_func_t) (const void *a, const void *b);
 typedef void (DN_CALLBACK_CALLTYPE *dn_vector_for_each_func_t) (void *data, void *user_data);
 typedef void (DN_CALLBACK_CALLTYPE *dn_vector_dispose_func_t) (void *data);
+typedef uint32_t (DN_CALLBACK_CALLTYPE *dn_vector_calc_capacity_func_t) (uint32_t capacity);
 
 #define DN_DEFINE_VECTOR_T_STRUCT(name, type) \
 typedef struct _ ## name ## _t name ## _t; \
@@ -22,6 +23,7 @@ struct _ ## name ## _t { \
 		uint32_t _capacity; \
 		uint32_t _attributes; \
 		dn_allocator_t *_allocator; \
+		dn_vector_calc_capacity_func_t _calc_capacity; \
 	} _internal; \
 }; \
 typedef struct _ ## name ## _it_t name ## _it_t; \
@@ -42,6 +44,7 @@ struct _ ## name ## _custom_params_t { \
 	dn_allocator_t *allocator; \
 	uint32_t capacity; \
 	uint32_t attributes; \
+	dn_vector_calc_capacity_func_t calc_capacity; \
 };
 
 DN_DEFINE_VECTOR_T_STRUCT (dn_vector, uint8_t);
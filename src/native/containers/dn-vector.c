@@ -45,7 +45,13 @@ _dn_vector_ensure_capacity (
 	if (capacity != 0 && capacity <= (uint64_t)(vector->_internal._capacity))
 		return true;
 
-	uint64_t new_capacity = calc_capacity ? CALC_NEW_CAPACITY (capacity) : capacity;
+	uint64_t new_capacity = capacity;
+	if (calc_capacity) {
+		new_capacity = vector->_internal._calc_capacity ? (uint64_t)vector->_internal._calc_capacity (capacity) : CALC_NEW_CAPACITY (capacity);
+		// A custom growth policy must never shrink below the requested capacity.
+		if (DN_UNLIKELY (new_capacity < (uint64_t)capacity))
+			new_capacity = capacity;
+	}
 
 	if (DN_UNLIKELY (new_capacity > (uint64_t)(UINT32_MAX)))
 		return false;
@@ -251,6 +257,7 @@ dn_vector_custom_init (
 	if (params) {
 		vector->_internal._allocator = params->allocator;
 		vector->_internal._attributes = params->attributes;
+		vector->_internal._calc_capacity = params->calc_capacity;
 		if (params->capacity != 0)
 			capacity = params->capacity;
 	}
@@ -158,6 +158,18 @@ dn_vector_init (
 #define dn_vector_init_t(vector, element_type) \
 	dn_vector_init (vector, sizeof (element_type))
 
+/* Declares and initializes a local vector storing its first inline_capacity
+ * elements in a stack buffer; growing beyond that spills to the heap.
+ * Dispose with dn_vector_dispose as usual, spilled storage is freed while
+ * inline storage is not. The vector must not outlive the declaring scope. */
+#define DN_VECTOR_INLINE_CAPACITY_INIT(var_name, element_type, inline_capacity) \
+	uint8_t __vector_buffer_ ## var_name [(sizeof (element_type) * (inline_capacity)) + 32]; \
+	dn_allocator_fixed_or_malloc_t __vector_allocator_ ## var_name; \
+	dn_allocator_fixed_or_malloc_init (&__vector_allocator_ ## var_name, __vector_buffer_ ## var_name, sizeof (__vector_buffer_ ## var_name)); \
+	dn_vector_custom_alloc_params_t __vector_params_ ## var_name = { (dn_allocator_t *)&__vector_allocator_ ## var_name, (inline_capacity), 0, NULL }; \
+	dn_vector_t var_name; \
+	dn_vector_custom_init (&var_name, &__vector_params_ ## var_name, sizeof (element_type));
+
 void
 dn_vector_custom_dispose (
 	dn_vector_t *vector,
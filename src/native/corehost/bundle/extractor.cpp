@@ -6,7 +6,10 @@
 #include "dir_utils.h"
 #include "pal.h"
 #include "utils.h"
+#include <algorithm>
+#include <atomic>
 #include <cinttypes>
+#include <thread>
 
 #ifdef __sun
 #include <alloca.h>
@@ -24,6 +27,10 @@ extern "C"
 
 using namespace bundle;
 
+// Extraction overlaps decompression with file I/O, so a few workers are
+// enough to saturate the disk; more threads only add contention.
+static const size_t max_extraction_workers = 4;
+
 pal::string_t& extractor_t::extraction_dir()
 {
     if (m_extraction_dir.empty())
@@ -280,13 +287,79 @@ void extractor_t::commit_file(const pal::string_t& relative_path)
 void extractor_t::extract_new(reader_t& reader)
 {
     begin();
+
+    std::vector<const file_entry_t*> entries;
     for (const file_entry_t& entry : m_manifest.files)
     {
         if (entry.needs_extraction())
         {
-            extract(entry, reader);
+            entries.push_back(&entry);
+        }
+    }
+
+    size_t worker_count = std::min<size_t>(
+        std::min<size_t>(entries.size(), max_extraction_workers),
+        std::thread::hardware_concurrency());
+
+    if (worker_count > 1)
+    {
+        // Extract with several workers, each claiming entries from a shared
+        // cursor.  Workers read the mapped bundle through their own copy of
+        // the reader, so no file-offset state is shared; directory creation
+        // in create_extraction_file() already tolerates concurrent callers.
+        trace::info(_X("Extracting %zu bundled files using %zu workers."), entries.size(), worker_count);
+
+        std::atomic<size_t> cursor(0);
+        std::atomic<int> failure(StatusCode::Success);
+
+        auto worker = [&](reader_t worker_reader)
+        {
+            for (size_t i = cursor.fetch_add(1); i < entries.size(); i = cursor.fetch_add(1))
+            {
+                if (failure.load() != StatusCode::Success)
+                {
+                    return;
+                }
+
+                try
+                {
+                    extract(*entries[i], worker_reader);
+                }
+                catch (StatusCode status)
+                {
+                    int expected = StatusCode::Success;
+                    failure.compare_exchange_strong(expected, status);
+                    return;
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < worker_count; ++i)
+        {
+            workers.emplace_back(worker, reader);
+        }
+
+        worker(reader);
+
+        for (std::thread& thread : workers)
+        {
+            thread.join();
+        }
+
+        if (failure.load() != StatusCode::Success)
+        {
+            throw static_cast<StatusCode>(failure.load());
         }
     }
+    else
+    {
+        for (const file_entry_t* entry : entries)
+        {
+            extract(*entry, reader);
+        }
+    }
+
     commit_dir();
 }
 
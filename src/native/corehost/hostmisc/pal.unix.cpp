@@ -973,6 +973,19 @@ bool pal::file_exists(const pal::string_t& path)
     return (::access(path.c_str(), F_OK) == 0);
 }
 
+bool pal::get_file_mtime_and_size(const pal::string_t& path, int64_t* mtime, int64_t* size)
+{
+    struct stat st;
+    if (::stat(path.c_str(), &st) != 0)
+    {
+        return false;
+    }
+
+    *mtime = static_cast<int64_t>(st.st_mtime);
+    *size = static_cast<int64_t>(st.st_size);
+    return true;
+}
+
 static void readdir(const pal::string_t& path, const pal::string_t& pattern, bool onlydirectories, std::vector<pal::string_t>* list)
 {
     assert(list != nullptr);
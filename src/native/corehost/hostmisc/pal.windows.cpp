@@ -807,6 +807,19 @@ bool pal::file_exists(const string_t& path)
     return pal::realpath(&tmp, true);
 }
 
+bool pal::get_file_mtime_and_size(const string_t& path, int64_t* mtime, int64_t* size)
+{
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!::GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data))
+    {
+        return false;
+    }
+
+    *mtime = (static_cast<int64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+    *size = (static_cast<int64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    return true;
+}
+
 static void readdir(const pal::string_t& path, const pal::string_t& pattern, bool onlydirectories, std::vector<pal::string_t>* list)
 {
     assert(list != nullptr);
@@ -16,6 +16,7 @@ list(APPEND SOURCES
     ${CMAKE_CURRENT_LIST_DIR}/hostpolicy_context.cpp
     ${CMAKE_CURRENT_LIST_DIR}/hostpolicy.cpp
     ${CMAKE_CURRENT_LIST_DIR}/hostpolicy_init.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/resolution_cache.cpp
     ${CMAKE_CURRENT_LIST_DIR}/shared_store.cpp
     ${CMAKE_CURRENT_LIST_DIR}/version.cpp
     ${CMAKE_CURRENT_LIST_DIR}/../bundle/dir_utils.cpp
@@ -34,6 +35,7 @@ list(APPEND HEADERS
     ${CMAKE_CURRENT_LIST_DIR}/deps_resolver.h
     ${CMAKE_CURRENT_LIST_DIR}/hostpolicy_context.h
     ${CMAKE_CURRENT_LIST_DIR}/hostpolicy_init.h
+    ${CMAKE_CURRENT_LIST_DIR}/resolution_cache.h
     ${CMAKE_CURRENT_LIST_DIR}/shared_store.h
     ${CMAKE_CURRENT_LIST_DIR}/version.h
     ${CMAKE_CURRENT_LIST_DIR}/../hostpolicy.h
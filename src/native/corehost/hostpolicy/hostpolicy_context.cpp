@@ -10,6 +10,7 @@
 #include <trace.h>
 #include "bundle/runner.h"
 #include "bundle/file_entry.h"
+#include "resolution_cache.h"
 #include "shared_store.h"
 
 namespace
@@ -142,26 +143,6 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
     host_path = hostpolicy_init.host_info.host_path;
     breadcrumbs_enabled = enable_breadcrumbs;
 
-    deps_resolver_t resolver
-    {
-        args,
-        hostpolicy_init.fx_definitions,
-        hostpolicy_init.additional_deps_serialized.c_str(),
-        shared_store::get_paths(hostpolicy_init.tfm, host_mode, host_path),
-        hostpolicy_init.probe_paths,
-        /* root_framework_rid_fallback_graph */ nullptr, // This means that the fx_definitions contains the root framework
-        hostpolicy_init.is_framework_dependent
-    };
-
-    pal::string_t resolver_errors;
-    if (!resolver.valid(&resolver_errors))
-    {
-        trace::error(_X("Error initializing the dependency resolver: %s"), resolver_errors.c_str());
-        return StatusCode::ResolverInitFailure;
-    }
-
-    probe_paths_t probe_paths;
-
     // Setup breadcrumbs.
     if (breadcrumbs_enabled)
     {
@@ -171,20 +152,85 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         // Always insert the hostpolicy that the code is running on.
         breadcrumbs.insert(policy_name);
         breadcrumbs.insert(policy_name + _X(",") + policy_version);
+    }
 
-        if (!resolver.resolve_probe_paths(&probe_paths, &breadcrumbs))
+    resolution_cache_t resolution_cache(hostpolicy_init, args, enable_breadcrumbs);
+    resolution_cache_t::payload_t resolution;
+    if (resolution_cache.enabled() && resolution_cache.try_load(&resolution))
+    {
+        for (const pal::string_t& breadcrumb : resolution.breadcrumbs)
         {
-            return StatusCode::ResolverResolveFailure;
+            breadcrumbs.insert(breadcrumb);
         }
     }
     else
     {
-        if (!resolver.resolve_probe_paths(&probe_paths, nullptr))
+        deps_resolver_t resolver
+        {
+            args,
+            hostpolicy_init.fx_definitions,
+            hostpolicy_init.additional_deps_serialized.c_str(),
+            shared_store::get_paths(hostpolicy_init.tfm, host_mode, host_path),
+            hostpolicy_init.probe_paths,
+            /* root_framework_rid_fallback_graph */ nullptr, // This means that the fx_definitions contains the root framework
+            hostpolicy_init.is_framework_dependent
+        };
+
+        pal::string_t resolver_errors;
+        if (!resolver.valid(&resolver_errors))
+        {
+            trace::error(_X("Error initializing the dependency resolver: %s"), resolver_errors.c_str());
+            return StatusCode::ResolverInitFailure;
+        }
+
+        if (!resolver.resolve_probe_paths(&resolution.probe_paths, breadcrumbs_enabled ? &breadcrumbs : nullptr))
         {
             return StatusCode::ResolverResolveFailure;
         }
+
+        if (resolver.is_framework_dependent())
+        {
+            // Use the root fx to define FX_DEPS_FILE
+            resolution.fx_deps_file = resolver.get_root_deps().get_deps_file();
+        }
+
+        std::vector<pal::string_t> deps_files;
+        resolver.enum_app_context_deps_files([&](const pal::string_t& deps_file)
+        {
+            deps_files.push_back(deps_file);
+
+            if (!resolution.app_context_deps_files.empty())
+                resolution.app_context_deps_files += _X(';');
+
+            // For the application's .deps.json if this is single file, 3.1 backward compat
+            // then the path used internally is the bundle path, but externally we need to report
+            // the path to the extraction folder.
+            if (resolution.app_context_deps_files.empty() && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
+            {
+                pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
+                append_path(&deps_path, get_filename(deps_file).c_str());
+                resolution.app_context_deps_files += deps_path;
+            }
+            else
+            {
+                resolution.app_context_deps_files += deps_file;
+            }
+        });
+
+        resolver.get_app_dir(&resolution.app_dir);
+        resolution.lookup_probe_directories = resolver.get_lookup_probe_directories();
+
+        if (resolution_cache.enabled())
+        {
+            if (breadcrumbs_enabled)
+                resolution.breadcrumbs.assign(breadcrumbs.begin(), breadcrumbs.end());
+
+            resolution_cache.try_save(resolution, deps_files);
+        }
     }
 
+    probe_paths_t& probe_paths = resolution.probe_paths;
+
     clr_path = probe_paths.coreclr;
     if (clr_path.empty() || !pal::realpath(&clr_path))
     {
@@ -224,44 +270,15 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         probe_paths.tpa.append(corelib_path);
     }
 
-    pal::string_t fx_deps_str;
-    if (resolver.is_framework_dependent())
-    {
-        // Use the root fx to define FX_DEPS_FILE
-        fx_deps_str = resolver.get_root_deps().get_deps_file();
-    }
-
-    pal::string_t app_context_deps_str;
-    resolver.enum_app_context_deps_files([&](const pal::string_t& deps_file)
-    {
-        if (!app_context_deps_str.empty())
-            app_context_deps_str += _X(';');
-
-        // For the application's .deps.json if this is single file, 3.1 backward compat
-        // then the path used internally is the bundle path, but externally we need to report
-        // the path to the extraction folder.
-        if (app_context_deps_str.empty() && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
-        {
-            pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
-            append_path(&deps_path, get_filename(deps_file).c_str());
-            app_context_deps_str += deps_path;
-        }
-        else
-        {
-            app_context_deps_str += deps_file;
-        }
-    });
-
     // Build properties for CoreCLR instantiation
-    pal::string_t app_base;
-    resolver.get_app_dir(&app_base);
+    const pal::string_t& app_base = resolution.app_dir;
     coreclr_properties.add(common_property::TrustedPlatformAssemblies, probe_paths.tpa.c_str());
     coreclr_properties.add(common_property::NativeDllSearchDirectories, probe_paths.native.c_str());
     coreclr_properties.add(common_property::PlatformResourceRoots, probe_paths.resources.c_str());
     coreclr_properties.add(common_property::AppContextBaseDirectory, app_base.c_str());
-    coreclr_properties.add(common_property::AppContextDepsFiles, app_context_deps_str.c_str());
-    coreclr_properties.add(common_property::FxDepsFile, fx_deps_str.c_str());
-    coreclr_properties.add(common_property::ProbingDirectories, resolver.get_lookup_probe_directories().c_str());
+    coreclr_properties.add(common_property::AppContextDepsFiles, resolution.app_context_deps_files.c_str());
+    coreclr_properties.add(common_property::FxDepsFile, resolution.fx_deps_file.c_str());
+    coreclr_properties.add(common_property::ProbingDirectories, resolution.lookup_probe_directories.c_str());
     coreclr_properties.add(common_property::RuntimeIdentifier, get_current_runtime_id(true /*use_fallback*/).c_str());
 
     bool set_app_paths = false;
@@ -0,0 +1,246 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "resolution_cache.h"
+
+#include <trace.h>
+#include <utils.h>
+#include "bundle/info.h"
+#include "shared_store.h"
+
+#include <fstream>
+
+namespace
+{
+    // Bumped whenever the record layout below changes.
+    constexpr int format_version = 1;
+
+    // Upper bound on a single record; anything larger is treated as corruption.
+    constexpr size_t max_record_length = 64 * 1024 * 1024;
+
+    // Records are written as "<byte length>\n<UTF-8 bytes>\n" so that paths
+    // containing arbitrary characters round-trip safely.
+    bool write_record(std::ofstream& file, const pal::string_t& value)
+    {
+        std::vector<char> utf8;
+        if (!pal::pal_utf8string(value, &utf8))
+            return false;
+
+        size_t length = utf8.size() - 1; // drop the null terminator
+        file << length << '\n';
+        file.write(utf8.data(), length);
+        file.put('\n');
+        return file.good();
+    }
+
+    bool read_record(pal::ifstream_t& file, pal::string_t* value)
+    {
+        size_t length;
+        if (!(file >> length) || length > max_record_length || file.get() != '\n')
+            return false;
+
+        std::vector<char> utf8(length + 1, '\0');
+        file.read(utf8.data(), length);
+        if (!file.good() || file.get() != '\n')
+            return false;
+
+        return pal::clr_palstring(utf8.data(), value);
+    }
+}
+
+resolution_cache_t::resolution_cache_t(const hostpolicy_init_t& init, const arguments_t& args, bool breadcrumbs_enabled)
+{
+    if (!pal::getenv(_X("DOTNET_HOST_RESOLUTION_CACHE"), &m_cache_path) || m_cache_path.empty())
+        return;
+
+    if (bundle::info_t::is_single_file_bundle())
+    {
+        // Bundled apps resolve against in-bundle deps data that cannot be
+        // validated by file times; never cache them.
+        trace::verbose(_X("Dependency resolution cache is disabled for single-file bundles"));
+        m_cache_path.clear();
+        return;
+    }
+
+    // Everything that influences resolution other than the contents of the
+    // deps files themselves, which are validated separately by size/mtime.
+    pal::stringstream_t key;
+    key << _STRINGIFY(HOST_POLICY_PKG_VER)
+        << _X('|') << format_version
+        << _X('|') << get_current_runtime_id(true /*use_fallback*/)
+        << _X('|') << init.tfm
+        << _X('|') << static_cast<int>(init.host_mode)
+        << _X('|') << (breadcrumbs_enabled ? 1 : 0)
+        << _X('|') << args.managed_application
+        << _X('|') << args.deps_path
+        << _X('|') << init.additional_deps_serialized;
+
+    for (const pal::string_t& probe : init.probe_paths)
+    {
+        key << _X('|') << probe;
+    }
+
+    for (const pal::string_t& store : shared_store::get_paths(init.tfm, init.host_mode, init.host_info.host_path))
+    {
+        key << _X('|') << store;
+    }
+
+    for (const auto& fx : init.fx_definitions)
+    {
+        key << _X('|') << fx->get_name() << _X(':') << fx->get_found_version() << _X('@') << fx->get_dir();
+    }
+
+    m_key = key.str();
+}
+
+bool resolution_cache_t::try_load(payload_t* payload) const
+{
+    pal::ifstream_t file(m_cache_path, std::ios::binary);
+    if (!file.good())
+    {
+        trace::verbose(_X("Dependency resolution cache [%s] could not be opened for reading"), m_cache_path.c_str());
+        return false;
+    }
+
+    int version;
+    if (!(file >> version) || version != format_version)
+    {
+        trace::verbose(_X("Dependency resolution cache [%s] has an unexpected format version"), m_cache_path.c_str());
+        return false;
+    }
+
+    pal::string_t key;
+    if (!read_record(file, &key) || key != m_key)
+    {
+        trace::verbose(_X("Dependency resolution cache [%s] was written for a different host configuration"), m_cache_path.c_str());
+        return false;
+    }
+
+    size_t file_count;
+    if (!(file >> file_count) || file_count > max_record_length)
+        return false;
+
+    for (size_t i = 0; i < file_count; ++i)
+    {
+        pal::string_t path;
+        int64_t expected_size;
+        int64_t expected_mtime;
+        if (!read_record(file, &path) || !(file >> expected_size) || !(file >> expected_mtime))
+            return false;
+
+        int64_t mtime;
+        int64_t size;
+        if (!pal::get_file_mtime_and_size(path, &mtime, &size) || size != expected_size || mtime != expected_mtime)
+        {
+            trace::verbose(_X("Dependency resolution cache [%s] is stale: [%s] changed"), m_cache_path.c_str(), path.c_str());
+            return false;
+        }
+    }
+
+    if (!read_record(file, &payload->probe_paths.tpa)
+        || !read_record(file, &payload->probe_paths.native)
+        || !read_record(file, &payload->probe_paths.resources)
+        || !read_record(file, &payload->probe_paths.coreclr)
+        || !read_record(file, &payload->fx_deps_file)
+        || !read_record(file, &payload->app_context_deps_files)
+        || !read_record(file, &payload->app_dir)
+        || !read_record(file, &payload->lookup_probe_directories))
+    {
+        trace::verbose(_X("Dependency resolution cache [%s] is truncated or corrupt"), m_cache_path.c_str());
+        return false;
+    }
+
+    size_t breadcrumb_count;
+    if (!(file >> breadcrumb_count) || breadcrumb_count > max_record_length)
+        return false;
+
+    payload->breadcrumbs.resize(breadcrumb_count);
+    for (size_t i = 0; i < breadcrumb_count; ++i)
+    {
+        if (!read_record(file, &payload->breadcrumbs[i]))
+            return false;
+    }
+
+    trace::verbose(_X("Dependency resolution cache hit [%s]"), m_cache_path.c_str());
+    return true;
+}
+
+void resolution_cache_t::try_save(const payload_t& payload, const std::vector<pal::string_t>& deps_files) const
+{
+    // Stat the inputs before writing anything; if any deps file cannot be
+    // validated later, the entry would never be usable.
+    std::vector<pal::string_t> paths;
+    std::vector<int64_t> mtimes;
+    std::vector<int64_t> sizes;
+    for (const pal::string_t& path : deps_files)
+    {
+        int64_t mtime;
+        int64_t size;
+        if (!pal::get_file_mtime_and_size(path, &mtime, &size))
+        {
+            trace::verbose(_X("Not writing dependency resolution cache [%s]: cannot stat [%s]"), m_cache_path.c_str(), path.c_str());
+            return;
+        }
+
+        paths.push_back(path);
+        mtimes.push_back(mtime);
+        sizes.push_back(size);
+    }
+
+    // Write to a temporary file and rename it into place so that concurrent
+    // starts never observe a partially written cache.
+    pal::string_t temp_path = m_cache_path + _X(".tmp");
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (!file.good())
+        {
+            trace::verbose(_X("Dependency resolution cache [%s] could not be opened for writing"), temp_path.c_str());
+            return;
+        }
+
+        file << format_version << '\n';
+
+        bool success = write_record(file, m_key);
+
+        file << paths.size() << '\n';
+        for (size_t i = 0; success && i < paths.size(); ++i)
+        {
+            success = write_record(file, paths[i]);
+            file << sizes[i] << '\n' << mtimes[i] << '\n';
+        }
+
+        success = success
+            && write_record(file, payload.probe_paths.tpa)
+            && write_record(file, payload.probe_paths.native)
+            && write_record(file, payload.probe_paths.resources)
+            && write_record(file, payload.probe_paths.coreclr)
+            && write_record(file, payload.fx_deps_file)
+            && write_record(file, payload.app_context_deps_files)
+            && write_record(file, payload.app_dir)
+            && write_record(file, payload.lookup_probe_directories);
+
+        file << payload.breadcrumbs.size() << '\n';
+        for (size_t i = 0; success && i < payload.breadcrumbs.size(); ++i)
+        {
+            success = write_record(file, payload.breadcrumbs[i]);
+        }
+
+        file.flush();
+        if (!success || !file.good())
+        {
+            trace::verbose(_X("Failed to write dependency resolution cache [%s]"), temp_path.c_str());
+            file.close();
+            pal::remove(temp_path.c_str());
+            return;
+        }
+    }
+
+    if (pal::rename(temp_path.c_str(), m_cache_path.c_str()) != 0)
+    {
+        trace::verbose(_X("Failed to move dependency resolution cache into place at [%s]"), m_cache_path.c_str());
+        pal::remove(temp_path.c_str());
+        return;
+    }
+
+    trace::verbose(_X("Wrote dependency resolution cache [%s]"), m_cache_path.c_str());
+}
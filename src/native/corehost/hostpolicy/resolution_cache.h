@@ -0,0 +1,58 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef __RESOLUTION_CACHE_H__
+#define __RESOLUTION_CACHE_H__
+
+#include <pal.h>
+
+#include "args.h"
+#include "deps_resolver.h"
+#include "hostpolicy_init.h"
+
+// Opt-in cache of the outputs of dependency resolution, enabled by pointing
+// DOTNET_HOST_RESOLUTION_CACHE at a cache file path. The first successful
+// start writes the resolved probe paths and derived runtime properties to the
+// cache; subsequent starts of the same configuration read them back without
+// parsing deps.json or probing the disk for assets.
+//
+// An entry is only used when the host configuration key (host version, RID,
+// app, probe paths, etc.) matches and the size and last-write time of every
+// deps file that produced the entry are unchanged. Any mismatch or read
+// failure falls back to full resolution, which rewrites the cache.
+//
+// The caller opting in owns the cache file's location and permissions; the
+// file contents determine the assembly list handed to the runtime, so it must
+// not be writable by less-trusted principals.
+class resolution_cache_t
+{
+public:
+    // The resolver outputs consumed by hostpolicy_context_t::initialize.
+    struct payload_t
+    {
+        probe_paths_t probe_paths;
+        pal::string_t fx_deps_file;
+        pal::string_t app_context_deps_files;
+        pal::string_t app_dir;
+        pal::string_t lookup_probe_directories;
+        std::vector<pal::string_t> breadcrumbs;
+    };
+
+    resolution_cache_t(const hostpolicy_init_t& init, const arguments_t& args, bool breadcrumbs_enabled);
+
+    bool enabled() const { return !m_cache_path.empty(); }
+
+    // Attempts to read a payload valid for the current configuration.
+    // Returns false (without tracing an error) on any mismatch.
+    bool try_load(payload_t* payload) const;
+
+    // Writes the payload, validated by the size/mtime of deps_files.
+    // Failures are traced but not surfaced; the cache is best-effort.
+    void try_save(const payload_t& payload, const std::vector<pal::string_t>& deps_files) const;
+
+private:
+    pal::string_t m_cache_path;
+    pal::string_t m_key;
+};
+
+#endif // __RESOLUTION_CACHE_H__
@@ -8,6 +8,17 @@
 // https://github.com/Tencent/rapidjson/issues/1596#issuecomment-548774663
 #define RAPIDJSON_48BITPOINTER_OPTIMIZATION 0
 
+// Use RapidJSON's SIMD string scanning and whitespace skipping where the
+// instruction set is part of the target's baseline; deps.json files can run
+// to several MB and parse time is a measurable part of host startup.  This
+// must be defined before any RapidJSON header is included, so all corehost
+// code includes RapidJSON through this header.
+#if defined(_M_X64) || defined(__x86_64__)
+#define RAPIDJSON_SSE2
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define RAPIDJSON_NEON
+#endif
+
 #include "pal.h"
 #include <external/rapidjson/document.h>
 #include <external/rapidjson/fwd.h>
@@ -77,6 +77,31 @@ process_protocol_helper_set_environment_variable (
 	DiagnosticsIpcMessage *message,
 	DiagnosticsIpcStream *stream);
 
+static
+uint8_t *
+create_heap_snapshot_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len);
+
+static
+bool
+process_protocol_helper_create_heap_snapshot (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream);
+
+static
+bool
+runtime_lock_stats_payload_flatten (
+	void *payload,
+	uint8_t **buffer,
+	uint16_t *size);
+
+static
+bool
+process_protocol_helper_get_runtime_lock_stats (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream);
+
 static
 bool
 process_protocol_helper_unknown_command (
@@ -745,6 +770,171 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+DiagnosticsCreateHeapSnapshotPayload *
+ds_create_heap_snapshot_payload_alloc (void)
+{
+	return ep_rt_object_alloc (DiagnosticsCreateHeapSnapshotPayload);
+}
+
+void
+ds_create_heap_snapshot_payload_free (DiagnosticsCreateHeapSnapshotPayload *payload)
+{
+	ep_return_void_if_nok (payload != NULL);
+	ep_rt_byte_array_free (payload->incoming_buffer);
+	ep_rt_object_free (payload);
+}
+
+static
+uint8_t *
+create_heap_snapshot_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len)
+{
+	EP_ASSERT (buffer != NULL);
+
+	uint8_t * buffer_cursor = buffer;
+	uint32_t buffer_cursor_len = buffer_len;
+
+	DiagnosticsCreateHeapSnapshotPayload *instance = ds_create_heap_snapshot_payload_alloc ();
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->incoming_buffer = buffer;
+
+	if (!ds_ipc_message_try_parse_string_utf16_t (&buffer_cursor, &buffer_cursor_len, &instance->snapshot_name) ||
+		!ds_ipc_message_try_parse_uint32_t (&buffer_cursor, &buffer_cursor_len, &instance->flags))
+		ep_raise_error ();
+
+ep_on_exit:
+	return (uint8_t *)instance;
+
+ep_on_error:
+	ds_create_heap_snapshot_payload_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+static
+bool
+process_protocol_helper_create_heap_snapshot (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	EP_ASSERT (message != NULL);
+	EP_ASSERT (stream != NULL);
+
+	if (!stream)
+		return false;
+
+	bool result = false;
+	ep_char8_t error_message [1024];
+	error_message [0] = '\0';
+
+	DiagnosticsCreateHeapSnapshotPayload *payload = (DiagnosticsCreateHeapSnapshotPayload *)ds_ipc_message_try_parse_payload (message, create_heap_snapshot_command_try_parse_payload);
+	if (!payload) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_BAD_ENCODING);
+		ep_raise_error ();
+	}
+
+	ds_ipc_result_t ipc_result;
+	ipc_result = ds_rt_create_heap_snapshot (payload->snapshot_name, payload->flags, error_message, (int32_t)sizeof (error_message));
+	if (ipc_result != DS_IPC_S_OK) {
+		DS_LOG_WARNING_1 ("Failed to create heap snapshot: %s", error_message);
+		ds_ipc_message_send_error (stream, ipc_result);
+		ep_raise_error ();
+	} else {
+		ds_ipc_message_send_success (stream, ipc_result);
+	}
+
+	result = true;
+
+ep_on_exit:
+	ds_create_heap_snapshot_payload_free (payload);
+	ds_ipc_stream_free (stream);
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	ep_exit_error_handler ();
+}
+
+/*
+ * DiagnosticsRuntimeLockStatsPayload.
+ */
+
+// The runtime hands back an already serialized histogram block
+// (see ds_rt_runtime_lock_stats_get), so flattening is a plain copy.
+typedef struct _DiagnosticsRuntimeLockStatsPayload {
+	uint8_t *stats_buffer;
+	uint32_t stats_buffer_len;
+} DiagnosticsRuntimeLockStatsPayload;
+
+static
+bool
+runtime_lock_stats_payload_flatten (
+	void *payload,
+	uint8_t **buffer,
+	uint16_t *size)
+{
+	DiagnosticsRuntimeLockStatsPayload *lock_stats = (DiagnosticsRuntimeLockStatsPayload *)payload;
+
+	EP_ASSERT (payload != NULL);
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (*buffer != NULL);
+	EP_ASSERT (size != NULL);
+	EP_ASSERT (lock_stats->stats_buffer_len == *size);
+
+	memcpy (*buffer, lock_stats->stats_buffer, lock_stats->stats_buffer_len);
+	*buffer += lock_stats->stats_buffer_len;
+	*size -= (uint16_t)lock_stats->stats_buffer_len;
+
+	// Assert we've used the whole buffer we were given
+	EP_ASSERT (*size == 0);
+
+	return true;
+}
+
+static
+bool
+process_protocol_helper_get_runtime_lock_stats (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	EP_ASSERT (message != NULL);
+	EP_ASSERT (stream != NULL);
+
+	bool result = false;
+	DiagnosticsRuntimeLockStatsPayload payload;
+	payload.stats_buffer = NULL;
+	payload.stats_buffer_len = 0;
+
+	ds_ipc_result_t ipc_result;
+	ipc_result = ds_rt_runtime_lock_stats_get (&payload.stats_buffer, &payload.stats_buffer_len);
+	if (ipc_result != DS_IPC_S_OK || payload.stats_buffer_len > UINT16_MAX) {
+		ds_ipc_message_send_error (stream, ipc_result != DS_IPC_S_OK ? ipc_result : DS_IPC_E_FAIL);
+		ep_raise_error ();
+	}
+
+	ep_raise_error_if_nok (ds_ipc_message_initialize_buffer (
+		message,
+		ds_ipc_header_get_generic_success (),
+		(void *)&payload,
+		(uint16_t)payload.stats_buffer_len,
+		runtime_lock_stats_payload_flatten));
+
+	ep_raise_error_if_nok (ds_ipc_message_send (message, stream));
+
+	result = true;
+
+ep_on_exit:
+	ep_rt_byte_array_free (payload.stats_buffer);
+	ds_ipc_stream_free (stream);
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	ep_exit_error_handler ();
+}
+
 static
 bool
 process_protocol_helper_unknown_command (
@@ -783,6 +973,12 @@ ds_process_protocol_helper_handle_ipc_message (
 	case DS_PROCESS_COMMANDID_GET_PROCESS_INFO_2:
 		result = process_protocol_helper_get_process_info_2 (message, stream);
 		break;
+	case DS_PROCESS_COMMANDID_CREATE_HEAP_SNAPSHOT:
+		result = process_protocol_helper_create_heap_snapshot (message, stream);
+		break;
+	case DS_PROCESS_COMMANDID_GET_RUNTIME_LOCK_STATS:
+		result = process_protocol_helper_get_runtime_lock_stats (message, stream);
+		break;
 	default:
 		result = process_protocol_helper_unknown_command (message, stream);
 		break;
@@ -164,6 +164,34 @@ ds_set_environment_variable_payload_alloc (void);
 void
 ds_set_environment_variable_payload_free (DiagnosticsSetEnvironmentVariablePayload *payload);
 
+/*
+* DiagnosticsCreateHeapSnapshotPayload
+*/
+
+#if defined(DS_INLINE_GETTER_SETTER) || defined(DS_IMPL_PROCESS_PROTOCOL_GETTER_SETTER)
+struct _DiagnosticsCreateHeapSnapshotPayload {
+#else
+struct _DiagnosticsCreateHeapSnapshotPayload_Internal {
+#endif
+	uint8_t * incoming_buffer;
+
+	// CreateHeapSnapshot = string snapshotName, uint flags
+	const ep_char16_t *snapshot_name;
+	uint32_t flags;
+};
+
+#if !defined(DS_INLINE_GETTER_SETTER) && !defined(DS_IMPL_PROCESS_PROTOCOL_GETTER_SETTER)
+struct _DiagnosticsCreateHeapSnapshotPayload {
+	uint8_t _internal [sizeof (struct _DiagnosticsCreateHeapSnapshotPayload_Internal)];
+};
+#endif
+
+DiagnosticsCreateHeapSnapshotPayload *
+ds_create_heap_snapshot_payload_alloc (void);
+
+void
+ds_create_heap_snapshot_payload_free (DiagnosticsCreateHeapSnapshotPayload *payload);
+
 /*
  * DiagnosticsProcessProtocolHelper.
  */
@@ -103,6 +103,30 @@ static
 uint32_t
 ds_rt_set_environment_variable (const ep_char16_t *name, const ep_char16_t *value);
 
+/*
+* Heap snapshot
+*/
+
+static
+ds_ipc_result_t
+ds_rt_create_heap_snapshot (
+	const ep_char16_t *snapshotName,
+	uint32_t flags,
+	ep_char8_t *errorMessageBuffer,
+	int32_t cbErrorMessageBuffer);
+
+/*
+* Runtime lock statistics
+*/
+
+// On success the buffer is allocated by the runtime and must be freed by the
+// caller with ep_rt_byte_array_free.
+static
+ds_ipc_result_t
+ds_rt_runtime_lock_stats_get (
+	uint8_t **buffer,
+	uint32_t *buffer_len);
+
 static
 uint32_t
 ds_rt_get_environment_variable (const ep_char16_t *name,
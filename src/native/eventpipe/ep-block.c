@@ -723,6 +723,15 @@ static EventPipeBlockVtable event_block_vtable = {
 	block_base_get_header_size_func,
 	block_base_serialize_header_func };
 
+// Event blocks are emitted with per-event header compression (delta + varint
+// encoded headers) for NetTrace V4 and later; event payloads are written
+// uncompressed. General-purpose payload compression (LZ4/deflate) of blocks
+// cannot be added behind a session flag: the block layout is part of the
+// nettrace format contract with external readers, so a compressed block type
+// requires a new EventPipeSerializationFormat revision coordinated with the
+// diagnostic clients, and this library deliberately carries no compression
+// dependency. Consumers that need smaller streams compress at the transport
+// or post-process the file.
 EventPipeEventBlock *
 ep_event_block_alloc (
 	uint32_t max_block_size,
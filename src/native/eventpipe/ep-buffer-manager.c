@@ -496,6 +496,12 @@ buffer_manager_allocate_buffer_for_thread (
 	new_buffer = ep_buffer_alloc (buffer_size, ep_thread_session_state_get_thread (thread_session_state), sequence_number);
 	ep_raise_error_if_nok (new_buffer != NULL);
 
+	// If sequence points are enabled, speculatively allocate one outside the lock.
+	// Whether it is needed depends on the remaining budget, which can only be
+	// inspected while holding the lock; an unused allocation is freed on exit.
+	if (buffer_manager->sequence_point_alloc_budget != 0)
+		sequence_point = ep_sequence_point_alloc ();
+
 	// Adding a buffer to the buffer list requires us to take the lock.
 	EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
 		thread_buffer_list = ep_thread_session_state_get_buffer_list (thread_session_state);
@@ -511,7 +517,6 @@ buffer_manager_allocate_buffer_for_thread (
 		if (buffer_manager->sequence_point_alloc_budget != 0) {
 			// sequence point bookkeeping
 			if (buffer_size >= buffer_manager->remaining_sequence_point_alloc_budget) {
-				sequence_point = ep_sequence_point_alloc ();
 				if (sequence_point) {
 					buffer_manager_init_sequence_point_thread_list (buffer_manager, sequence_point);
 					ep_raise_error_if_nok_holding_spin_lock (buffer_manager_enqueue_sequence_point (buffer_manager, sequence_point), section1);
@@ -533,13 +538,13 @@ buffer_manager_allocate_buffer_for_thread (
 	EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section1)
 
 ep_on_exit:
+	// Free the speculative sequence point if the budget check did not consume it.
+	ep_sequence_point_free (sequence_point);
+	sequence_point = NULL;
 
 	return new_buffer;
 
 ep_on_error:
-	ep_sequence_point_free (sequence_point);
-	sequence_point = NULL;
-
 	ep_buffer_list_free (thread_buffer_list);
 	thread_buffer_list = NULL;
 
@@ -47,6 +47,10 @@ fast_serializer_write_serialization_type (
 	FastSerializer *fast_serializer,
 	FastSerializableObject *fast_serializable_object);
 
+static
+void
+fast_serializer_flush_staging (FastSerializer *fast_serializer);
+
 /*
  * FastSerializableObject.
  */
@@ -174,9 +178,14 @@ ep_fast_serializer_alloc (StreamWriter *stream_writer)
 	instance->stream_writer = stream_writer;
 	instance->required_padding = 0;
 	instance->write_error_encountered = false;
+	instance->staging_buffer_len = 0;
 
 	ep_fast_serializer_write_string (instance, signature, signature_len);
 
+	// Push the stream signature out right away so a streaming reader does not
+	// wait on staged bytes for the handshake.
+	fast_serializer_flush_staging (instance);
+
 ep_on_exit:
 	return instance;
 
@@ -192,11 +201,31 @@ ep_fast_serializer_free (FastSerializer *fast_serializer)
 	ep_return_void_if_nok (fast_serializer != NULL);
 
 	EP_ASSERT (fast_serializer->stream_writer != NULL);
+	fast_serializer_flush_staging (fast_serializer);
 	ep_stream_writer_free_vcall (fast_serializer->stream_writer);
 
 	ep_rt_object_free (fast_serializer);
 }
 
+static
+void
+fast_serializer_flush_staging (FastSerializer *fast_serializer)
+{
+	EP_ASSERT (fast_serializer != NULL);
+
+	ep_return_void_if_nok (fast_serializer->staging_buffer_len != 0);
+
+	uint32_t bytes_to_write = fast_serializer->staging_buffer_len;
+	fast_serializer->staging_buffer_len = 0;
+
+	ep_return_void_if_nok (!fast_serializer->write_error_encountered && fast_serializer->stream_writer != NULL);
+
+	// Padding bookkeeping already happened when the bytes were staged.
+	uint32_t bytes_written = 0;
+	bool result = ep_stream_writer_write (fast_serializer->stream_writer, fast_serializer->staging_buffer, bytes_to_write, &bytes_written);
+	fast_serializer->write_error_encountered = ((bytes_to_write != bytes_written) || !result);
+}
+
 void
 ep_fast_serializer_write_buffer (
 	FastSerializer *fast_serializer,
@@ -209,6 +238,23 @@ ep_fast_serializer_write_buffer (
 
 	ep_return_void_if_nok (!fast_serializer->write_error_encountered && fast_serializer->stream_writer != NULL);
 
+	// Flush staged bytes first whenever this write can not be staged too,
+	// so bytes always reach the stream in serialization order.
+	if (buffer_len > FAST_SERIALIZER_STAGING_BUFFER_SIZE - fast_serializer->staging_buffer_len)
+		fast_serializer_flush_staging (fast_serializer);
+
+	if (buffer_len <= FAST_SERIALIZER_STAGING_BUFFER_SIZE) {
+		// Small write (tag, version, field value, block header): coalesce it
+		// instead of paying a stream write per field.
+		memcpy (fast_serializer->staging_buffer + fast_serializer->staging_buffer_len, buffer, buffer_len);
+		fast_serializer->staging_buffer_len += buffer_len;
+
+		uint32_t required_padding = fast_serializer->required_padding;
+		required_padding = (FAST_SERIALIZER_ALIGNMENT_SIZE + required_padding - (buffer_len % FAST_SERIALIZER_ALIGNMENT_SIZE)) % FAST_SERIALIZER_ALIGNMENT_SIZE;
+		fast_serializer->required_padding = required_padding;
+		return;
+	}
+
 	uint32_t bytes_written = 0;
 	bool result = ep_stream_writer_write (fast_serializer->stream_writer, buffer, buffer_len, &bytes_written);
 
@@ -219,7 +265,7 @@ ep_fast_serializer_write_buffer (
 	// This will cause us to stop writing to the file.
 	// The file will still remain open until shutdown so that we don't
 	// have to take a lock at this level when we touch the file stream.
-	fast_serializer->write_error_encountered = ((buffer_len != bytes_written) || !result);
+	fast_serializer->write_error_encountered = ((buffer_len != bytes_written) || !result) || fast_serializer->write_error_encountered;
 }
 
 void
@@ -260,6 +306,10 @@ ep_fast_serializer_write_object (
 	ep_fast_serializable_object_fast_serialize_vcall (fast_serializable_object, fast_serializer);
 
 	ep_fast_serializer_write_tag (fast_serializer, FAST_SERIALIZER_TAGS_END_OBJECT, NULL, 0);
+
+	// Object boundaries are where streaming readers expect data to become
+	// visible - push out whatever is still staged.
+	fast_serializer_flush_staging (fast_serializer);
 }
 
 void
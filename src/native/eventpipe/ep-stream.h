@@ -154,6 +154,7 @@ ep_fast_serializable_object_fast_serialize_vcall (
  */
 
 #define FAST_SERIALIZER_ALIGNMENT_SIZE 4
+#define FAST_SERIALIZER_STAGING_BUFFER_SIZE 4096
 
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_STREAM_GETTER_SETTER)
 struct _FastSerializer {
@@ -163,6 +164,13 @@ struct _FastSerializer_Internal {
 	StreamWriter *stream_writer;
 	uint32_t required_padding;
 	bool write_error_encountered;
+	// Serializing an object produces many small writes (tags, versions, field
+	// values) around each payload; they are coalesced here and handed to the
+	// stream writer in one piece at object boundaries, so a streamed block
+	// costs one write (a syscall for IPC and file backed streams) instead of
+	// one per field.
+	uint32_t staging_buffer_len;
+	uint8_t staging_buffer [FAST_SERIALIZER_STAGING_BUFFER_SIZE];
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_STREAM_GETTER_SETTER)
@@ -19,3 +19,13 @@ static int pal_atomic_cas_ptr(void* volatile* dest, void* exchange, void* compar
     return InterlockedCompareExchangePointer(dest, exchange, comparand) == comparand;
 #endif
 }
+
+// Reads a pointer with acquire semantics, pairing with publication via pal_atomic_cas_ptr
+static void* pal_atomic_load_ptr(void* volatile* ptr)
+{
+#if defined(TARGET_UNIX)
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+#elif defined(TARGET_WINDOWS)
+    return ReadPointerAcquire(ptr);
+#endif
+}
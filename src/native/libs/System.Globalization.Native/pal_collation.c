@@ -57,8 +57,25 @@ struct SortHandle
 {
     UCollator* collatorsPerOption[CompareOptionsMask + 1];
     SearchIteratorNode searchIteratorList[CompareOptionsMask + 1];
+    int32_t isShared;
 };
 
+/*
+ * Cold collator creation is expensive (the full locale tailoring is loaded),
+ * so SortHandles are additionally shared process-wide per locale. The cache is
+ * a lock-free singly-linked list: readers traverse without synchronization and
+ * writers publish with a CAS on the list head. Entries are immortal; a shared
+ * SortHandle survives GlobalizationNative_CloseSortHandle.
+ */
+typedef struct SortHandleCacheEntry
+{
+    char* localeName;
+    SortHandle* sortHandle;
+    struct SortHandleCacheEntry* next;
+} SortHandleCacheEntry;
+
+static SortHandleCacheEntry* volatile g_sortHandleCache = NULL;
+
 // Hiragana character range
 static const UChar hiraganaStart = 0x3041;
 static const UChar hiraganaEnd = 0x309e;
@@ -464,10 +481,61 @@ static void CreateSortHandle(SortHandle** ppSortHandle)
     memset(*ppSortHandle, 0, sizeof(SortHandle));
 }
 
+static SortHandle* FindCachedSortHandle(const char* lpLocaleName)
+{
+    SortHandleCacheEntry* pEntry = (SortHandleCacheEntry*)pal_atomic_load_ptr((void* volatile*)&g_sortHandleCache);
+    for (; pEntry != NULL; pEntry = pEntry->next)
+    {
+        if (strcmp(pEntry->localeName, lpLocaleName) == 0)
+        {
+            return pEntry->sortHandle;
+        }
+    }
+
+    return NULL;
+}
+
+static void TryCacheSortHandle(const char* lpLocaleName, SortHandle* pSortHandle)
+{
+    size_t nameLength = strlen(lpLocaleName) + 1;
+    SortHandleCacheEntry* pEntry = (SortHandleCacheEntry*)malloc(sizeof(SortHandleCacheEntry));
+    char* localeName = (char*)malloc(nameLength);
+    if (pEntry == NULL || localeName == NULL)
+    {
+        // Failing to cache is not an error; the handle just stays caller-owned.
+        free(pEntry);
+        free(localeName);
+        return;
+    }
+
+    memcpy(localeName, lpLocaleName, nameLength);
+    pEntry->localeName = localeName;
+    pEntry->sortHandle = pSortHandle;
+    pSortHandle->isShared = true;
+
+    SortHandleCacheEntry* pHead;
+    do
+    {
+        pHead = (SortHandleCacheEntry*)pal_atomic_load_ptr((void* volatile*)&g_sortHandleCache);
+        pEntry->next = pHead;
+    }
+    while (!pal_atomic_cas_ptr((void* volatile*)&g_sortHandleCache, pEntry, pHead));
+
+    // Two threads racing on the same locale can both insert; lookups will then
+    // consistently return whichever entry sits closer to the head, and both
+    // handles stay valid for their original callers since neither is ever freed.
+}
+
 ResultCode GlobalizationNative_GetSortHandle(const char* lpLocaleName, SortHandle** ppSortHandle)
 {
     assert(ppSortHandle != NULL);
 
+    *ppSortHandle = FindCachedSortHandle(lpLocaleName);
+    if ((*ppSortHandle) != NULL)
+    {
+        return Success;
+    }
+
     CreateSortHandle(ppSortHandle);
     if ((*ppSortHandle) == NULL)
     {
@@ -483,6 +551,10 @@ ResultCode GlobalizationNative_GetSortHandle(const char* lpLocaleName, SortHandl
         free(*ppSortHandle);
         (*ppSortHandle) = NULL;
     }
+    else
+    {
+        TryCacheSortHandle(lpLocaleName, *ppSortHandle);
+    }
 
     return GetResultCode(err);
 }
@@ -633,6 +705,13 @@ static void CloseSearchIterator(UStringSearch* pSearch)
 
 void GlobalizationNative_CloseSortHandle(SortHandle* pSortHandle)
 {
+    // Shared handles are owned by the process-wide locale cache and may still
+    // be in use by other callers; they live until process exit.
+    if (pSortHandle->isShared)
+    {
+        return;
+    }
+
     for (int i = 0; i <= CompareOptionsMask; i++)
     {
         if (pSortHandle->collatorsPerOption[i] != NULL)
@@ -25,11 +25,16 @@ static const Entry s_compressionNative[] =
     DllImportEntry(BrotliEncoderSetParameter)
     DllImportEntry(CompressionNative_Crc32)
     DllImportEntry(CompressionNative_Deflate)
+    DllImportEntry(CompressionNative_DeflateBatch)
     DllImportEntry(CompressionNative_DeflateEnd)
     DllImportEntry(CompressionNative_DeflateInit2_)
+    DllImportEntry(CompressionNative_DeflateReset)
+    DllImportEntry(CompressionNative_DeflateSetDictionary)
     DllImportEntry(CompressionNative_Inflate)
     DllImportEntry(CompressionNative_InflateEnd)
     DllImportEntry(CompressionNative_InflateInit2_)
+    DllImportEntry(CompressionNative_InflateReset)
+    DllImportEntry(CompressionNative_InflateSetDictionary)
 };
 
 EXTERN_C const void* CompressionResolveDllImport(const char* name);
@@ -185,6 +185,98 @@ int32_t CompressionNative_InflateEnd(PAL_ZStream* stream)
     return result;
 }
 
+int32_t CompressionNative_DeflateReset(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = deflateReset(zStream);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
+int32_t CompressionNative_InflateReset(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = inflateReset(zStream);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
+int32_t CompressionNative_DeflateSetDictionary(PAL_ZStream* stream, uint8_t* dictionary, int32_t dictionaryLength)
+{
+    assert(stream != NULL);
+    assert(dictionary != NULL);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = deflateSetDictionary(zStream, dictionary, (uInt)dictionaryLength);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
+int32_t CompressionNative_InflateSetDictionary(PAL_ZStream* stream, uint8_t* dictionary, int32_t dictionaryLength)
+{
+    assert(stream != NULL);
+    assert(dictionary != NULL);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = inflateSetDictionary(zStream, dictionary, (uInt)dictionaryLength);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
+int32_t CompressionNative_DeflateBatch(
+    PAL_ZStream* stream, PAL_ZSegment* segments, int32_t segmentCount, uint8_t* dictionary, int32_t dictionaryLength)
+{
+    assert(stream != NULL);
+    assert(segments != NULL || segmentCount == 0);
+
+    z_stream* zStream = (z_stream*)(stream->internalState);
+    assert(zStream != NULL);
+
+    for (int32_t i = 0; i < segmentCount; i++)
+    {
+        int32_t result = deflateReset(zStream);
+        if (result == PAL_Z_OK && dictionary != NULL)
+        {
+            // deflateReset discards the sliding window, so the preset dictionary
+            // has to be re-applied for every payload.
+            result = deflateSetDictionary(zStream, dictionary, (uInt)dictionaryLength);
+        }
+
+        if (result != PAL_Z_OK)
+        {
+            stream->msg = zStream->msg;
+            return result;
+        }
+
+        zStream->next_in = segments[i].nextIn;
+        zStream->avail_in = segments[i].availIn;
+        zStream->next_out = segments[i].nextOut;
+        zStream->avail_out = segments[i].availOut;
+
+        result = deflate(zStream, Z_FINISH);
+        if (result != PAL_Z_STREAMEND)
+        {
+            stream->msg = zStream->msg;
+
+            // Z_OK with Z_FINISH means the output buffer filled up before the
+            // payload was fully compressed; surface that as a buffer error.
+            return result == PAL_Z_OK ? PAL_Z_BUFERROR : result;
+        }
+
+        segments[i].availOut -= zStream->avail_out;
+    }
+
+    return segmentCount;
+}
+
 uint32_t CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len)
 {
     assert(buffer != NULL);
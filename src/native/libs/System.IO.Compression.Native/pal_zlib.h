@@ -124,6 +124,63 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_InflateEnd(PAL_ZStream* stream);
 
+/*
+Resets the PAL_ZStream for compressing a new payload, keeping the allocated
+compression state so the setup cost is paid only once per stream instance.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_DeflateReset(PAL_ZStream* stream);
+
+/*
+Resets the PAL_ZStream for decompressing a new payload, keeping the allocated
+decompression state so the setup cost is paid only once per stream instance.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_InflateReset(PAL_ZStream* stream);
+
+/*
+Presets the compression dictionary for the PAL_ZStream. Must be called after
+init or reset, before any input is consumed.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_DeflateSetDictionary(
+    PAL_ZStream* stream, uint8_t* dictionary, int32_t dictionaryLength);
+
+/*
+Sets the decompression dictionary for the PAL_ZStream. Called when Inflate
+reports that the stream was compressed with a preset dictionary.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_InflateSetDictionary(
+    PAL_ZStream* stream, uint8_t* dictionary, int32_t dictionaryLength);
+
+/*
+A single input/output buffer pair for the batch compression entry point.
+availOut holds the output capacity on input and the compressed size on output.
+*/
+typedef struct PAL_ZSegment
+{
+    uint8_t* nextIn;
+    uint8_t* nextOut;
+    uint32_t availIn;
+    uint32_t availOut;
+} PAL_ZSegment;
+
+/*
+Compresses segmentCount independent payloads with a single initialized deflate
+stream, resetting it between payloads and re-applying the optional preset
+dictionary, so small payloads don't pay a native transition and stream setup each.
+
+Returns the number of segments compressed on success (all of them), or a
+PAL_ErrorCode on the first failing segment; earlier segments hold valid output.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_DeflateBatch(
+    PAL_ZStream* stream, PAL_ZSegment* segments, int32_t segmentCount, uint8_t* dictionary, int32_t dictionaryLength);
+
 /*
 Update a running CRC-32 with the bytes buffer[0..len-1] and return the
 updated CRC-32.
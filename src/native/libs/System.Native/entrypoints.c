@@ -54,6 +54,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_StrErrorR)
     DllImportEntry(SystemNative_EnumerateInterfaceAddresses)
     DllImportEntry(SystemNative_GetNetworkInterfaces)
+    DllImportEntry(SystemNative_GetNetworkInterfaceSnapshot)
     DllImportEntry(SystemNative_EnumerateGatewayAddressesForInterface)
     DllImportEntry(SystemNative_Stat)
     DllImportEntry(SystemNative_LStat)
@@ -65,6 +66,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_ShmUnlink)
     DllImportEntry(SystemNative_GetReadDirRBufferSize)
     DllImportEntry(SystemNative_ReadDirR)
+    DllImportEntry(SystemNative_ReadDirBatch)
     DllImportEntry(SystemNative_OpenDir)
     DllImportEntry(SystemNative_CloseDir)
     DllImportEntry(SystemNative_Pipe)
@@ -187,6 +189,8 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_GetDomainSocketSizes)
     DllImportEntry(SystemNative_GetMaximumAddressSize)
     DllImportEntry(SystemNative_SendFile)
+    DllImportEntry(SystemNative_PlatformSupportsSplice)
+    DllImportEntry(SystemNative_Splice)
     DllImportEntry(SystemNative_Disconnect)
     DllImportEntry(SystemNative_InterfaceNameToIndex)
     DllImportEntry(SystemNative_GetTcpGlobalStatistics)
@@ -263,6 +267,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_PRead)
     DllImportEntry(SystemNative_PWrite)
     DllImportEntry(SystemNative_PReadV)
+    DllImportEntry(SystemNative_PReadVNoWait)
     DllImportEntry(SystemNative_PWriteV)
     DllImportEntry(SystemNative_CreateThread)
     DllImportEntry(SystemNative_EnablePosixSignalHandling)
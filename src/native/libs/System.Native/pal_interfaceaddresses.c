@@ -53,6 +53,7 @@
 #else
 #include <linux/if_packet.h>
 #endif
+#include <linux/if_link.h>
 #elif defined(AF_LINK)
 #include <net/if_dl.h>
 #include <net/if_types.h>
@@ -303,7 +304,22 @@ int32_t SystemNative_EnumerateInterfaceAddresses(void* context,
 #endif
 }
 
-int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInterfaceInfo **interfaceList, int32_t * addressCount, IpAddressInfo **addressList )
+#if HAVE_GETIFADDRS || defined(ANDROID_GETIFADDRS_WORKAROUND)
+// FNV-1a over the non-volatile parts of the configuration; used to derive the
+// snapshot change stamp.
+static uint64_t FoldChangeStamp(uint64_t hash, const void* bytes, size_t count)
+{
+    const uint8_t* data = (const uint8_t*)bytes;
+    for (size_t i = 0; i < count; i++)
+    {
+        hash = (hash ^ data[i]) * 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+#endif
+
+static int32_t GetNetworkInterfacesCore(int32_t * interfaceCount, NetworkInterfaceInfo **interfaceList, int32_t * addressCount, IpAddressInfo **addressList, NativeIPInterfaceStatistics **statisticsList, uint64_t* changeStamp)
 {
 #ifdef ANDROID_GETIFADDRS_WORKAROUND
     if (!ensure_getifaddrs_is_loaded())
@@ -323,8 +339,10 @@ int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInter
     int ifcount = 0;     // Total number of unique network interface.
     int index;
     int socketfd = -1;
+    uint64_t stamp = 0xcbf29ce484222325ULL; // FNV offset basis
 
     NetworkInterfaceInfo *nii;
+    NativeIPInterfaceStatistics *stats = NULL;
 
     if (getifaddrs(&head) == -1)
     {
@@ -361,7 +379,13 @@ int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInter
 #else
     int entriesCount = count;
 #endif
-    void * memoryBlock = calloc((size_t)entriesCount, sizeof(NetworkInterfaceInfo));
+    size_t blockSize = (size_t)entriesCount * sizeof(NetworkInterfaceInfo);
+    if (statisticsList != NULL)
+    {
+        // Statistics are carved from the tail of the same block so one free() releases everything.
+        blockSize += (size_t)entriesCount * sizeof(NativeIPInterfaceStatistics);
+    }
+    void * memoryBlock = calloc(blockSize, 1);
     if (memoryBlock == NULL)
     {
         errno = ENOMEM;
@@ -373,12 +397,23 @@ int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInter
     *interfaceList = nii = (NetworkInterfaceInfo*)memoryBlock;
     // address of first IpAddressInfo after all NetworkInterfaceInfo entries.
     *addressList = ai = (IpAddressInfo*)(nii + (entriesCount - ip4count - ip6count));
+    if (statisticsList != NULL)
+    {
+        *statisticsList = stats = (NativeIPInterfaceStatistics*)((uint8_t*)memoryBlock + (size_t)entriesCount * sizeof(NetworkInterfaceInfo));
+    }
 
     while (ifaddrsEntry != NULL)
     {
         //current = NULL;
         nii = NULL;
         uint ifindex = if_nametoindex(ifaddrsEntry->ifa_name);
+
+        // Fold the stable parts of this entry into the change stamp. Counters are
+        // deliberately excluded so the stamp only moves on configuration changes.
+        stamp = FoldChangeStamp(stamp, ifaddrsEntry->ifa_name, strlen(ifaddrsEntry->ifa_name));
+        stamp = FoldChangeStamp(stamp, &ifindex, sizeof(ifindex));
+        uint32_t stableFlags = (uint32_t)ifaddrsEntry->ifa_flags & (uint32_t)(IFF_UP | IFF_RUNNING | IFF_LOOPBACK | IFF_MULTICAST | IFF_ALLMULTI);
+        stamp = FoldChangeStamp(stamp, &stableFlags, sizeof(stableFlags));
         for (index = 0; index < (int)ifcount; index ++)
         {
             if (((NetworkInterfaceInfo*)memoryBlock)[index].InterfaceIndex == ifindex)
@@ -407,6 +442,23 @@ int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInter
             // OperationalState returns whether the interface can transmit data packets.
             // The administrator must have enabled the interface (IFF_UP), and the cable must be plugged in (IFF_RUNNING).
             nii->OperationalState = ((ifaddrsEntry->ifa_flags & (IFF_UP|IFF_RUNNING)) == (IFF_UP|IFF_RUNNING)) ? OperationalStatus_Up : OperationalStatus_Down;
+
+            if (stats != NULL)
+            {
+                NativeIPInterfaceStatistics* niis = &stats[nii - (NetworkInterfaceInfo*)memoryBlock];
+                if (ifaddrsEntry->ifa_flags & IFF_UP)
+                {
+                    niis->Flags |= InterfaceUp;
+                }
+                if (ifaddrsEntry->ifa_flags & IFF_RUNNING)
+                {
+                    niis->Flags |= InterfaceHasLink;
+                }
+                if (ifaddrsEntry->ifa_flags & (IFF_MULTICAST|IFF_ALLMULTI))
+                {
+                    niis->Flags |= InterfaceSupportsMulticast;
+                }
+            }
         }
 
         if (ifaddrsEntry->ifa_addr == NULL)
@@ -421,6 +473,7 @@ int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInter
             ai->NumAddressBytes = NUM_BYTES_IN_IPV4_ADDRESS;
             memcpy(ai->AddressBytes, &((struct sockaddr_in*)ifaddrsEntry->ifa_addr)->sin_addr, NUM_BYTES_IN_IPV4_ADDRESS);
             ai->PrefixLength = mask2prefix((uint8_t*)&((struct sockaddr_in*)ifaddrsEntry->ifa_netmask)->sin_addr, NUM_BYTES_IN_IPV4_ADDRESS);
+            stamp = FoldChangeStamp(stamp, ai, sizeof(IpAddressInfo));
             ai++;
         }
         else if (ifaddrsEntry->ifa_addr->sa_family == AF_INET6)
@@ -429,6 +482,7 @@ int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInter
             ai->NumAddressBytes = NUM_BYTES_IN_IPV6_ADDRESS;
             memcpy(ai->AddressBytes, &((struct sockaddr_in6*)ifaddrsEntry->ifa_addr)->sin6_addr, NUM_BYTES_IN_IPV6_ADDRESS);
             ai->PrefixLength = mask2prefix((uint8_t*)&(((struct sockaddr_in6*)ifaddrsEntry->ifa_netmask)->sin6_addr), NUM_BYTES_IN_IPV6_ADDRESS);
+            stamp = FoldChangeStamp(stamp, ai, sizeof(IpAddressInfo));
             ai++;
         }
 #if defined(AF_LINK)
@@ -439,6 +493,26 @@ int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInter
             nii->HardwareType = MapHardwareType(sadl->sdl_type);
             nii->NumAddressBytes =  sadl->sdl_alen;
             memcpy_s(&nii->AddressBytes, sizeof_member(NetworkInterfaceInfo, AddressBytes), (uint8_t*)LLADDR(sadl), sadl->sdl_alen);
+
+            if (stats != NULL && ifaddrsEntry->ifa_data != NULL)
+            {
+                // For AF_LINK entries ifa_data points to the kernel's if_data, so the
+                // counters come for free with the walk.
+                struct if_data* ifd = (struct if_data*)ifaddrsEntry->ifa_data;
+                NativeIPInterfaceStatistics* niis = &stats[nii - (NetworkInterfaceInfo*)memoryBlock];
+                niis->Mtu = ifd->ifi_mtu;
+                niis->Speed = ifd->ifi_baudrate;
+                niis->InPackets = ifd->ifi_ipackets;
+                niis->InErrors = ifd->ifi_ierrors;
+                niis->OutPackets = ifd->ifi_opackets;
+                niis->OutErrors = ifd->ifi_oerrors;
+                niis->InBytes = ifd->ifi_ibytes;
+                niis->OutBytes = ifd->ifi_obytes;
+                niis->InMulticastPackets = ifd->ifi_imcasts;
+                niis->OutMulticastPackets = ifd->ifi_omcasts;
+                niis->InDrops = ifd->ifi_iqdrops;
+                niis->InNoProto = ifd->ifi_noproto;
+            }
         }
 #endif
 #if defined(AF_PACKET)
@@ -512,6 +586,31 @@ int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInter
                 }
 #endif
             }
+
+            if (stats != NULL)
+            {
+                NativeIPInterfaceStatistics* niis = &stats[nii - (NetworkInterfaceInfo*)memoryBlock];
+                niis->Mtu = (uint64_t)nii->Mtu;
+                if (nii->Speed > 0)
+                {
+                    niis->Speed = (uint64_t)nii->Speed;
+                }
+
+                if (ifaddrsEntry->ifa_data != NULL)
+                {
+                    // For AF_PACKET entries ifa_data points to the link statistics, so the
+                    // counters come for free with the walk.
+                    struct rtnl_link_stats* ls = (struct rtnl_link_stats*)ifaddrsEntry->ifa_data;
+                    niis->InPackets = ls->rx_packets;
+                    niis->OutPackets = ls->tx_packets;
+                    niis->InBytes = ls->rx_bytes;
+                    niis->OutBytes = ls->tx_bytes;
+                    niis->InErrors = ls->rx_errors;
+                    niis->OutErrors = ls->tx_errors;
+                    niis->InDrops = ls->rx_dropped;
+                    niis->InMulticastPackets = ls->multicast;
+                }
+            }
         }
 #endif
         ifaddrsEntry = ifaddrsEntry->ifa_next;
@@ -519,6 +618,10 @@ int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInter
 
     *interfaceCount = ifcount;
     *addressCount = ip4count + ip6count;
+    if (changeStamp != NULL)
+    {
+        *changeStamp = stamp;
+    }
 
     // Cleanup.
     freeifaddrs(head);
@@ -534,11 +637,23 @@ int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInter
     (void)interfaceList;
     (void)addressCount;
     (void)addressList;
+    (void)statisticsList;
+    (void)changeStamp;
     errno = ENOTSUP;
     return -1;
 #endif
 }
 
+int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInterfaceInfo **interfaceList, int32_t * addressCount, IpAddressInfo **addressList )
+{
+    return GetNetworkInterfacesCore(interfaceCount, interfaceList, addressCount, addressList, NULL, NULL);
+}
+
+int32_t SystemNative_GetNetworkInterfaceSnapshot(int32_t* interfaceCount, NetworkInterfaceInfo** interfaceList, int32_t* addressCount, IpAddressInfo** addressList, NativeIPInterfaceStatistics** statisticsList, uint64_t* changeStamp)
+{
+    return GetNetworkInterfacesCore(interfaceCount, interfaceList, addressCount, addressList, statisticsList, changeStamp);
+}
+
 #if HAVE_RT_MSGHDR && defined(CTL_NET)
 int32_t SystemNative_EnumerateGatewayAddressesForInterface(void* context, uint32_t interfaceIndex, GatewayAddressFound onGatewayFound)
 {
@@ -5,6 +5,7 @@
 
 #include "pal_compiler.h"
 #include "pal_maphardwaretype.h"
+#include "pal_networkstatistics.h"
 #include "pal_types.h"
 
 typedef enum
@@ -56,4 +57,10 @@ PALEXPORT  int32_t SystemNative_EnumerateInterfaceAddresses(
     void* context, IPv4AddressFound onIpv4Found, IPv6AddressFound onIpv6Found, LinkLayerAddressFound onLinkLayerFound);
 PALEXPORT int32_t SystemNative_GetNetworkInterfaces(int32_t * interfaceCount, NetworkInterfaceInfo** interfaces, int32_t * addressCount, IpAddressInfo **addressList);
 
+// Like SystemNative_GetNetworkInterfaces, but the single allocated block additionally carries
+// per-interface statistics (parallel to the interface list) gathered during the same getifaddrs
+// walk, and changeStamp receives a hash of the interface/address configuration so pollers can
+// skip re-materializing managed state when nothing but the counters changed.
+PALEXPORT int32_t SystemNative_GetNetworkInterfaceSnapshot(int32_t* interfaceCount, NetworkInterfaceInfo** interfaces, int32_t* addressCount, IpAddressInfo** addressList, NativeIPInterfaceStatistics** statisticsList, uint64_t* changeStamp);
+
 PALEXPORT int32_t SystemNative_EnumerateGatewayAddressesForInterface(void* context, uint32_t interfaceIndex, GatewayAddressFound onGatewayFound);
@@ -534,6 +534,71 @@ int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, Dir
     return 0;
 }
 
+// Batched variant of SystemNative_ReadDirR: drains as many entries as fit into the caller's
+// name buffer and entry array in a single native call. The names are copied out of libc's
+// dirent storage, so unlike ReadDirR the results stay valid across subsequent readdir calls.
+// The underlying libc already batches getdents64 reads internally; the point of this entry
+// point is amortizing the managed/native transition over many entries.
+int32_t SystemNative_ReadDirBatch(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* entries, int32_t entriesLength)
+{
+    assert(dir != NULL);
+    assert(buffer != NULL);
+    assert(bufferSize > 0);
+    assert(entries != NULL);
+    assert(entriesLength > 0);
+
+    int32_t count = 0;
+    int32_t used = 0;
+    while (count < entriesLength)
+    {
+        // Remember the stream position so an entry that doesn't fit can be re-read
+        // by the next batch instead of being dropped.
+        long position = telldir(dir);
+
+        errno = 0;
+        struct dirent* entry = readdir(dir);
+        if (entry == NULL)
+        {
+            if (errno != 0 && count == 0)
+            {
+                return -1;
+            }
+
+            // End-of-stream, or an error after some entries were already gathered;
+            // in the latter case return what we have and let the next call fail.
+            return count;
+        }
+
+        size_t nameLength = strlen(entry->d_name);
+        if (used + (int64_t)nameLength + 1 > bufferSize)
+        {
+            seekdir(dir, position);
+            if (count == 0)
+            {
+                // Not even one name fits; sized like GetReadDirRBufferSize this can't happen.
+                errno = ERANGE;
+                return -1;
+            }
+
+            return count;
+        }
+
+        memcpy(buffer + used, entry->d_name, nameLength + 1);
+        entries[count].Name = (const char*)(buffer + used);
+        entries[count].NameLength = (int32_t)nameLength;
+#if !defined(DT_UNKNOWN) || defined(TARGET_WASM)
+        // See ConvertDirent: no (trustworthy) d_type on these platforms.
+        entries[count].InodeType = PAL_DT_UNKNOWN;
+#else
+        entries[count].InodeType = (int32_t)entry->d_type;
+#endif
+        used += (int32_t)(nameLength + 1);
+        count++;
+    }
+
+    return count;
+}
+
 DIR* SystemNative_OpenDir(const char* path)
 {
     DIR *result;
@@ -1893,6 +1958,26 @@ int64_t SystemNative_PReadV(intptr_t fd, IOVector* vectors, int32_t vectorCount,
     return count;
 }
 
+int64_t SystemNative_PReadVNoWait(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset)
+{
+    assert(vectors != NULL);
+    assert(vectorCount >= 0);
+
+#if defined(__linux__) && defined(RWF_NOWAIT)
+    int64_t count;
+    while ((count = preadv2(ToFileDescriptor(fd), (struct iovec*)vectors, (int)vectorCount, (off_t)fileOffset, RWF_NOWAIT)) < 0 && errno == EINTR);
+
+    // Kernels or file systems without RWF_NOWAIT support fail with EOPNOTSUPP;
+    // we surface that unchanged so the caller can fall back to a blocking read.
+    assert(count >= -1);
+    return count;
+#else
+    (void)fd, (void)vectors, (void)vectorCount, (void)fileOffset;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
 int64_t SystemNative_PWriteV(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset)
 {
     assert(vectors != NULL);
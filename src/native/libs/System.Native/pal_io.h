@@ -394,6 +394,15 @@ PALEXPORT int32_t SystemNative_GetReadDirRBufferSize(void);
  */
 PALEXPORT int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* outputEntry);
 
+/**
+ * Retrieves up to entriesLength dirents from the directory stream in a single call, copying
+ * the names into the provided byte buffer. Entry names remain valid until the buffer is reused.
+ *
+ * Returns the number of entries retrieved; returns 0 when end-of-stream is reached; returns -1
+ * and sets errno on failure. An entry that does not fit is deferred to the next call.
+ */
+PALEXPORT int32_t SystemNative_ReadDirBatch(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* entries, int32_t entriesLength);
+
 /**
  * Returns a DIR struct containing info about the current path or NULL on failure; sets errno on fail.
  */
@@ -815,6 +824,16 @@ PALEXPORT int32_t SystemNative_PWrite(intptr_t fd, void* buffer, int32_t bufferS
  */
 PALEXPORT int64_t SystemNative_PReadV(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset);
 
+/**
+ * Reads into the provided buffers from the specified, opened file descriptor at specified offset,
+ * without blocking: only data already resident in the page cache is returned.
+ *
+ * Returns the number of bytes read on success; otherwise, -1 is returned and errno is set.
+ * EAGAIN indicates the data would require I/O and ENOTSUP/EOPNOTSUPP indicates the platform,
+ * kernel, or file system does not support non-blocking reads; both call for a blocking fallback.
+ */
+PALEXPORT int64_t SystemNative_PReadVNoWait(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset);
+
 /**
  * Writes the number of bytes specified in the buffers into the specified, opened file descriptor at specified offset.
  *
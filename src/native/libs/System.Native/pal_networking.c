@@ -3263,6 +3263,44 @@ error:
 #endif
 }
 
+int32_t SystemNative_PlatformSupportsSplice(void)
+{
+#if defined(__linux__)
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+int32_t SystemNative_Splice(intptr_t in_fd, intptr_t out_fd, int64_t count, int64_t* moved)
+{
+    assert(moved != NULL);
+
+#if defined(__linux__)
+    int infd = ToFileDescriptor(in_fd);
+    int outfd = ToFileDescriptor(out_fd);
+
+    // One end must be a pipe; socket-to-socket forwarding goes through a
+    // caller-managed pipe pair (socket -> pipe, pipe -> socket).
+    ssize_t res;
+    while ((res = splice(infd, NULL, outfd, NULL, (size_t)count, SPLICE_F_MOVE)) < 0 && errno == EINTR);
+    if (res != -1)
+    {
+        *moved = res;
+        return Error_SUCCESS;
+    }
+
+    *moved = 0;
+    return SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)in_fd;
+    (void)out_fd;
+    (void)count;
+    *moved = 0;
+    return Error_ENOTSUP;
+#endif
+}
+
 uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName)
 {
     assert(interfaceName != NULL);
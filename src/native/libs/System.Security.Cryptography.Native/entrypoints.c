@@ -135,6 +135,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpDesCbc)
     DllImportEntry(CryptoNative_EvpDesCfb8)
     DllImportEntry(CryptoNative_EvpDesEcb)
+    DllImportEntry(CryptoNative_EvpDigestBatch)
     DllImportEntry(CryptoNative_EvpDigestCurrent)
     DllImportEntry(CryptoNative_EvpDigestFinalEx)
     DllImportEntry(CryptoNative_EvpDigestOneShot)
@@ -200,6 +201,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_GetX509SubjectPublicKeyInfoDerSize)
     DllImportEntry(CryptoNative_GetX509Thumbprint)
     DllImportEntry(CryptoNative_GetX509Version)
+    DllImportEntry(CryptoNative_HmacBatch)
     DllImportEntry(CryptoNative_HmacCreate)
     DllImportEntry(CryptoNative_HmacCurrent)
     DllImportEntry(CryptoNative_HmacDestroy)
@@ -288,8 +290,10 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_IsSslRenegotiatePending)
     DllImportEntry(CryptoNative_IsSslStateOK)
     DllImportEntry(CryptoNative_SslCtxAddExtraChainCert)
+    DllImportEntry(CryptoNative_SslCtxGetCacheStats)
     DllImportEntry(CryptoNative_SslCtxSetCaching)
     DllImportEntry(CryptoNative_SslCtxSetCiphers)
+    DllImportEntry(CryptoNative_SslCtxSetTicketKeys)
     DllImportEntry(CryptoNative_SslCtxSetDefaultOcspCallback)
     DllImportEntry(CryptoNative_SslCtxSetEncryptionPolicy)
     DllImportEntry(CryptoNative_SetCiphers)
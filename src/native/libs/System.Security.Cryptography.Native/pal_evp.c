@@ -139,6 +139,57 @@ int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, in
     return ret;
 }
 
+int32_t CryptoNative_EvpDigestBatch(const EVP_MD* type,
+                                    const void* const* sources,
+                                    const int32_t* sourceSizes,
+                                    int32_t count,
+                                    uint8_t* md,
+                                    uint32_t* mdSize)
+{
+    ERR_clear_error();
+
+    if (type == NULL || sources == NULL || sourceSizes == NULL || count < 0 || md == NULL || mdSize == NULL)
+    {
+        return 0;
+    }
+
+    int32_t digestSize = EVP_MD_get_size(type);
+
+    if (digestSize <= 0)
+    {
+        return 0;
+    }
+
+    EVP_MD_CTX* ctx = CryptoNative_EvpMdCtxCreate(type);
+
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        unsigned int size;
+
+        // Passing a NULL type reuses the already configured digest without
+        // re-fetching it, making the reset between payloads cheap.
+        if (sourceSizes[i] < 0 ||
+            (i > 0 && !EVP_DigestInit_ex(ctx, NULL, NULL)) ||
+            !EVP_DigestUpdate(ctx, sources[i], (size_t)sourceSizes[i]) ||
+            !EVP_DigestFinal_ex(ctx, md + (size_t)i * (size_t)digestSize, &size) ||
+            size != (unsigned int)digestSize)
+        {
+            CryptoNative_EvpMdCtxDestroy(ctx);
+            return 0;
+        }
+    }
+
+    *mdSize = (uint32_t)digestSize;
+
+    CryptoNative_EvpMdCtxDestroy(ctx);
+    return SUCCESS;
+}
+
 int32_t CryptoNative_EvpMdSize(const EVP_MD* md)
 {
     // No error queue impact.
@@ -65,6 +65,21 @@ Combines EVP_MD_CTX_create, EVP_DigestUpdate, and EVP_DigestFinal_ex in to a sin
 */
 PALEXPORT int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, int32_t sourceSize, uint8_t* md, uint32_t* mdSize);
 
+/*
+Function:
+EvpDigestBatch
+
+Computes independent digests of count (source, size) pairs with a single context,
+writing them back to back into md, which must hold count * EVP_MD_get_size(type)
+bytes. mdSize receives the size of each digest. Returns 1 on success, 0 on failure.
+*/
+PALEXPORT int32_t CryptoNative_EvpDigestBatch(const EVP_MD* type,
+                                              const void* const* sources,
+                                              const int32_t* sourceSizes,
+                                              int32_t count,
+                                              uint8_t* md,
+                                              uint32_t* mdSize);
+
 /*
 Function:
 EvpMdSize
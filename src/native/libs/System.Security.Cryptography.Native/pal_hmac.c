@@ -184,3 +184,57 @@ int32_t CryptoNative_HmacOneShot(const EVP_MD* type,
 
     return result == NULL ? 0 : 1;
 }
+
+int32_t CryptoNative_HmacBatch(const EVP_MD* type,
+                               const uint8_t* key,
+                               int32_t keySize,
+                               const uint8_t* const* sources,
+                               const int32_t* sourceSizes,
+                               int32_t count,
+                               uint8_t* md,
+                               int32_t* mdSize)
+{
+    assert(type != NULL && md != NULL && mdSize != NULL);
+    assert(sources != NULL || count == 0);
+    assert(sourceSizes != NULL || count == 0);
+    assert(keySize >= 0 && count >= 0);
+    assert(key != NULL || keySize == 0);
+
+    ERR_clear_error();
+
+    int32_t digestSize = EVP_MD_get_size(type);
+
+    if (digestSize <= 0)
+    {
+        return 0;
+    }
+
+    // The keyed inner/outer pads are computed once here; the per-payload reset
+    // below reuses them instead of rehashing the key.
+    HMAC_CTX* ctx = CryptoNative_HmacCreate(key, keySize, type);
+
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        unsigned int size;
+
+        if (sourceSizes[i] < 0 ||
+            (i > 0 && !HMAC_Init_ex(ctx, NULL, 0, NULL, NULL)) ||
+            !HMAC_Update(ctx, sources[i], Int32ToSizeT(sourceSizes[i])) ||
+            !HMAC_Final(ctx, md + (size_t)i * (size_t)digestSize, &size) ||
+            size != (unsigned int)digestSize)
+        {
+            HMAC_CTX_free(ctx);
+            return 0;
+        }
+    }
+
+    *mdSize = digestSize;
+
+    HMAC_CTX_free(ctx);
+    return 1;
+}
@@ -81,3 +81,19 @@ PALEXPORT int32_t CryptoNative_HmacOneShot(const EVP_MD* type,
                                            int32_t sourceSize,
                                            uint8_t* md,
                                            int32_t* mdSize);
+
+/**
+ * Computes independent HMACs of count (source, size) pairs under one key with a single
+ * context, rehashing the key only once. The results are written back to back into md,
+ * which must hold count * EVP_MD_get_size(type) bytes; mdSize receives the size of each.
+ *
+ * Returns 1 for success or 0 for failure.
+ */
+PALEXPORT int32_t CryptoNative_HmacBatch(const EVP_MD* type,
+                                         const uint8_t* key,
+                                         int32_t keySize,
+                                         const uint8_t* const* sources,
+                                         const int32_t* sourceSizes,
+                                         int32_t count,
+                                         uint8_t* md,
+                                         int32_t* mdSize);
@@ -701,6 +701,36 @@ int CryptoNative_SslCtxSetCaching(SSL_CTX* ctx, int mode, int cacheSize, int con
     return retValue;
 }
 
+int32_t CryptoNative_SslCtxSetTicketKeys(SSL_CTX* ctx, uint8_t* keys, int32_t keyLength)
+{
+    // void shim functions don't lead to exceptions, so skip the unconditional error clearing.
+    return SSL_CTX_ctrl(ctx, SSL_CTRL_SET_TLSEXT_TICKET_KEYS, (long)keyLength, keys) == 1;
+}
+
+void CryptoNative_SslCtxGetCacheStats(SSL_CTX* ctx, int64_t* sessions, int64_t* hits, int64_t* misses, int64_t* timeouts)
+{
+    // void shim functions don't lead to exceptions, so skip the unconditional error clearing.
+    if (sessions != NULL)
+    {
+        *sessions = (int64_t)SSL_CTX_ctrl(ctx, SSL_CTRL_SESS_NUMBER, 0, NULL);
+    }
+
+    if (hits != NULL)
+    {
+        *hits = (int64_t)SSL_CTX_ctrl(ctx, SSL_CTRL_SESS_HIT, 0, NULL);
+    }
+
+    if (misses != NULL)
+    {
+        *misses = (int64_t)SSL_CTX_ctrl(ctx, SSL_CTRL_SESS_MISSES, 0, NULL);
+    }
+
+    if (timeouts != NULL)
+    {
+        *timeouts = (int64_t)SSL_CTX_ctrl(ctx, SSL_CTRL_SESS_TIMEOUTS, 0, NULL);
+    }
+}
+
 const char* CryptoNative_SslGetServerName(SSL* ssl)
 {
     return SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
@@ -164,6 +164,23 @@ Sets session caching. 0 is disabled.
 */
 PALEXPORT int CryptoNative_SslCtxSetCaching(SSL_CTX* ctx, int mode, int cacheSize, int contextIdLength, uint8_t* contextId, SslCtxNewSessionCallback newSessionCb, SslCtxRemoveSessionCallback removeSessionCb);
 
+/*
+Sets the keys used to protect session tickets issued from this context.
+
+keyLength must match the size OpenSSL expects for its ticket key blob
+(SSL_CTX_set_tlsext_ticket_keys). Calling this again rotates the keys;
+tickets protected with the previous keys can no longer be decrypted.
+
+Returns 1 on success, 0 on failure (e.g. wrong key length).
+*/
+PALEXPORT int32_t CryptoNative_SslCtxSetTicketKeys(SSL_CTX* ctx, uint8_t* keys, int32_t keyLength);
+
+/*
+Reads the session cache counters of the context. Any of the out
+parameters may be NULL if that counter is not wanted.
+*/
+PALEXPORT void CryptoNative_SslCtxGetCacheStats(SSL_CTX* ctx, int64_t* sessions, int64_t* hits, int64_t* misses, int64_t* timeouts);
+
 /*
 Returns name associated with given ssl session.
 OpenSSL holds reference to it and it must not be freed.